@@ -996,6 +996,14 @@ a2b_pluginExecute
             }
             break;
 
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+        case A2B_MSGREQ_NET_PARTIAL_DISCOVERY:
+            /* Resumes with the BDD of the last discovery */
+            netDisc = (a2b_NetDiscovery*)a2b_msgGetPayload(msg);
+            ret = a2b_dscvryStartPartial( plugin, netDisc );
+            break;
+#endif /* A2B_FEATURE_PARTIAL_DISCOVERY */
+
         case A2B_MSGREQ_NET_DISCOVERY_DIAGMODE:
             /* TODO maybe? */
             break;
@@ -64,6 +64,15 @@
 /** Delay (in msec) for a node discovery */
 #define A2B_DISCOVERY_DELAY     (50u)
 
+/** Interval (in msec) at which DSCDONE is polled while a node is being
+ *  discovered. Discovery advances as soon as the node responds and
+ *  A2B_DISCOVERY_DELAY only bounds the wait. Zero falls back to a
+ *  single check after A2B_DISCOVERY_DELAY.
+ */
+#ifndef A2B_DISCOVERY_POLL_INTERVAL
+#define A2B_DISCOVERY_POLL_INTERVAL (1u)
+#endif
+
 /** Delay (in msec) to wait after a software reset */
 #define A2B_SW_RESET_DELAY      (25u)
 
@@ -83,6 +92,15 @@
 #undef FIND_NODE_HANDLER_AFTER_NODE_INIT
 #endif
 
+/** Defined when Simple discovery sends the slave plugin inits without
+ * waiting for each other (see #A2B_FEATURE_PARALLEL_PLUGIN_INIT).
+ */
+#if defined(A2B_FEATURE_PARALLEL_PLUGIN_INIT) && \
+    defined(A2B_FEATURE_WAIT_ON_PERIPHERAL_CFG_DELAY) && \
+    !defined(A2B_FEATURE_EEPROM_PROCESSING)
+#define A2B_DSCVRY_PARALLEL_PLUGIN_INIT
+#endif
+
 #ifdef A2B_QAC
 #pragma PRQA_NO_SIDE_EFFECTS a2b_isAd242xChip
 #endif
@@ -613,6 +631,10 @@ a2b_dscvryInitPluginComplete_EepromComplete
             (( plugin->discovery.hasEeprom ) &&
              ( a2b_periphCfgUsingSync() ) &&
              ( plugin->discovery.pendingPluginInit == 0u ) ) )
+#endif
+#ifdef A2B_DSCVRY_PARALLEL_PLUGIN_INIT
+        /* Another plugin init may already have ended discovery */
+        if ( !plugin->discovery.discoveryComplete )
 #endif
         {
             a2b_dscvryNetComplete( plugin );
@@ -1059,7 +1081,8 @@ a2b_dscvryEnd
 *
 *  \b              a2b_onDiscTimeout
 *
-*  Handle the discovery timeout.
+*  Poll for DSCDONE of the node being discovered and handle the discovery
+*  timeout once A2B_DISCOVERY_DELAY has elapsed without a response.
 *
 *  \param          [in]    timer
 *  \param          [in]    userData
@@ -1085,8 +1108,8 @@ a2b_onDiscTimeout
 
     A2B_UNUSED(timer);
 
-    /* Check the interrupt status one more time in 
-     * case of a timing race condition.
+    /* Check the interrupt status, DSCDONE is handled from there.
+     * On the final expiry this also covers a timing race condition.
      */
     ret = a2b_intrQueryIrq( plugin->ctx );
 
@@ -1096,6 +1119,17 @@ a2b_onDiscTimeout
         return;
     }
 
+#if (A2B_DISCOVERY_POLL_INTERVAL > 0u)
+    /* Keep polling until the node responds or the upper bound expires */
+    if ( (a2b_timerGetSysTime( plugin->ctx ) -
+          plugin->discovery.dscStartTime) < A2B_DISCOVERY_DELAY )
+    {
+        return;
+    }
+
+    a2b_timerStop( plugin->timer );
+#endif
+
     A2B_DSCVRY_ERROR0( plugin->ctx, "onDiscTimeout", "DISCOVERY TIMEOUT" );
 
     bNetConfigFlag = a2b_SimpleModeChkNodeConfig(plugin);
@@ -1218,8 +1252,9 @@ a2b_dscvryStartTimer
     a2b_dscvryTimer type
     )
 {
-    /* Default is for the discovery timer */
+    /* Default is for the discovery timer, polling for DSCDONE */
     a2b_UInt32 delay = A2B_DISCOVERY_DELAY;
+    a2b_UInt32 repeat = 0u;
     a2b_TimerFunc timerFunc = &a2b_onDiscTimeout; 
 
     if ( TIMER_RESET == type )
@@ -1228,12 +1263,25 @@ a2b_dscvryStartTimer
 		delay = (plugin->bdd->policy.discoveryStartDelay > 0u ? plugin->bdd->policy.discoveryStartDelay : A2B_SW_RESET_DELAY);
         timerFunc = &a2b_onResetTimeout;
     }
+#if (A2B_DISCOVERY_POLL_INTERVAL > 0u)
+    else
+    {
+        delay = A2B_DISCOVERY_POLL_INTERVAL;
+        repeat = A2B_DISCOVERY_POLL_INTERVAL;
+    }
+#endif
 
     /* Stop the previously running timer */
     a2b_timerStop( plugin->timer );
 
-    /* Single shot timer */
-    a2b_timerSet( plugin->timer, delay, 0u );
+    if ( TIMER_DSCVRY == type )
+    {
+        /* Reference for the node's time-to-discover */
+        plugin->discovery.dscStartTime = a2b_timerGetSysTime( plugin->ctx );
+    }
+
+    /* Single shot timer, or repeating while polling for DSCDONE */
+    a2b_timerSet( plugin->timer, delay, repeat );
     a2b_timerSetHandler(plugin->timer, timerFunc);
     a2b_timerSetData(plugin->timer, plugin);
     a2b_timerStart( plugin->timer );
@@ -2693,7 +2741,7 @@ a2b_dscvryNetComplete
 
         /* Start from the latest to the first (per spec) */
         for ( nodeAddr = ((a2b_Int16)plugin->discovery.simpleNodeCount-(a2b_Int16)1);
-              nodeAddr > A2B_NODEADDR_MASTER; 
+              nodeAddr >= (a2b_Int16)plugin->discovery.dscFirstNode;
               nodeAddr-- )
         {
 #if defined(A2B_FEATURE_SEQ_CHART) || defined(A2B_FEATURE_TRACE)
@@ -2741,6 +2789,15 @@ a2b_dscvryNetComplete
                     {
                         a2b_dscvryEnd( plugin, errCode );
                     }
+#ifdef A2B_DSCVRY_PARALLEL_PLUGIN_INIT
+                    else
+                    {
+                        /* Send the next plugin init right away, the
+                         * master is finished once all have completed
+                         */
+                        bContLoop = A2B_TRUE;
+                    }
+#endif
                     /* else, waiting for plugin message to process */
                 }
                 else
@@ -2763,9 +2820,18 @@ a2b_dscvryNetComplete
             }
         }
 
+#ifdef A2B_DSCVRY_PARALLEL_PLUGIN_INIT
+        if ( plugin->discovery.pendingPluginInit )
+        {
+            /* Called again as each plugin init completes */
+            A2B_DSCVRY_SEQEND_COND( plugin->ctx, bSeqGroupShown );
+            return;
+        }
+#endif
+
 #ifndef A2B_FEATURE_WAIT_ON_PERIPHERAL_CFG_DELAY
         for ( nodeAddr = plugin->discovery.dscNumNodes-1;
-              nodeAddr > A2B_NODEADDR_MASTER; 
+              nodeAddr >= (a2b_Int16)plugin->discovery.dscFirstNode;
               nodeAddr-- )
         {
             retCode = A2B_EXEC_COMPLETE;
@@ -2897,8 +2963,14 @@ a2b_dscvryNetComplete
         A2B_DSCVRY_SEQGROUP0_COND( plugin->ctx, bSeqGroupShown,
                                    "NetComplete" );
 
-        a2b_dscvryInitTdmSettings( plugin, A2B_NODEADDR_MASTER );
-        status = a2b_audioConfig( plugin->ctx, &plugin->pluginTdmSettings );
+        /* A partial discovery keeps the audio of the nodes above it
+         * running, so the TDM settings of the last discovery stand.
+         */
+        if ( 0u == plugin->discovery.dscFirstNode )
+        {
+            a2b_dscvryInitTdmSettings( plugin, A2B_NODEADDR_MASTER );
+            status = a2b_audioConfig( plugin->ctx, &plugin->pluginTdmSettings );
+        }
 
         if ( A2B_FAILED(status) )
         {
@@ -3627,6 +3699,18 @@ a2b_dscvryNodeDiscovered
     /* Stop the previously running timer */
     a2b_timerStop( plugin->timer );
 
+    if ( (dscNodeAddr >= 0) && (dscNodeAddr < (a2b_Int16)A2B_CONF_MAX_NUM_SLAVE_NODES) )
+    {
+        a2b_UInt32 nElapsed = a2b_timerGetSysTime( ctx ) -
+                              plugin->discovery.dscStartTime;
+
+        plugin->discovery.dscTime[dscNodeAddr] =
+                        (a2b_UInt16)A2B_MIN(nElapsed, (a2b_UInt32)0xFFFFu);
+        A2B_TRACE3( (ctx, (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_DEBUG),
+                    "%s NodeDiscovered(): nodeAddr %hd took %ld msec",
+                    A2B_MPLUGIN_PLUGIN_NAME, &dscNodeAddr, &nElapsed ));
+    }
+
     /* Enable phantom power with external switch mode
      *
      * NOTE: v3 ADI documentation shows the Simple Discovery flow  
@@ -4655,11 +4739,13 @@ adi_a2b_ConfigNodeOptimizAdvancedMode(a2b_Plugin* plugin, a2b_Int16 dscNodeAddr)
 	return bRet;
 }
 
+#ifdef A2B_FEATURE_EEPROM_PROCESSING
 /*!****************************************************************************
 *
-*  \b              a2b_dscvryReset
+*  \b              a2b_dscvryPeriphMailboxAlloc
 *
-*  Reset discovery (variables, A2B, etc)
+*  Create the per node mailboxes used for the EEPROM peripheral
+*  config processing, unless they already exist.
 * 
 *  \param          [in]    plugin   plugin specific data
 *
@@ -4667,40 +4753,19 @@ adi_a2b_ConfigNodeOptimizAdvancedMode(a2b_Plugin* plugin, a2b_Int16 dscNodeAddr)
 *
 *  \post           None
 *
-*  \return         A2B_EXEC_COMPLETE == Execution is now complete
-*                  A2B_EXEC_SCHEDULE == Execution is unfinished - schedule again
-*                  A2B_EXEC_SUSPEND  == Execution is unfinished - suspend 
-*                                       scheduling until a later event
+*  \return         None
 *
 ******************************************************************************/
-static a2b_Int32
-a2b_dscvryReset
+static void
+a2b_dscvryPeriphMailboxAlloc
     (
     a2b_Plugin* plugin
     )
 {
-    a2b_UInt8 wBuf[4];
-    a2b_UInt8 rBuf[4];
-    a2b_HResult status;
-#if defined(A2B_FEATURE_TRACE) && defined(A2B_FEATURE_EEPROM_PROCESSING)
+#ifdef A2B_FEATURE_TRACE
     a2b_UInt8 nTempVar;
 #endif
-#if defined(A2B_FEATURE_SEQ_CHART) || defined(A2B_FEATURE_TRACE)
-    a2b_Int32   mode = a2b_ovrGetDiscMode(plugin);
-#endif
-
-#ifdef A2B_FEATURE_EEPROM_PROCESSING
-    (void)a2b_periphCfgPreparse( plugin );
-#endif /* A2B_FEATURE_EEPROM_PROCESSING */
 
-    /* Unload any instantiated slave plugins */
-    (void)a2b_stackFreeSlaveNodeHandler( plugin->ctx, A2B_NODEADDR_NOTUSED );
-
-    /* Some discovery tracking variables need resetting */
-    (void)a2b_memset( &plugin->discovery, 0, sizeof(a2b_PluginDiscovery) );
-    plugin->discovery.inDiscovery = A2B_TRUE;
-
-#ifdef A2B_FEATURE_EEPROM_PROCESSING
 #ifndef A2B_FEATURE_COMM_CH
     if ( a2b_stackCtxMailboxCount(plugin->ctx) !=
          A2B_ARRAY_SIZE(plugin->periph.node)+1u )
@@ -4733,11 +4798,59 @@ a2b_dscvryReset
             {
                 A2B_TRACE1( (plugin->ctx, 
                          (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_ERROR),
-                         "dscvryReset: failed to create peripheral mailbox %bd",
+                         "dscvryPeriphMailboxAlloc: failed to create peripheral mailbox %bd",
                          &nTempVar));
             }
         }
     }
+} /* a2b_dscvryPeriphMailboxAlloc */
+#endif /* A2B_FEATURE_EEPROM_PROCESSING */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_dscvryReset
+*
+*  Reset discovery (variables, A2B, etc)
+* 
+*  \param          [in]    plugin   plugin specific data
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         A2B_EXEC_COMPLETE == Execution is now complete
+*                  A2B_EXEC_SCHEDULE == Execution is unfinished - schedule again
+*                  A2B_EXEC_SUSPEND  == Execution is unfinished - suspend 
+*                                       scheduling until a later event
+*
+******************************************************************************/
+static a2b_Int32
+a2b_dscvryReset
+    (
+    a2b_Plugin* plugin
+    )
+{
+    a2b_UInt8 wBuf[4];
+    a2b_UInt8 rBuf[4];
+    a2b_HResult status;
+#if defined(A2B_FEATURE_SEQ_CHART) || defined(A2B_FEATURE_TRACE)
+    a2b_Int32   mode = a2b_ovrGetDiscMode(plugin);
+#endif
+
+#ifdef A2B_FEATURE_EEPROM_PROCESSING
+    (void)a2b_periphCfgPreparse( plugin );
+#endif /* A2B_FEATURE_EEPROM_PROCESSING */
+
+    /* Unload any instantiated slave plugins */
+    (void)a2b_stackFreeSlaveNodeHandler( plugin->ctx, A2B_NODEADDR_NOTUSED );
+
+    /* Some discovery tracking variables need resetting */
+    (void)a2b_memset( &plugin->discovery, 0, sizeof(a2b_PluginDiscovery) );
+    plugin->discovery.inDiscovery = A2B_TRUE;
+
+#ifdef A2B_FEATURE_EEPROM_PROCESSING
+    a2b_dscvryPeriphMailboxAlloc( plugin );
 #endif /* A2B_FEATURE_EEPROM_PROCESSING */
 
 #if defined(A2B_FEATURE_SEQ_CHART)
@@ -4883,6 +4996,122 @@ a2b_dscvryStart
 
 } /* a2b_dscvryStart */
 
+
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+/*!****************************************************************************
+*
+*  \b              a2b_dscvryStartPartial
+*
+*  Start a partial discovery after a cable fault below a slave node.
+*  The nodes above the fault, their plugins and their audio are kept,
+*  the nodes below it are discovered and configured again with the BDD
+*  of the last discovery.  The master is not reset.
+* 
+*  \param          [in]    plugin           plugin specific data
+*
+*  \pre            A cable fault was reported on a slave node since
+*                  the last discovery (see a2b_pwrDiagNotifyComplete).
+*
+*  \post           On success discovery resumes from the slave node
+*                  which reported the fault.
+*
+*  \return         A2B_EXEC_COMPLETE == Execution is now complete
+*                  A2B_EXEC_SCHEDULE == Execution is unfinished - schedule again
+*                  A2B_EXEC_SUSPEND  == Execution is unfinished - suspend 
+*                                       scheduling until a later event
+*
+******************************************************************************/
+a2b_Int32
+a2b_dscvryStartPartial
+    (
+    a2b_Plugin*         plugin,
+    a2b_NetDiscovery*   netDisc
+    )
+{
+    a2b_UInt8 nResumeNodes = plugin->discovery.dscResumeNodes;
+    a2b_UInt32 nKeepMask;
+    a2b_UInt32 errCode = (a2b_UInt32)A2B_EC_OK;
+    a2b_Int16 nodeAddr;
+    bdd_DiscoveryMode eDiscMode = a2b_ovrGetDiscMode(plugin);
+
+    /* Advanced and Optimized discovery rework the master slots for
+     * every node found, which the upstream audio cannot survive.
+     */
+    if ( (bdd_DISCOVERY_MODE_SIMPLE  != eDiscMode) &&
+         (bdd_DISCOVERY_MODE_MODIFIED != eDiscMode) )
+    {
+        A2B_TRACE1( (plugin->ctx, (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_ERROR),
+                    "%s dscvryStartPartial(): unsupported discovery mode", 
+                     A2B_MPLUGIN_PLUGIN_NAME ));
+        errCode = (a2b_UInt32)A2B_EC_INVALID_PARAMETER;
+    }
+    else if ( (plugin->discovery.inDiscovery) || (A2B_NULL == plugin->bdd) ||
+              (0u == nResumeNodes) ||
+              (nResumeNodes > plugin->discovery.dscNumNodes) )
+    {
+        A2B_TRACE1( (plugin->ctx, (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_ERROR),
+                    "%s dscvryStartPartial(): no nodes to resume from", 
+                     A2B_MPLUGIN_PLUGIN_NAME ));
+        errCode = (a2b_UInt32)A2B_EC_INVALID_STATE;
+    }
+    else
+    {
+        /* Completing the control statement */
+    }
+
+    if ( (a2b_UInt32)A2B_EC_OK != errCode )
+    {
+        /* Nothing was touched, so unlike a2b_dscvryEnd() the running
+         * nodes and their plugins are left alone.
+         */
+        netDisc->resp.status = A2B_MAKE_HRESULT(A2B_SEV_FAILURE,
+                                                A2B_FAC_PLUGIN, errCode);
+        netDisc->resp.numNodes = plugin->discovery.dscNumNodes;
+        return A2B_EXEC_COMPLETE;
+    }
+
+    A2B_DSCVRY_SEQGROUP0( plugin->ctx, "Partial Discovery" );
+
+    /* Unload the slave plugins below the fault, they are rediscovered */
+    for ( nodeAddr = (a2b_Int16)nResumeNodes;
+          nodeAddr < (a2b_Int16)plugin->discovery.dscNumNodes;
+          nodeAddr++ )
+    {
+        (void)a2b_stackFreeSlaveNodeHandler( plugin->ctx, nodeAddr );
+        plugin->discovery.dscTime[nodeAddr] = 0u;
+    }
+
+    /* Forget the nodes below the fault, keep the tracking above it */
+    nKeepMask = ((a2b_UInt32)1u << (a2b_UInt32)nResumeNodes) - 1u;
+    plugin->discovery.hasEeprom             &= nKeepMask;
+    plugin->discovery.hasPlugin             &= nKeepMask;
+    plugin->discovery.needsPluginInit       &= nKeepMask;
+    plugin->discovery.hasSearchedForHandler &= nKeepMask;
+
+    plugin->discovery.inDiscovery           = A2B_TRUE;
+    plugin->discovery.discoveryComplete     = A2B_FALSE;
+    plugin->discovery.discoveryCompleteCode = (a2b_UInt32)A2B_EC_OK;
+    plugin->discovery.pendingPluginInit     = 0u;
+    plugin->discovery.pendingPluginDeinit   = 0u;
+    plugin->discovery.dscNumNodes           = nResumeNodes;
+    plugin->discovery.simpleNodeCount       = nResumeNodes;
+    plugin->discovery.dscFirstNode          = nResumeNodes;
+    plugin->discovery.dscResumeNodes        = 0u;
+
+#ifdef A2B_FEATURE_EEPROM_PROCESSING
+    a2b_dscvryPeriphMailboxAlloc( plugin );
+#endif /* A2B_FEATURE_EEPROM_PROCESSING */
+
+    A2B_DSCVRY_SEQEND( plugin->ctx );
+
+    /* Powers the cable below the last kept node and finds the next one */
+    (void)a2b_dscvryPreSlaveInit( plugin );
+
+    return A2B_EXEC_SUSPEND;
+
+} /* a2b_dscvryStartPartial */
+#endif /* A2B_FEATURE_PARTIAL_DISCOVERY */
+
 /*!****************************************************************************
 *
 *  \b              a2b_SimpleModeChkNodeConfig
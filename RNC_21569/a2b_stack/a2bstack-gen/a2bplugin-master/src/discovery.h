@@ -61,6 +61,11 @@ struct a2b_StackContext;
 A2B_EXPORT a2b_Int32 a2b_dscvryStart(a2b_Plugin* plugin,
                                      a2b_Bool    deinitFirst);
 
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+A2B_EXPORT a2b_Int32 a2b_dscvryStartPartial(a2b_Plugin* plugin,
+                                            a2b_NetDiscovery* netDisc);
+#endif /* A2B_FEATURE_PARTIAL_DISCOVERY */
+
 A2B_EXPORT a2b_Bool a2b_dscvryNodeDiscovered(a2b_Plugin* plugin);
 
 A2B_EXPORT void a2b_dscvryEnd(a2b_Plugin* plugin, a2b_UInt32 errCode);
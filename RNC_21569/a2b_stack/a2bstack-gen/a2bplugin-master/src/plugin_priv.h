@@ -194,7 +194,29 @@ typedef struct a2b_PluginDiscovery
      * and will not decrement (unlike simpleNoodeCount).
      */
     a2b_UInt8                   dscNumNodes;
-                          
+
+    /** System time (msec) at which discovery of the current node
+     *  was started.
+     */
+    a2b_UInt32                  dscStartTime;
+
+    /** Time-to-discover (msec) of each slave node, from the DISCVRY
+     *  write to DSCDONE.
+     */
+    a2b_UInt16                  dscTime[A2B_CONF_MAX_NUM_SLAVE_NODES];
+
+    /** Number of slave nodes left running by the last cable fault,
+     *  i.e. the nodes a partial discovery may keep.  Zero when
+     *  a partial discovery is not possible.
+     */
+    a2b_UInt8                   dscResumeNodes;
+
+    /** First slave node configured by this discovery.  Non-zero
+     *  only for a partial discovery, where the nodes above it
+     *  are left as they are.
+     */
+    a2b_UInt8                   dscFirstNode;
+
 } a2b_PluginDiscovery;
 
 typedef struct a2b_SlaveInitCtx
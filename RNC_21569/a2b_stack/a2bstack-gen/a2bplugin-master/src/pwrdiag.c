@@ -53,6 +53,10 @@ static void a2b_pwrDiagFreeSlavePlugins(a2b_HResult     result,
     a2b_Handle userData);
 static void a2b_pwrDiagNotifyComplete(a2b_Plugin* plugin,
     a2b_Bool disableBusPower);
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+static a2b_Bool a2b_pwrDiagIsSlaveCableFault(a2b_Plugin* plugin,
+    a2b_Bool disableBusPower);
+#endif
 static void a2b_pwrDiagOnDiscoveryTimeout(struct a2b_Timer* timer,
     a2b_Handle userData);
 static a2b_HResult a2b_pwrDiagStartDiscovery(a2b_Plugin* plugin);
@@ -123,6 +127,62 @@ a2b_pwrDiagFreeSlavePlugins
 }
 
 
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+/*!****************************************************************************
+*
+*  \b              a2b_pwrDiagIsSlaveCableFault
+*
+*
+*  This routine checks whether a diagnosed fault is a cable fault below
+*  a discovered slave node, for which only the switch of that node was
+*  turned off. The nodes up to that node are then still running and a
+*  partial discovery can resume from it.
+*
+*  \param          [in]    plugin           The master plugin instance.
+*
+*  \param          [in]    disableBusPower  An indication of whether or
+*                                           not bus power is disabled
+*                                           after the diagnosis.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         A2B_TRUE if only the nodes below the fault were lost
+*
+******************************************************************************/
+static a2b_Bool
+a2b_pwrDiagIsSlaveCableFault
+    (
+    a2b_Plugin* plugin,
+    a2b_Bool    disableBusPower
+    )
+{
+    a2b_Bool bSlaveFault = A2B_FALSE;
+
+    if ( (!disableBusPower) &&
+         (A2B_SUCCEEDED(plugin->pwrDiag.results.diagResult)) &&
+         (plugin->pwrDiag.results.faultNode > A2B_NODEADDR_MASTER) &&
+         (plugin->pwrDiag.results.faultNode <
+                            (a2b_Int16)plugin->discovery.dscNumNodes) )
+    {
+        switch ( plugin->pwrDiag.results.intrType )
+        {
+            case A2B_ENUM_INTTYPE_PWRERR_CS:
+            case A2B_ENUM_INTTYPE_PWRERR_CDISC:
+            case A2B_ENUM_INTTYPE_PWRERR_CREV:
+                bSlaveFault = A2B_TRUE;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return bSlaveFault;
+}
+#endif /* A2B_FEATURE_PARTIAL_DISCOVERY */
+
+
 /*!****************************************************************************
 *
 *  \b              a2b_pwrDiagNotifyComplete
@@ -158,9 +218,15 @@ a2b_pwrDiagNotifyComplete
     a2b_PowerFault* fault;
     a2b_HResult result;
     a2b_Int32 status;
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+    a2b_Int16 nodeAddr;
+#endif
 
     if ( A2B_NULL != plugin )
     {
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+        plugin->discovery.dscResumeNodes = 0u;
+#endif
         if ( disableBusPower )
         {
             /* Make best effort to turn off the phantom power at the master */
@@ -211,6 +277,23 @@ a2b_pwrDiagNotifyComplete
         {
             a2b_dscvryEnd(plugin, (a2b_UInt32)A2B_EC_DISCOVERY_PWR_FAULT);
         }
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+        else if ( a2b_pwrDiagIsSlaveCableFault(plugin, disableBusPower) )
+        {
+            /* Only the switch of the faulty node was turned off, so the
+             * nodes up to it keep running with their plugins. Only the
+             * plugins of the nodes below it are freed.
+             */
+            for ( nodeAddr = plugin->pwrDiag.results.faultNode + 1;
+                  nodeAddr < (a2b_Int16)plugin->discovery.dscNumNodes;
+                  nodeAddr++ )
+            {
+                (void)a2b_stackFreeSlaveNodeHandler(plugin->ctx, nodeAddr);
+            }
+            plugin->discovery.dscResumeNodes =
+                            (a2b_UInt8)(plugin->pwrDiag.results.faultNode + 1);
+        }
+#endif /* A2B_FEATURE_PARTIAL_DISCOVERY */
         else
         {
             /* Do a best effort clean-up of any attached slave plugins */
@@ -23,16 +23,49 @@ and its licensors.
 /*============= I N C L U D E S =============*/
 #include "platform/a2b/ctypes.h"
 #include "a2bstack-protobuf/inc/adi_a2b_busconfig.h"
+#include "platform/a2b/conf.h"
 /*============= D E F I N E S =============*/
 
+/*! Merge write units to consecutive registers of a device into one
+    auto-increment transaction. Set to 0 for devices without auto-increment. */
+#ifndef A2B_PERI_CFG_COALESCE
+#define A2B_PERI_CFG_COALESCE           (1u)
+#endif
+
+/*! Longest merged write in bytes, sub address included */
+#if (A2B_MAX_PERIPHERAL_BUFFER_SIZE < ADI_A2B_MAX_PERI_CONFIG_UNIT_SIZE)
+#define A2B_PERI_CFG_MAX_BURST          (A2B_MAX_PERIPHERAL_BUFFER_SIZE)
+#else
+#define A2B_PERI_CFG_MAX_BURST          (ADI_A2B_MAX_PERI_CONFIG_UNIT_SIZE)
+#endif
+
 /*============= D A T A T Y P E S=============*/
 struct a2b_Timer;
 struct a2b_Plugin;
 
+/*! \struct ADI_A2B_PERI_CFG_STATS
+    I2C transactions of a peripheral configuration
+*/
+typedef struct
+{
+    /*! Read and write units in the tables */
+    a2b_UInt32 nUnits;
+
+    /*! Transactions issued after merging */
+    a2b_UInt32 nTransactions;
+
+}ADI_A2B_PERI_CFG_STATS;
+
 
 /*======= P U B L I C P R O T O T Y P E S ========*/
 void adi_a2b_Concat_Addr_Data(a2b_UInt8 pDstBuf[] ,a2b_UInt32 nAddrwidth, a2b_UInt32 nAddr);
-a2b_HResult adi_a2b_PeriheralConfig(struct a2b_Plugin* plugin, ADI_A2B_NODE_PERICONFIG *pPeriConfig);
+a2b_HResult adi_a2b_PeriheralConfig(struct a2b_Plugin* plugin, ADI_A2B_NODE_PERICONFIG *pPeriConfig,
+                                    a2b_UInt32* pnDelay);
+a2b_HResult adi_a2b_PeriCfgResume(struct a2b_Plugin* plugin, a2b_UInt32* pnDelay);
+a2b_UInt32 adi_a2b_PeriCfgBurst(const ADI_A2B_PERI_CONFIG_UNIT aUnit[], a2b_UInt32 nNumUnits,
+                                a2b_UInt32 nIndex, a2b_UInt32 nMaxLen);
+a2b_UInt32 adi_a2b_PeriCfgLoadBurst(a2b_UInt8 pDstBuf[], const ADI_A2B_PERI_CONFIG_UNIT aUnit[],
+                                    a2b_UInt32 nCount);
 
 /** 
  @}
@@ -10,8 +10,11 @@ and its licensors.
                 the peripherals connected to A2B transceiver(AD2410)
                  
    Functions  :  adi_a2b_PeriheralConfig()
+                 adi_a2b_PeriCfgResume()
                  adi_a2b_DeviceConfig()
                  adi_a2b_RemoteDeviceConfig()
+                 adi_a2b_PeriCfgBurst()
+                 adi_a2b_PeriCfgLoadBurst()
 
    Prepared &
    Reviewed by: Automotive Software and Systems team, 
@@ -66,64 +69,128 @@ and its licensors.
 ** Function Prototype section
 */
 #ifdef ENABLE_PERI_CONFIG_BCF
-static a2b_UInt32 adi_a2b_RemoteDeviceConfig(a2b_Plugin* plugin, ADI_A2B_PERI_DEVICE_CONFIG* psDeviceConfig);
+#ifndef  A2B_BCF_FROM_SOC_EEPROM
+static a2b_UInt32 adi_a2b_RemoteDeviceConfig(a2b_Plugin* plugin, ADI_A2B_PERI_DEVICE_CONFIG* psDeviceConfig,
+                                             a2b_UInt32* pnUnit, ADI_A2B_PERI_CFG_STATS* pStats,
+                                             a2b_UInt32* pnDelay);
+#endif
 /*
 ** Function Definition section
 */
 
 /****************************************************************************/
 /*!
-    @brief          This function configures/programs peripherals connected 
-                    to the slave node.(remote I2C)
-     
+    @brief          This function starts configuring/programming the peripherals
+                    connected to the slave node (remote I2C). It runs until the
+                    first delay unit; adi_a2b_PeriCfgResume() continues once the
+                    delay has elapsed, so other nodes are configured meanwhile.
+
     @param [in]     plugin                 Pointer to A2B Slave Plugin
     @param [in]     pPeriConfig            Pointer to Node Peripheral Config Table
-  
-    
+    @param [out]    pnDelay                Delay (msec) to wait before resuming,
+                                           0 when the configuration is done
+
     @return          Return code
                     - 0: Success
                     - 1: Failure
-*/                    
-/********************************************************************************/ 
-a2b_HResult adi_a2b_PeriheralConfig(struct a2b_Plugin* plugin, ADI_A2B_NODE_PERICONFIG *pPeriConfig)
+*/
+/********************************************************************************/
+a2b_HResult adi_a2b_PeriheralConfig(struct a2b_Plugin* plugin, ADI_A2B_NODE_PERICONFIG *pPeriConfig,
+                                    a2b_UInt32* pnDelay)
 {
-    a2b_UInt32 nResult = 0u;
-    a2b_UInt8 i;
-    a2b_Int16 nodeAddr;
 #ifndef  A2B_BCF_FROM_SOC_EEPROM
-    nodeAddr = plugin->nodeSig.nodeAddr;
+    a2b_Int16 nodeAddr = plugin->nodeSig.nodeAddr;
+
+#ifndef A2B_FEATURE_TRACE
+    A2B_UNUSED(nodeAddr);
+#endif
 	A2B_TRACE1((plugin->ctx, (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_INFO),
 								 "a2b_PeriheralConfig: Starting peripheral configuration "
 								 "nodeAddr = %hd", &nodeAddr));
+#endif
+
+    plugin->pNodePeriDeviceConfig = pPeriConfig;
+    plugin->nPeriCfgDevice = 0u;
+    plugin->nPeriCfgUnit = 0u;
+    plugin->oPeriCfgStats.nUnits = 0u;
+    plugin->oPeriCfgStats.nTransactions = 0u;
 
+    return adi_a2b_PeriCfgResume(plugin, pnDelay);
+}
+
+/****************************************************************************/
+/*!
+    @brief          This function continues the peripheral configuration started
+                    by adi_a2b_PeriheralConfig() from the unit after the last
+                    delay, up to the next delay unit or the end of the table.
+                    Units of a device are never reordered.
 
-    for(i = 0u; i < (a2b_UInt8)pPeriConfig->nNumConfig;i++)
+    @param [in]     plugin                 Pointer to A2B Slave Plugin
+    @param [out]    pnDelay                Delay (msec) to wait before resuming,
+                                           0 when the configuration is done
+
+    @return          Return code
+                    - 0: Success
+                    - 1: Failure
+*/
+/********************************************************************************/
+a2b_HResult adi_a2b_PeriCfgResume(struct a2b_Plugin* plugin, a2b_UInt32* pnDelay)
+{
+    a2b_UInt32 nResult = 0u;
+#ifndef  A2B_BCF_FROM_SOC_EEPROM
+    ADI_A2B_NODE_PERICONFIG *pPeriConfig = plugin->pNodePeriDeviceConfig;
+    a2b_Int16 nodeAddr = plugin->nodeSig.nodeAddr;
+
+#ifndef A2B_FEATURE_TRACE
+    A2B_UNUSED(nodeAddr);
+#endif
+    *pnDelay = 0u;
+    while(plugin->nPeriCfgDevice < (a2b_UInt32)pPeriConfig->nNumConfig)
     {
-    	nResult = (a2b_UInt32)adi_a2b_RemoteDeviceConfig(plugin,&pPeriConfig->aDeviceConfig[i]);
+    	nResult |= adi_a2b_RemoteDeviceConfig(plugin, &pPeriConfig->aDeviceConfig[plugin->nPeriCfgDevice],
+    			&plugin->nPeriCfgUnit, &plugin->oPeriCfgStats, pnDelay);
+    	if(*pnDelay != 0u)
+    	{
+    		/* Parked on a delay, the unit after it is next */
+    		return nResult;
+    	}
+    	plugin->nPeriCfgDevice++;
+    	plugin->nPeriCfgUnit = 0u;
     }
 
-	A2B_TRACE1((plugin->ctx, (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_INFO),
+	A2B_TRACE3((plugin->ctx, (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_INFO),
 								 "a2b_PeriheralConfig: Ending peripheral configuration "
-								 "nodeAddr = %hd", &nodeAddr));
+								 "nodeAddr = %hd, %ld I2C transactions for %ld units", &nodeAddr,
+								 &plugin->oPeriCfgStats.nTransactions, &plugin->oPeriCfgStats.nUnits));
+#else
+    *pnDelay = 0u;
 #endif
     return nResult;
-} 
+}
 
 #ifndef  A2B_BCF_FROM_SOC_EEPROM
 /****************************************************************************/
 /*!
     @brief          This function configures devices connected to slave node
-                    through remote I2C
+                    through remote I2C, from unit *pnUnit up to the next delay
+                    unit or the last unit. Consecutive register writes are
+                    merged by adi_a2b_PeriCfgBurst(); units are never reordered.
 
     @param [in]     plugin                  Pointer to A2B slave Plugin
     @param [in]     psDeviceConfig          Pointer to peripheral device configuration structure
+    @param [in,out] pnUnit                  Next unit to process, updated
+    @param [in,out] pStats                  Transaction counts, accumulated
+    @param [out]    pnDelay                 Delay (msec) of the delay unit reached,
+                                            0 when the device is done
 
     @return          Return code
                     - 0: Success
                     - 1: Failure
 */
 /********************************************************************************/
-static a2b_UInt32 adi_a2b_RemoteDeviceConfig(a2b_Plugin* plugin, ADI_A2B_PERI_DEVICE_CONFIG* psDeviceConfig)
+static a2b_UInt32 adi_a2b_RemoteDeviceConfig(a2b_Plugin* plugin, ADI_A2B_PERI_DEVICE_CONFIG* psDeviceConfig,
+                                             a2b_UInt32* pnUnit, ADI_A2B_PERI_CFG_STATS* pStats,
+                                             a2b_UInt32* pnDelay)
 {
 	ADI_A2B_MEM_PERI_CONFIG_DATA
     static a2b_UInt8 aDataBuffer[ADI_A2B_MAX_PERI_CONFIG_UNIT_SIZE];
@@ -131,15 +198,18 @@ static a2b_UInt32 adi_a2b_RemoteDeviceConfig(a2b_Plugin* plugin, ADI_A2B_PERI_DE
 
     a2b_UInt32 nReturn = 0u;
     ADI_A2B_PERI_CONFIG_UNIT* pOPUnit;
-    a2b_UInt8 nIndex, nIndex1;
+    a2b_UInt32 nIndex;
+    a2b_UInt8 nIndex1;
     a2b_UInt32 nNumOpUnits;
     a2b_UInt32 nDelayVal;
+    a2b_UInt32 nBurst, nLen;
     a2b_Int16 nodeAddr;
     a2b_HResult status = A2B_RESULT_SUCCESS;
 
     nNumOpUnits = psDeviceConfig->nNumPeriConfigUnit;
     nodeAddr = plugin->nodeSig.nodeAddr;
-    for(nIndex= 0u ; nIndex < nNumOpUnits ; nIndex++ )
+    *pnDelay = 0u;
+    for(nIndex = *pnUnit; nIndex < nNumOpUnits ; nIndex++ )
     {
         pOPUnit = &psDeviceConfig->paPeriConfigUnit[nIndex];
         /* Operation code*/
@@ -147,13 +217,19 @@ static a2b_UInt32 adi_a2b_RemoteDeviceConfig(a2b_Plugin* plugin, ADI_A2B_PERI_DE
         {
            /* write */
             case 0u:
-                    adi_a2b_Concat_Addr_Data(&aDataBuffer[0u], pOPUnit->nAddrWidth, pOPUnit->nAddr);
-            	    (void)a2b_memcpy(&aDataBuffer[pOPUnit->nAddrWidth], pOPUnit->paConfigData, pOPUnit->nDataCount);
+                    nBurst = adi_a2b_PeriCfgBurst(psDeviceConfig->paPeriConfigUnit, nNumOpUnits, nIndex,
+                    		A2B_MIN(A2B_PERI_CFG_MAX_BURST, ADI_A2B_MAX_PERI_CONFIG_UNIT_SIZE));
+                    nLen   = adi_a2b_PeriCfgLoadBurst(&aDataBuffer[0u], pOPUnit, nBurst);
             	    status = a2b_i2cPeriphWrite(plugin->ctx, nodeAddr, (a2b_UInt16)psDeviceConfig->nDeviceAddress,
-            	    		(a2b_UInt16)(pOPUnit->nAddrWidth + pOPUnit->nDataCount), &aDataBuffer[0u]);
+            	    		(a2b_UInt16)nLen, &aDataBuffer[0u]);
+            	    pStats->nUnits += nBurst;
+            	    pStats->nTransactions++;
+            	    nIndex += (nBurst - 1u);
                     break;
             /* read */
             case 1u: 
+            	   pStats->nUnits++;
+            	   pStats->nTransactions++;
             	   (void)a2b_memset(&aDataBuffer[0u], (a2b_Int32)0u, (size_t)pOPUnit->nDataCount);
             	    adi_a2b_Concat_Addr_Data(&aDataWriteReadBuf[0u], pOPUnit->nAddrWidth, pOPUnit->nAddr);
             	    status = a2b_i2cPeriphWriteRead(plugin->ctx, nodeAddr, (a2b_UInt16)psDeviceConfig->nDeviceAddress,
@@ -161,13 +237,13 @@ static a2b_UInt32 adi_a2b_RemoteDeviceConfig(a2b_Plugin* plugin, ADI_A2B_PERI_DE
 							(a2b_UInt16)pOPUnit->nDataCount, &aDataBuffer[0u]);
 
                     break;
-            /* delay */
+            /* delay: handed back to the caller instead of spinning here */
             case 2u: nDelayVal = 0u;
 					for(nIndex1 = 0u; nIndex1 < pOPUnit->nDataCount; nIndex1++)
 					{
 						nDelayVal = (a2b_UInt32)((a2b_UInt32)pOPUnit->paConfigData[nIndex1] << (a2b_UInt32)((a2b_UInt32)8u * nIndex1)) | nDelayVal;
 					}
-            		(void)a2b_ActiveDelay(plugin->ctx, nDelayVal);
+					*pnDelay = nDelayVal;
                     break;
 
             default: break;
@@ -179,13 +255,112 @@ static a2b_UInt32 adi_a2b_RemoteDeviceConfig(a2b_Plugin* plugin, ADI_A2B_PERI_DE
         	nReturn = 1u;
             break;
         }
+
+        if(*pnDelay != 0u)
+        {
+        	nIndex++;
+        	break;
+        }
     }
 
+    *pnUnit = nIndex;
     return(nReturn);
 }
 #endif
 #endif
 
+/****************************************************************************/
+/*!
+    @brief          This function returns how many write units, starting at
+                    aUnit[nIndex], can be sent as one auto-increment I2C write:
+                    write units with the same sub address and data width,
+                    each starting at the register after the end of the
+                    previous one, up to nMaxLen bytes including the sub
+                    address. Read and delay units end a burst, so they keep
+                    their place in the sequence.
+
+    @param [in]     aUnit                 Configuration units of one device
+    @param [in]     nNumUnits             Number of units
+    @param [in]     nIndex                First unit of the burst
+    @param [in]     nMaxLen               Longest transaction in bytes
+
+    @return         Number of units in the burst (1 if nothing can be merged)
+*/
+/********************************************************************************/
+a2b_UInt32 adi_a2b_PeriCfgBurst(const ADI_A2B_PERI_CONFIG_UNIT aUnit[], a2b_UInt32 nNumUnits,
+                                a2b_UInt32 nIndex, a2b_UInt32 nMaxLen)
+{
+    a2b_UInt32 nCount = 1u;
+#if A2B_PERI_CFG_COALESCE
+    const ADI_A2B_PERI_CONFIG_UNIT *pFirst = &aUnit[nIndex];
+    const ADI_A2B_PERI_CONFIG_UNIT *pPrev  = pFirst;
+    const ADI_A2B_PERI_CONFIG_UNIT *pNext;
+    a2b_UInt32 nLen;
+
+    if((pFirst->eOpCode != A2B_WRITE_OP) || (pFirst->nDataWidth == 0u))
+    {
+        return nCount;
+    }
+
+    nLen = pFirst->nAddrWidth + pFirst->nDataCount;
+    while((nIndex + nCount) < nNumUnits)
+    {
+        pNext = &aUnit[nIndex + nCount];
+
+        /* The register after the previous unit, counted in data words */
+        if((pNext->eOpCode != A2B_WRITE_OP) ||
+           (pNext->nAddrWidth != pFirst->nAddrWidth) ||
+           (pNext->nDataWidth != pFirst->nDataWidth) ||
+           ((pPrev->nDataCount % pPrev->nDataWidth) != 0u) ||
+           (pNext->nAddr != (pPrev->nAddr + (pPrev->nDataCount / pPrev->nDataWidth))) ||
+           ((nLen + pNext->nDataCount) > nMaxLen))
+        {
+            break;
+        }
+
+        nLen += pNext->nDataCount;
+        pPrev = pNext;
+        nCount++;
+    }
+#else
+    A2B_UNUSED(aUnit);
+    A2B_UNUSED(nNumUnits);
+    A2B_UNUSED(nIndex);
+    A2B_UNUSED(nMaxLen);
+#endif
+
+    return nCount;
+}
+
+/****************************************************************************/
+/*!
+    @brief          This function builds one I2C write from nCount write units
+                    returned by adi_a2b_PeriCfgBurst(): the sub address of the
+                    first unit followed by the data of all units.
+
+    @param [out]    pDstBuf               Transaction buffer
+    @param [in]     aUnit                 First unit of the burst
+    @param [in]     nCount                Number of units in the burst
+
+    @return         Transaction length in bytes
+*/
+/********************************************************************************/
+a2b_UInt32 adi_a2b_PeriCfgLoadBurst(a2b_UInt8 pDstBuf[], const ADI_A2B_PERI_CONFIG_UNIT aUnit[],
+                                    a2b_UInt32 nCount)
+{
+    a2b_UInt32 nUnit;
+    a2b_UInt32 nLen = aUnit[0u].nAddrWidth;
+
+    adi_a2b_Concat_Addr_Data(&pDstBuf[0u], aUnit[0u].nAddrWidth, aUnit[0u].nAddr);
+    for(nUnit = 0u; nUnit < nCount; nUnit++)
+    {
+        (void)memcpy(&pDstBuf[nLen], aUnit[nUnit].paConfigData, aUnit[nUnit].nDataCount);
+        nLen += aUnit[nUnit].nDataCount;
+    }
+
+    return nLen;
+}
+
 /****************************************************************************/
 /*!
     @brief          This function calculates reg value based on width and adds
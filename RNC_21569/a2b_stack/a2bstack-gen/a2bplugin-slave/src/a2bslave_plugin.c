@@ -53,6 +53,11 @@
 static a2b_Plugin* a2b_pluginFind(a2b_Handle  hnd);
 static void a2b_onSimulatedPeriphAccess(struct a2b_Timer* timer,
     a2b_Handle          userData);
+#ifdef ENABLE_PERI_CONFIG_BCF
+static void a2b_periCfgWait(a2b_Plugin* plugin, a2b_UInt32 nDelay);
+static void a2b_onPeriCfgDelay(struct a2b_Timer* timer,
+    a2b_Handle          userData);
+#endif
 static void a2b_onDtcMsgFree(struct a2b_Msg* msg);
 static void a2b_emitSlaveDtc(a2b_Plugin* plugin,
     a2b_UInt8   intrSrc, a2b_UInt8   intrType);
@@ -176,6 +181,110 @@ a2b_onSimulatedPeriphAccess
 }
 
 
+#ifdef ENABLE_PERI_CONFIG_BCF
+/*!****************************************************************************
+*
+*  \b              a2b_periCfgWait
+*
+*  Parks the peripheral configuration of this node on the plugin timer for
+*  the delay of a delay unit. The A2B_MSGREQ_PLUGIN_PERIPH_INIT request
+*  stays suspended meanwhile, so the job executor keeps serving the other
+*  nodes.
+*
+*  \param          [in]    plugin   The slave plugin instance.
+*
+*  \param          [in]    nDelay   Delay (msec) of the delay unit.
+*
+*  \pre            None
+*
+*  \post           a2b_onPeriCfgDelay() is called once the delay elapsed.
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_periCfgWait
+    (
+    a2b_Plugin* plugin,
+    a2b_UInt32  nDelay
+    )
+{
+    /* Single shot timer */
+    a2b_timerSet(plugin->timer, nDelay, 0u);
+    a2b_timerSetHandler(plugin->timer, &a2b_onPeriCfgDelay);
+    a2b_timerSetData(plugin->timer, plugin);
+    a2b_timerStart(plugin->timer);
+}
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_onPeriCfgDelay
+*
+*  Called by the timer when the delay unit the peripheral configuration is
+*  parked on has elapsed. Resumes the configuration and, once the last unit
+*  is done, completes the A2B_MSGREQ_PLUGIN_PERIPH_INIT request.
+*
+*  \param          [in]    timer    The timer instance.
+*
+*  \param          [in]    userData User data passed to timer services
+*                                   when the timer was initialized. Should
+*                                   contain the plugin instance.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_onPeriCfgDelay
+    (
+    struct a2b_Timer*   timer,
+    a2b_Handle          userData
+    )
+{
+    a2b_Plugin* plugin = (a2b_Plugin*)userData;
+    a2b_UInt32 nDelay;
+    a2b_HResult nRes;
+    struct a2b_Msg* msg;
+    a2b_PluginInit* initReply;
+
+    A2B_UNUSED(timer);
+
+    if ( (A2B_NULL != plugin) && (plugin->inUse) )
+    {
+        nRes = adi_a2b_PeriCfgResume(plugin, &nDelay);
+        if ( nRes != 0u )
+        {
+            /* A failed unit fails the whole request, later units included */
+            msg = a2b_msgRtrGetExecutingMsg(plugin->ctx, A2B_MSG_MAILBOX);
+            if ( (A2B_NULL != msg) &&
+                (A2B_MSGREQ_PLUGIN_PERIPH_INIT == a2b_msgGetCmd(msg)) )
+            {
+                initReply = (a2b_PluginInit*)a2b_msgGetPayload(msg);
+                initReply->resp.status = A2B_MAKE_HRESULT(A2B_SEV_FAILURE,
+                                                          A2B_FAC_PLUGIN,
+                                                          A2B_EC_IO);
+            }
+        }
+
+        if ( nDelay != 0u )
+        {
+            a2b_periCfgWait(plugin, nDelay);
+        }
+        else
+        {
+            /* Finish the request so the next message can be processed */
+            a2b_msgRtrExecUpdate(plugin->ctx, A2B_MSG_MAILBOX,
+                                 A2B_EXEC_COMPLETE);
+        }
+    }
+}
+#endif /* ENABLE_PERI_CONFIG_BCF */
+
+
 /*!****************************************************************************
 *
 *  \b              a2b_onDtcMsgFree
@@ -527,9 +636,10 @@ a2b_pluginExecute
     a2b_Plugin*                 plugin = (a2b_Plugin*)pluginHnd;
     a2b_PluginInit*             initMsg;
     a2b_Int16                   nodeAddr= a2b_msgGetDestNodeAddr(msg);
-    a2b_HResult 				nRes;
 #ifdef ENABLE_PERI_CONFIG_BCF
+    a2b_HResult                 nRes;
     ADI_A2B_NODE_PERICONFIG (*pPeriConfig)[];  /* Pointer to an array of configuration */
+    a2b_UInt32                  nDelay = 0u;
 #endif
 
 #ifndef A2B_FEATURE_TRACE
@@ -558,9 +668,16 @@ a2b_pluginExecute
             if(initMsg->req.pNodePeriDeviceConfig != A2B_NULL)
             {
             	pPeriConfig = (ADI_A2B_NODE_PERICONFIG (*)[])initMsg->req.pNodePeriDeviceConfig;
-            	plugin->pNodePeriDeviceConfig = &((*pPeriConfig)[((a2b_UInt32)nodeAddr + (a2b_UInt32)1)]);
-
-            	nRes = adi_a2b_PeriheralConfig(plugin, plugin->pNodePeriDeviceConfig);
+            	nRes = adi_a2b_PeriheralConfig(plugin,
+            			&((*pPeriConfig)[((a2b_UInt32)nodeAddr + (a2b_UInt32)1)]), &nDelay);
+            	if ( nRes != 0u )
+            	{
+            		/* Set before a delay suspends the request, so
+            		 * a2b_onPeriCfgDelay() can only add failures */
+            		initMsg->resp.status = A2B_MAKE_HRESULT(A2B_SEV_FAILURE,
+            		                                        A2B_FAC_PLUGIN,
+            		                                        A2B_EC_IO);
+            	}
             }
 #endif
 
@@ -586,6 +703,14 @@ a2b_pluginExecute
             }
 #endif
             ret = A2B_EXEC_COMPLETE;
+#ifdef ENABLE_PERI_CONFIG_BCF
+            if ( nDelay != 0u )
+            {
+                /* Completed by a2b_onPeriCfgDelay() after the last unit */
+                a2b_periCfgWait(plugin, nDelay);
+                ret = A2B_EXEC_SUSPEND;
+            }
+#endif
             break;
 
         case A2B_MSGREQ_PLUGIN_PERIPH_DEINIT:
@@ -54,6 +54,9 @@ typedef struct a2b_Plugin
     a2b_DtcMsgItem              dtcMsgHeap[A2B_DTC_MAX_NOTIFY_MSGS];
 #ifdef ENABLE_PERI_CONFIG_BCF
     ADI_A2B_NODE_PERICONFIG     *pNodePeriDeviceConfig;
+    a2b_UInt32                  nPeriCfgDevice;     /* Device being configured */
+    a2b_UInt32                  nPeriCfgUnit;       /* Next unit of that device */
+    ADI_A2B_PERI_CFG_STATS      oPeriCfgStats;
 #endif
     struct a2b_StackContext*    Mstrctx;
 } a2b_Plugin;
@@ -48,17 +48,46 @@
 #define PB_FIELD_16BIT
 #endif
 
+#ifndef A2B_FEATURE_BDD_STREAM
 /* Disable support for custom streams (support only memory buffers) */
 #define PB_BUFFER_ONLY 1
+#elif defined(PB_BUFFER_ONLY)
+#error "A2B_FEATURE_BDD_STREAM decodes through a nanopb custom stream, PB_BUFFER_ONLY must not be defined"
+#endif
 
 #include "pb_decode.h"
 #include "bdd_pb2.pb.h"
 
 /*======================= D E F I N E S ===========================*/
 
+#ifdef A2B_FEATURE_BDD_STREAM
+#ifndef A2B_BDD_STREAM_CHUNK_SIZE
+/*! Bytes fetched per read by a2b_bddDecodeStream() (one 24xx EEPROM page) */
+#define A2B_BDD_STREAM_CHUNK_SIZE       (32u)
+#endif
+#endif
+
+#ifdef A2B_BCF_FROM_SOC_EEPROM
+#ifdef A2B_FEATURE_BDD_STREAM
+/*! Size of the scratch buffer a2b_get_bddFromEEPROM() needs, the BDD itself
+ *  is streamed so only the level 0/1 headers pass through it */
+#define A2B_BDD_EEPROM_SCRATCH_SIZE     (17u)
+#else
+/*! Size of the scratch buffer a2b_get_bddFromEEPROM() needs, the whole
+ *  BDD is read into it before being decoded */
+#define A2B_BDD_EEPROM_SCRATCH_SIZE     (4096u)
+#endif
+#endif
 
 /*======================= D A T A T Y P E S =======================*/
 
+#ifdef A2B_FEATURE_BDD_STREAM
+/*! Reads nLen bytes of an encoded BDD, starting nOffset bytes into its
+ *  storage (EEPROM, flash, file), into pBuf. Returns 0 on success. */
+typedef a2b_HResult (A2B_CALL * a2b_BddReadFunc)(void* pCtx, a2b_UInt32 nOffset,
+                                                a2b_UInt32 nLen, a2b_Byte* pBuf);
+#endif
+
 A2B_BEGIN_DECLS
 
 /*======================= P U B L I C  P R O T O T Y P E S ========*/
@@ -68,6 +97,14 @@ A2B_EXPORT a2b_Bool a2b_bddDecode(  const a2b_Byte* bddData,
                                     a2b_UInt32      bddLen,
                                     bdd_Network*    bddOut );
 
+#ifdef A2B_FEATURE_BDD_STREAM
+A2B_EXPORT a2b_Bool a2b_bddDecodeStream( a2b_BddReadFunc pfRead,
+                                         void*           pCtx,
+                                         a2b_UInt32      bddOffset,
+                                         a2b_UInt32      bddLen,
+                                         bdd_Network*    bddOut );
+#endif
+
 A2B_EXPORT void a2b_bddPalInit(     A2B_ECB*            ecb,
                                     const bdd_Network*  bdd );
 
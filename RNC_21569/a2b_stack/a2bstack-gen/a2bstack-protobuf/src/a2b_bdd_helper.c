@@ -38,6 +38,12 @@
 #define A2B_CLEAR_HAS(x, y) x.has_##y =  A2B_FALSE;
 #define A2B_CONFIG_HAS(x, y, z) x.has_##y =  z;
 
+#ifdef A2B_BCF_FROM_SOC_EEPROM
+/*! Result of a2b_get_bddFromEEPROM() when the BDD cannot be read or decoded */
+#define A2B_BDD_EEPROM_FAILURE(code) \
+            A2B_MAKE_HRESULT(A2B_SEV_FAILURE, A2B_FAC_PLATFORM, (code))
+#endif
+
 /*! \addtogroup Network_Configuration
  *  @{
  */
@@ -381,6 +387,193 @@ a2b_bddDecode
 
 } /* a2b_bddDecode */
 
+#ifdef A2B_FEATURE_BDD_STREAM
+/*! State of a nanopb input stream served by chunked storage reads */
+typedef struct a2b_BddStream
+{
+    a2b_BddReadFunc pfRead;     /*!< Storage read function */
+    void*           pCtx;       /*!< Context passed to pfRead */
+    a2b_UInt32      nOffset;    /*!< Storage offset of the next fetch */
+    a2b_UInt32      nLeft;      /*!< BDD bytes not yet fetched */
+    a2b_UInt16      nPos;       /*!< Next unread byte of aChunk */
+    a2b_UInt16      nFill;      /*!< Valid bytes in aChunk */
+    a2b_Byte        aChunk[A2B_BDD_STREAM_CHUNK_SIZE];
+} a2b_BddStream;
+
+/*!****************************************************************************
+*
+*  \b              a2b_bddStreamFetch
+*
+*  Reads the next nLen bytes of the BDD from its storage into pBuf.
+*
+*  \param          [in]    pState   stream state
+*  \param          [in]    nLen     number of bytes to read
+*  \param          [out]   pBuf     destination
+*
+*  \pre            nLen <= pState->nLeft
+*
+*  \post           None
+*
+*  \return         True = success, False = Failure
+*
+******************************************************************************/
+static a2b_Bool
+a2b_bddStreamFetch
+    (
+    a2b_BddStream*  pState,
+    a2b_UInt32      nLen,
+    a2b_Byte*       pBuf
+    )
+{
+    if ( A2B_FAILED( pState->pfRead( pState->pCtx, pState->nOffset, nLen, pBuf ) ) )
+    {
+        return A2B_FALSE;
+    }
+    pState->nOffset += nLen;
+    pState->nLeft   -= nLen;
+
+    return A2B_TRUE;
+
+} /* a2b_bddStreamFetch */
+
+/*!****************************************************************************
+*
+*  \b              a2b_bddStreamRead
+*
+*  nanopb input stream callback. Serves the decoder from the chunk buffer,
+*  refilling it from storage as it drains. Reads of a chunk or more (e.g.
+*  bytes fields) go straight from storage to their place in the decoded
+*  BDD, and skipped data passes through nanopb's 16 byte scratch.
+*
+*  \param          [in]    stream   nanopb stream, state is an a2b_BddStream
+*  \param          [out]   buf      destination
+*  \param          [in]    count    number of bytes to read
+*
+*  \pre            nanopb has checked count against the stream length
+*
+*  \post           None
+*
+*  \return         true = success, false = Failure
+*
+******************************************************************************/
+static bool
+a2b_bddStreamRead
+    (
+    pb_istream_t*   stream,
+    uint8_t*        buf,
+    size_t          count
+    )
+{
+    a2b_BddStream*  pState = (a2b_BddStream*)stream->state;
+    a2b_UInt32      nCopy;
+
+    while ( count > 0u )
+    {
+        if ( pState->nPos == pState->nFill )
+        {
+            if ( pState->nLeft < count )
+            {
+                return false;
+            }
+            if ( count >= A2B_BDD_STREAM_CHUNK_SIZE )
+            {
+                /* Bypass the chunk buffer */
+                return (bool)a2b_bddStreamFetch( pState, (a2b_UInt32)count, buf );
+            }
+            nCopy = ( pState->nLeft < A2B_BDD_STREAM_CHUNK_SIZE ) ?
+                    pState->nLeft : A2B_BDD_STREAM_CHUNK_SIZE;
+            if ( !a2b_bddStreamFetch( pState, nCopy, pState->aChunk ) )
+            {
+                return false;
+            }
+            pState->nPos  = 0u;
+            pState->nFill = (a2b_UInt16)nCopy;
+        }
+
+        nCopy = (a2b_UInt32)pState->nFill - pState->nPos;
+        if ( nCopy > count )
+        {
+            nCopy = (a2b_UInt32)count;
+        }
+        (void)memcpy( buf, &pState->aChunk[pState->nPos], nCopy );
+        pState->nPos += (a2b_UInt16)nCopy;
+        buf          += nCopy;
+        count        -= nCopy;
+    }
+
+    return true;
+
+} /* a2b_bddStreamRead */
+
+/*!****************************************************************************
+*
+*  \b              a2b_bddDecodeStream
+*
+*  Decodes an A2B BDD straight from its storage. The encoded BDD is read
+*  A2B_BDD_STREAM_CHUNK_SIZE bytes at a time into a buffer on the stack
+*  as the decoder consumes it, so no buffer of the BDD size is needed.
+*  The decoded BDD has fixed size arrays (e.g. nodes), so decoding
+*  allocates nothing either.
+*
+*  \param          [in]    pfRead       storage read function
+*  \param          [in]    pCtx         context passed to pfRead
+*  \param          [in]    bddOffset    storage offset of the encoded BDD
+*  \param          [in]    bddLen       length of the encoded BDD
+*  \param          [out]   bddOut       decoded BDD
+*
+*  \pre            Only available with A2B_FEATURE_BDD_STREAM
+*
+*  \post           None
+*
+*  \return         True = success, False = Failure
+*
+******************************************************************************/
+a2b_Bool
+a2b_bddDecodeStream
+    (
+    a2b_BddReadFunc pfRead,
+    void*           pCtx,
+    a2b_UInt32      bddOffset,
+    a2b_UInt32      bddLen,
+    bdd_Network*    bddOut
+    )
+{
+    a2b_BddStream   oState;
+    pb_istream_t    stream;
+
+    if ( ( pfRead == A2B_NULL ) || ( bddLen == 0u ) )
+    {
+        return A2B_FALSE;
+    }
+
+    oState.pfRead  = pfRead;
+    oState.pCtx    = pCtx;
+    oState.nOffset = bddOffset;
+    oState.nLeft   = bddLen;
+    oState.nPos    = 0u;
+    oState.nFill   = 0u;
+
+    stream.callback   = &a2b_bddStreamRead;
+    stream.state      = &oState;
+    stream.bytes_left = bddLen;
+#ifndef PB_NO_ERRMSG
+    stream.errmsg     = A2B_NULL;
+#endif
+
+    if ( !pb_decode( &stream, bdd_Network_fields, bddOut ) )
+    {
+        return A2B_FALSE;
+    }
+
+    #ifdef A2B_DUMP_BDD
+    a2b_bddDump( bddOut );
+    #endif
+
+    return A2B_TRUE;
+
+} /* a2b_bddDecodeStream */
+#endif /* A2B_FEATURE_BDD_STREAM */
+
 
 /*!****************************************************************************
 *
@@ -2421,6 +2614,37 @@ static void adi_a2b_SetforAllReg_241x_master(bdd_Node *pNode)
 #define  A2B_LVL0_NUM_CHIAN			6u
 #define  A2B_LVL0_LVL1_PTR			8u
 #define  A2B_LVL1_NUM_SLAVE			6u
+
+#ifdef A2B_FEATURE_BDD_STREAM
+/*!****************************************************************************
+ *
+ *  \b              a2b_bddEepromRead
+ *
+ *  a2b_BddReadFunc reading the BDD from the SoC EEPROM, one random read
+ *  per call.
+ *
+ *  \param          [in]    pCtx     I2C handle
+ *  \param          [in]    nOffset  EEPROM address
+ *  \param          [in]    nLen     number of bytes to read
+ *  \param          [out]   pBuf     destination
+ *
+ *  \pre            None
+ *
+ *  \post           None
+ *
+ *  \return         Result of a2b_EepromWriteRead()
+ *
+ ******************************************************************************/
+static a2b_HResult A2B_CALL
+a2b_bddEepromRead(void* pCtx, a2b_UInt32 nOffset, a2b_UInt32 nLen, a2b_Byte* pBuf)
+{
+	a2b_UInt8 wBuf[2];
+
+	A2B_PUT_UINT16_BE((a2b_UInt16)nOffset, wBuf, 0u);
+
+	return a2b_EepromWriteRead((a2b_Handle)pCtx, A2B_I2C_EEPROM_ADDR, 2u, wBuf, (a2b_UInt16)nLen, pBuf);
+}
+#endif
 /*!****************************************************************************
  *
  *  \b              a2b_get_bddFromEEPROM
@@ -2430,18 +2654,21 @@ static void adi_a2b_SetforAllReg_241x_master(bdd_Node *pNode)
  *
  *  \param          [in]    ecb      Ptr to Bus Description Struct
  *  \param          [in]    bdd      decoded BDD (e.g. from a2b_bddDecode)
+ *  \param          [in]    pBuff    Scratch of A2B_BDD_EEPROM_SCRATCH_SIZE bytes
  *
  *  \pre            None
  *
  *  \post           None
  *
- *  \return         None
+ *  \return         A2B_RESULT_SUCCESS, or a failure if an EEPROM read fails
+ *                  or the BDD does not decode; bdd_Graph may then be
+ *                  partly filled and must not be used.
  *
  ******************************************************************************/
 a2b_HResult a2b_get_bddFromEEPROM(A2B_ECB* ecb, bdd_Network *bdd_Graph, a2b_UInt8* pBuff, a2b_UInt8 pPeriBuf[], ADI_A2B_NETWORK_CONFIG* pTgtProp)
 {
 	a2b_UInt8 wBuf[2] = {0, 0};
-	a2b_UInt8 status = 0;
+	a2b_HResult status;
 	a2b_UInt8 nNumSlaves;
 	a2b_UInt8 nNumChain;
 	a2b_UInt16 nBDDLength;
@@ -2451,12 +2678,16 @@ a2b_HResult a2b_get_bddFromEEPROM(A2B_ECB* ecb, bdd_Network *bdd_Graph, a2b_UInt
 
 	/* Read Level 0  */
 	status = a2b_EepromWriteRead(ecb->palEcb.i2chnd, A2B_I2C_EEPROM_ADDR, 2u, wBuf, A2B_LVL0_EEPROM_BYTES, pBuff);
+	if(A2B_FAILED(status))
+	{
+		return status;
+	}
 	crc8 = a2b_crc8(pBuff, 0u, A2B_LVL0_EEPROM_BYTES - 1);
 
 	if(pBuff[A2B_LVL0_EEPROM_BYTES - 1] != crc8)
 	{
 		/* CRC Fail */
-		return A2B_FALSE;
+		return A2B_BDD_EEPROM_FAILURE(A2B_EC_NETWORK_DECODE_FAILURE);
 	}
 
     nNumChain = pBuff[A2B_LVL0_NUM_CHIAN];
@@ -2464,7 +2695,7 @@ a2b_HResult a2b_get_bddFromEEPROM(A2B_ECB* ecb, bdd_Network *bdd_Graph, a2b_UInt
     if(nNumChain > 1)
     {
     	/* Not supported */
-		return A2B_FALSE;
+		return A2B_BDD_EEPROM_FAILURE(A2B_EC_NETWORK_DECODE_FAILURE);
     }
 	/* Read LEVEL 1*/
 	A2B_GET_UINT16_BE(nChRdIndx, pBuff, A2B_LVL0_LVL1_PTR);
@@ -2472,6 +2703,10 @@ a2b_HResult a2b_get_bddFromEEPROM(A2B_ECB* ecb, bdd_Network *bdd_Graph, a2b_UInt
 
 	/* Check CRC */
 	status = a2b_EepromWriteRead(ecb->palEcb.i2chnd, A2B_I2C_EEPROM_ADDR, 2u, wBuf, A2B_LVL1_NUM_SLAVE + 1u, pBuff);
+	if(A2B_FAILED(status))
+	{
+		return status;
+	}
 	/* Get Number of slaves  */
 	nNumSlaves = pBuff[A2B_LVL1_NUM_SLAVE];
 
@@ -2490,22 +2725,46 @@ a2b_HResult a2b_get_bddFromEEPROM(A2B_ECB* ecb, bdd_Network *bdd_Graph, a2b_UInt
 
 	/* Read and store Configuration Pointers  */
 	status = a2b_EepromWriteRead( ecb->palEcb.i2chnd, A2B_I2C_EEPROM_ADDR, 2u, wBuf, nPeriConfigLen, pPeriBuf);
+	if(A2B_FAILED(status))
+	{
+		return status;
+	}
 	nChRdIndx += nPeriConfigLen;
 	A2B_PUT_UINT16_BE(nChRdIndx, wBuf, 0u);
 
 	/* Read BDD Length */
 	status = a2b_EepromWriteRead(ecb->palEcb.i2chnd, A2B_I2C_EEPROM_ADDR, 2u, wBuf, 2u, pBuff);
+	if(A2B_FAILED(status))
+	{
+		return status;
+	}
 	nChRdIndx += 2u;
 	A2B_PUT_UINT16_BE(nChRdIndx, wBuf, 0u);
 
 	/* Get BDD length */
 	A2B_GET_UINT16_BE(nBDDLength, pBuff, 0u);
 
+#ifdef A2B_FEATURE_BDD_STREAM
+	/* Decode BDD as it is read, one EEPROM page at a time */
+	if(!a2b_bddDecodeStream(&a2b_bddEepromRead, ecb->palEcb.i2chnd, nChRdIndx, nBDDLength, bdd_Graph))
+	{
+		/* Short or corrupt BDD, or a failed EEPROM read */
+		return A2B_BDD_EEPROM_FAILURE(A2B_EC_IO);
+	}
+#else
 	/* Read BDD  */
 	status = a2b_EepromWriteRead(ecb->palEcb.i2chnd, A2B_I2C_EEPROM_ADDR, 2u, wBuf, nBDDLength, pBuff);
+	if(A2B_FAILED(status))
+	{
+		return status;
+	}
 
 	/* Decode BDD */
-	a2b_bddDecode(pBuff, nBDDLength, bdd_Graph);
+	if(!a2b_bddDecode(pBuff, nBDDLength, bdd_Graph))
+	{
+		return A2B_BDD_EEPROM_FAILURE(A2B_EC_NETWORK_DECODE_FAILURE);
+	}
+#endif
 
 	/* Explicitly ensure node level eeprom is not ignored */
 	for(nNodeIdx = 0u; nNodeIdx < nNumSlaves + 1; nNodeIdx++)
@@ -2513,7 +2772,7 @@ a2b_HResult a2b_get_bddFromEEPROM(A2B_ECB* ecb, bdd_Network *bdd_Graph, a2b_UInt
 		bdd_Graph->nodes[nNodeIdx].ignEeprom = 0;
 	}
 
-	return status;
+	return A2B_RESULT_SUCCESS;
 
 
 }
@@ -78,10 +78,7 @@ static bool checkreturn buf_read(pb_istream_t *stream, uint8_t *buf, size_t coun
     stream->state = source + count;
     
     if (buf != NULL)
-    {
-        while (count--)
-            *buf++ = *source++;
-    }
+        memcpy(buf, source, count);
     
     return true;
 }
@@ -34,9 +34,15 @@
 
 #include "a2bstack/inc/a2b/macros.h"
 #include "platform/a2b/ctypes.h"
+#include "a2bstack/inc/a2b/defs.h"
 
 /*======================= D E F I N E S ===========================*/
 
+/** Registers captured per node by #a2b_diagSnapshot(), offsets 0 up to
+ *  and including A2B_REG_MBOX1B3 (the last AD242x register).
+ */
+#define A2B_DIAG_SNAP_REGS      (0x9Cu)
+
 
 /*======================= D A T A T Y P E S =======================*/
 
@@ -45,6 +51,39 @@ A2B_BEGIN_DECLS
 /* Forward Declarations */
 struct a2b_StackContext;
 
+/** Register map of every node, captured by #a2b_diagSnapshot() */
+typedef struct a2b_DiagSnapshot
+{
+    /** Nodes captured, the master and the slave nodes that follow it */
+    a2b_UInt8   numNodes;
+
+    /** Registers captured per node, from offset 0. Zero for a node that
+     *  did not respond.  Index 0 is the master, index n+1 slave node n.
+     */
+    a2b_UInt8   numRegs[A2B_CONF_MAX_NUM_SLAVE_NODES + 1u];
+
+    /** Register values, A2B_REG_INTTYPE is stored as zero */
+    a2b_UInt8   regs[A2B_CONF_MAX_NUM_SLAVE_NODES + 1u][A2B_DIAG_SNAP_REGS];
+
+} a2b_DiagSnapshot;
+
+/** One register that differs between two snapshots */
+typedef struct a2b_DiagRegDiff
+{
+    /** Node address: [#A2B_NODEADDR_MASTER(-1)..n] */
+    a2b_Int16   nodeAddr;
+
+    /** Register offset */
+    a2b_UInt8   reg;
+
+    /** Value in the first (older) snapshot */
+    a2b_UInt8   before;
+
+    /** Value in the second (newer) snapshot */
+    a2b_UInt8   after;
+
+} a2b_DiagRegDiff;
+
 
 /*======================= P U B L I C  P R O T O T Y P E S ========*/
 
@@ -72,6 +111,17 @@ A2B_DSO_PUBLIC a2b_HResult A2B_CALL a2b_diagGetRegDump(
                                                 a2b_UInt8* regs,
                                                 a2b_UInt16* numRegs);
 
+A2B_DSO_PUBLIC a2b_HResult A2B_CALL a2b_diagSnapshot(
+                                                struct a2b_StackContext* ctx,
+                                                a2b_UInt8 numSlaves,
+                                                a2b_DiagSnapshot* snap);
+
+A2B_DSO_PUBLIC a2b_UInt16 A2B_CALL a2b_diagSnapshotDiff(
+                                                const a2b_DiagSnapshot* before,
+                                                const a2b_DiagSnapshot* after,
+                                                a2b_DiagRegDiff* diffs,
+                                                a2b_UInt16 maxDiffs);
+
 A2B_END_DECLS
 
 /*======================= D A T A =================================*/
@@ -121,16 +121,21 @@ A2B_DSO_PUBLIC a2b_HResult A2B_CALL a2b_intrStopIrqPoll(
 
 /*----------------------------------------------------------------------------*/
 /** 
- * \defgroup a2bstack_interrupt_query   Query Function
+ * \defgroup a2bstack_interrupt_query   Query Functions
  *  
- * This function is used query the A2B master interrupt status. If 
- * an interrupt is detected it will be processed.
+ * These functions are used query the A2B master interrupt status. If 
+ * an interrupt is detected it will be processed. #a2b_intrServiceIrq()
+ * is used instead when the application has seen the master IRQ pin
+ * asserted.
  *
  * \{ */
 /*----------------------------------------------------------------------------*/
 
 A2B_DSO_PUBLIC a2b_HResult A2B_CALL a2b_intrQueryIrq(
                                         struct a2b_StackContext*  ctx );
+
+A2B_DSO_PUBLIC a2b_HResult A2B_CALL a2b_intrServiceIrq(
+                                        struct a2b_StackContext*  ctx );
 /** \} -- a2bstack_interrupt_query */
 
 A2B_END_DECLS
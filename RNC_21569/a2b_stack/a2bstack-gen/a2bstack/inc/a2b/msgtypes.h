@@ -130,8 +130,15 @@
 /** Transmission request to master plugin over mailbox to a particular slave node */
 #define A2B_MSGREQ_SEND_MBOX_DATA		    (12u)
 
+/** Re-discover only the nodes below the slave node that reported the
+ * last cable fault, keeping the nodes above it running. Uses the
+ * a2b_NetDiscovery payload; the *req* fields are ignored since the
+ * BDD of the last discovery is reused.
+ */
+#define A2B_MSGREQ_NET_PARTIAL_DISCOVERY    (13u)
+
 /** Max message request command (for range checking) */
-#define A2B_MSGREQ_MAX                      (13u)
+#define A2B_MSGREQ_MAX                      (14u)
 
 /** Arbitrary custom command.  Anything beyond this
   *  value is considered a custom command.
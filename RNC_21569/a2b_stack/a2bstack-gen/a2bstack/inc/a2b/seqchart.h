@@ -492,8 +492,10 @@ typedef struct a2b_SeqChartChannel
     a2b_Handle          hnd;
     a2b_UInt32          levelMask;
     a2b_UInt32          options;
+#ifndef A2B_FEATURE_SEQ_CHART_BINARY
     a2b_Char            buf[A2B_CONF_TRACE_BUF_SIZE];
     a2b_StringBuffer    strBuf;
+#endif
     struct a2b_StackContext*   ctx;
 } a2b_SeqChartChannel;
 
@@ -161,6 +161,82 @@ typedef enum
 #define A2B_SEQ_CHART_OPT_ALL           (A2B_SEQ_CHART_OPT_AUTONUMBER | \
                                         A2B_SEQ_CHART_OPT_TIMESTAMP)
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \name    Binary Sequence Chart Format
+ *
+ * With #A2B_FEATURE_SEQ_CHART_BINARY each chart event is stored as a
+ * record of 32-bit words in a preallocated buffer:
+ *
+ *   header, time (msec), entities, level, event data
+ *
+ * The header holds the event type, flags and the record length. The time
+ * is only valid with #A2B_SEQBIN_FLAG_TIMESTAMP, which also means the
+ * chart shows a time stamp note after the event. The event data is:
+ *
+ *   START  options, title address (0 = no title)
+ *   MSG    format address, arguments by value as for the binary trace
+ *          (see #A2B_TRCBIN_ARG_8 ...)
+ *   TEXT   byte count, bytes padded to a word
+ *   I2C    operation and address, write and read byte counts, result,
+ *          first #A2B_SEQBIN_I2C_DATA_BYTES bytes written, and read
+ *   STOP   nothing
+ *
+ * An I2C record stands for the request and the reply of the transfer.
+ * Addresses take #A2B_TRCBIN_PTR_WORDS words, low word first.
+ *
+ * a2b_seqChartBinDump() writes a header (magic, version, pointer words,
+ * record words, dropped events, 0), the records, the strings they refer
+ * to (#A2B_SEQBIN_STR_MAGIC, address, byte count, bytes padded to a word)
+ * and a terminating #A2B_SEQBIN_END word, in the byte order of the target.
+ */
+/*----------------------------------------------------------------------------*/
+#define A2B_SEQBIN_MAGIC        (0x43533241u)   /*!< "A2SC" */
+#define A2B_SEQBIN_VERSION      (1u)
+#define A2B_SEQBIN_STR_MAGIC    (0x52545341u)   /*!< "ASTR" */
+#define A2B_SEQBIN_END          (0u)
+#define A2B_SEQBIN_HDR_WORDS    (6u)
+
+#define A2B_SEQBIN_REC_SYNC     (0xC5u)
+#define A2B_SEQBIN_REC(nWords, type, flags) \
+            ((A2B_SEQBIN_REC_SYNC << 24u) | ((type) << 16u) | \
+            ((flags) << 8u) | (nWords))
+#define A2B_SEQBIN_REC_IS_VALID(hdr)    (((hdr) >> 24u) == A2B_SEQBIN_REC_SYNC)
+#define A2B_SEQBIN_REC_TYPE(hdr)        (((hdr) >> 16u) & 0xFFu)
+#define A2B_SEQBIN_REC_FLAGS(hdr)       (((hdr) >> 8u) & 0xFFu)
+#define A2B_SEQBIN_REC_WORDS(hdr)       ((hdr) & 0xFFu)
+#define A2B_SEQBIN_FLAG_TIMESTAMP       (0x01u)
+
+/** Event types */
+#define A2B_SEQBIN_TYPE_START   (1u)
+#define A2B_SEQBIN_TYPE_MSG     (2u)
+#define A2B_SEQBIN_TYPE_TEXT    (3u)
+#define A2B_SEQBIN_TYPE_I2C     (4u)
+#define A2B_SEQBIN_TYPE_STOP    (5u)
+
+/** Word offsets in a record */
+#define A2B_SEQBIN_REC_HDR      (0u)
+#define A2B_SEQBIN_REC_TIME     (1u)
+#define A2B_SEQBIN_REC_ENTITIES (2u)
+#define A2B_SEQBIN_REC_LEVEL    (3u)
+#define A2B_SEQBIN_REC_DATA     (4u)
+
+#define A2B_SEQBIN_ENTITIES(src, dest, commType) \
+            ((a2b_UInt32)(src) | ((a2b_UInt32)(dest) << 8u) | \
+            ((a2b_UInt32)(commType) << 16u))
+#define A2B_SEQBIN_SRC(ent)             ((ent) & 0xFFu)
+#define A2B_SEQBIN_DEST(ent)            (((ent) >> 8u) & 0xFFu)
+#define A2B_SEQBIN_COMM(ent)            (((ent) >> 16u) & 0xFFu)
+
+/** I2C transfers: operation in the upper half of the address word */
+#define A2B_SEQBIN_I2C_READ         (0u)
+#define A2B_SEQBIN_I2C_WRITE        (1u)
+#define A2B_SEQBIN_I2C_WRITE_READ   (2u)
+#define A2B_SEQBIN_I2C_DATA_BYTES   (8u)
+#define A2B_SEQBIN_I2C_WORDS        (A2B_SEQBIN_REC_DATA + 3u + \
+                                    (2u * (A2B_SEQBIN_I2C_DATA_BYTES / 4u)))
+/** \} */
+
 /*======================= D A T A T Y P E S =======================*/
 
 A2B_BEGIN_DECLS
@@ -204,6 +280,17 @@ A2B_DSO_PUBLIC void A2B_CALL a2b_seqChartSetOptions(
                                     struct a2b_StackContext* ctx,
                                     a2b_UInt32               options);
 
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+/** Receives a binary sequence chart dump in pieces */
+typedef void (A2B_CALL * a2b_SeqChartBinWriteFunc)(a2b_Handle hnd,
+                                                   const a2b_Byte* data,
+                                                   a2b_UInt32 nBytes);
+
+A2B_DSO_PUBLIC void A2B_CALL a2b_seqChartBinDump(
+                                    a2b_SeqChartBinWriteFunc writeFunc,
+                                    a2b_Handle               hnd);
+#endif /* A2B_FEATURE_SEQ_CHART_BINARY */
+
 A2B_END_DECLS
 
 #endif  /* A2B_FEATURE_SEQ_CHART */
@@ -52,6 +52,55 @@ struct a2b_NodeInfo;
 typedef void (A2B_CALL *a2b_stackDefCbFunc)(struct a2b_StackContext*,
                                             a2b_Handle);
 
+#ifdef A2B_FEATURE_MEMORY_MANAGER
+/** Usage of one memory pool of a stack heap */
+typedef struct a2b_HeapPoolStats
+{
+    /** The number of bytes per block */
+    a2b_UInt32  blockSize;
+
+    /** The total number of blocks in the pool */
+    a2b_UInt32  numBlocks;
+
+    /** The number of blocks currently allocated */
+    a2b_UInt32  numInUse;
+
+    /** Maximum number of blocks ever allocated at once (high watermark) */
+    a2b_UInt32  maxInUse;
+
+    /** Requests this pool was the best fit for but had no free block.
+     *  They were served from a larger pool or failed.
+     */
+    a2b_UInt32  numMissed;
+
+    /** Requests this pool was the best fit for that could not be served
+     *  by any pool.
+     */
+    a2b_UInt32  numFailed;
+} a2b_HeapPoolStats;
+
+/** One entry of the pool table the stack heap is built from */
+typedef struct a2b_HeapPoolEntry
+{
+    /** The entry name (e.g. "POOL_2") */
+    const a2b_Char* name;
+
+    /** The name of the type the blocks are sized for */
+    const a2b_Char* typeName;
+
+    /** The configured number of blocks */
+    a2b_UInt32      numBlocks;
+
+    /** The size of the type in bytes */
+    a2b_UInt32      blockSize;
+
+    /** Index of the heap pool serving the entry. Entries with the same
+     *  block size share a pool.
+     */
+    a2b_UInt32      poolIdx;
+} a2b_HeapPoolEntry;
+#endif
+
 /*======================= P U B L I C  P R O T O T Y P E S ========*/
 
 /**
@@ -80,6 +129,14 @@ A2B_DSO_PUBLIC void A2B_CALL a2b_stackFree(struct a2b_StackContext* ctx);
  */
 A2B_DSO_PUBLIC void A2B_CALL a2b_stackTick(struct a2b_StackContext* ctx);
 
+/**
+ * Returns the time in msec until #a2b_stackTick has work to do: 0 if it
+ * has now, #A2B_TIMER_NO_DEADLINE if nothing is pending. Lets the
+ * application idle between ticks.
+ */
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_stackNextDeadline(
+                            struct a2b_StackContext* ctx);
+
 /** This call will search for a plugin to handle a node. */
 A2B_DSO_PUBLIC a2b_HResult A2B_CALL a2b_stackFindHandler(
                                      struct a2b_StackContext*       ctx,
@@ -105,6 +162,25 @@ A2B_DSO_PUBLIC a2b_HResult A2B_CALL a2b_stackFreeSlaveNodeHandler(
  */
 A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_stackGetMinHeapSize(
                                                         a2b_Byte* heapStart);
+
+/**
+ * Returns the usage of each memory pool of the stack's heap in ascending
+ * block size order. Returns zero when the PAL replaced the built-in
+ * memory manager.
+ */
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_stackGetHeapStats(
+                                        struct a2b_StackContext*    ctx,
+                                        a2b_HeapPoolStats*          stats,
+                                        a2b_UInt32                  maxStats);
+
+/**
+ * Returns the entries of the pool table (A2B_POOL_TABLE) the stack
+ * heaps are built from. Used to emit a table sized from the measured
+ * high watermarks, see #A2B_CONF_POOL_TABLE_HEADER.
+ */
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_stackGetHeapPoolTable(
+                                        a2b_HeapPoolEntry*  entries,
+                                        a2b_UInt32          maxEntries);
 #endif
 
 /*----------------------------------------------------------------------------*/
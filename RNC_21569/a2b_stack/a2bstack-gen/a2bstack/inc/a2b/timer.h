@@ -35,6 +35,9 @@
 
 /*======================= D E F I N E S ===========================*/
 
+/** Returned by #a2b_timerNextDeadline() when no timer is active */
+#define A2B_TIMER_NO_DEADLINE   (0xFFFFFFFFu)
+
 /*======================= D A T A T Y P E S =======================*/
 
 A2B_BEGIN_DECLS
@@ -74,6 +77,10 @@ A2B_DSO_PUBLIC void A2B_CALL a2b_timerStop(struct a2b_Timer* timer);
 
 A2B_DSO_PUBLIC a2b_Bool A2B_CALL a2b_timerIsActive(struct a2b_Timer* timer);
 A2B_DSO_PUBLIC void a2b_ActiveDelay(struct a2b_StackContext* ctx, a2b_UInt32 nTime);
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_timerGetSysTime(
+                                            struct a2b_StackContext* ctx);
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_timerNextDeadline(
+                                            struct a2b_StackContext* ctx);
 
 A2B_END_DECLS
 
@@ -51,6 +51,79 @@
 #define A2B_TRC_LVL_MASK        (0xFFFu)
 #define A2B_TRC_DOM_MASK        (0xFFFFF000u)
 
+/*----------------------------------------------------------------------------*/
+/**
+ * \name    Binary Trace Format
+ *
+ * With #A2B_FEATURE_TRACE_BINARY a trace message is stored as a record of
+ * 32-bit words in a RAM ring:
+ *
+ *   header, time (msec), level, line, file, function, format, arguments
+ *
+ * File, function and format are addresses (#A2B_TRCBIN_PTR_WORDS words
+ * each). Arguments are stored by value in the order of the format
+ * conversions: 8/16/32-bit integers in one word, 64-bit integers and
+ * pointers (%p, %s) in two words low first when they are wider than 32
+ * bits. A message injected with a2b_traceInject() carries its text
+ * inline (#A2B_TRCBIN_FLAG_TEXT): a byte count and the bytes padded to a
+ * word replace the format address. An I2C transfer (#A2B_TRCBIN_FLAG_I2C)
+ * is stored as operation and address, write and read byte counts, result
+ * and the first #A2B_TRCBIN_I2C_DATA_BYTES bytes written, and read, in
+ * place of the format and arguments; the host formats the data bytes.
+ *
+ * a2b_traceBinDump() writes a header (magic, version, pointer words,
+ * record words, dropped messages, 0), the records oldest first, the
+ * strings they refer to (#A2B_TRCBIN_STR_MAGIC, address, byte count,
+ * bytes padded to a word) and a terminating #A2B_TRCBIN_END word. Words
+ * are in the byte order of the target.
+ */
+/*----------------------------------------------------------------------------*/
+#define A2B_TRCBIN_MAGIC        (0x54423241u)   /*!< "A2BT" */
+#define A2B_TRCBIN_VERSION      (2u)
+#define A2B_TRCBIN_STR_MAGIC    (0x52545341u)   /*!< "ASTR" */
+#define A2B_TRCBIN_END          (0u)
+#define A2B_TRCBIN_HDR_WORDS    (6u)
+
+#define A2B_TRCBIN_REC_SYNC     (0xA2u)
+#define A2B_TRCBIN_REC(nWords, flags) \
+            ((A2B_TRCBIN_REC_SYNC << 24u) | ((flags) << 16u) | (nWords))
+#define A2B_TRCBIN_REC_IS_VALID(hdr)    (((hdr) >> 24u) == A2B_TRCBIN_REC_SYNC)
+#define A2B_TRCBIN_REC_WORDS(hdr)       ((hdr) & 0xFFFFu)
+#define A2B_TRCBIN_REC_FLAGS(hdr)       (((hdr) >> 16u) & 0xFFu)
+#define A2B_TRCBIN_FLAG_PAD     (0x01u)         /*!< Ring filler, not dumped */
+#define A2B_TRCBIN_FLAG_TEXT    (0x02u)         /*!< Text stored inline */
+#define A2B_TRCBIN_FLAG_I2C     (0x04u)         /*!< I2C transfer */
+
+#define A2B_TRCBIN_PTR_WORDS    ((sizeof(a2b_UIntPtr) + 3u) / 4u)
+
+/** Word offsets in a record */
+#define A2B_TRCBIN_REC_HDR      (0u)
+#define A2B_TRCBIN_REC_TIME     (1u)
+#define A2B_TRCBIN_REC_LEVEL    (2u)
+#define A2B_TRCBIN_REC_LINE     (3u)
+#define A2B_TRCBIN_REC_FILE     (4u)
+
+/** Argument kinds of a format string, 3 bits per argument */
+#define A2B_TRCBIN_MAX_ARGS     (8u)
+#define A2B_TRCBIN_ARG_8        (1u)    /*!< %bu, %c, ...  */
+#define A2B_TRCBIN_ARG_16       (2u)    /*!< %hu, ...       */
+#define A2B_TRCBIN_ARG_32       (3u)    /*!< %u, %lu, ...   */
+#define A2B_TRCBIN_ARG_64       (4u)    /*!< %Lu, ...       */
+#define A2B_TRCBIN_ARG_PTR      (5u)    /*!< %p, %P         */
+#define A2B_TRCBIN_ARG_STR      (6u)    /*!< %s             */
+#define A2B_TRCBIN_DESC_KIND(desc, idx) (((desc) >> (3u * (idx))) & 0x7u)
+#define A2B_TRCBIN_DESC_COUNT(desc)     (((desc) >> 24u) & 0xFu)
+
+/** I2C transfers: operation in the upper half of the address word */
+#define A2B_TRCBIN_I2C_READ         (0u)
+#define A2B_TRCBIN_I2C_WRITE        (1u)
+#define A2B_TRCBIN_I2C_WRITE_READ   (2u)
+#define A2B_TRCBIN_I2C_DATA_BYTES   (8u)
+#define A2B_TRCBIN_I2C_WORDS        (A2B_TRCBIN_REC_FILE + \
+                                    (2u * A2B_TRCBIN_PTR_WORDS) + 3u + \
+                                    (2u * (A2B_TRCBIN_I2C_DATA_BYTES / 4u)))
+/** \} */
+
 /*----------------------------------------------------------------------------*/
 /** 
  * \name    Basic Trace 
@@ -231,6 +304,20 @@ A2B_DSO_PUBLIC void A2B_CALL a2b_trace8(
                 const a2b_Char* fmt, void* a1, void* a2, void* a3, void* a4,
                 void* a5, void* a6, void* a7, void* a8);
 
+#ifdef A2B_FEATURE_TRACE_BINARY
+
+/** Receives the bytes of a binary trace dump */
+typedef void (A2B_CALL * a2b_TraceBinWriteFunc)(a2b_Handle hnd,
+                                                const a2b_Byte* data,
+                                                a2b_UInt32 nBytes);
+
+A2B_DSO_PUBLIC void A2B_CALL a2b_traceBinDump(
+                                a2b_TraceBinWriteFunc   writeFunc,
+                                a2b_Handle              hnd);
+A2B_DSO_PUBLIC void A2B_CALL a2b_traceBinClear(void);
+
+#endif /* A2B_FEATURE_TRACE_BINARY */
+
 #endif /* A2B_FEATURE_TRACE */
 
 /** \} -- a2bstack_trace_funct */
@@ -42,6 +42,13 @@ A2B_BEGIN_DECLS
 /* Forward Declarations */
 struct a2b_StringBuffer;
 
+#if defined(A2B_FEATURE_TRACE_BINARY) || defined(A2B_FEATURE_SEQ_CHART_BINARY)
+/** Receives a binary dump (a2b_TraceBinWriteFunc, a2b_SeqChartBinWriteFunc) */
+typedef void (A2B_CALL * a2b_BinWriteFunc)(a2b_Handle         hnd,
+                                           const a2b_Byte*    data,
+                                           a2b_UInt32         nBytes);
+#endif
+
 /*======================= P U B L I C  P R O T O T Y P E S ========*/
 
 /*----------------------------------------------------------------------------*/
@@ -59,6 +66,13 @@ A2B_DSO_PUBLIC a2b_UInt8 A2B_CALL a2b_crc8Cont(const a2b_UInt8* dataArr,
                                                  a2b_UInt8      initCrc8,
                                                  a2b_UInt32     startIdx,
                                                  a2b_UInt32     crcLen);
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_crc32(const a2b_UInt8* dataArr,
+                                             a2b_UInt32     startIdx,
+                                             a2b_UInt32     crcLen);
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_crc32Cont(const a2b_UInt8* dataArr,
+                                                 a2b_UInt32     initCrc32,
+                                                 a2b_UInt32     startIdx,
+                                                 a2b_UInt32     crcLen);
 /** \} -- a2bstack_util_crc */
 
 /*----------------------------------------------------------------------------*/
@@ -103,8 +117,36 @@ A2B_DSO_PUBLIC a2b_Int A2B_CALL a2b_vsnprintfStringBuffer(
                                         const a2b_Char*             fmt,
                                         void**                      args,
                                         a2b_UInt16                  numArgs);
+#if defined(A2B_FEATURE_TRACE_BINARY) || defined(A2B_FEATURE_SEQ_CHART_BINARY)
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_vsnprintfArgKinds(const a2b_Char* fmt);
+#endif
 /** \} -- a2bstack_util_str */
 
+#if defined(A2B_FEATURE_TRACE_BINARY) || defined(A2B_FEATURE_SEQ_CHART_BINARY)
+/*----------------------------------------------------------------------------*/
+/** 
+ * \defgroup a2bstack_util_bin          Binary Record Functions
+ *  
+ * These functions are shared by the binary trace and sequence chart
+ * records and dumps.
+ *
+ * \{ */
+/*----------------------------------------------------------------------------*/
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL a2b_binPutPtr(a2b_UInt32*    rec,
+                                                 a2b_UInt32     pos,
+                                                 const void*    ptr);
+A2B_DSO_PUBLIC a2b_UIntPtr A2B_CALL a2b_binGetPtr(const a2b_UInt32* rec,
+                                                  a2b_UInt32        pos);
+A2B_DSO_PUBLIC void A2B_CALL a2b_binDumpStr(a2b_BinWriteFunc    writeFunc,
+                                            a2b_Handle          hnd,
+                                            a2b_UIntPtr         addr,
+                                            a2b_Bool            baseName,
+                                            a2b_UIntPtr*        known,
+                                            a2b_UInt32          maxKnown,
+                                            a2b_UInt32*         nStrings);
+/** \} -- a2bstack_util_bin */
+#endif
+
 A2B_END_DECLS
 
 /*======================= D A T A =================================*/
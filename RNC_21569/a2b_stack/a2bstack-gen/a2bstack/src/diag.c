@@ -46,6 +46,8 @@
 /*======================= L O C A L  P R O T O T Y P E S  =========*/
 static a2b_Bool a2b_diagIsValidRegister(a2b_Int16 nodeAddr,
     a2b_UInt8   reg, a2b_UInt8   value, a2b_Char    mode);
+static a2b_HResult a2b_diagSnapNode(struct a2b_StackContext* mCtx,
+    a2b_Int16 nodeAddr, a2b_UInt8* regs, a2b_UInt8* numRegs);
 
 
 /*======================= D A T A  ================================*/
@@ -744,3 +746,267 @@ a2b_diagGetRegDump
 
 } /* a2b_diagGetRegDump */
 
+
+/*!****************************************************************************
+*  \ingroup     a2bstack_diag_priv
+*
+*  \b           a2b_diagSnapNode
+*
+*  Captures the register map of one node with two burst reads, the
+*  registers before and after #A2B_REG_INTTYPE. The chip type, and so the
+*  last register, is taken from VENDOR/PRODUCT in the first burst.
+*
+*  \param   [in]        mCtx        The master plugin context.
+*
+*  \param   [in]        nodeAddr    The address of the node to access.
+*
+*  \param   [in,out]    regs        #A2B_DIAG_SNAP_REGS bytes receiving the
+*                                   registers from offset 0.
+*
+*  \param   [out]       numRegs     Registers captured, zero on failure.
+*
+*  \pre     None
+*
+*  \post    None
+*
+*  \return  A status code that can be checked with the #A2B_SUCCEEDED() or
+*           #A2B_FAILED() for success or failure of the request.
+*
+******************************************************************************/
+static a2b_HResult
+a2b_diagSnapNode
+    (
+    struct a2b_StackContext*    mCtx,
+    a2b_Int16                   nodeAddr,
+    a2b_UInt8*                  regs,
+    a2b_UInt8*                  numRegs
+    )
+{
+    a2b_HResult result;
+    a2b_Byte wBuf[1];
+    a2b_UInt8 maxRegOffset;
+
+    *numRegs = 0u;
+
+    wBuf[0] = 0u;
+    if ( A2B_NODEADDR_MASTER == nodeAddr )
+    {
+        result = a2b_i2cMasterWriteRead(mCtx, 1u, &wBuf[0],
+                                        (a2b_UInt16)A2B_REG_INTTYPE, &regs[0]);
+    }
+    else
+    {
+        result = a2b_i2cSlaveWriteRead(mCtx, nodeAddr, 1u, &wBuf[0],
+                                       (a2b_UInt16)A2B_REG_INTTYPE, &regs[0]);
+    }
+
+    if ( A2B_SUCCEEDED(result) )
+    {
+        if ( A2B_IS_AD242X_CHIP(regs[A2B_REG_VENDOR], regs[A2B_REG_PRODUCT]) )
+        {
+            maxRegOffset = A2B_REG_MBOX1B3;
+        }
+        else
+        {
+            maxRegOffset = A2B_REG_GENERR;
+        }
+
+        /* Reading INTTYPE would clear the pending interrupt */
+        regs[A2B_REG_INTTYPE] = 0u;
+
+        wBuf[0] = (a2b_Byte)A2B_REG_INTTYPE + 1u;
+        if ( A2B_NODEADDR_MASTER == nodeAddr )
+        {
+            result = a2b_i2cMasterWriteRead(mCtx, 1u, &wBuf[0],
+                            (a2b_UInt16)maxRegOffset - (a2b_UInt16)A2B_REG_INTTYPE,
+                            &regs[A2B_REG_INTTYPE + 1u]);
+        }
+        else
+        {
+            result = a2b_i2cSlaveWriteRead(mCtx, nodeAddr, 1u, &wBuf[0],
+                            (a2b_UInt16)maxRegOffset - (a2b_UInt16)A2B_REG_INTTYPE,
+                            &regs[A2B_REG_INTTYPE + 1u]);
+        }
+
+        if ( A2B_SUCCEEDED(result) )
+        {
+            *numRegs = maxRegOffset + 1u;
+        }
+    }
+
+    return result;
+
+} /* a2b_diagSnapNode */
+
+
+/*!****************************************************************************
+*
+*  \b   a2b_diagSnapshot
+*
+*  Captures the register map of the master and the first 'numSlaves' slave
+*  nodes into a snapshot that can later be compared with
+*  #a2b_diagSnapshotDiff(). Each node is read with two burst reads (see
+*  #a2b_diagGetRegDump() for the A2B_REG_INTTYPE exception) instead of
+*  register by register. A node that does not respond is recorded with no
+*  registers and the capture goes on with the next node. Only the
+*  application and the master plugin can take a snapshot.
+*
+*  \param   [in]        ctx         The stack context associated with the
+*                                   snapshot request.
+*
+*  \param   [in]        numSlaves   Number of slave nodes to capture.
+*
+*  \param   [in,out]    snap        The snapshot to fill in.
+*
+*  \pre     A2B discovery has already been conducted successfully.
+*
+*  \post    None
+*
+*  \return  A status code that can be checked with the #A2B_SUCCEEDED() or
+*           #A2B_FAILED() for success or failure of the request. A failure
+*           reading a node is returned once all nodes have been read.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_HResult
+a2b_diagSnapshot
+    (
+    struct a2b_StackContext*    ctx,
+    a2b_UInt8                   numSlaves,
+    a2b_DiagSnapshot*           snap
+    )
+{
+    a2b_HResult result = A2B_RESULT_SUCCESS;
+    a2b_HResult nodeResult;
+    struct a2b_StackContext* mCtx;
+    a2b_UInt8 idx;
+
+    /* If the basic input arguments are incorrect then ... */
+    if ( (A2B_NULL == ctx) ||
+        (A2B_NULL == snap) ||
+        (numSlaves > A2B_CONF_MAX_NUM_SLAVE_NODES) )
+    {
+        result = A2B_MAKE_HRESULT(A2B_SEV_FAILURE, A2B_FAC_DIAG,
+                                  A2B_EC_INVALID_PARAMETER);
+    }
+    /* Slave plugins may only read the node they manage */
+    else if ( (ctx->domain == A2B_DOMAIN_PLUGIN) &&
+            (ctx->ccb.plugin.nodeSig.nodeAddr != A2B_NODEADDR_MASTER) )
+    {
+        result =  A2B_MAKE_HRESULT(A2B_SEV_FAILURE,
+                                    A2B_FAC_DIAG,
+                                    A2B_EC_PERMISSION);
+    }
+    else
+    {
+        /* Need a master plugin context to do I2C calls */
+        mCtx = a2b_stackContextFind(ctx, A2B_NODEADDR_MASTER);
+        if ( A2B_NULL == mCtx )
+        {
+            /* This should *never* happen */
+            result =  A2B_MAKE_HRESULT(A2B_SEV_FAILURE,
+                                        A2B_FAC_DIAG,
+                                        A2B_EC_INTERNAL);
+        }
+        else
+        {
+            (void)a2b_memset(snap, 0, sizeof(*snap));
+            snap->numNodes = numSlaves + 1u;
+
+            /* The master first, then the slave nodes in order */
+            for ( idx = 0u; idx < snap->numNodes; idx++ )
+            {
+                nodeResult = a2b_diagSnapNode(mCtx,
+                                    (a2b_Int16)idx + A2B_NODEADDR_MASTER,
+                                    &snap->regs[idx][0], &snap->numRegs[idx]);
+                if ( A2B_FAILED(nodeResult) )
+                {
+                    result = nodeResult;
+                }
+            }
+        }
+    }
+
+    return result;
+
+} /* a2b_diagSnapshot */
+
+
+/*!****************************************************************************
+*
+*  \b   a2b_diagSnapshotDiff
+*
+*  Lists the registers that differ between two snapshots taken with
+*  #a2b_diagSnapshot(), node by node in register order. A register that is
+*  missing from one of the snapshots (the node did not respond, or is not
+*  in it) compares as zero.
+*
+*  \param   [in]        before      The older snapshot.
+*
+*  \param   [in]        after       The newer snapshot.
+*
+*  \param   [in,out]    diffs       Buffer receiving the first 'maxDiffs'
+*                                   differences. May be A2B_NULL to only
+*                                   count them.
+*
+*  \param   [in]        maxDiffs    Number of entries in 'diffs'.
+*
+*  \pre     None
+*
+*  \post    None
+*
+*  \return  The number of differing registers, which can be larger than
+*           'maxDiffs'.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt16
+a2b_diagSnapshotDiff
+    (
+    const a2b_DiagSnapshot*     before,
+    const a2b_DiagSnapshot*     after,
+    a2b_DiagRegDiff*            diffs,
+    a2b_UInt16                  maxDiffs
+    )
+{
+    a2b_UInt16 numDiffs = 0u;
+    a2b_UInt8 idx;
+    a2b_UInt8 numNodes;
+    a2b_UInt16 reg;
+    a2b_UInt16 numRegs;
+    a2b_UInt8 valBefore;
+    a2b_UInt8 valAfter;
+
+    if ( (A2B_NULL == before) || (A2B_NULL == after) )
+    {
+        return 0u;
+    }
+
+    numNodes = A2B_MAX(before->numNodes, after->numNodes);
+    numNodes = A2B_MIN(numNodes, (a2b_UInt8)(A2B_CONF_MAX_NUM_SLAVE_NODES + 1u));
+
+    for ( idx = 0u; idx < numNodes; idx++ )
+    {
+        numRegs = A2B_MAX(before->numRegs[idx], after->numRegs[idx]);
+        for ( reg = 0u; reg < numRegs; reg++ )
+        {
+            valBefore = (reg < before->numRegs[idx]) ?
+                                before->regs[idx][reg] : 0u;
+            valAfter = (reg < after->numRegs[idx]) ?
+                                after->regs[idx][reg] : 0u;
+            if ( valBefore != valAfter )
+            {
+                if ( (A2B_NULL != diffs) && (numDiffs < maxDiffs) )
+                {
+                    diffs[numDiffs].nodeAddr = (a2b_Int16)idx +
+                                                A2B_NODEADDR_MASTER;
+                    diffs[numDiffs].reg = (a2b_UInt8)reg;
+                    diffs[numDiffs].before = valBefore;
+                    diffs[numDiffs].after = valAfter;
+                }
+                numDiffs++;
+            }
+        }
+    }
+
+    return numDiffs;
+
+} /* a2b_diagSnapshotDiff */
@@ -38,6 +38,9 @@
 #include "a2bstack/inc/a2b/msgrtr.h"
 #include "a2bstack/inc/a2b/stringbuffer.h"
 #include "a2bstack/inc/a2b/seqchart.h"
+#include "a2bstack/inc/a2b/seqchartctl.h"
+#include "seqchart_priv.h"
+#include "trace_priv.h"
 #include "stack_priv.h"
 #include "i2c_priv.h"
 #include "stackctx.h"
@@ -47,12 +50,22 @@
 #define A2B_I2C_TEMP_BUF_SIZE   (64)
 #define A2B_I2C_DATA_ARGS       (8)
 
+/* Binary sequence charts record the transfer, text ones format it here */
+#if defined(A2B_FEATURE_SEQ_CHART) && !defined(A2B_FEATURE_SEQ_CHART_BINARY)
+#define A2B_I2C_SEQ_CHART_TEXT
+#endif
+
+/* Likewise for the binary trace */
+#if defined(A2B_FEATURE_TRACE) && !defined(A2B_FEATURE_TRACE_BINARY)
+#define A2B_I2C_TRACE_TEXT
+#endif
+
 /*======================= L O C A L  P R O T O T Y P E S  =========*/
-#if defined(A2B_FEATURE_TRACE) || defined(A2B_FEATURE_SEQ_CHART)
+#if defined(A2B_I2C_TRACE_TEXT) || defined(A2B_I2C_SEQ_CHART_TEXT)
 static a2b_Char* a2b_i2cFormatString(a2b_Char* buf,
     a2b_UInt32  bufLen, const a2b_Char* fmt, void**  args,
     a2b_UInt16  numArgs, const a2b_Byte* data, a2b_UInt16 nBytes);
-#endif  /* A2B_FEATURE_TRACE || A2B_FEATURE_SEQ_CHART */
+#endif  /* A2B_I2C_TRACE_TEXT || A2B_I2C_SEQ_CHART_TEXT */
 static a2b_HResult a2b_i2cRead(a2b_StackContext* ctx,
     a2b_UInt16 addr, a2b_UInt16 nRead, a2b_Byte* rBuf);
 static a2b_HResult a2b_i2cWrite(a2b_StackContext* ctx,
@@ -89,7 +102,7 @@ a2b_i2cGenericWrite
 
 /*==================== C O D E =================================*/
 
-#if defined(A2B_FEATURE_TRACE) || defined(A2B_FEATURE_SEQ_CHART)
+#if defined(A2B_I2C_TRACE_TEXT) || defined(A2B_I2C_SEQ_CHART_TEXT)
 
 /*!****************************************************************************
 *  \ingroup         a2bstack_i2c_priv
@@ -173,7 +186,7 @@ a2b_i2cFormatString
 
 } /* a2b_i2cFormatString */
 
-#endif  /* A2B_FEATURE_TRACE || A2B_FEATURE_SEQ_CHART */
+#endif  /* A2B_I2C_TRACE_TEXT || A2B_I2C_SEQ_CHART_TEXT */
 
 
 /*!****************************************************************************
@@ -215,8 +228,10 @@ a2b_i2cRead
                                                 nRead, rBuf);
 
 #if defined(A2B_FEATURE_TRACE) || defined(A2B_FEATURE_SEQ_CHART)
+#if defined(A2B_I2C_TRACE_TEXT) || defined(A2B_I2C_SEQ_CHART_TEXT)
     a2b_Char    buf[A2B_I2C_TEMP_BUF_SIZE];
     void*       args[3u];
+#endif
 
 #ifdef A2B_FEATURE_SEQ_CHART
     a2b_UInt32  callOrigin;
@@ -226,11 +241,20 @@ a2b_i2cRead
     a2b_UInt32  trcMask = A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE2;
 #endif
 
+#if defined(A2B_I2C_TRACE_TEXT) || defined(A2B_I2C_SEQ_CHART_TEXT)
     args[0U] = &addr;
     args[1U] = &result;
     args[2U] = A2B_NULL;
+#endif
 
-#ifdef A2B_FEATURE_TRACE
+#ifdef A2B_FEATURE_TRACE_BINARY
+    if ( A2B_FAILED(result) )
+    {
+        trcMask |= A2B_TRC_LVL_ERROR;
+    }
+    A2B_TRACE_I2C((ctx, trcMask, A2B_TRCBIN_I2C_READ, addr,
+                   0u, A2B_NULL, nRead, rBuf, result));
+#elif defined(A2B_FEATURE_TRACE)
     if ( A2B_SUCCEEDED(result) )
     {
         (void)a2b_i2cFormatString(buf, A2B_ARRAY_SIZE(buf),
@@ -247,14 +271,18 @@ a2b_i2cRead
 #endif  /* A2B_FEATURE_TRACE */
 
 #ifdef A2B_FEATURE_SEQ_CHART
-    args[0] = &addr;
-    args[1] = &nRead;
-    args[2] = &result;
     callOrigin = (a2b_UInt32)((a2b_UInt32)(ctx->domain == A2B_DOMAIN_APP) ?
                         A2B_SEQ_CHART_ENTITY_APP :
                         A2B_NODE_ADDR_TO_CHART_PLUGIN_ENTITY(
                             ctx->ccb.plugin.nodeSig.nodeAddr));
 
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+    a2b_seqChartI2c(ctx, callOrigin, A2B_SEQBIN_I2C_READ, addr,
+                    0u, A2B_NULL, nRead, rBuf, result);
+#else
+    args[0] = &addr;
+    args[1] = &nRead;
+    args[2] = &result;
     (void)a2b_i2cFormatString(buf, A2B_ARRAY_SIZE(buf), "a2b_i2cRead(0x%02hX, %hu)",
                                 args, 2, A2B_NULL, 0);
     A2B_SEQ_CHART1((ctx,
@@ -281,6 +309,7 @@ a2b_i2cRead
                     A2B_SEQ_CHART_COMM_REPLY,
                     A2B_SEQ_CHART_LEVEL_I2C,
                     "%s", buf));
+#endif /* A2B_FEATURE_SEQ_CHART_BINARY */
 #endif /* A2B_FEATURE_SEQ_CHART */
 
 #endif /* A2B_FEATURE_TRACE || A2B_FEATURE_SEQ_CHART */
@@ -328,8 +357,10 @@ a2b_i2cWrite
                                                 nWrite, wBuf);
 
 #if defined(A2B_FEATURE_TRACE) || defined(A2B_FEATURE_SEQ_CHART)
+#if defined(A2B_I2C_TRACE_TEXT) || defined(A2B_I2C_SEQ_CHART_TEXT)
     a2b_Char    buf[A2B_I2C_TEMP_BUF_SIZE];
     void*       args[3u];
+#endif
 
 #ifdef A2B_FEATURE_SEQ_CHART
     a2b_UInt32  callOrigin;
@@ -339,11 +370,20 @@ a2b_i2cWrite
     a2b_UInt32  trcMask = A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE2;
 #endif
 
+#if defined(A2B_I2C_TRACE_TEXT) || defined(A2B_I2C_SEQ_CHART_TEXT)
     args[0u] = &addr;
     args[1u] = &result;
     args[2u] = A2B_NULL;
+#endif
 
-#ifdef A2B_FEATURE_TRACE
+#ifdef A2B_FEATURE_TRACE_BINARY
+    if ( A2B_FAILED(result) )
+    {
+        trcMask |= A2B_TRC_LVL_ERROR;
+    }
+    A2B_TRACE_I2C((ctx, trcMask, A2B_TRCBIN_I2C_WRITE, addr,
+                   nWrite, wBuf, 0u, A2B_NULL, result));
+#elif defined(A2B_FEATURE_TRACE)
     if ( A2B_SUCCEEDED(result) )
     {
         (void)a2b_i2cFormatString(buf, A2B_ARRAY_SIZE(buf),
@@ -360,14 +400,18 @@ a2b_i2cWrite
 #endif  /* A2B_FEATURE_TRACE */
 
 #ifdef A2B_FEATURE_SEQ_CHART
-    args[0] = &addr;
-    args[1] = &nWrite;
-    args[2] = &result;
     callOrigin = (a2b_UInt32)((a2b_UInt32)(ctx->domain == A2B_DOMAIN_APP) ?
                     A2B_SEQ_CHART_ENTITY_APP :
                     A2B_NODE_ADDR_TO_CHART_PLUGIN_ENTITY(
                         ctx->ccb.plugin.nodeSig.nodeAddr));
 
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+    a2b_seqChartI2c(ctx, callOrigin, A2B_SEQBIN_I2C_WRITE, addr,
+                    nWrite, wBuf, 0u, A2B_NULL, result);
+#else
+    args[0] = &addr;
+    args[1] = &nWrite;
+    args[2] = &result;
     (void)a2b_i2cFormatString(buf, A2B_ARRAY_SIZE(buf),
                 "a2b_i2cWrite(0x%02hX, %hu) -> ", args, 2, wBuf, nWrite);
     A2B_SEQ_CHART1((ctx,
@@ -395,6 +439,7 @@ a2b_i2cWrite
                     A2B_SEQ_CHART_COMM_REPLY,
                     A2B_SEQ_CHART_LEVEL_I2C,
                     "%s", buf));
+#endif  /* A2B_FEATURE_SEQ_CHART_BINARY */
 #endif  /* A2B_FEATURE_SEQ_CHART */
 
 
@@ -451,8 +496,10 @@ a2b_i2cWriteRead
                                                 nWrite, wBuf, nRead, rBuf);
 
 #if defined(A2B_FEATURE_SEQ_CHART) || defined(A2B_FEATURE_TRACE)
+#if defined(A2B_I2C_TRACE_TEXT) || defined(A2B_I2C_SEQ_CHART_TEXT)
     a2b_Char    buf[A2B_I2C_TEMP_BUF_SIZE];
     void*       args[4u];
+#endif
 
 #if defined(A2B_FEATURE_TRACE)
     a2b_UInt32  trcMask = A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE2;
@@ -462,12 +509,21 @@ a2b_i2cWriteRead
     a2b_UInt32  callOrigin;
 #endif  /* A2B_FEATURE_SEQ_CHART */
 
+#if defined(A2B_I2C_TRACE_TEXT) || defined(A2B_I2C_SEQ_CHART_TEXT)
     args[0u] = &addr;
     args[1u] = &result;
     args[2u] = A2B_NULL;
     args[3u] = A2B_NULL;
+#endif
 
-#ifdef A2B_FEATURE_TRACE
+#ifdef A2B_FEATURE_TRACE_BINARY
+    if ( A2B_FAILED(result) )
+    {
+        trcMask |= A2B_TRC_LVL_ERROR;
+    }
+    A2B_TRACE_I2C((ctx, trcMask, A2B_TRCBIN_I2C_WRITE_READ, addr,
+                   nWrite, wBuf, nRead, rBuf, result));
+#elif defined(A2B_FEATURE_TRACE)
     if ( A2B_SUCCEEDED(result) )
     {
         (void)a2b_i2cFormatString(buf, A2B_ARRAY_SIZE(buf),
@@ -489,14 +545,18 @@ a2b_i2cWriteRead
 #endif /* A2B_FEATURE_TRACE */
 
 #ifdef A2B_FEATURE_SEQ_CHART
-    args[0] = &addr;
-    args[1] = &nWrite;
-    args[2] = &nRead;
-    args[3] = &result;
     callOrigin = (a2b_UInt32)((a2b_UInt32)(ctx->domain == A2B_DOMAIN_APP) ?
                         A2B_SEQ_CHART_ENTITY_APP :
                         A2B_NODE_ADDR_TO_CHART_PLUGIN_ENTITY(
                             ctx->ccb.plugin.nodeSig.nodeAddr));
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+    a2b_seqChartI2c(ctx, callOrigin, A2B_SEQBIN_I2C_WRITE_READ, addr,
+                    nWrite, wBuf, nRead, rBuf, result);
+#else
+    args[0] = &addr;
+    args[1] = &nWrite;
+    args[2] = &nRead;
+    args[3] = &result;
     (void)a2b_i2cFormatString(buf, A2B_ARRAY_SIZE(buf),
                                 "a2b_i2cWriteRead(0x%02hX, %hu, %hu) -> ",
                                 args, 3, wBuf, nWrite);
@@ -525,6 +585,7 @@ a2b_i2cWriteRead
                     A2B_SEQ_CHART_COMM_REPLY,
                     A2B_SEQ_CHART_LEVEL_I2C,
                     "%s", buf));
+#endif  /* A2B_FEATURE_SEQ_CHART_BINARY */
 #endif  /* A2B_FEATURE_SEQ_CHART */
 
 #endif
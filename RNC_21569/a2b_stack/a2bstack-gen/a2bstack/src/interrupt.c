@@ -344,15 +344,20 @@ a2b_intrStopIrqPoll
 
 
 /*!****************************************************************************
+*  \ingroup         a2bstack_interrupt_priv
 *
-*  \b              a2b_intrQueryIrq
+*  \b               a2b_intrDispatch
 *
-*  This is called to trigger the stack to read/check the interrupt status
-*  of the master.  If interrupts are pending they will be processed.  At
-*  most #A2B_CONF_CONSECUTIVE_INTERRUPTS will be processed in a row before
-*  exiting this routine. 
+*  Emits the interrupt notifications for one interrupt read from the master
+*  and hands it to the slave plugin (GPIO interrupts) or the master plugin.
 *
-*  \param          [in]    ctx  A2B stack context
+*  \param          [in]    ctx          A2B stack context
+*
+*  \param          [in]    masterCtx    Master plugin context
+*
+*  \param          [in]    intSrc       Value read from A2B_REG_INTSRC
+*
+*  \param          [in]    intType      Value read from A2B_REG_INTTYPE
 *
 *  \pre            None
 *
@@ -362,219 +367,318 @@ a2b_intrStopIrqPoll
 *                  or #A2B_FAILED() for success or failure of the request.
 *
 ******************************************************************************/
-A2B_DSO_PUBLIC a2b_HResult
-a2b_intrQueryIrq
+static a2b_HResult
+a2b_intrDispatch
     (
-    struct a2b_StackContext*  ctx
+    struct a2b_StackContext*  ctx,
+    a2b_StackContext*         masterCtx,
+    a2b_UInt8                 intSrc,
+    a2b_UInt8                 intType
     )
 {
-    a2b_UInt16          idx;
-    a2b_UInt8           intSrc;
-    a2b_UInt8           intType;
-    a2b_UInt8           regOffset;
-    a2b_HResult         ret = A2B_RESULT_SUCCESS;
-    a2b_StackContext*   masterCtx;
     struct a2b_Msg*     notifyMsg;
     a2b_Interrupt*      interrupt;
     a2b_Bool            gpioIntrpt = A2B_FALSE;
     a2b_StackContext*   slaveCtx;
-    a2b_Bool 			bBreakLoop = A2B_FALSE;
-    a2b_UInt8 			nTempVar;
+    a2b_UInt8           nTempVar;
+    a2b_HResult         ret = A2B_RESULT_SUCCESS;
 
-    if ( A2B_NULL == ctx )
+    if ( (intType >= A2B_ENUM_INTTYPE_IO0PND) &&
+        (intType <= A2B_ENUM_INTTYPE_IO6PND) )
     {
-        ret = A2B_MAKE_HRESULT(A2B_SEV_FAILURE, A2B_FAC_INTERRUPT,
-                                A2B_EC_INVALID_PARAMETER);
+        gpioIntrpt = A2B_TRUE;
+    }
+
+    /* Allocate a notification message */
+    notifyMsg = a2b_msgAlloc(ctx,
+                                A2B_MSG_NOTIFY,
+                                A2B_MSGNOTIFY_INTERRUPT);
+
+    if ( A2B_NULL == notifyMsg )
+    {
+        A2B_TRACE0((ctx, (A2B_TRC_DOM_STACK |
+                A2B_TRC_LVL_ERROR),
+                "a2b_intrQueryIrq: "
+                "failed to allocate notification"));
     }
     else
     {
-        masterCtx = a2b_stackContextFind(ctx, A2B_NODEADDR_MASTER);
-        
-        /* Process up to A2B_CONF_CONSECUTIVE_INTERRUPTS at once.
-         */
-        for ( idx = 0u; idx < A2B_CONF_CONSECUTIVE_INTERRUPTS; idx++ )
+    	nTempVar = intSrc & (a2b_UInt8)A2B_BITM_INTSRC_INODE;
+        interrupt = (a2b_Interrupt*)
+                        a2b_msgGetPayload(notifyMsg);
+        interrupt->intrType = intType;
+        interrupt->nodeAddr = (intSrc &
+                A2B_BITM_INTSRC_MSTINT) ?
+                A2B_NODEADDR_MASTER :
+                (a2b_Int16)(nTempVar);
+        /* Make best effort delivery of notification */
+        ret = a2b_msgRtrNotify(notifyMsg);
+        if ( A2B_FAILED(ret) )
         {
-            /* NOTE: This is tricky. You should only read INTSRC
-             * first to see if there is an interrupt pending. Only if there is
-             * one pending should you find out which type of the interrupt
-             * (INTTYPE). If all both registers are read
-             * at once there is a possibility an interrupt could occur *between*
-             * reading the two registers (which would not indicate an
-             * interrupt) and reading the INTTYPE registers (which will clear
-             * the register and thus possibly miss processing the
-             * interrupt that arrived in the middle of the two register reads).
-             */
-            regOffset = A2B_REG_INTSRC;
-            ret = a2b_i2cMasterWriteRead( masterCtx, 1u, &regOffset, 1u, &intSrc);
+            A2B_TRACE1((ctx,
+                (A2B_TRC_DOM_STACK | A2B_TRC_LVL_ERROR),
+                "a2b_intrQueryIrq: failed to emit power "
+                "interrupt notification: 0x%lX",
+                &ret));
+        }
+
+        if ( gpioIntrpt )
+        {
+            ret = a2b_msgSetCmd(notifyMsg,
+                      A2B_MSGNOTIFY_GPIO_INTERRUPT);
             if ( A2B_FAILED(ret) )
             {
-                /* Read failure, move on */
-                A2B_TRACE0((ctx, (A2B_TRC_DOM_STACK |
-                            A2B_TRC_LVL_ERROR),
-                            "a2b_intrQueryIrq: "
-                            "failed to read A2B_REG_INTSRC"));
-                bBreakLoop = A2B_TRUE;
+                A2B_TRACE1((ctx,
+                    (A2B_TRC_DOM_STACK | A2B_TRC_LVL_ERROR),
+                    "a2b_intrQueryIrq: failed set GPIO "
+                    "interrupt notify command: 0x%lX",
+                    &ret));
             }
             else
             {
-                /* If neither the master or slave nodes triggered an
-                 * interrupt
-                 */
-                if ( 0u == (intSrc & (A2B_BITM_INTSRC_MSTINT |
-                    A2B_BITM_INTSRC_SLVINT)) )
-                {
-                    /* Else no interrupt detected - move on */
-                    bBreakLoop = A2B_TRUE;
-                }
-                else
+                ret = a2b_msgRtrNotify(notifyMsg);
+                if ( A2B_FAILED(ret) )
                 {
-                    regOffset = A2B_REG_INTTYPE;
-                    ret = a2b_i2cMasterWriteRead( masterCtx, 1u, &regOffset, 1u,
-                                                &intType );
-                    if ( A2B_FAILED(ret) )
-                    {
-                        /* Read failure, move on */
-                        A2B_TRACE0((ctx, (A2B_TRC_DOM_STACK |
-                                    A2B_TRC_LVL_ERROR),
-                                    "a2b_intrQueryIrq: "
-                                    "failed to read INTTYPE"));
-                        bBreakLoop = A2B_TRUE;
-                    }
-                    else
-                    {
-                        if ( (intType >= A2B_ENUM_INTTYPE_IO0PND) &&
-                            (intType <= A2B_ENUM_INTTYPE_IO6PND) )
-                        {
-                            gpioIntrpt = A2B_TRUE;
-                        }
-
-                        /* Allocate a notification message */
-                        notifyMsg = a2b_msgAlloc(ctx,
-                                                    A2B_MSG_NOTIFY,
-                                                    A2B_MSGNOTIFY_INTERRUPT);
-
-                        if ( A2B_NULL == notifyMsg )
-                        {
-                            A2B_TRACE0((ctx, (A2B_TRC_DOM_STACK |
-                                    A2B_TRC_LVL_ERROR),
-                                    "a2b_intrQueryIrq: "
-                                    "failed to allocate notification"));
-                        }
-                        else
-                        {
-                        	nTempVar = intSrc & (a2b_UInt8)A2B_BITM_INTSRC_INODE;
-                            interrupt = (a2b_Interrupt*)
-                                            a2b_msgGetPayload(notifyMsg);
-                            interrupt->intrType = intType;
-                            interrupt->nodeAddr = (intSrc &
-                                    A2B_BITM_INTSRC_MSTINT) ?
-                                    A2B_NODEADDR_MASTER :
-                                    (a2b_Int16)(nTempVar);
-                            /* Make best effort delivery of notification */
-                            ret = a2b_msgRtrNotify(notifyMsg);
-                            if ( A2B_FAILED(ret) )
-                            {
-                                A2B_TRACE1((ctx,
-                                    (A2B_TRC_DOM_STACK | A2B_TRC_LVL_ERROR),
-                                    "a2b_intrQueryIrq: failed to emit power "
-                                    "interrupt notification: 0x%lX",
-                                    &ret));
-                            }
-
-                            if ( gpioIntrpt )
-                            {
-                                ret = a2b_msgSetCmd(notifyMsg,
-                                          A2B_MSGNOTIFY_GPIO_INTERRUPT);
-                                if ( A2B_FAILED(ret) )
-                                {
-                                    A2B_TRACE1((ctx,
-                                        (A2B_TRC_DOM_STACK | A2B_TRC_LVL_ERROR),
-                                        "a2b_intrQueryIrq: failed set GPIO "
-                                        "interrupt notify command: 0x%lX",
-                                        &ret));
-                                }
-                                else
-                                {
-                                    ret = a2b_msgRtrNotify(notifyMsg);
-                                    if ( A2B_FAILED(ret) )
-                                    {
-                                        A2B_TRACE1((ctx,
-                                        (A2B_TRC_DOM_STACK | A2B_TRC_LVL_ERROR),
-                                        "a2b_intrQueryIrq: failed to emit GPIO "
-                                        "interrupt notification: 0x%lX",
-                                        &ret));
-                                    }
-                                }
-                            }
-
-                            /* We no longer need this notification message */
-                            (void)a2b_msgUnref(notifyMsg);
-                        }
-
-                        /* We'll assume there is no available slave plugin */
-                        slaveCtx = A2B_NULL;
-
-                        /* See if it was a slave interrupt */
-                        if (intSrc & A2B_BITM_INTSRC_SLVINT)
-                        {
-                            /* Get the plugin context (if it exists) for the
-                             * slave node.intrSrc
-                             */
-                        	nTempVar = intSrc & (a2b_UInt8)A2B_BITM_INTSRC_INODE;
-                            slaveCtx = a2b_stackContextFind(masterCtx,
-                                             (a2b_Int16)(nTempVar));
-                        }
-
-
-                        /* If there is an associated slave plugin AND it's
-                         * a GPIO interrupt (only) then ...
-                         */
-                        if ((slaveCtx) &&
-                            (slaveCtx->ccb.plugin.pluginApi) &&
-                            (slaveCtx->ccb.plugin.pluginApi->interrupt) &&
-                            gpioIntrpt)
-                        {
-                            /* Slave plugins handle their own GPIO interrupts.
-                             * All other interrupts get directed to the master
-                             * plugin.
-                             */
-                            slaveCtx->ccb.plugin.pluginApi->interrupt(
-                                              slaveCtx,
-                                              slaveCtx->ccb.plugin.pluginHnd,
-                                              intSrc, intType);
-                        }
-                        /* Else the master plugin receives all the interrupts
-                         * that aren't handled by a slave plugin (e.g. slave
-                         * plugin only handles GPIO interrupts). This includes
-                         * interrupts for a slave node that does not have an
-                         * associated slave plugin.
-                         */
-                        else
-                        {
-                            /* Always tell the master plugin about
-                             * an interrupt
-                             */
-                            masterCtx->ccb.plugin.pluginApi->interrupt(
-                                            masterCtx,
-                                            masterCtx->ccb.plugin.pluginHnd,
-                                            intSrc, intType);
-                        }
-                    }
+                    A2B_TRACE1((ctx,
+                    (A2B_TRC_DOM_STACK | A2B_TRC_LVL_ERROR),
+                    "a2b_intrQueryIrq: failed to emit GPIO "
+                    "interrupt notification: 0x%lX",
+                    &ret));
                 }
             }
+        }
+
+        /* We no longer need this notification message */
+        (void)a2b_msgUnref(notifyMsg);
+    }
+
+    /* We'll assume there is no available slave plugin */
+    slaveCtx = A2B_NULL;
+
+    /* See if it was a slave interrupt */
+    if (intSrc & A2B_BITM_INTSRC_SLVINT)
+    {
+        /* Get the plugin context (if it exists) for the
+         * slave node.intrSrc
+         */
+    	nTempVar = intSrc & (a2b_UInt8)A2B_BITM_INTSRC_INODE;
+        slaveCtx = a2b_stackContextFind(masterCtx,
+                         (a2b_Int16)(nTempVar));
+    }
+
+
+    /* If there is an associated slave plugin AND it's
+     * a GPIO interrupt (only) then ...
+     */
+    if ((slaveCtx) &&
+        (slaveCtx->ccb.plugin.pluginApi) &&
+        (slaveCtx->ccb.plugin.pluginApi->interrupt) &&
+        gpioIntrpt)
+    {
+        /* Slave plugins handle their own GPIO interrupts.
+         * All other interrupts get directed to the master
+         * plugin.
+         */
+        slaveCtx->ccb.plugin.pluginApi->interrupt(
+                          slaveCtx,
+                          slaveCtx->ccb.plugin.pluginHnd,
+                          intSrc, intType);
+    }
+    /* Else the master plugin receives all the interrupts
+     * that aren't handled by a slave plugin (e.g. slave
+     * plugin only handles GPIO interrupts). This includes
+     * interrupts for a slave node that does not have an
+     * associated slave plugin.
+     */
+    else
+    {
+        /* Always tell the master plugin about
+         * an interrupt
+         */
+        masterCtx->ccb.plugin.pluginApi->interrupt(
+                        masterCtx,
+                        masterCtx->ccb.plugin.pluginHnd,
+                        intSrc, intType);
+    }
+
+    return ret;
+
+} /* a2b_intrDispatch */
+
+
+/*!****************************************************************************
+*  \ingroup         a2bstack_interrupt_priv
+*
+*  \b               a2b_intrDrain
+*
+*  Reads and processes pending master interrupts, at most
+*  #A2B_CONF_CONSECUTIVE_INTERRUPTS in a row.
+*
+*  INTSRC is normally read on its own and INTTYPE only once INTSRC shows a
+*  pending interrupt. Reading INTTYPE clears the interrupt, so reading both
+*  at once could clear an interrupt that arrives between the two bytes
+*  while INTSRC still reads as idle. When the caller knows an interrupt is
+*  pending (the IRQ pin is asserted), it is latched in both registers until
+*  INTTYPE is read and the first pair is fetched in a single burst.
+*
+*  \param          [in]    ctx          A2B stack context
+*
+*  \param          [in]    bPending     A2B_TRUE if an interrupt is known
+*                                       to be pending.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         A status code that can be checked with the #A2B_SUCCEEDED()
+*                  or #A2B_FAILED() for success or failure of the request.
+*
+******************************************************************************/
+static a2b_HResult
+a2b_intrDrain
+    (
+    struct a2b_StackContext*  ctx,
+    a2b_Bool                  bPending
+    )
+{
+    a2b_UInt16          idx;
+    a2b_UInt8           rBuf[2];
+    a2b_UInt8           regOffset;
+    a2b_HResult         ret = A2B_RESULT_SUCCESS;
+    a2b_StackContext*   masterCtx;
+
+    if ( A2B_NULL == ctx )
+    {
+        return A2B_MAKE_HRESULT(A2B_SEV_FAILURE, A2B_FAC_INTERRUPT,
+                                A2B_EC_INVALID_PARAMETER);
+    }
+
+    masterCtx = a2b_stackContextFind(ctx, A2B_NODEADDR_MASTER);
+
+    /* Process up to A2B_CONF_CONSECUTIVE_INTERRUPTS at once.
+     */
+    for ( idx = 0u; idx < A2B_CONF_CONSECUTIVE_INTERRUPTS; idx++ )
+    {
+        regOffset = A2B_REG_INTSRC;
+        if ( (0u == idx) && (bPending) )
+        {
+            /* INTSRC and INTTYPE are adjacent, one transfer reads both */
+            ret = a2b_i2cMasterWriteRead( masterCtx, 1u, &regOffset,
+                                          2u, &rBuf[0] );
+        }
+        else
+        {
+            ret = a2b_i2cMasterWriteRead( masterCtx, 1u, &regOffset,
+                                          1u, &rBuf[0] );
+        }
+        if ( A2B_FAILED(ret) )
+        {
+            /* Read failure, move on */
+            A2B_TRACE0((ctx, (A2B_TRC_DOM_STACK |
+                        A2B_TRC_LVL_ERROR),
+                        "a2b_intrQueryIrq: "
+                        "failed to read A2B_REG_INTSRC"));
+            break;
+        }
 
-            if(bBreakLoop)
+        /* If neither the master or slave nodes triggered an
+         * interrupt
+         */
+        if ( 0u == (rBuf[0] & (A2B_BITM_INTSRC_MSTINT |
+            A2B_BITM_INTSRC_SLVINT)) )
+        {
+            /* Else no interrupt detected - move on */
+            break;
+        }
+
+        if ( (0u != idx) || (!bPending) )
+        {
+            regOffset = A2B_REG_INTTYPE;
+            ret = a2b_i2cMasterWriteRead( masterCtx, 1u, &regOffset, 1u,
+                                          &rBuf[1] );
+            if ( A2B_FAILED(ret) )
             {
+                /* Read failure, move on */
+                A2B_TRACE0((ctx, (A2B_TRC_DOM_STACK |
+                            A2B_TRC_LVL_ERROR),
+                            "a2b_intrQueryIrq: "
+                            "failed to read INTTYPE"));
                 break;
             }
         }
+
+        ret = a2b_intrDispatch(ctx, masterCtx, rBuf[0], rBuf[1]);
     }
 
     return ret;
 
+} /* a2b_intrDrain */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_intrQueryIrq
+*
+*  This is called to trigger the stack to read/check the interrupt status
+*  of the master.  If interrupts are pending they will be processed.  At
+*  most #A2B_CONF_CONSECUTIVE_INTERRUPTS will be processed in a row before
+*  exiting this routine. 
+*
+*  \param          [in]    ctx  A2B stack context
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         A status code that can be checked with the #A2B_SUCCEEDED()
+*                  or #A2B_FAILED() for success or failure of the request.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_HResult
+a2b_intrQueryIrq
+    (
+    struct a2b_StackContext*  ctx
+    )
+{
+    return a2b_intrDrain(ctx, A2B_FALSE);
+
 } /* a2b_intrQueryIrq */
 
 
+/*!****************************************************************************
+*
+*  \b              a2b_intrServiceIrq
+*
+*  Called by an application driving the stack from the master IRQ pin
+*  instead of #a2b_intrStartIrqPoll(), once it has seen the pin asserted.
+*  The pending interrupt is fetched with one I2C transfer (INTSRC and
+*  INTTYPE in a single burst) and any further pending interrupts are
+*  drained as #a2b_intrQueryIrq() does.
+*
+*  \param          [in]    ctx  A2B stack context
+*
+*  \pre            The IRQ pin has been asserted since the last call. If
+*                  the interrupt was already taken by #a2b_intrQueryIrq()
+*                  the INTTYPE byte of the burst is discarded, but an
+*                  interrupt raised during that burst would be missed.
+*
+*  \post           None
+*
+*  \return         A status code that can be checked with the #A2B_SUCCEEDED()
+*                  or #A2B_FAILED() for success or failure of the request.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_HResult
+a2b_intrServiceIrq
+    (
+    struct a2b_StackContext*  ctx
+    )
+{
+    return a2b_intrDrain(ctx, A2B_TRUE);
+
+} /* a2b_intrServiceIrq */
+
+
 /*!****************************************************************************
 *
 *  \b              a2b_intrDestroy
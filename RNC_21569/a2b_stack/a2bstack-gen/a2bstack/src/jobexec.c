@@ -31,14 +31,118 @@
 
 /*======================= D E F I N E S ===========================*/
 
-#define A2B_MAX_SCHED_MASK_VALUE    (0x1FFu)
-
 /*======================= L O C A L  P R O T O T Y P E S  =========*/
 
+static void a2b_jobExecMakeReady(a2b_JobQueue* q);
+static void a2b_jobExecDefer(a2b_JobQueue* q);
+static void a2b_jobExecUnlink(a2b_JobQueue* q);
+
 /*======================= D A T A  ================================*/
 
 /*======================= C O D E =================================*/
 
+/*!****************************************************************************
+*  \ingroup        a2bstack_jobexec_priv
+* 
+*  \b              a2b_jobExecMakeReady
+*
+*  Puts the queue at the end of the ready list of its priority so its
+*  next job runs in the current or next scheduling pass.
+*
+*  \param          [in]    q        The job queue.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_jobExecMakeReady
+    (
+    a2b_JobQueue*   q
+    )
+{
+    if ( A2B_JOBQ_READY != q->readyState )
+    {
+        a2b_jobExecUnlink(q);
+        TAILQ_INSERT_TAIL(&q->executor->ready[q->priority], q, readyLink);
+        q->readyState = A2B_JOBQ_READY;
+    }
+} /* a2b_jobExecMakeReady */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_jobexec_priv
+* 
+*  \b              a2b_jobExecDefer
+*
+*  Parks a queue whose job asked to be run again on the deferred list
+*  until a2b_jobExecRelease() is called. A queue made ready by an event in
+*  the meantime stays ready.
+*
+*  \param          [in]    q        The job queue.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_jobExecDefer
+    (
+    a2b_JobQueue*   q
+    )
+{
+    if ( A2B_JOBQ_IDLE == q->readyState )
+    {
+        TAILQ_INSERT_TAIL(&q->executor->deferred, q, readyLink);
+        q->readyState = A2B_JOBQ_DEFERRED;
+    }
+} /* a2b_jobExecDefer */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_jobexec_priv
+* 
+*  \b              a2b_jobExecUnlink
+*
+*  Takes the queue off the ready or deferred list it is on.
+*
+*  \param          [in]    q        The job queue.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_jobExecUnlink
+    (
+    a2b_JobQueue*   q
+    )
+{
+    if ( A2B_JOBQ_READY == q->readyState )
+    {
+        TAILQ_REMOVE(&q->executor->ready[q->priority], q, readyLink);
+    }
+    else if ( A2B_JOBQ_DEFERRED == q->readyState )
+    {
+        TAILQ_REMOVE(&q->executor->deferred, q, readyLink);
+    }
+    else
+    {
+        /* Not on a list */
+    }
+    q->readyState = A2B_JOBQ_IDLE;
+} /* a2b_jobExecUnlink */
+
+
 /*!**************************************************************************** 
 *  \ingroup        a2bstack_jobexec_priv
 *  \private
@@ -65,14 +169,19 @@ a2b_jobExecAlloc
     )
 {
     a2b_JobExecutor* jobExec = A2B_NULL;
+    a2b_UInt32 prio;
 
     if ( A2B_NULL != ctx )
     {
         jobExec = (a2b_JobExecutor*)A2B_MALLOC(ctx->stk, sizeof(*jobExec));
         if ( A2B_NULL != jobExec )
         {
-            jobExec->schedMask = 1u;
             SLIST_INIT(&jobExec->listHead);
+            for ( prio = 0u; prio < A2B_JOB_NUM_PRIORITIES; prio++ )
+            {
+                TAILQ_INIT(&jobExec->ready[prio]);
+            }
+            TAILQ_INIT(&jobExec->deferred);
             jobExec->ctx = ctx;
         }
     }
@@ -132,9 +241,9 @@ a2b_jobExecFree
 *
 *  Allocates a job queue from the Job Executor. Each allocated job queue
 *  has an associated priority with a range from 0 - 4 where zero (0) is
-*  the highest priority and four (4) the lowest. The priority controls how
-*  frequently jobs from the given queue are scheduled during system "tick"
-*  processing. Jobs in the highest priority queue are executed on every tick.
+*  the highest priority and four (4) the lowest. Ready queues of a higher
+*  priority are always served before those of a lower priority; queues of
+*  the same priority take turns.
 *  Allocated queues are returned with a reference count equal to one (1).
 *
 *  \param          [in]    exec         The Job Executor to allocate a job
@@ -159,21 +268,15 @@ a2b_jobExecAllocQueue
     a2b_JobPriority         priority
     )
 {
-    static const a2b_UInt16 gsPriorityMasks[] = {
-                                        0x01FFu, /*!< 111111111 - Highest priority */
-                                        0x00AAu, /*!< 010101010 */
-                                        0x0049u, /*!< 001001001 */
-                                        0x0022u, /*!< 000100010 */
-                                        0x0010u  /*!< 000010000 - Lowest priority */
-                                        };
     a2b_JobQueue* queue = A2B_NULL;
 
-    if ( (a2b_UInt32)priority < (a2b_UInt32)A2B_ARRAY_SIZE(gsPriorityMasks) )
+    if ( (a2b_UInt32)priority < A2B_JOB_NUM_PRIORITIES )
     {
         queue = A2B_MALLOC(exec->ctx->stk, sizeof(*queue));
         if ( A2B_NULL != queue )
         {
-            queue->priorityMask = gsPriorityMasks[priority];
+            queue->priority = (a2b_UInt8)priority;
+            queue->readyState = A2B_JOBQ_IDLE;
             queue->action = A2B_EXEC_SUSPEND;
             queue->executor = exec;
             SIMPLEQ_INIT(&queue->qHead);
@@ -328,6 +431,7 @@ a2b_jobExecUnrefQueue
                  */
 
                 SLIST_REMOVE(&exec->listHead, q, a2b_JobQueue, link);
+                a2b_jobExecUnlink(q);
 
                 /* Free the queue itself. */
                 A2B_FREE(exec->ctx->stk, q);
@@ -347,8 +451,9 @@ a2b_jobExecUnrefQueue
 *  \b              a2b_jobExecSubmit
 *
 *  Submits a job to the specified job queue. The job is added to the end
-*  of the queue. It is assumed the job queue "owns" the job after it's been
-*  successfully submitted.
+*  of the queue. If the queue was empty it becomes ready and the job runs
+*  in the current or next scheduling pass. It is assumed the job queue
+*  "owns" the job after it's been successfully submitted.
 *
 *  \param          [in]    q        The job queue to receive the job.
 * 
@@ -376,6 +481,7 @@ a2b_jobExecSubmit
         {
             /* Make sure it's scheduled to be processed again */
             q->action = A2B_EXEC_SCHEDULE;
+            a2b_jobExecMakeReady(q);
         }
         /* Insert the job at the end of the queue */
         SIMPLEQ_INSERT_TAIL(&q->qHead, job, link);
@@ -394,10 +500,13 @@ a2b_jobExecSubmit
 *  \b              a2b_jobExecSchedule
 *
 *  This function should be called periodically to schedule jobs to be
-*  executed. Based on the priority of individual queues, the Job Executor
-*  will execute one job at the head of each ready queue. Jobs indicating
-*  they are finished processing are finalized and deallocated during the
-*  scheduling process.
+*  executed. The Job Executor runs the job at the head of the ready queues,
+*  highest priority first and queues of the same priority in turn, until
+*  no queue is ready or #A2B_CONF_SCHEDULER_JOB_BUDGET jobs have run. A
+*  queue made ready while the pass runs (a job submitted, completed or
+*  resumed) is served in the same pass. A queue whose job asks to run
+*  again waits for a2b_jobExecRelease(). Jobs indicating they are finished
+*  processing are finalized and deallocated during the scheduling process.
 *
 *  \param          [in]    exec     The Job Executor to schedule.
 *
@@ -415,55 +524,156 @@ a2b_jobExecSchedule
     )
 {
     a2b_JobQueue* q;
-    a2b_JobQueue* nextQ;
     a2b_Job* job;
     a2b_Int32 action;
+    a2b_UInt32 prio;
+    a2b_UInt32 budget = A2B_CONF_SCHEDULER_JOB_BUDGET;
 
     if ( A2B_NULL != exec )
     {
-        q = SLIST_FIRST(&exec->listHead);
-        while ( q != SLIST_END(&exec->listHead) )
+        while ( 0u < budget )
         {
+            /* Pick the first ready queue of the highest priority */
+            q = A2B_NULL;
+            for ( prio = 0u; prio < A2B_JOB_NUM_PRIORITIES; prio++ )
+            {
+                if ( !TAILQ_EMPTY(&exec->ready[prio]) )
+                {
+                    q = TAILQ_FIRST(&exec->ready[prio]);
+                    break;
+                }
+            }
+            if ( A2B_NULL == q )
+            {
+                break;
+            }
+            a2b_jobExecUnlink(q);
+
             /* Add a reference to the queue in case it's
              * unreferenced as part of the job processing.
              */
             a2b_jobExecRefQueue(q);
 
-            /* If it's the queue's turn to run then ... */
-            if ( (exec->schedMask & q->priorityMask) &&
-                ( A2B_EXEC_SCHEDULE == q->action) )
+            /* The queue may have been suspended or flushed since it was
+             * made ready.
+             */
+            if ( (A2B_EXEC_SCHEDULE == q->action) &&
+                 (!SIMPLEQ_EMPTY(&q->qHead)) )
             {
-                /* If the queue is not empty then ... */
-                if ( !SIMPLEQ_EMPTY(&q->qHead) )
-                {
-                    /* Grab the job at the head of the queue */
-                    job = SIMPLEQ_FIRST(&q->qHead);
+                /* Grab the job at the head of the queue */
+                job = SIMPLEQ_FIRST(&q->qHead);
 
-                    /* If the job provided an execute method then ... */
-                    if ( A2B_NULL != job->execute )
+                /* If the job provided an execute method then ... */
+                if ( A2B_NULL != job->execute )
+                {
+                    action = job->execute(job);
+                    budget--;
+                    if ( A2B_EXEC_SCHEDULE == action )
+                    {
+                        /* Run again on a later pass rather than spin */
+                        q->action = action;
+                        a2b_jobExecDefer(q);
+                    }
+                    else
                     {
-                        action = job->execute(job);
                         a2b_jobExecUpdate(q, action);
                     }
                 }
             }
 
-            /* Advance to the next job queue */
-            nextQ = SLIST_NEXT(q, link);
             /* The queue could be free here */
             (void)a2b_jobExecUnrefQueue(q);
-            q = nextQ;
         }
+    }
+} /* a2b_jobExecSchedule */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_jobexec_priv
+*  \private
+* 
+*  \b              a2b_jobExecRelease
+*
+*  Makes the queues whose job asked to run again ready. Called every
+*  #A2B_CONF_SCHEDULER_TICK_MULTIPLE msec of system time, which paces jobs
+*  that poll.
+*
+*  \param          [in]    exec     The Job Executor.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+A2B_DSO_LOCAL void
+a2b_jobExecRelease
+    (
+    struct a2b_JobExecutor* exec
+    )
+{
+    a2b_JobQueue* q;
+
+    if ( A2B_NULL != exec )
+    {
+        while ( !TAILQ_EMPTY(&exec->deferred) )
+        {
+            q = TAILQ_FIRST(&exec->deferred);
+            a2b_jobExecMakeReady(q);
+        }
+    }
+} /* a2b_jobExecRelease */
+
 
-        /* Advance the scheduling mask to the next position */
-        exec->schedMask = exec->schedMask << 1;
-        if ( exec->schedMask > A2B_MAX_SCHED_MASK_VALUE )
+/*!****************************************************************************
+*  \ingroup        a2bstack_jobexec_priv
+*  \private
+* 
+*  \b              a2b_jobExecPending
+*
+*  Returns whether the executor has work pending. Used to decide how long
+*  the stack can go without being ticked.
+*
+*  \param          [in]    exec     The Job Executor.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         #A2B_JOBQ_READY if a job can run now, #A2B_JOBQ_DEFERRED
+*                  if jobs wait for the next #a2b_jobExecRelease, otherwise
+*                  #A2B_JOBQ_IDLE.
+*
+******************************************************************************/
+A2B_DSO_LOCAL a2b_UInt32
+a2b_jobExecPending
+    (
+    struct a2b_JobExecutor* exec
+    )
+{
+    a2b_UInt32 prio;
+    a2b_UInt32 state = A2B_JOBQ_IDLE;
+
+    if ( A2B_NULL != exec )
+    {
+        for ( prio = 0u; prio < A2B_JOB_NUM_PRIORITIES; prio++ )
+        {
+            if ( !TAILQ_EMPTY(&exec->ready[prio]) )
+            {
+                state = A2B_JOBQ_READY;
+                break;
+            }
+        }
+
+        if ( (A2B_JOBQ_IDLE == state) && (!TAILQ_EMPTY(&exec->deferred)) )
         {
-            /* Reset the mask */
-            exec->schedMask = 1u;
+            state = A2B_JOBQ_DEFERRED;
         }
     }
-} /* a2b_jobExecSchedule */
+
+    return state;
+} /* a2b_jobExecPending */
 
 
 /*!****************************************************************************
@@ -545,16 +755,23 @@ a2b_jobExecUpdate
                 if ( !SIMPLEQ_EMPTY(&q->qHead) )
                 {
                     q->action = A2B_EXEC_SCHEDULE;
+                    a2b_jobExecMakeReady(q);
                 }
                 else
                 {
                     q->action = A2B_EXEC_SUSPEND;
+                    a2b_jobExecUnlink(q);
                 }
                 break;
 
             case A2B_EXEC_SCHEDULE:
+                q->action = action;
+                a2b_jobExecMakeReady(q);
+                break;
+
             case A2B_EXEC_SUSPEND:
                 q->action = action;
+                a2b_jobExecUnlink(q);
                 break;
 
             default:
@@ -39,10 +39,19 @@
 /*======================= I N C L U D E S =========================*/
 #include "a2bstack/inc/a2b/macros.h"
 #include "platform/a2b/ctypes.h"
+#include "a2bstack/inc/a2b/defs.h"
 #include "queue.h"
 
 /*======================= D E F I N E S ===========================*/
 
+/** Number of job queue priorities (#A2B_JOB_PRIO0 - #A2B_JOB_PRIO4) */
+#define A2B_JOB_NUM_PRIORITIES      ((a2b_UInt32)A2B_JOB_PRIO4 + 1u)
+
+/** Job queue ready states */
+#define A2B_JOBQ_IDLE               (0u) /*!< Not on a ready list         */
+#define A2B_JOBQ_READY              (1u) /*!< On the list of its priority */
+#define A2B_JOBQ_DEFERRED           (2u) /*!< Waiting for the next release */
+
 
 /*======================= D A T A T Y P E S =======================*/
 
@@ -54,6 +63,9 @@ struct a2b_JobExecutor;
 struct a2b_JobQueue;
 struct a2b_StackContext;
 
+/** A list of runnable job queues */
+TAILQ_HEAD(a2b_JobReadyHead, a2b_JobQueue);
+
 /**
  * Holds a sequence of jobs to be executed.
  */
@@ -65,10 +77,18 @@ typedef struct a2b_JobQueue
     SLIST_ENTRY(a2b_JobQueue)               link2;
 
     SIMPLEQ_HEAD(a2b_JobHead, a2b_Job)      qHead;
-    a2b_UInt16                              priorityMask;
     a2b_Int32                               action;
     struct a2b_JobExecutor*                 executor;
     a2b_UInt32                              refCnt;
+
+    /** Links the queue on a ready or the deferred list of the executor */
+    TAILQ_ENTRY(a2b_JobQueue)               readyLink;
+
+    /** The list the queue is on (A2B_JOBQ_xxx) */
+    a2b_UInt8                               readyState;
+
+    /** The priority (#a2b_JobPriority) of the queue */
+    a2b_UInt8                               priority;
 } a2b_JobQueue;
 
 /**
@@ -77,7 +97,15 @@ typedef struct a2b_JobQueue
 typedef struct a2b_JobExecutor
 {
     SLIST_HEAD(a2b_JobQHead, a2b_JobQueue)  listHead;
-    a2b_UInt16                              schedMask;
+
+    /** Queues with a job ready to run, one list per priority */
+    struct a2b_JobReadyHead                 ready[A2B_JOB_NUM_PRIORITIES];
+
+    /** Queues whose job asked to run again. They are made ready by
+     *  a2b_jobExecRelease().
+     */
+    struct a2b_JobReadyHead                 deferred;
+
     struct a2b_StackContext*                ctx;
 } a2b_JobExecutor;
 
@@ -111,6 +139,12 @@ A2B_EXPORT A2B_DSO_LOCAL a2b_Bool a2b_jobExecSubmit(
 A2B_EXPORT A2B_DSO_LOCAL void a2b_jobExecSchedule(
                                         struct a2b_JobExecutor* exec);
 
+A2B_EXPORT A2B_DSO_LOCAL void a2b_jobExecRelease(
+                                        struct a2b_JobExecutor* exec);
+
+A2B_EXPORT A2B_DSO_LOCAL a2b_UInt32 a2b_jobExecPending(
+                                        struct a2b_JobExecutor* exec);
+
 A2B_EXPORT A2B_DSO_LOCAL void a2b_jobExecUpdate(a2b_JobQueue* q,
                                         a2b_Int32 action);
 
@@ -46,6 +46,12 @@
 
 #define A2B_EXPAND_AS_POOL_DESCRIPTORS(a,b,c) {b, sizeof(c)},
 #define A2B_EXPAND_AS_ENUMERATION(a,b,c)      A2B_##a,
+#define A2B_EXPAND_AS_UNION_MEMBER(a,b,c)     c a;
+#define A2B_EXPAND_AS_POOL_ENTRY(a,b,c)       {#a, #c, b, sizeof(c), 0u},
+
+#ifdef A2B_CONF_POOL_TABLE_HEADER
+#include A2B_CONF_POOL_TABLE_HEADER
+#endif
 
 /*----------------------------------------------------------------------------*/
 /** 
@@ -55,9 +61,11 @@
  *  
  * This defines the pool sizes for the complete memory manager. 
  * It defines the block [typedef] size and the number of each to 
- * manage.
+ * manage. A platform can replace it with a table sized from measured
+ * high watermarks through #A2B_CONF_POOL_TABLE_HEADER.
  */
 /*----------------------------------------------------------------------------*/
+#ifndef A2B_POOL_TABLE
 #define A2B_POOL_TABLE(ENTRY) \
     /*    Name      Num Blocks                      Block Size          */ \
     /*    ==============================================================*/ \
@@ -71,6 +79,7 @@
     ENTRY(POOL_9,   A2B_CONF_MSG_POOL_SIZE,             a2b_Msg) \
     ENTRY(POOL_10,  A2B_CONF_MSG_NOTIFICATION_MAX,      a2b_MsgNotifier) \
     ENTRY(POOL_11,  A2B_CONF_MAX_NUM_MASTER_NODES,      a2b_IntrInfo)
+#endif
 
 
 /*======================= L O C A L  P R O T O T Y P E S  =========*/
@@ -81,6 +90,19 @@ enum {
     A2B_NUM_POOLS
 };
 
+/** Defined just to get the largest block size in the pool table */
+typedef union a2b_PoolBlock
+{
+    A2B_POOL_TABLE(A2B_EXPAND_AS_UNION_MEMBER)
+} a2b_PoolBlock;
+
+/** One size class per A2B_CONF_MEMORY_ALIGNMENT bytes up to the largest
+ *  block size.
+ */
+#define A2B_MEMMGR_NUM_SIZE_CLASSES \
+    (((sizeof(a2b_PoolBlock) + A2B_CONF_MEMORY_ALIGNMENT - 1u) / \
+      A2B_CONF_MEMORY_ALIGNMENT) + 1u)
+
 typedef struct a2b_PoolDescriptor
 {
     a2b_UInt32  numBlocks;
@@ -92,13 +114,26 @@ typedef struct a2b_PoolEntry
 {
     a2b_Pool    pool;
     a2b_UInt32  blockSize;
+
+    /** Requests this pool was the first choice for while exhausted */
+    a2b_UInt32  numMissed;
+
+    /** Of those, requests that no larger pool could serve either */
+    a2b_UInt32  numFailed;
 } a2b_PoolEntry;
 
 typedef struct a2b_StackHeap
 {
+    /** Pools in ascending block size and address order */
     a2b_PoolEntry   pools[A2B_NUM_POOLS];
     a2b_Int32       numPools;
     a2b_Bool        inUse;
+
+    /** Index of the smallest pool whose blocks hold the size class, or
+     *  numPools if none does. Indexed by the request size rounded up to
+     *  A2B_CONF_MEMORY_ALIGNMENT.
+     */
+    a2b_UInt8       sizeClass[A2B_MEMMGR_NUM_SIZE_CLASSES];
 } a2b_StackHeap;
 
 static a2b_Int32 a2b_memMgrNormPoolDescriptors(
@@ -106,6 +141,8 @@ static a2b_Int32 a2b_memMgrNormPoolDescriptors(
     a2b_Int32           numItems);
 static const a2b_PoolDescriptor* a2b_memMgrGetPoolDescriptors(
     a2b_Int32*  num);
+static void a2b_memMgrInitSizeClasses(
+    a2b_StackHeap*  stackHeap);
 /*======================= D A T A  ================================*/
 
 /*======================= C O D E =================================*/
@@ -229,6 +266,46 @@ a2b_memMgrGetPoolDescriptors
 } /* a2b_memMgrGetPoolDescriptors */
 
 
+/*!****************************************************************************
+*  \ingroup        a2bstack_memmgr_priv
+* 
+*  \b              a2b_memMgrInitSizeClasses
+*
+*  Builds the table that maps a request size to the smallest pool whose
+*  block size satisfies it, so an allocation does not have to search the
+*  pools.
+*
+*  \param          [in]    stackHeap    The stack heap with its pools created.
+*
+*  \pre            #A2B_FEATURE_MEMORY_MANAGER must be enabled
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_memMgrInitSizeClasses
+    (
+    a2b_StackHeap*  stackHeap
+    )
+{
+    a2b_UInt32 sizeIdx;
+    a2b_Int32 poolIdx = 0;
+
+    for ( sizeIdx = 0u; sizeIdx < A2B_MEMMGR_NUM_SIZE_CLASSES; ++sizeIdx )
+    {
+        while ( (poolIdx < stackHeap->numPools) &&
+                (stackHeap->pools[poolIdx].blockSize <
+                    (sizeIdx * A2B_CONF_MEMORY_ALIGNMENT)) )
+        {
+            poolIdx++;
+        }
+        stackHeap->sizeClass[sizeIdx] = (a2b_UInt8)poolIdx;
+    }
+} /* a2b_memMgrInitSizeClasses */
+
+
 /*!****************************************************************************
 *  \ingroup        a2bstack_memmgr_priv
 *  \private
@@ -396,11 +473,14 @@ a2b_memMgrOpen
                     break;
                 }
                 stackHeap->pools[poolIdx].blockSize = blockSize;
+                stackHeap->pools[poolIdx].numMissed = 0u;
+                stackHeap->pools[poolIdx].numFailed = 0u;
                 heap += blockSize * numBlocks;
             }
 
             if ( !allocFailed )
             {
+                a2b_memMgrInitSizeClasses(stackHeap);
                 stackHeap->inUse = A2B_TRUE;
             }
             break;
@@ -442,15 +522,21 @@ a2b_memMgrMalloc
     a2b_StackHeap* stackHeap = (a2b_StackHeap*)hnd;
     void* mem = A2B_NULL;
     a2b_Int32 idx;
+    a2b_Int32 first;
+    a2b_UInt32 sizeIdx;
 
     if ( A2B_NULL != stackHeap )
     {
-        /* Look for the pool with the smallest block size that will
-         * satisfy the memory request.
-         */
-        for ( idx = 0; idx < stackHeap->numPools; ++idx )
+        sizeIdx = (size + (A2B_CONF_MEMORY_ALIGNMENT - 1u)) /
+                  A2B_CONF_MEMORY_ALIGNMENT;
+        if ( sizeIdx < A2B_MEMMGR_NUM_SIZE_CLASSES )
         {
-            if ( size <= stackHeap->pools[idx].blockSize )
+            /* Start at the pool with the smallest block size that will
+             * satisfy the memory request. Larger pools are only tried
+             * when it is exhausted.
+             */
+            first = (a2b_Int32)stackHeap->sizeClass[sizeIdx];
+            for ( idx = first; idx < stackHeap->numPools; ++idx )
             {
                 mem = a2b_poolAlloc(&stackHeap->pools[idx].pool);
                 if ( A2B_NULL != mem )
@@ -458,6 +544,18 @@ a2b_memMgrMalloc
                     break;
                 }
             }
+
+            /* Charge a spill or failure to the best fitting pool so it
+             * shows which pool is undersized.
+             */
+            if ( (idx != first) && (first < stackHeap->numPools) )
+            {
+                stackHeap->pools[first].numMissed++;
+                if ( A2B_NULL == mem )
+                {
+                    stackHeap->pools[first].numFailed++;
+                }
+            }
         }
     }
 
@@ -493,20 +591,32 @@ a2b_memMgrFree
     )
 {
     a2b_StackHeap* stackHeap = (a2b_StackHeap*)hnd;
-    a2b_Int32 idx;
+    a2b_Int32 lo;
+    a2b_Int32 hi;
+    a2b_Int32 mid;
 
-    if ( A2B_NULL != stackHeap )
+    if ( (A2B_NULL != stackHeap) && (0 < stackHeap->numPools) )
     {
-        /* Look for the pool where the memory request came from
+        /* The pools are carved out of the heap in order, so look for the
+         * last pool starting at or below the pointer.
          */
-        for ( idx = 0; idx < stackHeap->numPools; ++idx )
+        lo = 0;
+        hi = stackHeap->numPools - 1;
+        while ( lo < hi )
         {
-            if ( a2b_poolContainsPtr(&stackHeap->pools[idx].pool, p) )
+            mid = (lo + hi + 1) / 2;
+            if ( stackHeap->pools[mid].pool.heapStart <= (a2b_Byte*)p )
             {
-                a2b_poolFree(&stackHeap->pools[idx].pool, p);
-                break;
+                lo = mid;
+            }
+            else
+            {
+                hi = mid - 1;
             }
         }
+
+        /* a2b_poolFree() ignores a pointer it does not own */
+        a2b_poolFree(&stackHeap->pools[lo].pool, p);
     }
 } /* a2b_memMgrFree */
 
@@ -560,6 +670,123 @@ a2b_memMgrClose
 } /* a2b_memMgrClose */
 
 
+/*!****************************************************************************
+*  \ingroup        a2bstack_memmgr_priv
+*  \private
+* 
+*  \b              a2b_memMgrGetStats
+*
+*  Reports the usage of each pool of the stack's heap: block size,
+*  capacity, current use, high watermark and the requests the pool could
+*  not serve. The pools are reported in ascending block size order.
+*
+*  \param          [in]    hnd          The handle of the stack's heap.
+* 
+*  \param          [out]   stats        The array receiving one entry per
+*                                       pool.
+* 
+*  \param          [in]    maxStats     The number of entries in the array.
+*
+*  \pre            #A2B_FEATURE_MEMORY_MANAGER must be enabled
+*
+*  \post           None
+*
+*  \return         The number of entries filled in.
+*
+******************************************************************************/
+A2B_DSO_LOCAL a2b_UInt32
+a2b_memMgrGetStats
+    (
+    a2b_Handle          hnd,
+    a2b_HeapPoolStats*  stats,
+    a2b_UInt32          maxStats
+    )
+{
+    a2b_StackHeap* stackHeap = (a2b_StackHeap*)hnd;
+    const a2b_PoolEntry* entry;
+    a2b_UInt32 idx;
+    a2b_UInt32 num = 0u;
+
+    if ( (A2B_NULL != stackHeap) && (stackHeap->inUse) && (A2B_NULL != stats) )
+    {
+        num = A2B_MIN((a2b_UInt32)stackHeap->numPools, maxStats);
+        for ( idx = 0u; idx < num; ++idx )
+        {
+            entry = &stackHeap->pools[idx];
+            stats[idx].blockSize = entry->blockSize;
+            stats[idx].numBlocks = entry->pool.numBlocks;
+            stats[idx].numInUse  = entry->pool.numBlocks - entry->pool.numFree;
+            stats[idx].maxInUse  = a2b_poolMaxAlloc(&entry->pool);
+            stats[idx].numMissed = entry->numMissed;
+            stats[idx].numFailed = entry->numFailed;
+        }
+    }
+
+    return num;
+} /* a2b_memMgrGetStats */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_memmgr_priv
+*  \private
+* 
+*  \b              a2b_memMgrGetPoolTable
+*
+*  Reports the entries of #A2B_POOL_TABLE in table order together with the
+*  index of the heap pool that serves each of them, so pool statistics can
+*  be mapped back to the table.
+*
+*  \param          [out]   entries      The array receiving one element per
+*                                       table entry.
+* 
+*  \param          [in]    maxEntries   The number of elements in the array.
+*
+*  \pre            #A2B_FEATURE_MEMORY_MANAGER must be enabled
+*
+*  \post           None
+*
+*  \return         The number of elements filled in.
+*
+******************************************************************************/
+A2B_DSO_LOCAL a2b_UInt32
+a2b_memMgrGetPoolTable
+    (
+    a2b_HeapPoolEntry*  entries,
+    a2b_UInt32          maxEntries
+    )
+{
+    static const a2b_HeapPoolEntry gsPoolTable[] =
+        { A2B_POOL_TABLE(A2B_EXPAND_AS_POOL_ENTRY) };
+    const a2b_PoolDescriptor* desc;
+    a2b_Int32 numDesc;
+    a2b_Int32 poolIdx;
+    a2b_UInt32 idx;
+    a2b_UInt32 num = 0u;
+
+    if ( A2B_NULL != entries )
+    {
+        desc = a2b_memMgrGetPoolDescriptors(&numDesc);
+        num = A2B_MIN((a2b_UInt32)A2B_ARRAY_SIZE(gsPoolTable), maxEntries);
+        for ( idx = 0u; idx < num; ++idx )
+        {
+            entries[idx] = gsPoolTable[idx];
+
+            /* The descriptors are merged by block size, one per pool */
+            for ( poolIdx = 0; poolIdx < numDesc; ++poolIdx )
+            {
+                if ( desc[poolIdx].blockSize == entries[idx].blockSize )
+                {
+                    break;
+                }
+            }
+            entries[idx].poolIdx = (a2b_UInt32)poolIdx;
+        }
+    }
+
+    return num;
+} /* a2b_memMgrGetPoolTable */
+
+
 /*!****************************************************************************
 *  \ingroup        a2bstack_memmgr_priv
 *  \private
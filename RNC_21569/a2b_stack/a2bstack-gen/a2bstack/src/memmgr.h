@@ -50,6 +50,7 @@
 #include "a2bstack/inc/a2b/macros.h"
 #include "platform/a2b/ctypes.h"
 #include "a2bstack/inc/a2b/ecb.h"
+#include "a2bstack/inc/a2b/stack.h"
 #include "platform/a2b/features.h"
 #include "pool.h"
 
@@ -74,6 +75,12 @@ A2B_EXPORT A2B_DSO_LOCAL void a2b_memMgrFree(a2b_Handle hnd,
                                             void* p);
 A2B_EXPORT A2B_DSO_LOCAL a2b_HResult a2b_memMgrClose(a2b_Handle hnd);
 A2B_EXPORT A2B_DSO_LOCAL a2b_HResult a2b_memMgrShutdown(A2B_ECB* ecb);
+A2B_EXPORT A2B_DSO_LOCAL a2b_UInt32 a2b_memMgrGetStats(a2b_Handle hnd,
+                                                a2b_HeapPoolStats* stats,
+                                                a2b_UInt32 maxStats);
+A2B_EXPORT A2B_DSO_LOCAL a2b_UInt32 a2b_memMgrGetPoolTable(
+                                                a2b_HeapPoolEntry* entries,
+                                                a2b_UInt32 maxEntries);
 
 A2B_END_DECLS
 
@@ -25,14 +25,55 @@
 #include "stack_priv.h"
 #include "a2bstack/inc/a2b/seqchart.h"
 #include "a2bstack/inc/a2b/util.h"
+#include "a2bstack/inc/a2b/trace.h"
 #include "stackctx.h"
 
 #ifdef A2B_FEATURE_SEQ_CHART
 
 /*======================= D E F I N E S ===========================*/
 
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+#if (A2B_CONF_CHAR_BIT != 8u)
+#error "The binary sequence chart dump expects 8-bit characters"
+#endif
+#if (A2B_CONF_SEQ_CHART_BIN_SIZE < 64u)
+#error "A2B_CONF_SEQ_CHART_BIN_SIZE must be at least 64 words"
+#endif
+
+/** Words kept free for the STOP record so a full capture still ends */
+#define A2B_SEQBIN_STOP_WORDS   (A2B_SEQBIN_REC_DATA)
+
+/** Longest inline text, as for a formatted line */
+#define A2B_SEQBIN_MAX_TEXT     (A2B_CONF_TRACE_BUF_SIZE - 1u)
+
+/** Distinct strings a dump writes only once */
+#define A2B_SEQBIN_DUMP_STRINGS (32u)
+#endif
+
+/*======================= D A T A T Y P E S =======================*/
+
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+/** The binary capture, filled from the start of a chart */
+typedef struct a2b_SeqChartBin
+{
+    a2b_UInt32  nWords;
+    a2b_UInt32  nDropped;
+    a2b_UInt32  words[A2B_CONF_SEQ_CHART_BIN_SIZE];
+} a2b_SeqChartBin;
+#endif
+
 /*======================= L O C A L  P R O T O T Y P E S  =========*/
 
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+static a2b_UInt32* a2b_seqChartBinRecord(struct a2b_StackContext* ctx,
+    a2b_UInt32 type, a2b_UInt32 entities, a2b_UInt32 level,
+    a2b_UInt32 nWords);
+static void a2b_seqChartBinMsg(struct a2b_StackContext* ctx,
+    a2b_UInt32 entities, a2b_UInt32 level, const a2b_Char* fmt,
+    void** args, a2b_UInt16 numArgs);
+static void a2b_seqChartBinText(struct a2b_StackContext* ctx,
+    a2b_UInt32 level, const a2b_Char* text);
+#else
 static void a2b_seqChartLog0(struct a2b_StackContext* ctx,
     const a2b_Char*             fmt);
 static void a2b_seqChartLog1(struct a2b_StackContext* ctx,
@@ -44,11 +85,22 @@ static void a2b_seqChartFooter(struct a2b_StackContext* ctx);
 static void a2b_seqChartPrefix(struct a2b_StackContext* ctx,
     a2b_SeqChartEntity src, a2b_SeqChartEntity dest,
     a2b_SeqChartCommType commType);
+#endif
+static void a2b_seqChartOutput(struct a2b_StackContext* ctx,
+    a2b_SeqChartEntity src, a2b_SeqChartEntity dest,
+    a2b_SeqChartCommType commType, a2b_UInt32 level,
+    const a2b_Char* fmt, void** args, a2b_UInt16 numArgs);
 
 /*======================= D A T A  ================================*/
 
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+static a2b_SeqChartBin gSeqChartBin;
+static a2b_UIntPtr gSeqChartBinDumpStr[A2B_SEQBIN_DUMP_STRINGS];
+#endif
+
 /*======================= C O D E =================================*/
 
+#ifndef A2B_FEATURE_SEQ_CHART_BINARY
 /*!****************************************************************************
 *  \ingroup        a2bstack_seqchart_priv
 * 
@@ -399,6 +451,323 @@ a2b_seqChartPrefix
     }
 } /* a2b_seqChartPrefix */
 
+#else /* A2B_FEATURE_SEQ_CHART_BINARY */
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_seqchart_priv
+*
+*  \b              a2b_seqChartBinRecord
+*
+*  Reserves a record at the end of the capture and fills in the words
+*  common to all events. The time is only read when the chart shows time
+*  stamps. When the capture is full the event is counted as dropped; the
+*  last words are kept for the STOP record.
+*
+*  \param          [in]    ctx          The A2B stack context.
+*
+*  \param          [in]    type         The event type (A2B_SEQBIN_TYPE_xxx).
+*
+*  \param          [in]    entities     Source, destination and
+*                                       communication type
+*                                       (#A2B_SEQBIN_ENTITIES).
+*
+*  \param          [in]    level        The sequence event level.
+*
+*  \param          [in]    nWords       Size of the record in words.
+*
+*  \pre            Only available when #A2B_FEATURE_SEQ_CHART_BINARY is
+*                  enabled.
+*
+*  \pre            Expectation is that the following are NON-NULL:
+*                  ctx->stk and ctx->stk->seqChartChan
+*
+*  \post           None
+*
+*  \return         The first word of the record or A2B_NULL if it was
+*                  dropped.
+*
+******************************************************************************/
+static a2b_UInt32*
+a2b_seqChartBinRecord
+    (
+    struct a2b_StackContext*    ctx,
+    a2b_UInt32                  type,
+    a2b_UInt32                  entities,
+    a2b_UInt32                  level,
+    a2b_UInt32                  nWords
+    )
+{
+    a2b_UInt32* rec = A2B_NULL;
+    a2b_UInt32 limit = A2B_CONF_SEQ_CHART_BIN_SIZE;
+    a2b_UInt32 flags = 0u;
+
+    if ( A2B_SEQBIN_TYPE_STOP != type )
+    {
+        limit -= A2B_SEQBIN_STOP_WORDS;
+    }
+
+    if ( (gSeqChartBin.nWords + nWords) > limit )
+    {
+        gSeqChartBin.nDropped++;
+    }
+    else
+    {
+        rec = &gSeqChartBin.words[gSeqChartBin.nWords];
+        gSeqChartBin.nWords += nWords;
+
+        if ( (A2B_SEQBIN_TYPE_START != type) &&
+             (A2B_SEQBIN_TYPE_STOP != type) &&
+             (ctx->stk->seqChartChan->options & A2B_SEQ_CHART_OPT_TIMESTAMP) )
+        {
+            flags = A2B_SEQBIN_FLAG_TIMESTAMP;
+            rec[A2B_SEQBIN_REC_TIME] = ctx->stk->pal.timerGetSysTime();
+        }
+        else
+        {
+            rec[A2B_SEQBIN_REC_TIME] = 0u;
+        }
+        rec[A2B_SEQBIN_REC_HDR] = A2B_SEQBIN_REC(nWords, type, flags);
+        rec[A2B_SEQBIN_REC_ENTITIES] = entities;
+        rec[A2B_SEQBIN_REC_LEVEL] = level;
+    }
+
+    return rec;
+} /* a2b_seqChartBinRecord */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_seqchart_priv
+*
+*  \b              a2b_seqChartBinMsg
+*
+*  Captures a sequence chart message: the format address and the argument
+*  values. Nothing is formatted.
+*
+*  \param          [in]    ctx          The A2B stack context.
+*
+*  \param          [in]    entities     Source, destination and
+*                                       communication type
+*                                       (#A2B_SEQBIN_ENTITIES).
+*
+*  \param          [in]    level        The sequence event level.
+*
+*  \param          [in]    fmt          The format string.
+*
+*  \param          [in]    args         The format parameters.
+*
+*  \param          [in]    numArgs      The number of format parameters.
+*
+*  \pre            Only available when #A2B_FEATURE_SEQ_CHART_BINARY is
+*                  enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_seqChartBinMsg
+    (
+    struct a2b_StackContext*    ctx,
+    a2b_UInt32                  entities,
+    a2b_UInt32                  level,
+    const a2b_Char*             fmt,
+    void**                      args,
+    a2b_UInt16                  numArgs
+    )
+{
+    a2b_UInt32* rec;
+    a2b_UInt32 desc = a2b_vsnprintfArgKinds(fmt);
+    a2b_UInt32 nArgs = A2B_MIN(A2B_TRCBIN_DESC_COUNT(desc), (a2b_UInt32)numArgs);
+    a2b_UInt32 nWords = A2B_SEQBIN_REC_DATA + A2B_TRCBIN_PTR_WORDS;
+    a2b_UInt32 idx;
+    a2b_UInt32 kind;
+    a2b_UInt32 pos;
+#ifdef A2B_FEATURE_64_BIT_INTEGER
+    a2b_UInt64 value64;
+#endif
+
+    for ( idx = 0u; idx < nArgs; idx++ )
+    {
+        kind = A2B_TRCBIN_DESC_KIND(desc, idx);
+        if ( kind == A2B_TRCBIN_ARG_64 )
+        {
+            nWords += 2u;
+        }
+        else if ( kind >= A2B_TRCBIN_ARG_PTR )
+        {
+            nWords += A2B_TRCBIN_PTR_WORDS;
+        }
+        else
+        {
+            nWords++;
+        }
+    }
+
+    rec = a2b_seqChartBinRecord(ctx, A2B_SEQBIN_TYPE_MSG, entities, level,
+                                nWords);
+    if ( A2B_NULL != rec )
+    {
+        pos = a2b_binPutPtr(rec, A2B_SEQBIN_REC_DATA, fmt);
+        for ( idx = 0u; idx < nArgs; idx++ )
+        {
+            switch ( A2B_TRCBIN_DESC_KIND(desc, idx) )
+            {
+                case A2B_TRCBIN_ARG_8:
+                    rec[pos] = *((const a2b_UInt8*)args[idx]);
+                    pos++;
+                    break;
+                case A2B_TRCBIN_ARG_16:
+                    rec[pos] = *((const a2b_UInt16*)args[idx]);
+                    pos++;
+                    break;
+#ifdef A2B_FEATURE_64_BIT_INTEGER
+                case A2B_TRCBIN_ARG_64:
+                    value64 = *((const a2b_UInt64*)args[idx]);
+                    rec[pos] = (a2b_UInt32)value64;
+                    rec[pos + 1u] = (a2b_UInt32)(value64 >> 32u);
+                    pos += 2u;
+                    break;
+#endif
+                case A2B_TRCBIN_ARG_PTR:
+                case A2B_TRCBIN_ARG_STR:
+                    pos = a2b_binPutPtr(rec, pos, args[idx]);
+                    break;
+                case A2B_TRCBIN_ARG_32:
+                default:
+                    rec[pos] = *((const a2b_UInt32*)args[idx]);
+                    pos++;
+                    break;
+            }
+        }
+    }
+} /* a2b_seqChartBinMsg */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_seqchart_priv
+*
+*  \b              a2b_seqChartBinText
+*
+*  Captures raw text (a2b_seqChartInject()). The text is copied, callers
+*  usually pass a buffer on their stack.
+*
+*  \param          [in]    ctx      The A2B stack context.
+*
+*  \param          [in]    level    The sequence event level.
+*
+*  \param          [in]    text     The PlantUML text.
+*
+*  \pre            Only available when #A2B_FEATURE_SEQ_CHART_BINARY is
+*                  enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_seqChartBinText
+    (
+    struct a2b_StackContext*    ctx,
+    a2b_UInt32                  level,
+    const a2b_Char*             text
+    )
+{
+    a2b_UInt32* rec;
+    a2b_UInt32 nText = (a2b_UInt32)a2b_strlen(text);
+
+    nText = A2B_MIN(nText, A2B_SEQBIN_MAX_TEXT);
+    rec = a2b_seqChartBinRecord(ctx, A2B_SEQBIN_TYPE_TEXT, 0u, level,
+                            A2B_SEQBIN_REC_DATA + 1u + ((nText + 3u) / 4u));
+    if ( A2B_NULL != rec )
+    {
+        rec[A2B_SEQBIN_REC_DATA] = nText;
+        if ( 0u != (nText & 3u) )
+        {
+            rec[A2B_SEQBIN_REC_DATA + 1u + (nText / 4u)] = 0u;
+        }
+        (void)a2b_memcpy(&rec[A2B_SEQBIN_REC_DATA + 1u], text, nText);
+    }
+} /* a2b_seqChartBinText */
+
+
+#endif /* A2B_FEATURE_SEQ_CHART_BINARY */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_seqchart_priv
+*
+*  \b              a2b_seqChartOutput
+*
+*  Outputs a sequence chart message for a2b_seqChart0() .. a2b_seqChart8():
+*  formatted and written to the log channel, or captured in binary form
+*  with #A2B_FEATURE_SEQ_CHART_BINARY.
+*
+*  \param          [in]    ctx          The A2B stack context.
+*
+*  \param          [in]    src          The source entity in the sequence.
+*
+*  \param          [in]    dest         The destination entity in the
+*                                       sequence.
+*
+*  \param          [in]    commType     The type of sequence communication.
+*
+*  \param          [in]    level        The sequence event level.
+*
+*  \param          [in]    fmt          The format string.
+*
+*  \param          [in]    args         The format parameters.
+*
+*  \param          [in]    numArgs      The number of format parameters.
+*
+*  \pre            Only available when #A2B_FEATURE_SEQ_CHART is enabled.
+*
+*  \pre            Expectation is that the following are NON-NULL:
+*                  ctx->stk and ctx->stk->seqChartChan
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_seqChartOutput
+    (
+    struct a2b_StackContext*    ctx,
+    a2b_SeqChartEntity          src,
+    a2b_SeqChartEntity          dest,
+    a2b_SeqChartCommType        commType,
+    a2b_UInt32                  level,
+    const a2b_Char*             fmt,
+    void**                      args,
+    a2b_UInt16                  numArgs
+    )
+{
+    if ( A2B_NULL != ctx )
+    {
+        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
+
+        if ( level & chan->levelMask )
+        {
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+            a2b_seqChartBinMsg(ctx, A2B_SEQBIN_ENTITIES(src, dest, commType),
+                               level, fmt, args, numArgs);
+#else
+            a2b_seqChartPrefix(ctx, src, dest, commType);
+            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args, numArgs);
+            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
+            a2b_stringBufferClear(&chan->strBuf);
+
+            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
+            {
+                a2b_seqChartLogTime(ctx);
+            }
+#endif
+        }
+    }
+} /* a2b_seqChartOutput */
+
 
 /*!****************************************************************************
 * 
@@ -449,16 +818,23 @@ a2b_seqChartAlloc
             if ( !gsSeqChartChanPool[idx].inUse )
             {
                 chan = &gsSeqChartChanPool[idx];
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+                /* Captured in memory, written by a2b_seqChartBinDump() */
+                chan->hnd = A2B_NULL;
+#else
                 chan->hnd = ctx->stk->pal.logOpen(name);
                 if ( A2B_NULL == chan->hnd )
                 {
                     chan = A2B_NULL;
                 }
                 else
+#endif
                 {
                     chan->ctx = ctx;
+#ifndef A2B_FEATURE_SEQ_CHART_BINARY
                     a2b_stringBufferInit(&chan->strBuf, chan->buf,
                                             A2B_ARRAY_SIZE(chan->buf));
+#endif
                     chan->inUse = A2B_TRUE;
                     /* The "always" bit should be forced to be enabled */
                     chan->levelMask = level | A2B_SEQ_CHART_LEVEL_ALWAYS;
@@ -495,7 +871,9 @@ a2b_seqChartFree
 {
     if ( A2B_NULL != chan )
     {
+#ifndef A2B_FEATURE_SEQ_CHART_BINARY
         chan->ctx->stk->pal.logClose(chan->hnd);
+#endif
         chan->inUse = A2B_FALSE;
     }
 } /* a2b_seqChartFree */
@@ -579,7 +957,25 @@ a2b_seqChartStart
             {
                 ctx->stk->seqChartChan->options = options;
                 /* Start the sequence chart */
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+                {
+                    a2b_UInt32* rec;
+
+                    gSeqChartBin.nWords = 0u;
+                    gSeqChartBin.nDropped = 0u;
+                    rec = a2b_seqChartBinRecord(ctx, A2B_SEQBIN_TYPE_START,
+                                0u, A2B_SEQ_CHART_LEVEL_ALWAYS,
+                                A2B_SEQBIN_REC_DATA + 1u + A2B_TRCBIN_PTR_WORDS);
+                    if ( A2B_NULL != rec )
+                    {
+                        rec[A2B_SEQBIN_REC_DATA] = options;
+                        (void)a2b_binPutPtr(rec,
+                                        A2B_SEQBIN_REC_DATA + 1u, title);
+                    }
+                }
+#else
                 a2b_seqChartHeader(ctx, title);
+#endif
             }
         }
     }
@@ -625,7 +1021,13 @@ a2b_seqChartStop
     {
         if ( A2B_NULL != ctx->stk->seqChartChan )
         {
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+            (void)a2b_seqChartBinRecord(ctx, A2B_SEQBIN_TYPE_STOP, 0u,
+                                        A2B_SEQ_CHART_LEVEL_ALWAYS,
+                                        A2B_SEQBIN_STOP_WORDS);
+#else
             a2b_seqChartFooter(ctx);
+#endif
             a2b_seqChartFree(ctx->stk->seqChartChan);
             ctx->stk->seqChartChan = A2B_NULL;
         }
@@ -762,12 +1164,16 @@ a2b_seqChartInject
         {
             if ( ctx->stk->seqChartChan->levelMask & level )
             {
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+                a2b_seqChartBinText(ctx, level, text);
+#else
                 a2b_seqChartLog0(ctx, text);
                 if ( ctx->stk->seqChartChan->options &
                         A2B_SEQ_CHART_OPT_TIMESTAMP )
                 {
                     a2b_seqChartLogTime(ctx);
                 }
+#endif
             }
             status = A2B_RESULT_SUCCESS;
         }
@@ -891,23 +1297,7 @@ a2b_seqChart0
 {
 
     A2B_UNUSED(level);
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
-
-        if ( level & chan->levelMask )
-        {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, A2B_NULL, 0);
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
-        }
-    }
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, A2B_NULL, 0u);
 } /* a2b_seqChart0 */
 
 
@@ -972,24 +1362,8 @@ a2b_seqChart1
 
     A2B_UNUSED(level);
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
-
-        if ( level & chan->levelMask )
-        {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
-        }
-    }
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, args,
+                       (a2b_UInt16)A2B_ARRAY_SIZE(args));
 } /* a2b_seqChart1 */
 
 
@@ -1058,24 +1432,8 @@ a2b_seqChart2
 
     A2B_UNUSED(level);
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
-
-        if ( level & chan->levelMask )
-        {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
-        }
-    }
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, args,
+                       (a2b_UInt16)A2B_ARRAY_SIZE(args));
 } /* a2b_seqChart2 */
 
 
@@ -1148,24 +1506,8 @@ a2b_seqChart3
 
     A2B_UNUSED(level);
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
-
-        if ( level & chan->levelMask )
-        {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
-        }
-    }
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, args,
+                       (a2b_UInt16)A2B_ARRAY_SIZE(args));
 } /* a2b_seqChart3 */
 
 
@@ -1242,24 +1584,8 @@ a2b_seqChart4
 
     A2B_UNUSED(level);
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
-
-        if ( level & chan->levelMask )
-        {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
-        }
-    }
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, args,
+                       (a2b_UInt16)A2B_ARRAY_SIZE(args));
 } /* a2b_seqChart4 */
 
 
@@ -1340,24 +1666,8 @@ a2b_seqChart5
 
     A2B_UNUSED(level);
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
-
-        if ( level & chan->levelMask )
-        {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
-        }
-    }
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, args,
+                       (a2b_UInt16)A2B_ARRAY_SIZE(args));
 } /* a2b_seqChart5 */
 
 
@@ -1442,24 +1752,8 @@ a2b_seqChart6
 
     A2B_UNUSED(level);
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
-
-        if ( level & chan->levelMask )
-        {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
-        }
-    }
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, args,
+                       (a2b_UInt16)A2B_ARRAY_SIZE(args));
 } /* a2b_seqChart6 */
 
 
@@ -1548,24 +1842,8 @@ a2b_seqChart7
 
     A2B_UNUSED(level);
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
-
-        if ( level & chan->levelMask )
-        {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
-        }
-    }
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, args,
+                       (a2b_UInt16)A2B_ARRAY_SIZE(args));
 } /* a2b_seqChart7 */
 
 
@@ -1658,24 +1936,215 @@ a2b_seqChart8
 
     A2B_UNUSED(level);
 
-    if ( A2B_NULL != ctx )
+    a2b_seqChartOutput(ctx, src, dest, commType, level, fmt, args,
+                       (a2b_UInt16)A2B_ARRAY_SIZE(args));
+} /* a2b_seqChart8 */
+
+
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+/*!****************************************************************************
+*  \ingroup        a2bstack_seqchart_priv
+*
+*  \b              a2b_seqChartI2c
+*
+*  Captures an I2C transfer as a single record. The host renders it as the
+*  request and the reply of the transfer, so the I2C layer no longer
+*  formats the data bytes on the target.
+*
+*  \param          [in]    ctx      The A2B stack context.
+*
+*  \param          [in]    origin   The entity that issued the transfer.
+*
+*  \param          [in]    op       #A2B_SEQBIN_I2C_READ,
+*                                   #A2B_SEQBIN_I2C_WRITE or
+*                                   #A2B_SEQBIN_I2C_WRITE_READ.
+*
+*  \param          [in]    addr     The I2C address.
+*
+*  \param          [in]    nWrite   Number of bytes written.
+*
+*  \param          [in]    wBuf     The bytes written (may be A2B_NULL if
+*                                   nWrite is zero).
+*
+*  \param          [in]    nRead    Number of bytes read.
+*
+*  \param          [in]    rBuf     The bytes read (may be A2B_NULL if
+*                                   nRead is zero).
+*
+*  \param          [in]    result   The result of the transfer. The read
+*                                   bytes are only captured on success.
+*
+*  \pre            Only available when #A2B_FEATURE_SEQ_CHART_BINARY is
+*                  enabled.
+*
+*  \pre            Expectation is that the following are NON-NULL: ctx->stk
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+A2B_DSO_LOCAL void
+a2b_seqChartI2c
+    (
+    struct a2b_StackContext*    ctx,
+    a2b_UInt32                  origin,
+    a2b_UInt32                  op,
+    a2b_UInt16                  addr,
+    a2b_UInt16                  nWrite,
+    const a2b_Byte*             wBuf,
+    a2b_UInt16                  nRead,
+    const a2b_Byte*             rBuf,
+    a2b_HResult                 result
+    )
+{
+    a2b_UInt32* rec;
+    a2b_UInt32 nBytes;
+    a2b_Byte* data;
+
+    if ( (A2B_NULL == ctx) || (A2B_NULL == ctx->stk->seqChartChan) ||
+        (0u == (ctx->stk->seqChartChan->levelMask & A2B_SEQ_CHART_LEVEL_I2C)) )
     {
-        struct a2b_SeqChartChannel* chan = ctx->stk->seqChartChan;
+        return;
+    }
 
-        if ( level & chan->levelMask )
+    rec = a2b_seqChartBinRecord(ctx, A2B_SEQBIN_TYPE_I2C,
+                                A2B_SEQBIN_ENTITIES(origin,
+                                    A2B_SEQ_CHART_ENTITY_PLATFORM,
+                                    A2B_SEQ_CHART_COMM_REQUEST),
+                                A2B_SEQ_CHART_LEVEL_I2C, A2B_SEQBIN_I2C_WORDS);
+    if ( A2B_NULL != rec )
+    {
+        rec[A2B_SEQBIN_REC_DATA] = (a2b_UInt32)addr | (op << 16u);
+        rec[A2B_SEQBIN_REC_DATA + 1u] = (a2b_UInt32)nWrite |
+                                        ((a2b_UInt32)nRead << 16u);
+        rec[A2B_SEQBIN_REC_DATA + 2u] = (a2b_UInt32)result;
+
+        data = (a2b_Byte*)&rec[A2B_SEQBIN_REC_DATA + 3u];
+        (void)a2b_memset(data, 0, 2u * A2B_SEQBIN_I2C_DATA_BYTES);
+        if ( A2B_NULL != wBuf )
         {
-            a2b_seqChartPrefix(ctx, src, dest, commType);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
+            nBytes = A2B_MIN((a2b_UInt32)nWrite, A2B_SEQBIN_I2C_DATA_BYTES);
+            (void)a2b_memcpy(data, wBuf, nBytes);
+        }
+        if ( (A2B_NULL != rBuf) && A2B_SUCCEEDED(result) )
+        {
+            nBytes = A2B_MIN((a2b_UInt32)nRead, A2B_SEQBIN_I2C_DATA_BYTES);
+            (void)a2b_memcpy(&data[A2B_SEQBIN_I2C_DATA_BYTES], rBuf, nBytes);
+        }
+    }
+} /* a2b_seqChartI2c */
 
-            if ( chan->options & A2B_SEQ_CHART_OPT_TIMESTAMP )
-            {
-                a2b_seqChartLogTime(ctx);
-            }
+
+/*!****************************************************************************
+*
+*  \b              a2b_seqChartBinDump
+*
+*  Writes the binary sequence chart captured since the last
+*  a2b_seqChartStart() together with the strings its records refer to.
+*  The dump is rendered to PlantUML text on the host by
+*  tools/seqchart_host.c. It is normally called after a2b_seqChartStop().
+*
+*  \param          [in]    writeFunc    Receives the dump in pieces.
+*
+*  \param          [in]    hnd          Handle passed to writeFunc.
+*
+*  \pre            Only available when #A2B_FEATURE_SEQ_CHART_BINARY is
+*                  enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+A2B_DSO_PUBLIC void
+a2b_seqChartBinDump
+    (
+    a2b_SeqChartBinWriteFunc    writeFunc,
+    a2b_Handle                  hnd
+    )
+{
+    a2b_UInt32 hdr[A2B_SEQBIN_HDR_WORDS];
+    const a2b_UInt32* rec;
+    a2b_UInt32 nStrings = 0u;
+    a2b_UInt32 offset;
+    a2b_UInt32 desc;
+    a2b_UInt32 nArgs;
+    a2b_UInt32 kind;
+    a2b_UInt32 pos;
+    a2b_UInt32 idx;
+
+    if ( A2B_NULL == writeFunc )
+    {
+        return;
+    }
+
+    hdr[0u] = A2B_SEQBIN_MAGIC;
+    hdr[1u] = A2B_SEQBIN_VERSION;
+    hdr[2u] = A2B_TRCBIN_PTR_WORDS;
+    hdr[3u] = gSeqChartBin.nWords;
+    hdr[4u] = gSeqChartBin.nDropped;
+    hdr[5u] = 0u;
+    writeFunc(hnd, (const a2b_Byte*)hdr, sizeof(hdr));
+    writeFunc(hnd, (const a2b_Byte*)gSeqChartBin.words,
+              gSeqChartBin.nWords * 4u);
+
+    for ( offset = 0u; offset < gSeqChartBin.nWords;
+          offset += A2B_SEQBIN_REC_WORDS(rec[A2B_SEQBIN_REC_HDR]) )
+    {
+        rec = &gSeqChartBin.words[offset];
+        switch ( A2B_SEQBIN_REC_TYPE(rec[A2B_SEQBIN_REC_HDR]) )
+        {
+            case A2B_SEQBIN_TYPE_START:
+                a2b_binDumpStr(writeFunc, hnd,
+                        a2b_binGetPtr(rec, A2B_SEQBIN_REC_DATA + 1u),
+                        A2B_FALSE, gSeqChartBinDumpStr,
+                        A2B_SEQBIN_DUMP_STRINGS, &nStrings);
+                break;
+            case A2B_SEQBIN_TYPE_MSG:
+                a2b_binDumpStr(writeFunc, hnd,
+                        a2b_binGetPtr(rec, A2B_SEQBIN_REC_DATA),
+                        A2B_FALSE, gSeqChartBinDumpStr,
+                        A2B_SEQBIN_DUMP_STRINGS, &nStrings);
+                desc = a2b_vsnprintfArgKinds((const a2b_Char*)
+                        a2b_binGetPtr(rec, A2B_SEQBIN_REC_DATA));
+                nArgs = A2B_TRCBIN_DESC_COUNT(desc);
+                pos = A2B_SEQBIN_REC_DATA + A2B_TRCBIN_PTR_WORDS;
+                for ( idx = 0u; (idx < nArgs) &&
+                    (pos < A2B_SEQBIN_REC_WORDS(rec[A2B_SEQBIN_REC_HDR]));
+                    idx++ )
+                {
+                    kind = A2B_TRCBIN_DESC_KIND(desc, idx);
+                    if ( kind == A2B_TRCBIN_ARG_STR )
+                    {
+                        a2b_binDumpStr(writeFunc, hnd,
+                                a2b_binGetPtr(rec, pos), A2B_FALSE,
+                                gSeqChartBinDumpStr, A2B_SEQBIN_DUMP_STRINGS,
+                                &nStrings);
+                    }
+                    if ( kind == A2B_TRCBIN_ARG_64 )
+                    {
+                        pos += 2u;
+                    }
+                    else if ( kind >= A2B_TRCBIN_ARG_PTR )
+                    {
+                        pos += A2B_TRCBIN_PTR_WORDS;
+                    }
+                    else
+                    {
+                        pos++;
+                    }
+                }
+                break;
+            default:
+                break;
         }
     }
-} /* a2b_seqChart8 */
+
+    hdr[0u] = A2B_SEQBIN_END;
+    writeFunc(hnd, (const a2b_Byte*)hdr, 4u);
+} /* a2b_seqChartBinDump */
+#endif /* A2B_FEATURE_SEQ_CHART_BINARY */
+
 
 #endif /* A2B_FEATURE_SEQ_CHART */
@@ -61,6 +61,19 @@ A2B_EXPORT A2B_DSO_LOCAL struct a2b_SeqChartChannel* a2b_seqChartAlloc(
 A2B_EXPORT A2B_DSO_LOCAL void a2b_seqChartFree(
                                             struct a2b_SeqChartChannel* chan);
 
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+A2B_EXPORT A2B_DSO_LOCAL void a2b_seqChartI2c(
+                                            struct a2b_StackContext*    ctx,
+                                            a2b_UInt32                  origin,
+                                            a2b_UInt32                  op,
+                                            a2b_UInt16                  addr,
+                                            a2b_UInt16                  nWrite,
+                                            const a2b_Byte*             wBuf,
+                                            a2b_UInt16                  nRead,
+                                            const a2b_Byte*             rBuf,
+                                            a2b_HResult                 result);
+#endif /* A2B_FEATURE_SEQ_CHART_BINARY */
+
 #endif /* A2B_FEATURE_SEQ_CHART */
 
 A2B_END_DECLS
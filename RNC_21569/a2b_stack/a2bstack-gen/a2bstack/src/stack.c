@@ -373,6 +373,80 @@ a2b_stackGetMinHeapSize
 {
     return a2b_memMgrGetMinHeapSize(heapStart);
 } /* a2b_stackGetMinHeapSize */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_stackGetHeapStats
+*
+*  Reports the usage of each memory pool of the stack's heap: block size,
+*  capacity, current use, high watermark and the allocations the pool
+*  could not serve. The pools are reported in ascending block size order.
+*
+*  \param          [in]    ctx          The A2B stack context.
+*
+*  \param          [out]   stats        The array receiving one entry per
+*                                       pool.
+*
+*  \param          [in]    maxStats     The number of entries in the array.
+*
+*  \pre            Only available when #A2B_FEATURE_MEMORY_MANAGER is enabled.
+*
+*  \post           None
+*
+*  \return         The number of entries filled in. Zero if the PAL does not
+*                  use the built-in memory manager.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32
+a2b_stackGetHeapStats
+    (
+    struct a2b_StackContext*    ctx,
+    a2b_HeapPoolStats*          stats,
+    a2b_UInt32                  maxStats
+    )
+{
+    a2b_UInt32 num = 0u;
+
+    if ( (A2B_NULL != ctx) && (A2B_NULL != ctx->stk) &&
+        (ctx->stk->pal.memMgrMalloc == &a2b_memMgrMalloc) )
+    {
+        num = a2b_memMgrGetStats(ctx->stk->heapHnd, stats, maxStats);
+    }
+
+    return num;
+} /* a2b_stackGetHeapStats */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_stackGetHeapPoolTable
+*
+*  Reports the entries of the pool table the stack heaps are built from,
+*  each with the index of the pool (as reported by a2b_stackGetHeapStats())
+*  that serves it.
+*
+*  \param          [out]   entries      The array receiving one element per
+*                                       table entry.
+*
+*  \param          [in]    maxEntries   The number of elements in the array.
+*
+*  \pre            Only available when #A2B_FEATURE_MEMORY_MANAGER is enabled.
+*
+*  \post           None
+*
+*  \return         The number of elements filled in.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32
+a2b_stackGetHeapPoolTable
+    (
+    a2b_HeapPoolEntry*  entries,
+    a2b_UInt32          maxEntries
+    )
+{
+    return a2b_memMgrGetPoolTable(entries, maxEntries);
+} /* a2b_stackGetHeapPoolTable */
 #endif /* A2B_FEATURE_MEMORY_MANAGER */
 
 
@@ -932,6 +1006,9 @@ a2b_stackFree
 *
 *  This function should be called periodically to provide a system
 *  'tick' for the stack in order to schedule necessary processing.
+*  The stack runs on the PAL system time rather than on the number of
+*  ticks, so the calls need not be evenly spaced: #a2b_stackNextDeadline
+*  tells how long the application can wait before the next call.
 *
 *  \param          [in]    ctx      The A2B stack instance.
 *
@@ -948,9 +1025,7 @@ a2b_stackTick
     struct a2b_StackContext *ctx
     )
 {
-#ifdef A2B_FEATURE_TRACE
     a2b_UInt32 curTime;
-#endif
 
     if ( (A2B_NULL != ctx) && (A2B_DOMAIN_APP == ctx->domain) )
     {
@@ -961,19 +1036,23 @@ a2b_stackTick
                         A2B_SEQ_CHART_LEVEL_7,
                         "a2b_stackTick(0x%p)", ctx));
 
-#ifdef A2B_FEATURE_TRACE
         curTime = ctx->stk->pal.timerGetSysTime();
         A2B_TRACE1((ctx, (A2B_TRC_DOM_TICK | A2B_TRC_LVL_TRACE2),
                     "Current time = %lu",&curTime));
-#endif
 
         /* Give the timer services a tick and let it dispatch any timeouts */
         a2b_timerTick(ctx);
 
-        if ( 0u == (ctx->stk->stackTickCnt % A2B_CONF_SCHEDULER_TICK_MULTIPLE) )
+        /* Jobs that asked to run again are paced by the system time,
+         * jobs made ready by an event run on every tick.
+         */
+        if ( (curTime - ctx->stk->releaseTime) >=
+             (a2b_UInt32)A2B_CONF_SCHEDULER_TICK_MULTIPLE )
         {
-            a2b_jobExecSchedule(ctx->stk->jobExec);
+            ctx->stk->releaseTime = curTime;
+            a2b_jobExecRelease(ctx->stk->jobExec);
         }
+        a2b_jobExecSchedule(ctx->stk->jobExec);
 
         /* Track the number of times this function is called. It's okay
          * if this number rolls over.
@@ -990,6 +1069,68 @@ a2b_stackTick
 } /* a2b_stackTick */
 
 
+/*!****************************************************************************
+*
+*  \b              a2b_stackNextDeadline
+*
+*  Returns how long the application can go without calling #a2b_stackTick.
+*  This is the earlier of the next timer expiry and, when jobs asked to
+*  run again, their next release. The application can idle (or wait for
+*  an interrupt) until then. Anything that changes the stack from outside
+*  a tick (e.g. an API call that submits a job) is seen by calling this
+*  function again.
+*
+*  \param          [in]    ctx      The A2B stack instance.
+*
+*  \pre            None
+*
+*  \post           None
+*
+*  \return         Time in msec until #a2b_stackTick has work to do, 0 if
+*                  it has work to do now, #A2B_TIMER_NO_DEADLINE if nothing
+*                  is pending (or the context is invalid).
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32
+a2b_stackNextDeadline
+    (
+    struct a2b_StackContext *ctx
+    )
+{
+    a2b_UInt32 deadline = A2B_TIMER_NO_DEADLINE;
+    a2b_UInt32 pending;
+    a2b_UInt32 elapsed;
+    a2b_UInt32 release;
+
+    if ( (A2B_NULL != ctx) && (A2B_DOMAIN_APP == ctx->domain) )
+    {
+        pending = a2b_jobExecPending(ctx->stk->jobExec);
+        if ( A2B_JOBQ_READY == pending )
+        {
+            deadline = 0u;
+        }
+        else
+        {
+            deadline = a2b_timerNextDeadline(ctx);
+            if ( A2B_JOBQ_DEFERRED == pending )
+            {
+                elapsed = ctx->stk->pal.timerGetSysTime() -
+                            ctx->stk->releaseTime;
+                release = 0u;
+                if ( elapsed < (a2b_UInt32)A2B_CONF_SCHEDULER_TICK_MULTIPLE )
+                {
+                    release = (a2b_UInt32)A2B_CONF_SCHEDULER_TICK_MULTIPLE -
+                                elapsed;
+                }
+                deadline = A2B_MIN(deadline, release);
+            }
+        }
+    }
+
+    return deadline;
+} /* a2b_stackNextDeadline */
+
+
 /*!****************************************************************************
 *
 *  \b              a2b_stackPalGetVersion
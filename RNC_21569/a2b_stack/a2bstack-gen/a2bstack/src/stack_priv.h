@@ -39,6 +39,7 @@
 #include "a2bstack/inc/a2b/pal.h"
 #include "platform/a2b/conf.h"
 #include "queue.h"
+#include "timer_priv.h"
 
 /*======================= D E F I N E S ===========================*/
 
@@ -130,12 +131,18 @@ typedef struct a2b_Stack
     /** A list of managed timers */
     SLIST_HEAD(a2b_TimerHead, a2b_Timer) timerList;
 
-    /** Tracks the number of times the stack "tick" has been issued.  This is
-     *  used with #A2B_CONF_SCHEDULER_TICK_MULTIPLE to decide when to call
-     *  #a2b_jobExecSchedule to do work.
-     */
+    /** The active timers ordered by expiry */
+    a2b_TimerWheel              timerWheel;
+
+    /** Tracks the number of times the stack "tick" has been issued. */
     a2b_UInt32                  stackTickCnt;
 
+    /** System time (msec) of the last #a2b_jobExecRelease. Jobs that asked
+     *  to run again are released #A2B_CONF_SCHEDULER_TICK_MULTIPLE msec
+     *  later.
+     */
+    a2b_UInt32                  releaseTime;
+
     /** Interrupt info used when interrupt polling is enabled */
     struct a2b_IntrInfo*        intrInfo;
 
@@ -36,10 +36,19 @@
 /** Flag used to indicate that a timer is active or not */
 #define A2B_TIMER_STATUS_ACTIVE    ((a2b_UInt32)1u << (a2b_UInt32)1u)
 
+/** Flag used to indicate that a timer is linked into the timer wheel */
+#define A2B_TIMER_STATUS_LINKED    ((a2b_UInt32)1u << (a2b_UInt32)2u)
+
 /*======================= L O C A L  P R O T O T Y P E S  =========*/
 static void a2b_timerInit(struct a2b_StackContext*    ctx,
     struct a2b_Timer* timer, a2b_TimerFunc onTimeout,
     a2b_Handle userData);
+static void a2b_timerWheelInsert(a2b_TimerWheel* wheel,
+    struct a2b_Timer* timer);
+static void a2b_timerWheelRemove(a2b_TimerWheel* wheel,
+    struct a2b_Timer* timer);
+static a2b_UInt32 a2b_timerWheelMove(a2b_TimerWheel* wheel,
+    struct a2b_TimerSlot* from, struct a2b_TimerSlot* to);
 
 /*======================= D A T A  ================================*/
 
@@ -80,7 +89,9 @@ a2b_timerInit
         timer->after = (a2b_UInt32)0;
         timer->repeat = (a2b_UInt32)0;
         timer->lastTime = (a2b_UInt32)0;
-        timer->status &= (a2b_UInt8)~(A2B_TIMER_STATUS_ACTIVE);
+        timer->expires = (a2b_UInt32)0;
+        timer->status &= (a2b_UInt8)~(A2B_TIMER_STATUS_ACTIVE |
+                                      A2B_TIMER_STATUS_LINKED);
         timer->userData = userData;
         timer->expireFunc = onTimeout;
         timer->ctx = ctx;
@@ -94,15 +105,172 @@ a2b_timerInit
 } /* a2b_timerInit */
 
 
+/*!****************************************************************************
+* 
+*  \b   a2b_timerWheelInsert
+* 
+*  Links an active timer into the wheel slot matching its expiry time.
+*  Timers that are already due are kept for the next tick.
+* 
+*  \param   [in]    wheel   The timer wheel of the stack.
+* 
+*  \param   [in]    timer   The timer to link, `expires` must be set.
+* 
+*  \pre     The timer is not linked.
+* 
+*  \post    None
+* 
+*  \return  None
+* 
+******************************************************************************/
+static void
+a2b_timerWheelInsert
+    (
+    a2b_TimerWheel*     wheel,
+    struct a2b_Timer*   timer
+    )
+{
+    a2b_UInt32 delta = timer->expires - wheel->now;
+    a2b_UInt32 expires = timer->expires;
+    a2b_UInt32 level = 0u;
+    struct a2b_TimerSlot* slot;
+
+    /* Expired or wrapped into the past */
+    if ( (delta == 0u) || (delta >= 0x80000000u) )
+    {
+        slot = &wheel->due;
+    }
+    else
+    {
+        if ( delta >= A2B_TIMER_WHEEL_RANGE )
+        {
+            delta = A2B_TIMER_WHEEL_RANGE - 1u;
+            expires = wheel->now + delta;
+        }
+
+        while ( (level < (A2B_TIMER_WHEEL_LEVELS - 1u)) &&
+                (delta >= ((a2b_UInt32)1u <<
+                           (A2B_TIMER_WHEEL_BITS * (level + 1u)))) )
+        {
+            level++;
+        }
+
+        slot = &wheel->slot[level][(expires >> (A2B_TIMER_WHEEL_BITS * level))
+                                   & A2B_TIMER_WHEEL_MASK];
+    }
+
+    LIST_INSERT_HEAD(slot, timer, wheelLink);
+    timer->status |= (a2b_UInt8)A2B_TIMER_STATUS_LINKED;
+    wheel->count++;
+
+} /* a2b_timerWheelInsert */
+
+
+/*!****************************************************************************
+* 
+*  \b   a2b_timerWheelRemove
+* 
+*  Unlinks a timer from the wheel if it is linked.
+* 
+*  \param   [in]    wheel   The timer wheel of the stack.
+* 
+*  \param   [in]    timer   The timer to unlink.
+* 
+*  \pre     None
+* 
+*  \post    None
+* 
+*  \return  None
+* 
+******************************************************************************/
+static void
+a2b_timerWheelRemove
+    (
+    a2b_TimerWheel*     wheel,
+    struct a2b_Timer*   timer
+    )
+{
+    if ( timer->status & A2B_TIMER_STATUS_LINKED )
+    {
+        LIST_REMOVE(timer, wheelLink);
+        timer->status &= (a2b_UInt8)~A2B_TIMER_STATUS_LINKED;
+        wheel->count--;
+    }
+
+} /* a2b_timerWheelRemove */
+
+
+/*!****************************************************************************
+* 
+*  \b   a2b_timerWheelMove
+* 
+*  Moves all timers of one slot to another list, or re-places them in the
+*  wheel relative to its current time if `to` is A2B_NULL (cascading).
+* 
+*  \param   [in]    wheel   The timer wheel of the stack.
+* 
+*  \param   [in]    from    The slot to empty.
+* 
+*  \param   [in]    to      The list to move the timers to or A2B_NULL.
+* 
+*  \pre     None
+* 
+*  \post    None
+* 
+*  \return  The number of timers moved.
+* 
+******************************************************************************/
+static a2b_UInt32
+a2b_timerWheelMove
+    (
+    a2b_TimerWheel*         wheel,
+    struct a2b_TimerSlot*   from,
+    struct a2b_TimerSlot*   to
+    )
+{
+    struct a2b_TimerSlot moving;
+    a2b_Timer* timer;
+    a2b_UInt32 nMoved = 0u;
+
+    /* Detach the slot first so cascading can never re-visit a timer */
+    moving.lh_first = from->lh_first;
+    if ( A2B_NULL != moving.lh_first )
+    {
+        moving.lh_first->wheelLink.le_prev = &moving.lh_first;
+    }
+    LIST_INIT(from);
+
+    while ( !LIST_EMPTY(&moving) )
+    {
+        timer = LIST_FIRST(&moving);
+        LIST_REMOVE(timer, wheelLink);
+        if ( A2B_NULL == to )
+        {
+            wheel->count--;
+            a2b_timerWheelInsert(wheel, timer);
+        }
+        else
+        {
+            LIST_INSERT_HEAD(to, timer, wheelLink);
+        }
+        nMoved++;
+    }
+
+    return nMoved;
+
+} /* a2b_timerWheelMove */
+
+
 /*!****************************************************************************
 * 
 *  \b   a2b_timerTick
 * 
 *  The primary timer services driver. Called as a by-product of the
-*  `a2b_stackTick()` function. Scans through the list of allocated timers
-*  for this stack and does the necessary processing on each timer including
-*  expiring timers and invoking necessary timeout callback functions. This
-*  is the "engine" that drives all the timers.
+*  `a2b_stackTick()` function. Advances the timer wheel of this stack up to
+*  the current system time and does the necessary processing on each timer
+*  that expired including invoking necessary timeout callback functions.
+*  Timers that are not due are not visited. This is the "engine" that
+*  drives all the timers.
 * 
 *  \param   [in]    ctx     The parent A2B stack context.
 * 
@@ -120,16 +288,56 @@ a2b_timerTick
     )
 {
     a2b_Timer* timer;
-    a2b_Timer* next;
+    a2b_TimerWheel* wheel;
+    struct a2b_TimerSlot expired;
+    a2b_UInt32 nNow;
+    a2b_UInt32 nExpired = 0u;
+    a2b_UInt32 nLevel;
     a2b_UInt32 nTimerRemaining = 0u;
     a2b_Bool bTimterActive = A2B_FALSE;
 
     if ( A2B_NULL != ctx )
     {
-        next = SLIST_FIRST(&ctx->stk->timerList);
-        while ( next != SLIST_END(&ctx->stk->timerList) )
+        wheel = &ctx->stk->timerWheel;
+        nNow = ctx->stk->pal.timerGetSysTime();
+        LIST_INIT(&expired);
+
+        nExpired = a2b_timerWheelMove(wheel, &wheel->due, &expired);
+
+        while ( wheel->now != nNow )
         {
-            timer = next;
+            /* Nothing left in the slots, skip ahead */
+            if ( nExpired == wheel->count )
+            {
+                wheel->now = nNow;
+                break;
+            }
+
+            wheel->now++;
+
+            /* Cascade the levels whose lower levels wrapped, top first */
+            for ( nLevel = A2B_TIMER_WHEEL_LEVELS - 1u; nLevel > 0u; nLevel-- )
+            {
+                if ( (wheel->now & (((a2b_UInt32)1u <<
+                        (A2B_TIMER_WHEEL_BITS * nLevel)) - 1u)) == 0u )
+                {
+                    (void)a2b_timerWheelMove(wheel,
+                        &wheel->slot[nLevel][(wheel->now >>
+                            (A2B_TIMER_WHEEL_BITS * nLevel)) &
+                            A2B_TIMER_WHEEL_MASK],
+                        A2B_NULL);
+                }
+            }
+
+            nExpired += a2b_timerWheelMove(wheel, &wheel->due, &expired);
+            nExpired += a2b_timerWheelMove(wheel,
+                &wheel->slot[0][wheel->now & A2B_TIMER_WHEEL_MASK], &expired);
+        }
+
+        while ( !LIST_EMPTY(&expired) )
+        {
+            timer = LIST_FIRST(&expired);
+            a2b_timerWheelRemove(wheel, timer);
 
             /* Reference the timer in case it's unreferenced in the
              * timer callback.
@@ -173,8 +381,16 @@ a2b_timerTick
                     }
                 }
             }
+            else if ( bTimterActive )
+            {
+                /* Not due after all, put it back */
+                a2b_timerWheelInsert(wheel, timer);
+            }
+            else
+            {
+                /* Nothing to do */
+            }
 
-            next = SLIST_NEXT(timer, link);
             (void)a2b_timerUnref(timer);
         }
     }
@@ -381,6 +597,9 @@ a2b_timerUnref
 
             if (timer->refCnt == (a2b_UInt16)0 )
             {
+                /* A released timer must not stay in the wheel */
+                a2b_timerWheelRemove(&timer->ctx->stk->timerWheel, timer);
+
                 /* Unlink the driver from the link list of timers */
                 SLIST_REMOVE(&timer->ctx->stk->timerList, timer,
                                 a2b_Timer, link);
@@ -772,6 +991,14 @@ a2b_timerStart
         timer->lastTime = timer->ctx->stk->pal.timerGetSysTime();
         timer->status |= (a2b_UInt8)A2B_TIMER_STATUS_ACTIVE;
 
+        /* An empty wheel has nothing to catch up on */
+        if ( 0u == timer->ctx->stk->timerWheel.count )
+        {
+            timer->ctx->stk->timerWheel.now = timer->lastTime;
+        }
+        timer->expires = timer->lastTime + timer->after;
+        a2b_timerWheelInsert(&timer->ctx->stk->timerWheel, timer);
+
         A2B_SEQ_CHART1((timer->ctx,
                        A2B_SEQ_CHART_ENTITY_STACK,
                        ((timer->ctx->domain == A2B_DOMAIN_APP) ?
@@ -825,6 +1052,7 @@ a2b_timerStop
 
         timer->status &= (a2b_UInt8)~A2B_TIMER_STATUS_ACTIVE;
         timer->lastTime = 0u;
+        a2b_timerWheelRemove(&timer->ctx->stk->timerWheel, timer);
 
         A2B_SEQ_CHART1((timer->ctx,
                        A2B_SEQ_CHART_ENTITY_STACK,
@@ -934,3 +1162,113 @@ a2b_ActiveDelay
 		nCurrTime = ctx->stk->pal.timerGetSysTime();
 	}
 }
+
+/*!****************************************************************************
+*
+*  \b   a2b_timerGetSysTime
+*
+*  Returns the current system time of the stack's timer base
+*
+*  \param   [in]    ctx     The stack context.
+*
+*  \pre     None
+*
+*  \post    None
+*
+*  \return  The system time in mSec
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL
+a2b_timerGetSysTime
+    (
+    struct a2b_StackContext* ctx
+    )
+{
+    return ctx->stk->pal.timerGetSysTime();
+}
+
+
+/*!****************************************************************************
+*
+*  \b   a2b_timerNextDeadline
+*
+*  Returns the time until the earliest active timer of the stack expires.
+*  Scans at most one slot per wheel level, independent of the number of
+*  timers.
+*
+*  \param   [in]    ctx     The stack context.
+*
+*  \pre     None
+*
+*  \post    None
+*
+*  \return  The time (in mSec) until the next timer expires, zero if one is
+*           already due, or A2B_TIMER_NO_DEADLINE if no timer is active.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32 A2B_CALL
+a2b_timerNextDeadline
+    (
+    struct a2b_StackContext* ctx
+    )
+{
+    a2b_UInt32 nRemaining = A2B_TIMER_NO_DEADLINE;
+    a2b_UInt32 nEarliest = 0u;
+    a2b_UInt32 nLevel;
+    a2b_UInt32 nSlot;
+    a2b_UInt32 nIdx;
+    a2b_Bool bFound = A2B_FALSE;
+    a2b_TimerWheel* wheel;
+    a2b_Timer* timer;
+
+    if ( A2B_NULL != ctx )
+    {
+        wheel = &ctx->stk->timerWheel;
+
+        if ( !LIST_EMPTY(&wheel->due) )
+        {
+            nEarliest = wheel->now;
+            bFound = A2B_TRUE;
+        }
+        else
+        {
+            for ( nLevel = 0u; nLevel < A2B_TIMER_WHEEL_LEVELS; nLevel++ )
+            {
+                nIdx = wheel->now >> (A2B_TIMER_WHEEL_BITS * nLevel);
+
+                /* The first occupied slot holds the level's earliest timer */
+                for ( nSlot = 1u; nSlot <= A2B_TIMER_WHEEL_SLOTS; nSlot++ )
+                {
+                    struct a2b_TimerSlot* slot =
+                        &wheel->slot[nLevel][(nIdx + nSlot) & A2B_TIMER_WHEEL_MASK];
+
+                    if ( !LIST_EMPTY(slot) )
+                    {
+                        LIST_FOREACH(timer, slot, wheelLink)
+                        {
+                            if ( (!bFound) ||
+                                 ((a2b_Int32)(timer->expires - nEarliest) < 0) )
+                            {
+                                nEarliest = timer->expires;
+                                bFound = A2B_TRUE;
+                            }
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+        if ( bFound )
+        {
+            nRemaining = nEarliest - ctx->stk->pal.timerGetSysTime();
+            if ( nRemaining >= 0x80000000u )
+            {
+                nRemaining = 0u;
+            }
+        }
+    }
+
+    return nRemaining;
+
+} /* a2b_timerNextDeadline */
@@ -40,6 +40,27 @@
 
 /*======================= D E F I N E S ===========================*/
 
+/** Number of bits of the expiry time resolved by each level of the
+ *  timer wheel (slots per level = 2^bits)
+ */
+#ifndef A2B_TIMER_WHEEL_BITS
+#define A2B_TIMER_WHEEL_BITS        (5u)
+#endif
+
+/** Number of levels of the timer wheel */
+#ifndef A2B_TIMER_WHEEL_LEVELS
+#define A2B_TIMER_WHEEL_LEVELS      (4u)
+#endif
+
+#define A2B_TIMER_WHEEL_SLOTS       ((a2b_UInt32)1u << A2B_TIMER_WHEEL_BITS)
+#define A2B_TIMER_WHEEL_MASK        (A2B_TIMER_WHEEL_SLOTS - 1u)
+
+/** Longest timeout (in msec) the wheel places directly. Longer ones are
+ *  parked in the last slot reachable and re-placed when it cascades.
+ */
+#define A2B_TIMER_WHEEL_RANGE       ((a2b_UInt32)1u << \
+                                    (A2B_TIMER_WHEEL_BITS * A2B_TIMER_WHEEL_LEVELS))
+
 /*======================= D A T A T Y P E S =======================*/
 
 A2B_BEGIN_DECLS
@@ -47,12 +68,46 @@ A2B_BEGIN_DECLS
 /* Forward declarations */
 struct a2b_StackContext;
 
+/** A list of timers expiring in the same wheel slot */
+LIST_HEAD(a2b_TimerSlot, a2b_Timer);
+
+/** Active timers of a stack, hashed by expiry time.
+ *
+ *  Level 0 holds timers expiring within the next 2^bits msec, one slot per
+ *  msec. Each level above covers 2^bits times the span of the one below.
+ *  When the lower levels wrap, the next slot of the level above is
+ *  cascaded, i.e. its timers are re-placed closer to their expiry. A tick
+ *  therefore only touches the slot of each elapsed msec plus the timers
+ *  that expire or cascade, no matter how many timers are idle.
+ */
+typedef struct a2b_TimerWheel
+{
+    /** Time (in msec) up to which the wheel has been advanced */
+    a2b_UInt32              now;
+
+    /** Number of timers linked into the wheel (active timers) */
+    a2b_UInt32              count;
+
+    /** Timers that are due on the next tick */
+    struct a2b_TimerSlot    due;
+
+    /** The wheel slots, level 0 first */
+    struct a2b_TimerSlot    slot[A2B_TIMER_WHEEL_LEVELS][A2B_TIMER_WHEEL_SLOTS];
+
+} a2b_TimerWheel;
+
 /** The detailed timer implementation */
 typedef struct a2b_Timer
 {
     /** Link to the next timer in the linked list of allocated timers */
     SLIST_ENTRY(a2b_Timer)     link;
 
+    /** Link into the timer wheel slot while the timer is active */
+    LIST_ENTRY(a2b_Timer)      wheelLink;
+
+    /** The absolute time (in msec) the active timer expires */
+    a2b_UInt32          expires;
+
     /** The time (in msec) the timer will expire after initially starting */
     a2b_UInt32          after;
 
@@ -25,6 +25,7 @@
 #include "trace_priv.h"
 #include "a2bstack/inc/a2b/trace.h"
 #include "a2bstack/inc/a2b/util.h"
+#include "a2bstack/inc/a2b/error.h"
 #include "utilmacros.h"
 
 
@@ -35,13 +36,76 @@
 #define IS_ENABLED(lvl, mask)   (((lvl) & (A2B_TRC_DOM_MASK & (mask))) && \
                                  ((lvl) & (A2B_TRC_LVL_MASK & (mask))))
 
+#ifdef A2B_FEATURE_TRACE_BINARY
+#if (A2B_CONF_CHAR_BIT != 8u)
+#error "The binary trace dump expects 8-bit characters"
+#endif
+#if (A2B_CONF_TRACE_BIN_SIZE < 128u) || (A2B_CONF_TRACE_BIN_SIZE > 0xFFFFu)
+#error "A2B_CONF_TRACE_BIN_SIZE must be 128 to 65535 words"
+#endif
+
+/** Record words before the format address or inline text */
+#define A2B_TRCBIN_FIXED_WORDS  (A2B_TRCBIN_REC_FILE + (2u * A2B_TRCBIN_PTR_WORDS))
+
+/** Longest inline text, as for a formatted message */
+#define A2B_TRCBIN_MAX_TEXT     (A2B_CONF_TRACE_BUF_SIZE - 1u)
+#endif
+
+/*======================= D A T A T Y P E S =======================*/
+
+#ifdef A2B_FEATURE_TRACE_BINARY
+/** Argument layout of a format string, see a2b_vsnprintfArgKinds() */
+typedef struct a2b_TraceBinFmt
+{
+    const a2b_Char*     fmt;
+    a2b_UInt32          desc;
+} a2b_TraceBinFmt;
+
+/** The binary trace ring. There is a single writer (the stack runs from
+ *  the application main loop), so no locking is needed. When a record
+ *  does not fit the oldest ones are dropped.
+ */
+typedef struct a2b_TraceBinRing
+{
+    a2b_UInt32          head;       /*!< Word index of the next record */
+    a2b_UInt32          tail;       /*!< Word index of the oldest record */
+    a2b_UInt32          nRecords;   /*!< Records (and fillers) in the ring */
+    a2b_UInt32          nDropped;   /*!< Messages overwritten */
+    a2b_UInt32          words[A2B_CONF_TRACE_BIN_SIZE];
+} a2b_TraceBinRing;
+#endif
+
 /*======================= L O C A L  P R O T O T Y P E S  =========*/
+#ifdef A2B_FEATURE_TRACE_BINARY
+static a2b_UInt32 a2b_traceBinFmtDesc(const a2b_Char* fmt);
+static void a2b_traceBinDrop(a2b_UInt32 start, a2b_UInt32 end);
+static a2b_UInt32* a2b_traceBinReserve(a2b_UInt32 nWords);
+static void a2b_traceBinRecord(struct a2b_TraceChannel* chan,
+    a2b_UInt32 level, const a2b_Char* fmt, void** args, a2b_UInt16 numArgs,
+    a2b_UInt32 flags);
+static a2b_UInt32 a2b_traceBinWalk(a2b_TraceBinWriteFunc writeFunc,
+    a2b_Handle hnd, a2b_Bool strings, a2b_UInt32* nStrings);
+#else
 static void a2b_traceLevelString(struct a2b_TraceChannel* chan,
     a2b_UInt32 level);
+#endif
+static void a2b_traceOutput(struct a2b_StackContext* ctx, a2b_UInt32 level,
+    const a2b_Char* fmt, void** args, a2b_UInt16 numArgs);
+
 /*======================= D A T A  ================================*/
 
+#ifdef A2B_FEATURE_TRACE_BINARY
+/** Shared by all stack instances and kept across a2b_stackFree() so the
+ *  history leading up to a restart of the stack survives it.
+ */
+static a2b_TraceBinRing gTraceBin;
+static a2b_TraceBinFmt gTraceBinFmt[A2B_CONF_TRACE_BIN_FMT_CACHE];
+static a2b_UIntPtr gTraceBinDumpStr[A2B_CONF_TRACE_BIN_DUMP_STRINGS];
+#endif
+
 /*======================= C O D E =================================*/
 
+#ifndef A2B_FEATURE_TRACE_BINARY
 /*!**************************************************************************** 
 *  \ingroup        a2bstack_trace_priv
 *
@@ -115,6 +179,464 @@ a2b_traceLevelString
     }
 
 } /* a2b_traceLevelString */
+#endif /* A2B_FEATURE_TRACE_BINARY */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_trace_priv
+*
+*  \b              a2b_traceOutput
+*
+*  Outputs a trace message that is enabled for the channel: formatted and
+*  written to the log channel, or with #A2B_FEATURE_TRACE_BINARY stored in
+*  the binary trace ring.
+*
+*  \param          [in]    ctx      The A2B stack context.
+*
+*  \param          [in]    level    The A2B level for the trace.
+*
+*  \param          [in]    fmt      The trace format string.
+*
+*  \param          [in]    args     The format parameters.
+*
+*  \param          [in]    numArgs  The number of format parameters.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE is enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_traceOutput
+    (
+    struct a2b_StackContext*   ctx,
+    a2b_UInt32          level,
+    const a2b_Char*     fmt,
+    void**              args,
+    a2b_UInt16          numArgs
+    )
+{
+    if ( A2B_NULL != ctx )
+    {
+        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
+
+        if ( IS_ENABLED(level, chan->mask) )
+        {
+#ifdef A2B_FEATURE_TRACE_BINARY
+            a2b_traceBinRecord(chan, level, fmt, args, numArgs, 0u);
+#else
+            a2b_traceLevelString(chan, level);
+            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args, numArgs);
+            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
+            a2b_stringBufferClear(&chan->strBuf);
+#endif
+        }
+    }
+} /* a2b_traceOutput */
+
+
+#ifdef A2B_FEATURE_TRACE_BINARY
+/*!****************************************************************************
+*  \ingroup        a2bstack_trace_priv
+*
+*  \b              a2b_traceBinFmtDesc
+*
+*  Returns the argument kinds of a format string from a small cache keyed
+*  by its address, so each call site is parsed once.
+*
+*  \param          [in]    fmt      The trace format string.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         See a2b_vsnprintfArgKinds().
+*
+******************************************************************************/
+static a2b_UInt32
+a2b_traceBinFmtDesc
+    (
+    const a2b_Char*     fmt
+    )
+{
+    a2b_TraceBinFmt* entry = &gTraceBinFmt[((a2b_UIntPtr)fmt >> 2u) &
+                                    (A2B_CONF_TRACE_BIN_FMT_CACHE - 1u)];
+
+    if ( entry->fmt != fmt )
+    {
+        entry->desc = a2b_vsnprintfArgKinds(fmt);
+        entry->fmt = fmt;
+    }
+
+    return entry->desc;
+} /* a2b_traceBinFmtDesc */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_trace_priv
+*
+*  \b              a2b_traceBinDrop
+*
+*  Drops the oldest records while they start within words [start, end) of
+*  the ring.
+*
+*  \param          [in]    start    First word to be overwritten.
+*
+*  \param          [in]    end      One past the last word to be overwritten.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_traceBinDrop
+    (
+    a2b_UInt32  start,
+    a2b_UInt32  end
+    )
+{
+    a2b_UInt32 hdr;
+
+    while ( (0u != gTraceBin.nRecords) && (gTraceBin.tail >= start) &&
+            (gTraceBin.tail < end) )
+    {
+        hdr = gTraceBin.words[gTraceBin.tail];
+        if ( 0u == (A2B_TRCBIN_REC_FLAGS(hdr) & A2B_TRCBIN_FLAG_PAD) )
+        {
+            gTraceBin.nDropped++;
+        }
+        gTraceBin.tail += A2B_TRCBIN_REC_WORDS(hdr);
+        if ( gTraceBin.tail >= A2B_CONF_TRACE_BIN_SIZE )
+        {
+            gTraceBin.tail = 0u;
+        }
+        gTraceBin.nRecords--;
+    }
+} /* a2b_traceBinDrop */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_trace_priv
+*
+*  \b              a2b_traceBinReserve
+*
+*  Reserves contiguous words for a record at the head of the ring. A
+*  record never wraps: the end of the ring is filled with a filler record
+*  and the record starts over at the beginning.
+*
+*  \param          [in]    nWords   Size of the record in words.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY is enabled.
+*
+*  \post           Older records that overlap are dropped.
+*
+*  \return         The first word of the record.
+*
+******************************************************************************/
+static a2b_UInt32*
+a2b_traceBinReserve
+    (
+    a2b_UInt32  nWords
+    )
+{
+    a2b_UInt32 start = gTraceBin.head;
+
+    if ( (start + nWords) > A2B_CONF_TRACE_BIN_SIZE )
+    {
+        if ( start < A2B_CONF_TRACE_BIN_SIZE )
+        {
+            a2b_traceBinDrop(start, A2B_CONF_TRACE_BIN_SIZE);
+            if ( 0u == gTraceBin.nRecords )
+            {
+                gTraceBin.tail = start;
+            }
+            gTraceBin.words[start] = A2B_TRCBIN_REC(
+                    A2B_CONF_TRACE_BIN_SIZE - start, A2B_TRCBIN_FLAG_PAD);
+            gTraceBin.nRecords++;
+        }
+        start = 0u;
+    }
+
+    a2b_traceBinDrop(start, start + nWords);
+    if ( 0u == gTraceBin.nRecords )
+    {
+        gTraceBin.tail = start;
+    }
+    gTraceBin.nRecords++;
+    gTraceBin.head = start + nWords;
+
+    return &gTraceBin.words[start];
+} /* a2b_traceBinReserve */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_trace_priv
+*
+*  \b              a2b_traceBinRecord
+*
+*  Stores a trace message in the binary trace ring: the prefix kept by
+*  a2b_tracePrintPrefix(), the level, the format address and the argument
+*  values. Nothing is formatted.
+*
+*  \param          [in]    chan     The trace channel.
+*
+*  \param          [in]    level    The A2B level for the trace.
+*
+*  \param          [in]    fmt      The trace format string, or the text
+*                                   with #A2B_TRCBIN_FLAG_TEXT.
+*
+*  \param          [in]    args     The format parameters.
+*
+*  \param          [in]    numArgs  The number of format parameters.
+*
+*  \param          [in]    flags    0 or #A2B_TRCBIN_FLAG_TEXT to copy the
+*                                   text into the record.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+static void
+a2b_traceBinRecord
+    (
+    struct a2b_TraceChannel*   chan,
+    a2b_UInt32          level,
+    const a2b_Char*     fmt,
+    void**              args,
+    a2b_UInt16          numArgs,
+    a2b_UInt32          flags
+    )
+{
+    a2b_UInt32* rec;
+    a2b_UInt32 desc = 0u;
+    a2b_UInt32 nArgs = 0u;
+    a2b_UInt32 nText = 0u;
+    a2b_UInt32 nWords = A2B_TRCBIN_FIXED_WORDS;
+    a2b_UInt32 idx;
+    a2b_UInt32 kind;
+    a2b_UInt32 pos;
+#ifdef A2B_FEATURE_64_BIT_INTEGER
+    a2b_UInt64 value64;
+#endif
+
+    if ( 0u != (flags & A2B_TRCBIN_FLAG_TEXT) )
+    {
+        if ( A2B_NULL != fmt )
+        {
+            nText = (a2b_UInt32)a2b_strlen(fmt);
+            nText = A2B_MIN(nText, A2B_TRCBIN_MAX_TEXT);
+        }
+        nWords += 1u + ((nText + 3u) / 4u);
+    }
+    else
+    {
+        desc = a2b_traceBinFmtDesc(fmt);
+        nArgs = A2B_MIN(A2B_TRCBIN_DESC_COUNT(desc), (a2b_UInt32)numArgs);
+        nWords += A2B_TRCBIN_PTR_WORDS;
+        for ( idx = 0u; idx < nArgs; idx++ )
+        {
+            kind = A2B_TRCBIN_DESC_KIND(desc, idx);
+            if ( kind == A2B_TRCBIN_ARG_64 )
+            {
+                nWords += 2u;
+            }
+            else if ( kind >= A2B_TRCBIN_ARG_PTR )
+            {
+                nWords += A2B_TRCBIN_PTR_WORDS;
+            }
+            else
+            {
+                nWords++;
+            }
+        }
+    }
+
+    rec = a2b_traceBinReserve(nWords);
+    rec[A2B_TRCBIN_REC_HDR] = A2B_TRCBIN_REC(nWords, flags);
+    rec[A2B_TRCBIN_REC_TIME] = chan->time;
+    rec[A2B_TRCBIN_REC_LEVEL] = level;
+    rec[A2B_TRCBIN_REC_LINE] = chan->line;
+    pos = a2b_binPutPtr(rec, A2B_TRCBIN_REC_FILE, chan->file);
+    pos = a2b_binPutPtr(rec, pos, chan->funcName);
+
+    if ( 0u != (flags & A2B_TRCBIN_FLAG_TEXT) )
+    {
+        rec[pos] = nText;
+        if ( 0u != (nText & 3u) )
+        {
+            rec[pos + 1u + (nText / 4u)] = 0u;
+        }
+        (void)a2b_memcpy(&rec[pos + 1u], fmt, nText);
+    }
+    else
+    {
+        pos = a2b_binPutPtr(rec, pos, fmt);
+        for ( idx = 0u; idx < nArgs; idx++ )
+        {
+            switch ( A2B_TRCBIN_DESC_KIND(desc, idx) )
+            {
+                case A2B_TRCBIN_ARG_8:
+                    rec[pos] = *((const a2b_UInt8*)args[idx]);
+                    pos++;
+                    break;
+                case A2B_TRCBIN_ARG_16:
+                    rec[pos] = *((const a2b_UInt16*)args[idx]);
+                    pos++;
+                    break;
+#ifdef A2B_FEATURE_64_BIT_INTEGER
+                case A2B_TRCBIN_ARG_64:
+                    value64 = *((const a2b_UInt64*)args[idx]);
+                    rec[pos] = (a2b_UInt32)value64;
+                    rec[pos + 1u] = (a2b_UInt32)(value64 >> 32u);
+                    pos += 2u;
+                    break;
+#endif
+                case A2B_TRCBIN_ARG_PTR:
+                case A2B_TRCBIN_ARG_STR:
+                    pos = a2b_binPutPtr(rec, pos, args[idx]);
+                    break;
+                case A2B_TRCBIN_ARG_32:
+                default:
+                    rec[pos] = *((const a2b_UInt32*)args[idx]);
+                    pos++;
+                    break;
+            }
+        }
+    }
+} /* a2b_traceBinRecord */
+
+
+/*!****************************************************************************
+*  \ingroup        a2bstack_trace_priv
+*
+*  \b              a2b_traceBinWalk
+*
+*  Walks the records of the ring, oldest first. Writes the records, or the
+*  strings they refer to when strings is set, or only counts the record
+*  words when writeFunc is A2B_NULL.
+*
+*  \param          [in]        writeFunc    Receives the dump, or A2B_NULL.
+*
+*  \param          [in]        hnd          Handle for writeFunc.
+*
+*  \param          [in]        strings      Write the strings instead of
+*                                           the records.
+*
+*  \param          [in,out]    nStrings     Strings written so far.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         The number of record words.
+*
+******************************************************************************/
+static a2b_UInt32
+a2b_traceBinWalk
+    (
+    a2b_TraceBinWriteFunc   writeFunc,
+    a2b_Handle              hnd,
+    a2b_Bool                strings,
+    a2b_UInt32*             nStrings
+    )
+{
+    const a2b_UInt32* rec;
+    a2b_UInt32 total = 0u;
+    a2b_UInt32 idx = gTraceBin.tail;
+    a2b_UInt32 n;
+    a2b_UInt32 nWords;
+    a2b_UInt32 flags;
+    a2b_UInt32 desc;
+    a2b_UInt32 kind;
+    a2b_UInt32 arg;
+    a2b_UInt32 pos;
+
+    for ( n = 0u; n < gTraceBin.nRecords; n++ )
+    {
+        rec = &gTraceBin.words[idx];
+        nWords = A2B_TRCBIN_REC_WORDS(rec[A2B_TRCBIN_REC_HDR]);
+        flags = A2B_TRCBIN_REC_FLAGS(rec[A2B_TRCBIN_REC_HDR]);
+
+        if ( 0u == (flags & A2B_TRCBIN_FLAG_PAD) )
+        {
+            total += nWords;
+            if ( A2B_NULL == writeFunc )
+            {
+                /* Count only */
+            }
+            else if ( !strings )
+            {
+                writeFunc(hnd, (const a2b_Byte*)rec, nWords * 4u);
+            }
+            else
+            {
+                pos = A2B_TRCBIN_REC_FILE;
+                a2b_binDumpStr(writeFunc, hnd, a2b_binGetPtr(rec, pos),
+                            A2B_TRUE, gTraceBinDumpStr,
+                            A2B_CONF_TRACE_BIN_DUMP_STRINGS, nStrings);
+                pos += A2B_TRCBIN_PTR_WORDS;
+                a2b_binDumpStr(writeFunc, hnd, a2b_binGetPtr(rec, pos),
+                            A2B_FALSE, gTraceBinDumpStr,
+                            A2B_CONF_TRACE_BIN_DUMP_STRINGS, nStrings);
+                pos += A2B_TRCBIN_PTR_WORDS;
+
+                if ( 0u == (flags & (A2B_TRCBIN_FLAG_TEXT |
+                                     A2B_TRCBIN_FLAG_I2C)) )
+                {
+                    a2b_binDumpStr(writeFunc, hnd, a2b_binGetPtr(rec, pos),
+                            A2B_FALSE, gTraceBinDumpStr,
+                            A2B_CONF_TRACE_BIN_DUMP_STRINGS, nStrings);
+                    desc = a2b_vsnprintfArgKinds(
+                            (const a2b_Char*)a2b_binGetPtr(rec, pos));
+                    pos += A2B_TRCBIN_PTR_WORDS;
+
+                    /* The arguments fill the rest of the record */
+                    for ( arg = 0u; pos < nWords; arg++ )
+                    {
+                        kind = A2B_TRCBIN_DESC_KIND(desc, arg);
+                        if ( kind == A2B_TRCBIN_ARG_STR )
+                        {
+                            a2b_binDumpStr(writeFunc, hnd,
+                                    a2b_binGetPtr(rec, pos), A2B_FALSE,
+                                    gTraceBinDumpStr,
+                                    A2B_CONF_TRACE_BIN_DUMP_STRINGS,
+                                    nStrings);
+                        }
+                        if ( kind == A2B_TRCBIN_ARG_64 )
+                        {
+                            pos += 2u;
+                        }
+                        else if ( kind >= A2B_TRCBIN_ARG_PTR )
+                        {
+                            pos += A2B_TRCBIN_PTR_WORDS;
+                        }
+                        else
+                        {
+                            pos++;
+                        }
+                    }
+                }
+            }
+        }
+
+        idx += nWords;
+        if ( idx >= A2B_CONF_TRACE_BIN_SIZE )
+        {
+            idx = 0u;
+        }
+    }
+
+    return total;
+} /* a2b_traceBinWalk */
+#endif /* A2B_FEATURE_TRACE_BINARY */
 
 
 /*!****************************************************************************
@@ -156,6 +678,16 @@ a2b_traceAlloc
         chan = A2B_MALLOC(ctx->stk, sizeof(*chan));
         if ( A2B_NULL != chan )
         {
+#ifdef A2B_FEATURE_TRACE_BINARY
+            /* Messages go to the binary ring, no log channel is needed */
+            chan->hnd = A2B_NULL;
+            chan->ctx  = ctx;
+            chan->mask = A2B_TRC_LVL_DEFAULT;
+            chan->file = A2B_NULL;
+            chan->funcName = A2B_NULL;
+            chan->line = 0u;
+            chan->time = 0u;
+#else
             chan->hnd = ctx->stk->pal.logOpen(name);
             if ( A2B_NULL == chan->hnd )
             {
@@ -169,6 +701,7 @@ a2b_traceAlloc
                 a2b_stringBufferInit(&chan->strBuf, chan->buf,
                                         A2B_ARRAY_SIZE(chan->buf));
             }
+#endif
         }
     }
     return chan;
@@ -199,7 +732,9 @@ a2b_traceFree
 {
     if ( A2B_NULL != chan )
     {
+#ifndef A2B_FEATURE_TRACE_BINARY
         chan->ctx->stk->pal.logClose(chan->hnd);
+#endif
 		a2b_traceSetMask(chan->ctx, 0);
         A2B_FREE(chan->ctx->stk, chan);
     }
@@ -260,6 +795,8 @@ a2b_traceIsEnabled
 *  Outputs a prefix which includes the current time, file name,
 *  function (optional), and line number to the trace channel. It is assumed
 *  this function is always called prior to the actual trace message.
+*  With #A2B_FEATURE_TRACE_BINARY the prefix is only remembered and is
+*  stored with the message.
 *
 *  \param          [in]    ctx      The A2B stack context.
 * 
@@ -291,13 +828,27 @@ a2b_tracePrintPrefix
     a2b_UInt32          line
     )
 {
+#ifndef A2B_FEATURE_TRACE_BINARY
     void* args[4];
+    const a2b_Char* fileName;
+#endif
     a2b_UInt32 curTime = 0;
 	char* pch;
 
     if ( A2B_NULL != ctx )
     {
-        const a2b_Char* fileName = a2b_strrchr(file, A2B_CONF_PATH_SEPARATOR);
+        curTime = ctx->stk->pal.timerGetSysTime();
+
+#ifdef A2B_FEATURE_TRACE_BINARY
+        /* Kept for the record written by the message that follows. The
+         * path is stripped from the file name by a2b_traceBinDump().
+         */
+        ctx->stk->traceChan->file = file;
+        ctx->stk->traceChan->funcName = funcName;
+        ctx->stk->traceChan->line = line;
+        ctx->stk->traceChan->time = curTime;
+#else
+        fileName = a2b_strrchr(file, A2B_CONF_PATH_SEPARATOR);
         if ( A2B_NULL != fileName )
         {
             /* Point one past the path separator */
@@ -307,7 +858,6 @@ a2b_tracePrintPrefix
         {
             fileName = file;
         }
-        curTime = ctx->stk->pal.timerGetSysTime();
 
         if ( A2B_NULL != funcName )
         {
@@ -328,6 +878,7 @@ a2b_tracePrintPrefix
                                       "%010lu %s(%lu) ",
                                       args, 3);
         }
+#endif
     }
 } /* a2b_tracePrintPrefix */
 
@@ -439,7 +990,13 @@ a2b_traceInject
         if ( IS_ENABLED(level, ctx->stk->traceChan->mask) )
         {
             a2b_tracePrintPrefix(ctx, "user", A2B_NULL, 0);
+#ifdef A2B_FEATURE_TRACE_BINARY
+            /* The text may not outlive the call, keep a copy */
+            a2b_traceBinRecord(ctx->stk->traceChan, level, text, A2B_NULL, 0u,
+                               A2B_TRCBIN_FLAG_TEXT);
+#else
             a2b_trace0(ctx, level, text);
+#endif
         }
     }
 } /* a2b_traceInject */
@@ -477,18 +1034,7 @@ a2b_trace0
     const a2b_Char*     fmt
     )
 {
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
-
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, A2B_NULL, 0);
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
-    }
+    a2b_traceOutput(ctx, level, fmt, A2B_NULL, 0u);
 } /* a2b_trace0 */
 
 
@@ -537,19 +1083,7 @@ a2b_trace1
 
     args[0u] = a1;
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
-
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
-    }
+    a2b_traceOutput(ctx, level, fmt, args, A2B_ARRAY_SIZE(args));
 } /* a2b_trace1 */
 
 
@@ -602,19 +1136,7 @@ a2b_trace2
     args[0u] = a1;
     args[1u] = a2;
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
-
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
-    }
+    a2b_traceOutput(ctx, level, fmt, args, A2B_ARRAY_SIZE(args));
 } /* a2b_trace2 */
 
 
@@ -668,19 +1190,7 @@ a2b_trace3
     args[1u] = a2;
     args[2u] = a3;
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
-
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
-    }
+    a2b_traceOutput(ctx, level, fmt, args, A2B_ARRAY_SIZE(args));
 } /* a2b_trace3 */
 
 
@@ -741,19 +1251,7 @@ a2b_trace4
     args[2u] = a3;
     args[3u] = a4;
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
-
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
-    }
+    a2b_traceOutput(ctx, level, fmt, args, A2B_ARRAY_SIZE(args));
 } /* a2b_trace4 */
 
 
@@ -818,19 +1316,7 @@ a2b_trace5
     args[3u] = a4;
     args[4u] = a5;
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
-
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
-    }
+    a2b_traceOutput(ctx, level, fmt, args, A2B_ARRAY_SIZE(args));
 } /* a2b_trace5 */
 
 
@@ -899,19 +1385,7 @@ a2b_trace6
     args[4u] = a5;
     args[5u] = a6;
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
-
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
-    }
+    a2b_traceOutput(ctx, level, fmt, args, A2B_ARRAY_SIZE(args));
 } /* a2b_trace6 */
 
 
@@ -984,19 +1458,7 @@ a2b_trace7
     args[5u] = a6;
     args[6u] = a7;
 
-    if ( A2B_NULL != ctx )
-    {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
-
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
-    }
+    a2b_traceOutput(ctx, level, fmt, args, A2B_ARRAY_SIZE(args));
 } /* a2b_trace7 */
 
 
@@ -1073,19 +1535,184 @@ a2b_trace8
     args[6u] = a7;
     args[7u] = a8;
 
-    if ( A2B_NULL != ctx )
+    a2b_traceOutput(ctx, level, fmt, args, A2B_ARRAY_SIZE(args));
+} /* a2b_trace8 */
+
+#ifdef A2B_FEATURE_TRACE_BINARY
+/*!****************************************************************************
+*  \ingroup        a2bstack_trace_priv
+*
+*  \b              a2b_traceI2c
+*
+*  Stores an I2C transfer in the binary trace ring as a single record
+*  (#A2B_TRCBIN_FLAG_I2C). The data bytes are copied, the host formats them
+*  as the text trace of the I2C layer does. Called through #A2B_TRACE_I2C,
+*  which records the prefix first.
+*
+*  \param          [in]    ctx      The A2B stack context.
+*
+*  \param          [in]    level    The A2B level for the trace.
+*
+*  \param          [in]    op       #A2B_TRCBIN_I2C_READ,
+*                                   #A2B_TRCBIN_I2C_WRITE or
+*                                   #A2B_TRCBIN_I2C_WRITE_READ.
+*
+*  \param          [in]    addr     The I2C address.
+*
+*  \param          [in]    nWrite   Number of bytes written.
+*
+*  \param          [in]    wBuf     The bytes written (may be A2B_NULL if
+*                                   nWrite is zero).
+*
+*  \param          [in]    nRead    Number of bytes read.
+*
+*  \param          [in]    rBuf     The bytes read (may be A2B_NULL if
+*                                   nRead is zero).
+*
+*  \param          [in]    result   The result of the transfer. The read
+*                                   bytes are only captured on success.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+A2B_DSO_LOCAL void
+a2b_traceI2c
+    (
+    struct a2b_StackContext*    ctx,
+    a2b_UInt32                  level,
+    a2b_UInt32                  op,
+    a2b_UInt16                  addr,
+    a2b_UInt16                  nWrite,
+    const a2b_Byte*             wBuf,
+    a2b_UInt16                  nRead,
+    const a2b_Byte*             rBuf,
+    a2b_HResult                 result
+    )
+{
+    struct a2b_TraceChannel* chan;
+    a2b_UInt32* rec;
+    a2b_UInt32 nBytes;
+    a2b_UInt32 pos;
+    a2b_Byte* data;
+
+    if ( A2B_NULL == ctx )
     {
-        struct a2b_TraceChannel* chan = ctx->stk->traceChan;
+        return;
+    }
+    chan = ctx->stk->traceChan;
+    if ( !IS_ENABLED(level, chan->mask) )
+    {
+        return;
+    }
 
-        if ( IS_ENABLED(level, chan->mask) )
-        {
-            a2b_traceLevelString(chan, level);
-            (void)a2b_vsnprintfStringBuffer(&chan->strBuf, fmt, args,
-                                        A2B_ARRAY_SIZE(args));
-            ctx->stk->pal.logWrite(chan->hnd, chan->buf);
-            a2b_stringBufferClear(&chan->strBuf);
-        }
+    rec = a2b_traceBinReserve(A2B_TRCBIN_I2C_WORDS);
+    rec[A2B_TRCBIN_REC_HDR] = A2B_TRCBIN_REC(A2B_TRCBIN_I2C_WORDS,
+                                             A2B_TRCBIN_FLAG_I2C);
+    rec[A2B_TRCBIN_REC_TIME] = chan->time;
+    rec[A2B_TRCBIN_REC_LEVEL] = level;
+    rec[A2B_TRCBIN_REC_LINE] = chan->line;
+    pos = a2b_binPutPtr(rec, A2B_TRCBIN_REC_FILE, chan->file);
+    pos = a2b_binPutPtr(rec, pos, chan->funcName);
+
+    rec[pos] = (a2b_UInt32)addr | (op << 16u);
+    rec[pos + 1u] = (a2b_UInt32)nWrite | ((a2b_UInt32)nRead << 16u);
+    rec[pos + 2u] = (a2b_UInt32)result;
+
+    data = (a2b_Byte*)&rec[pos + 3u];
+    (void)a2b_memset(data, 0, 2u * A2B_TRCBIN_I2C_DATA_BYTES);
+    if ( A2B_NULL != wBuf )
+    {
+        nBytes = A2B_MIN((a2b_UInt32)nWrite, A2B_TRCBIN_I2C_DATA_BYTES);
+        (void)a2b_memcpy(data, wBuf, nBytes);
     }
-} /* a2b_trace8 */
+    if ( (A2B_NULL != rBuf) && A2B_SUCCEEDED(result) )
+    {
+        nBytes = A2B_MIN((a2b_UInt32)nRead, A2B_TRCBIN_I2C_DATA_BYTES);
+        (void)a2b_memcpy(&data[A2B_TRCBIN_I2C_DATA_BYTES], rBuf, nBytes);
+    }
+} /* a2b_traceI2c */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_traceBinDump
+*
+*  Writes the binary trace ring, oldest message first, followed by the
+*  strings (file and function names, formats, %s arguments) the messages
+*  refer to. See the Binary Trace Format in trace.h. The dump is rendered
+*  to text on a host; strings are read when dumping, so a %s argument that
+*  pointed to a buffer shows its current content. File names are written
+*  without their path.
+*
+*  \param          [in]    writeFunc    Receives the dump, possibly in
+*                                       several calls.
+*
+*  \param          [in]    hnd          Handle passed to writeFunc.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY is
+*                  enabled. Not to be called while the stack is ticked.
+*
+*  \post           The ring is left as it is.
+*
+*  \return         None
+*
+******************************************************************************/
+A2B_DSO_PUBLIC void
+a2b_traceBinDump
+    (
+    a2b_TraceBinWriteFunc   writeFunc,
+    a2b_Handle              hnd
+    )
+{
+    a2b_UInt32 hdr[A2B_TRCBIN_HDR_WORDS];
+    a2b_UInt32 nStrings = 0u;
+    a2b_UInt32 end = A2B_TRCBIN_END;
+
+    if ( A2B_NULL != writeFunc )
+    {
+        hdr[0u] = A2B_TRCBIN_MAGIC;
+        hdr[1u] = A2B_TRCBIN_VERSION;
+        hdr[2u] = A2B_TRCBIN_PTR_WORDS;
+        hdr[3u] = a2b_traceBinWalk(A2B_NULL, hnd, A2B_FALSE, &nStrings);
+        hdr[4u] = gTraceBin.nDropped;
+        hdr[5u] = 0u;
+        writeFunc(hnd, (const a2b_Byte*)hdr, sizeof(hdr));
+
+        (void)a2b_traceBinWalk(writeFunc, hnd, A2B_FALSE, &nStrings);
+        (void)a2b_traceBinWalk(writeFunc, hnd, A2B_TRUE, &nStrings);
+        writeFunc(hnd, (const a2b_Byte*)&end, sizeof(end));
+    }
+} /* a2b_traceBinDump */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_traceBinClear
+*
+*  Empties the binary trace ring.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+A2B_DSO_PUBLIC void
+a2b_traceBinClear
+    (
+    void
+    )
+{
+    gTraceBin.head = 0u;
+    gTraceBin.tail = 0u;
+    gTraceBin.nRecords = 0u;
+    gTraceBin.nDropped = 0u;
+} /* a2b_traceBinClear */
+#endif /* A2B_FEATURE_TRACE_BINARY */
 
 #endif /* A2B_FEATURE_TRACE */
@@ -40,6 +40,30 @@
 
 /*======================= D E F I N E S ===========================*/
 
+/**
+ * With #A2B_FEATURE_TRACE_BINARY an I2C transfer is recorded by value
+ * and formatted on the host:
+ *
+ * \code
+ *          A2B_TRACE_I2C((ctx, (A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE2),
+ *                         A2B_TRCBIN_I2C_READ, addr, 0u, A2B_NULL,
+ *                         nRead, rBuf, result));
+ * \endcode
+ */
+#ifdef A2B_FEATURE_TRACE_BINARY
+#   if (__STDC_VERSION__ >= 199901L)
+#       define A2B_TRACE_I2C(X) \
+            do { \
+                a2b_tracePrintPrefix(a2b_traceIsEnabled X, __FILE__, __FUNCTION__, __LINE__); \
+            a2b_traceI2c X; } while ( 0 )
+#   else
+#       define A2B_TRACE_I2C(X) \
+            do { \
+                a2b_tracePrintPrefix(a2b_traceIsEnabled X, __FILE__, 0, __LINE__); \
+            a2b_traceI2c X; } while ( 0 )
+#   endif
+#endif
+
 
 /*======================= D A T A T Y P E S =======================*/
 
@@ -53,8 +77,16 @@ typedef struct a2b_TraceChannel
 {
     a2b_Handle                  hnd;
     a2b_UInt32                  mask;
+#ifdef A2B_FEATURE_TRACE_BINARY
+    /** Prefix of the message being traced (a2b_tracePrintPrefix) */
+    const a2b_Char*             file;
+    const a2b_Char*             funcName;
+    a2b_UInt32                  line;
+    a2b_UInt32                  time;
+#else
     a2b_Char                    buf[A2B_CONF_TRACE_BUF_SIZE];
     a2b_StringBuffer            strBuf;
+#endif
     struct a2b_StackContext*    ctx;
 } a2b_TraceChannel;
 
@@ -70,6 +102,19 @@ A2B_EXPORT A2B_DSO_LOCAL struct a2b_TraceChannel* a2b_traceAlloc(
 
 A2B_EXPORT A2B_DSO_LOCAL void a2b_traceFree(struct a2b_TraceChannel* chan);
 
+#ifdef A2B_FEATURE_TRACE_BINARY
+A2B_EXPORT A2B_DSO_LOCAL void a2b_traceI2c(
+                                    struct a2b_StackContext*    ctx,
+                                    a2b_UInt32                  level,
+                                    a2b_UInt32                  op,
+                                    a2b_UInt16                  addr,
+                                    a2b_UInt16                  nWrite,
+                                    const a2b_Byte*             wBuf,
+                                    a2b_UInt16                  nRead,
+                                    const a2b_Byte*             rBuf,
+                                    a2b_HResult                 result);
+#endif
+
 #endif /* A2B_FEATURE_TRACE */
 
 A2B_END_DECLS
@@ -67,6 +67,7 @@
 /*======================= I N C L U D E S =========================*/
 #include "a2bstack/inc/a2b/util.h"
 #include "a2bstack/inc/a2b/stringbuffer.h"
+#include "a2bstack/inc/a2b/trace.h"
 
 /*======================= D E F I N E S ===========================*/
 
@@ -94,11 +95,14 @@
 #define A2B_64BIT_INTEGER   ((a2b_UInt32)1u << (a2b_UInt32)3u)
 /** /} */
 
+#if defined(A2B_FEATURE_TRACE_BINARY) || defined(A2B_FEATURE_SEQ_CHART_BINARY)
+/** Longest string a binary dump writes, as for a formatted message */
+#define A2B_BIN_MAX_TEXT    (A2B_CONF_TRACE_BUF_SIZE - 1u)
+#endif
+
 
 /*======================= L O C A L  P R O T O T Y P E S  =========*/
 static a2b_Int8 a2b_alphaToDigit(a2b_Char    ch);
-static a2b_UInt8 a2b_doCrc8(a2b_UInt8   crc_in,
-    a2b_UInt8   data);
 static a2b_Char a2b_textToUnsigned(a2b_Char ch,
     const a2b_Char**  src, a2b_UInt16 base,
     a2b_UInt32*         retNum);
@@ -116,6 +120,429 @@ static void a2b_signedToText(a2b_Int32   num,
     a2b_Char*   buf);
 /*======================= D A T A  ================================*/
 
+#if (A2B_CONF_CRC_SLICES != 1u) && (A2B_CONF_CRC_SLICES != 4u)
+#error "A2B_CONF_CRC_SLICES must be 1 or 4"
+#endif
+
+/** CRC-8 (x^8 + x^2 + x + 1, MSB first) of every byte value. Row k holds
+ *  the CRC of the byte followed by k zero bytes, so #a2b_crc8Cont() can
+ *  fold #A2B_CONF_CRC_SLICES bytes per step.
+ */
+static const a2b_UInt8 gCrc8Table[A2B_CONF_CRC_SLICES][256] =
+{
+    {
+        0x00u, 0x07u, 0x0Eu, 0x09u, 0x1Cu, 0x1Bu, 0x12u, 0x15u,
+        0x38u, 0x3Fu, 0x36u, 0x31u, 0x24u, 0x23u, 0x2Au, 0x2Du,
+        0x70u, 0x77u, 0x7Eu, 0x79u, 0x6Cu, 0x6Bu, 0x62u, 0x65u,
+        0x48u, 0x4Fu, 0x46u, 0x41u, 0x54u, 0x53u, 0x5Au, 0x5Du,
+        0xE0u, 0xE7u, 0xEEu, 0xE9u, 0xFCu, 0xFBu, 0xF2u, 0xF5u,
+        0xD8u, 0xDFu, 0xD6u, 0xD1u, 0xC4u, 0xC3u, 0xCAu, 0xCDu,
+        0x90u, 0x97u, 0x9Eu, 0x99u, 0x8Cu, 0x8Bu, 0x82u, 0x85u,
+        0xA8u, 0xAFu, 0xA6u, 0xA1u, 0xB4u, 0xB3u, 0xBAu, 0xBDu,
+        0xC7u, 0xC0u, 0xC9u, 0xCEu, 0xDBu, 0xDCu, 0xD5u, 0xD2u,
+        0xFFu, 0xF8u, 0xF1u, 0xF6u, 0xE3u, 0xE4u, 0xEDu, 0xEAu,
+        0xB7u, 0xB0u, 0xB9u, 0xBEu, 0xABu, 0xACu, 0xA5u, 0xA2u,
+        0x8Fu, 0x88u, 0x81u, 0x86u, 0x93u, 0x94u, 0x9Du, 0x9Au,
+        0x27u, 0x20u, 0x29u, 0x2Eu, 0x3Bu, 0x3Cu, 0x35u, 0x32u,
+        0x1Fu, 0x18u, 0x11u, 0x16u, 0x03u, 0x04u, 0x0Du, 0x0Au,
+        0x57u, 0x50u, 0x59u, 0x5Eu, 0x4Bu, 0x4Cu, 0x45u, 0x42u,
+        0x6Fu, 0x68u, 0x61u, 0x66u, 0x73u, 0x74u, 0x7Du, 0x7Au,
+        0x89u, 0x8Eu, 0x87u, 0x80u, 0x95u, 0x92u, 0x9Bu, 0x9Cu,
+        0xB1u, 0xB6u, 0xBFu, 0xB8u, 0xADu, 0xAAu, 0xA3u, 0xA4u,
+        0xF9u, 0xFEu, 0xF7u, 0xF0u, 0xE5u, 0xE2u, 0xEBu, 0xECu,
+        0xC1u, 0xC6u, 0xCFu, 0xC8u, 0xDDu, 0xDAu, 0xD3u, 0xD4u,
+        0x69u, 0x6Eu, 0x67u, 0x60u, 0x75u, 0x72u, 0x7Bu, 0x7Cu,
+        0x51u, 0x56u, 0x5Fu, 0x58u, 0x4Du, 0x4Au, 0x43u, 0x44u,
+        0x19u, 0x1Eu, 0x17u, 0x10u, 0x05u, 0x02u, 0x0Bu, 0x0Cu,
+        0x21u, 0x26u, 0x2Fu, 0x28u, 0x3Du, 0x3Au, 0x33u, 0x34u,
+        0x4Eu, 0x49u, 0x40u, 0x47u, 0x52u, 0x55u, 0x5Cu, 0x5Bu,
+        0x76u, 0x71u, 0x78u, 0x7Fu, 0x6Au, 0x6Du, 0x64u, 0x63u,
+        0x3Eu, 0x39u, 0x30u, 0x37u, 0x22u, 0x25u, 0x2Cu, 0x2Bu,
+        0x06u, 0x01u, 0x08u, 0x0Fu, 0x1Au, 0x1Du, 0x14u, 0x13u,
+        0xAEu, 0xA9u, 0xA0u, 0xA7u, 0xB2u, 0xB5u, 0xBCu, 0xBBu,
+        0x96u, 0x91u, 0x98u, 0x9Fu, 0x8Au, 0x8Du, 0x84u, 0x83u,
+        0xDEu, 0xD9u, 0xD0u, 0xD7u, 0xC2u, 0xC5u, 0xCCu, 0xCBu,
+        0xE6u, 0xE1u, 0xE8u, 0xEFu, 0xFAu, 0xFDu, 0xF4u, 0xF3u
+    }
+#if (A2B_CONF_CRC_SLICES == 4u)
+    ,{
+        0x00u, 0x15u, 0x2Au, 0x3Fu, 0x54u, 0x41u, 0x7Eu, 0x6Bu,
+        0xA8u, 0xBDu, 0x82u, 0x97u, 0xFCu, 0xE9u, 0xD6u, 0xC3u,
+        0x57u, 0x42u, 0x7Du, 0x68u, 0x03u, 0x16u, 0x29u, 0x3Cu,
+        0xFFu, 0xEAu, 0xD5u, 0xC0u, 0xABu, 0xBEu, 0x81u, 0x94u,
+        0xAEu, 0xBBu, 0x84u, 0x91u, 0xFAu, 0xEFu, 0xD0u, 0xC5u,
+        0x06u, 0x13u, 0x2Cu, 0x39u, 0x52u, 0x47u, 0x78u, 0x6Du,
+        0xF9u, 0xECu, 0xD3u, 0xC6u, 0xADu, 0xB8u, 0x87u, 0x92u,
+        0x51u, 0x44u, 0x7Bu, 0x6Eu, 0x05u, 0x10u, 0x2Fu, 0x3Au,
+        0x5Bu, 0x4Eu, 0x71u, 0x64u, 0x0Fu, 0x1Au, 0x25u, 0x30u,
+        0xF3u, 0xE6u, 0xD9u, 0xCCu, 0xA7u, 0xB2u, 0x8Du, 0x98u,
+        0x0Cu, 0x19u, 0x26u, 0x33u, 0x58u, 0x4Du, 0x72u, 0x67u,
+        0xA4u, 0xB1u, 0x8Eu, 0x9Bu, 0xF0u, 0xE5u, 0xDAu, 0xCFu,
+        0xF5u, 0xE0u, 0xDFu, 0xCAu, 0xA1u, 0xB4u, 0x8Bu, 0x9Eu,
+        0x5Du, 0x48u, 0x77u, 0x62u, 0x09u, 0x1Cu, 0x23u, 0x36u,
+        0xA2u, 0xB7u, 0x88u, 0x9Du, 0xF6u, 0xE3u, 0xDCu, 0xC9u,
+        0x0Au, 0x1Fu, 0x20u, 0x35u, 0x5Eu, 0x4Bu, 0x74u, 0x61u,
+        0xB6u, 0xA3u, 0x9Cu, 0x89u, 0xE2u, 0xF7u, 0xC8u, 0xDDu,
+        0x1Eu, 0x0Bu, 0x34u, 0x21u, 0x4Au, 0x5Fu, 0x60u, 0x75u,
+        0xE1u, 0xF4u, 0xCBu, 0xDEu, 0xB5u, 0xA0u, 0x9Fu, 0x8Au,
+        0x49u, 0x5Cu, 0x63u, 0x76u, 0x1Du, 0x08u, 0x37u, 0x22u,
+        0x18u, 0x0Du, 0x32u, 0x27u, 0x4Cu, 0x59u, 0x66u, 0x73u,
+        0xB0u, 0xA5u, 0x9Au, 0x8Fu, 0xE4u, 0xF1u, 0xCEu, 0xDBu,
+        0x4Fu, 0x5Au, 0x65u, 0x70u, 0x1Bu, 0x0Eu, 0x31u, 0x24u,
+        0xE7u, 0xF2u, 0xCDu, 0xD8u, 0xB3u, 0xA6u, 0x99u, 0x8Cu,
+        0xEDu, 0xF8u, 0xC7u, 0xD2u, 0xB9u, 0xACu, 0x93u, 0x86u,
+        0x45u, 0x50u, 0x6Fu, 0x7Au, 0x11u, 0x04u, 0x3Bu, 0x2Eu,
+        0xBAu, 0xAFu, 0x90u, 0x85u, 0xEEu, 0xFBu, 0xC4u, 0xD1u,
+        0x12u, 0x07u, 0x38u, 0x2Du, 0x46u, 0x53u, 0x6Cu, 0x79u,
+        0x43u, 0x56u, 0x69u, 0x7Cu, 0x17u, 0x02u, 0x3Du, 0x28u,
+        0xEBu, 0xFEu, 0xC1u, 0xD4u, 0xBFu, 0xAAu, 0x95u, 0x80u,
+        0x14u, 0x01u, 0x3Eu, 0x2Bu, 0x40u, 0x55u, 0x6Au, 0x7Fu,
+        0xBCu, 0xA9u, 0x96u, 0x83u, 0xE8u, 0xFDu, 0xC2u, 0xD7u
+    }
+    ,{
+        0x00u, 0x6Bu, 0xD6u, 0xBDu, 0xABu, 0xC0u, 0x7Du, 0x16u,
+        0x51u, 0x3Au, 0x87u, 0xECu, 0xFAu, 0x91u, 0x2Cu, 0x47u,
+        0xA2u, 0xC9u, 0x74u, 0x1Fu, 0x09u, 0x62u, 0xDFu, 0xB4u,
+        0xF3u, 0x98u, 0x25u, 0x4Eu, 0x58u, 0x33u, 0x8Eu, 0xE5u,
+        0x43u, 0x28u, 0x95u, 0xFEu, 0xE8u, 0x83u, 0x3Eu, 0x55u,
+        0x12u, 0x79u, 0xC4u, 0xAFu, 0xB9u, 0xD2u, 0x6Fu, 0x04u,
+        0xE1u, 0x8Au, 0x37u, 0x5Cu, 0x4Au, 0x21u, 0x9Cu, 0xF7u,
+        0xB0u, 0xDBu, 0x66u, 0x0Du, 0x1Bu, 0x70u, 0xCDu, 0xA6u,
+        0x86u, 0xEDu, 0x50u, 0x3Bu, 0x2Du, 0x46u, 0xFBu, 0x90u,
+        0xD7u, 0xBCu, 0x01u, 0x6Au, 0x7Cu, 0x17u, 0xAAu, 0xC1u,
+        0x24u, 0x4Fu, 0xF2u, 0x99u, 0x8Fu, 0xE4u, 0x59u, 0x32u,
+        0x75u, 0x1Eu, 0xA3u, 0xC8u, 0xDEu, 0xB5u, 0x08u, 0x63u,
+        0xC5u, 0xAEu, 0x13u, 0x78u, 0x6Eu, 0x05u, 0xB8u, 0xD3u,
+        0x94u, 0xFFu, 0x42u, 0x29u, 0x3Fu, 0x54u, 0xE9u, 0x82u,
+        0x67u, 0x0Cu, 0xB1u, 0xDAu, 0xCCu, 0xA7u, 0x1Au, 0x71u,
+        0x36u, 0x5Du, 0xE0u, 0x8Bu, 0x9Du, 0xF6u, 0x4Bu, 0x20u,
+        0x0Bu, 0x60u, 0xDDu, 0xB6u, 0xA0u, 0xCBu, 0x76u, 0x1Du,
+        0x5Au, 0x31u, 0x8Cu, 0xE7u, 0xF1u, 0x9Au, 0x27u, 0x4Cu,
+        0xA9u, 0xC2u, 0x7Fu, 0x14u, 0x02u, 0x69u, 0xD4u, 0xBFu,
+        0xF8u, 0x93u, 0x2Eu, 0x45u, 0x53u, 0x38u, 0x85u, 0xEEu,
+        0x48u, 0x23u, 0x9Eu, 0xF5u, 0xE3u, 0x88u, 0x35u, 0x5Eu,
+        0x19u, 0x72u, 0xCFu, 0xA4u, 0xB2u, 0xD9u, 0x64u, 0x0Fu,
+        0xEAu, 0x81u, 0x3Cu, 0x57u, 0x41u, 0x2Au, 0x97u, 0xFCu,
+        0xBBu, 0xD0u, 0x6Du, 0x06u, 0x10u, 0x7Bu, 0xC6u, 0xADu,
+        0x8Du, 0xE6u, 0x5Bu, 0x30u, 0x26u, 0x4Du, 0xF0u, 0x9Bu,
+        0xDCu, 0xB7u, 0x0Au, 0x61u, 0x77u, 0x1Cu, 0xA1u, 0xCAu,
+        0x2Fu, 0x44u, 0xF9u, 0x92u, 0x84u, 0xEFu, 0x52u, 0x39u,
+        0x7Eu, 0x15u, 0xA8u, 0xC3u, 0xD5u, 0xBEu, 0x03u, 0x68u,
+        0xCEu, 0xA5u, 0x18u, 0x73u, 0x65u, 0x0Eu, 0xB3u, 0xD8u,
+        0x9Fu, 0xF4u, 0x49u, 0x22u, 0x34u, 0x5Fu, 0xE2u, 0x89u,
+        0x6Cu, 0x07u, 0xBAu, 0xD1u, 0xC7u, 0xACu, 0x11u, 0x7Au,
+        0x3Du, 0x56u, 0xEBu, 0x80u, 0x96u, 0xFDu, 0x40u, 0x2Bu
+    }
+    ,{
+        0x00u, 0x16u, 0x2Cu, 0x3Au, 0x58u, 0x4Eu, 0x74u, 0x62u,
+        0xB0u, 0xA6u, 0x9Cu, 0x8Au, 0xE8u, 0xFEu, 0xC4u, 0xD2u,
+        0x67u, 0x71u, 0x4Bu, 0x5Du, 0x3Fu, 0x29u, 0x13u, 0x05u,
+        0xD7u, 0xC1u, 0xFBu, 0xEDu, 0x8Fu, 0x99u, 0xA3u, 0xB5u,
+        0xCEu, 0xD8u, 0xE2u, 0xF4u, 0x96u, 0x80u, 0xBAu, 0xACu,
+        0x7Eu, 0x68u, 0x52u, 0x44u, 0x26u, 0x30u, 0x0Au, 0x1Cu,
+        0xA9u, 0xBFu, 0x85u, 0x93u, 0xF1u, 0xE7u, 0xDDu, 0xCBu,
+        0x19u, 0x0Fu, 0x35u, 0x23u, 0x41u, 0x57u, 0x6Du, 0x7Bu,
+        0x9Bu, 0x8Du, 0xB7u, 0xA1u, 0xC3u, 0xD5u, 0xEFu, 0xF9u,
+        0x2Bu, 0x3Du, 0x07u, 0x11u, 0x73u, 0x65u, 0x5Fu, 0x49u,
+        0xFCu, 0xEAu, 0xD0u, 0xC6u, 0xA4u, 0xB2u, 0x88u, 0x9Eu,
+        0x4Cu, 0x5Au, 0x60u, 0x76u, 0x14u, 0x02u, 0x38u, 0x2Eu,
+        0x55u, 0x43u, 0x79u, 0x6Fu, 0x0Du, 0x1Bu, 0x21u, 0x37u,
+        0xE5u, 0xF3u, 0xC9u, 0xDFu, 0xBDu, 0xABu, 0x91u, 0x87u,
+        0x32u, 0x24u, 0x1Eu, 0x08u, 0x6Au, 0x7Cu, 0x46u, 0x50u,
+        0x82u, 0x94u, 0xAEu, 0xB8u, 0xDAu, 0xCCu, 0xF6u, 0xE0u,
+        0x31u, 0x27u, 0x1Du, 0x0Bu, 0x69u, 0x7Fu, 0x45u, 0x53u,
+        0x81u, 0x97u, 0xADu, 0xBBu, 0xD9u, 0xCFu, 0xF5u, 0xE3u,
+        0x56u, 0x40u, 0x7Au, 0x6Cu, 0x0Eu, 0x18u, 0x22u, 0x34u,
+        0xE6u, 0xF0u, 0xCAu, 0xDCu, 0xBEu, 0xA8u, 0x92u, 0x84u,
+        0xFFu, 0xE9u, 0xD3u, 0xC5u, 0xA7u, 0xB1u, 0x8Bu, 0x9Du,
+        0x4Fu, 0x59u, 0x63u, 0x75u, 0x17u, 0x01u, 0x3Bu, 0x2Du,
+        0x98u, 0x8Eu, 0xB4u, 0xA2u, 0xC0u, 0xD6u, 0xECu, 0xFAu,
+        0x28u, 0x3Eu, 0x04u, 0x12u, 0x70u, 0x66u, 0x5Cu, 0x4Au,
+        0xAAu, 0xBCu, 0x86u, 0x90u, 0xF2u, 0xE4u, 0xDEu, 0xC8u,
+        0x1Au, 0x0Cu, 0x36u, 0x20u, 0x42u, 0x54u, 0x6Eu, 0x78u,
+        0xCDu, 0xDBu, 0xE1u, 0xF7u, 0x95u, 0x83u, 0xB9u, 0xAFu,
+        0x7Du, 0x6Bu, 0x51u, 0x47u, 0x25u, 0x33u, 0x09u, 0x1Fu,
+        0x64u, 0x72u, 0x48u, 0x5Eu, 0x3Cu, 0x2Au, 0x10u, 0x06u,
+        0xD4u, 0xC2u, 0xF8u, 0xEEu, 0x8Cu, 0x9Au, 0xA0u, 0xB6u,
+        0x03u, 0x15u, 0x2Fu, 0x39u, 0x5Bu, 0x4Du, 0x77u, 0x61u,
+        0xB3u, 0xA5u, 0x9Fu, 0x89u, 0xEBu, 0xFDu, 0xC7u, 0xD1u
+    }
+#endif
+};
+
+/** CRC-32 (IEEE 802.3, reflected 0xEDB88320) of every byte value, row k
+ *  again for the byte followed by k zero bytes.
+ */
+static const a2b_UInt32 gCrc32Table[A2B_CONF_CRC_SLICES][256] =
+{
+    {
+        0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu,
+        0x076DC419u, 0x706AF48Fu, 0xE963A535u, 0x9E6495A3u,
+        0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u,
+        0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u,
+        0x1DB71064u, 0x6AB020F2u, 0xF3B97148u, 0x84BE41DEu,
+        0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,
+        0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu,
+        0x14015C4Fu, 0x63066CD9u, 0xFA0F3D63u, 0x8D080DF5u,
+        0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u,
+        0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu,
+        0x35B5A8FAu, 0x42B2986Cu, 0xDBBBC9D6u, 0xACBCF940u,
+        0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+        0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u,
+        0x21B4F4B5u, 0x56B3C423u, 0xCFBA9599u, 0xB8BDA50Fu,
+        0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u,
+        0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du,
+        0x76DC4190u, 0x01DB7106u, 0x98D220BCu, 0xEFD5102Au,
+        0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,
+        0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u,
+        0x7F6A0DBBu, 0x086D3D2Du, 0x91646C97u, 0xE6635C01u,
+        0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu,
+        0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u,
+        0x65B0D9C6u, 0x12B7E950u, 0x8BBEB8EAu, 0xFCB9887Cu,
+        0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+        0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u,
+        0x4ADFA541u, 0x3DD895D7u, 0xA4D1C46Du, 0xD3D6F4FBu,
+        0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u,
+        0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u,
+        0x5005713Cu, 0x270241AAu, 0xBE0B1010u, 0xC90C2086u,
+        0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,
+        0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u,
+        0x59B33D17u, 0x2EB40D81u, 0xB7BD5C3Bu, 0xC0BA6CADu,
+        0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au,
+        0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u,
+        0xE3630B12u, 0x94643B84u, 0x0D6D6A3Eu, 0x7A6A5AA8u,
+        0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+        0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu,
+        0xF762575Du, 0x806567CBu, 0x196C3671u, 0x6E6B06E7u,
+        0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu,
+        0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u,
+        0xD6D6A3E8u, 0xA1D1937Eu, 0x38D8C2C4u, 0x4FDFF252u,
+        0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,
+        0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u,
+        0xDF60EFC3u, 0xA867DF55u, 0x316E8EEFu, 0x4669BE79u,
+        0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u,
+        0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu,
+        0xC5BA3BBEu, 0xB2BD0B28u, 0x2BB45A92u, 0x5CB36A04u,
+        0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+        0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au,
+        0x9C0906A9u, 0xEB0E363Fu, 0x72076785u, 0x05005713u,
+        0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u,
+        0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u,
+        0x86D3D2D4u, 0xF1D4E242u, 0x68DDB3F8u, 0x1FDA836Eu,
+        0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,
+        0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu,
+        0x8F659EFFu, 0xF862AE69u, 0x616BFFD3u, 0x166CCF45u,
+        0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u,
+        0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu,
+        0xAED16A4Au, 0xD9D65ADCu, 0x40DF0B66u, 0x37D83BF0u,
+        0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+        0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u,
+        0xBAD03605u, 0xCDD70693u, 0x54DE5729u, 0x23D967BFu,
+        0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u,
+        0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du
+    }
+#if (A2B_CONF_CRC_SLICES == 4u)
+    ,{
+        0x00000000u, 0x191B3141u, 0x32366282u, 0x2B2D53C3u,
+        0x646CC504u, 0x7D77F445u, 0x565AA786u, 0x4F4196C7u,
+        0xC8D98A08u, 0xD1C2BB49u, 0xFAEFE88Au, 0xE3F4D9CBu,
+        0xACB54F0Cu, 0xB5AE7E4Du, 0x9E832D8Eu, 0x87981CCFu,
+        0x4AC21251u, 0x53D92310u, 0x78F470D3u, 0x61EF4192u,
+        0x2EAED755u, 0x37B5E614u, 0x1C98B5D7u, 0x05838496u,
+        0x821B9859u, 0x9B00A918u, 0xB02DFADBu, 0xA936CB9Au,
+        0xE6775D5Du, 0xFF6C6C1Cu, 0xD4413FDFu, 0xCD5A0E9Eu,
+        0x958424A2u, 0x8C9F15E3u, 0xA7B24620u, 0xBEA97761u,
+        0xF1E8E1A6u, 0xE8F3D0E7u, 0xC3DE8324u, 0xDAC5B265u,
+        0x5D5DAEAAu, 0x44469FEBu, 0x6F6BCC28u, 0x7670FD69u,
+        0x39316BAEu, 0x202A5AEFu, 0x0B07092Cu, 0x121C386Du,
+        0xDF4636F3u, 0xC65D07B2u, 0xED705471u, 0xF46B6530u,
+        0xBB2AF3F7u, 0xA231C2B6u, 0x891C9175u, 0x9007A034u,
+        0x179FBCFBu, 0x0E848DBAu, 0x25A9DE79u, 0x3CB2EF38u,
+        0x73F379FFu, 0x6AE848BEu, 0x41C51B7Du, 0x58DE2A3Cu,
+        0xF0794F05u, 0xE9627E44u, 0xC24F2D87u, 0xDB541CC6u,
+        0x94158A01u, 0x8D0EBB40u, 0xA623E883u, 0xBF38D9C2u,
+        0x38A0C50Du, 0x21BBF44Cu, 0x0A96A78Fu, 0x138D96CEu,
+        0x5CCC0009u, 0x45D73148u, 0x6EFA628Bu, 0x77E153CAu,
+        0xBABB5D54u, 0xA3A06C15u, 0x888D3FD6u, 0x91960E97u,
+        0xDED79850u, 0xC7CCA911u, 0xECE1FAD2u, 0xF5FACB93u,
+        0x7262D75Cu, 0x6B79E61Du, 0x4054B5DEu, 0x594F849Fu,
+        0x160E1258u, 0x0F152319u, 0x243870DAu, 0x3D23419Bu,
+        0x65FD6BA7u, 0x7CE65AE6u, 0x57CB0925u, 0x4ED03864u,
+        0x0191AEA3u, 0x188A9FE2u, 0x33A7CC21u, 0x2ABCFD60u,
+        0xAD24E1AFu, 0xB43FD0EEu, 0x9F12832Du, 0x8609B26Cu,
+        0xC94824ABu, 0xD05315EAu, 0xFB7E4629u, 0xE2657768u,
+        0x2F3F79F6u, 0x362448B7u, 0x1D091B74u, 0x04122A35u,
+        0x4B53BCF2u, 0x52488DB3u, 0x7965DE70u, 0x607EEF31u,
+        0xE7E6F3FEu, 0xFEFDC2BFu, 0xD5D0917Cu, 0xCCCBA03Du,
+        0x838A36FAu, 0x9A9107BBu, 0xB1BC5478u, 0xA8A76539u,
+        0x3B83984Bu, 0x2298A90Au, 0x09B5FAC9u, 0x10AECB88u,
+        0x5FEF5D4Fu, 0x46F46C0Eu, 0x6DD93FCDu, 0x74C20E8Cu,
+        0xF35A1243u, 0xEA412302u, 0xC16C70C1u, 0xD8774180u,
+        0x9736D747u, 0x8E2DE606u, 0xA500B5C5u, 0xBC1B8484u,
+        0x71418A1Au, 0x685ABB5Bu, 0x4377E898u, 0x5A6CD9D9u,
+        0x152D4F1Eu, 0x0C367E5Fu, 0x271B2D9Cu, 0x3E001CDDu,
+        0xB9980012u, 0xA0833153u, 0x8BAE6290u, 0x92B553D1u,
+        0xDDF4C516u, 0xC4EFF457u, 0xEFC2A794u, 0xF6D996D5u,
+        0xAE07BCE9u, 0xB71C8DA8u, 0x9C31DE6Bu, 0x852AEF2Au,
+        0xCA6B79EDu, 0xD37048ACu, 0xF85D1B6Fu, 0xE1462A2Eu,
+        0x66DE36E1u, 0x7FC507A0u, 0x54E85463u, 0x4DF36522u,
+        0x02B2F3E5u, 0x1BA9C2A4u, 0x30849167u, 0x299FA026u,
+        0xE4C5AEB8u, 0xFDDE9FF9u, 0xD6F3CC3Au, 0xCFE8FD7Bu,
+        0x80A96BBCu, 0x99B25AFDu, 0xB29F093Eu, 0xAB84387Fu,
+        0x2C1C24B0u, 0x350715F1u, 0x1E2A4632u, 0x07317773u,
+        0x4870E1B4u, 0x516BD0F5u, 0x7A468336u, 0x635DB277u,
+        0xCBFAD74Eu, 0xD2E1E60Fu, 0xF9CCB5CCu, 0xE0D7848Du,
+        0xAF96124Au, 0xB68D230Bu, 0x9DA070C8u, 0x84BB4189u,
+        0x03235D46u, 0x1A386C07u, 0x31153FC4u, 0x280E0E85u,
+        0x674F9842u, 0x7E54A903u, 0x5579FAC0u, 0x4C62CB81u,
+        0x8138C51Fu, 0x9823F45Eu, 0xB30EA79Du, 0xAA1596DCu,
+        0xE554001Bu, 0xFC4F315Au, 0xD7626299u, 0xCE7953D8u,
+        0x49E14F17u, 0x50FA7E56u, 0x7BD72D95u, 0x62CC1CD4u,
+        0x2D8D8A13u, 0x3496BB52u, 0x1FBBE891u, 0x06A0D9D0u,
+        0x5E7EF3ECu, 0x4765C2ADu, 0x6C48916Eu, 0x7553A02Fu,
+        0x3A1236E8u, 0x230907A9u, 0x0824546Au, 0x113F652Bu,
+        0x96A779E4u, 0x8FBC48A5u, 0xA4911B66u, 0xBD8A2A27u,
+        0xF2CBBCE0u, 0xEBD08DA1u, 0xC0FDDE62u, 0xD9E6EF23u,
+        0x14BCE1BDu, 0x0DA7D0FCu, 0x268A833Fu, 0x3F91B27Eu,
+        0x70D024B9u, 0x69CB15F8u, 0x42E6463Bu, 0x5BFD777Au,
+        0xDC656BB5u, 0xC57E5AF4u, 0xEE530937u, 0xF7483876u,
+        0xB809AEB1u, 0xA1129FF0u, 0x8A3FCC33u, 0x9324FD72u
+    }
+    ,{
+        0x00000000u, 0x01C26A37u, 0x0384D46Eu, 0x0246BE59u,
+        0x0709A8DCu, 0x06CBC2EBu, 0x048D7CB2u, 0x054F1685u,
+        0x0E1351B8u, 0x0FD13B8Fu, 0x0D9785D6u, 0x0C55EFE1u,
+        0x091AF964u, 0x08D89353u, 0x0A9E2D0Au, 0x0B5C473Du,
+        0x1C26A370u, 0x1DE4C947u, 0x1FA2771Eu, 0x1E601D29u,
+        0x1B2F0BACu, 0x1AED619Bu, 0x18ABDFC2u, 0x1969B5F5u,
+        0x1235F2C8u, 0x13F798FFu, 0x11B126A6u, 0x10734C91u,
+        0x153C5A14u, 0x14FE3023u, 0x16B88E7Au, 0x177AE44Du,
+        0x384D46E0u, 0x398F2CD7u, 0x3BC9928Eu, 0x3A0BF8B9u,
+        0x3F44EE3Cu, 0x3E86840Bu, 0x3CC03A52u, 0x3D025065u,
+        0x365E1758u, 0x379C7D6Fu, 0x35DAC336u, 0x3418A901u,
+        0x3157BF84u, 0x3095D5B3u, 0x32D36BEAu, 0x331101DDu,
+        0x246BE590u, 0x25A98FA7u, 0x27EF31FEu, 0x262D5BC9u,
+        0x23624D4Cu, 0x22A0277Bu, 0x20E69922u, 0x2124F315u,
+        0x2A78B428u, 0x2BBADE1Fu, 0x29FC6046u, 0x283E0A71u,
+        0x2D711CF4u, 0x2CB376C3u, 0x2EF5C89Au, 0x2F37A2ADu,
+        0x709A8DC0u, 0x7158E7F7u, 0x731E59AEu, 0x72DC3399u,
+        0x7793251Cu, 0x76514F2Bu, 0x7417F172u, 0x75D59B45u,
+        0x7E89DC78u, 0x7F4BB64Fu, 0x7D0D0816u, 0x7CCF6221u,
+        0x798074A4u, 0x78421E93u, 0x7A04A0CAu, 0x7BC6CAFDu,
+        0x6CBC2EB0u, 0x6D7E4487u, 0x6F38FADEu, 0x6EFA90E9u,
+        0x6BB5866Cu, 0x6A77EC5Bu, 0x68315202u, 0x69F33835u,
+        0x62AF7F08u, 0x636D153Fu, 0x612BAB66u, 0x60E9C151u,
+        0x65A6D7D4u, 0x6464BDE3u, 0x662203BAu, 0x67E0698Du,
+        0x48D7CB20u, 0x4915A117u, 0x4B531F4Eu, 0x4A917579u,
+        0x4FDE63FCu, 0x4E1C09CBu, 0x4C5AB792u, 0x4D98DDA5u,
+        0x46C49A98u, 0x4706F0AFu, 0x45404EF6u, 0x448224C1u,
+        0x41CD3244u, 0x400F5873u, 0x4249E62Au, 0x438B8C1Du,
+        0x54F16850u, 0x55330267u, 0x5775BC3Eu, 0x56B7D609u,
+        0x53F8C08Cu, 0x523AAABBu, 0x507C14E2u, 0x51BE7ED5u,
+        0x5AE239E8u, 0x5B2053DFu, 0x5966ED86u, 0x58A487B1u,
+        0x5DEB9134u, 0x5C29FB03u, 0x5E6F455Au, 0x5FAD2F6Du,
+        0xE1351B80u, 0xE0F771B7u, 0xE2B1CFEEu, 0xE373A5D9u,
+        0xE63CB35Cu, 0xE7FED96Bu, 0xE5B86732u, 0xE47A0D05u,
+        0xEF264A38u, 0xEEE4200Fu, 0xECA29E56u, 0xED60F461u,
+        0xE82FE2E4u, 0xE9ED88D3u, 0xEBAB368Au, 0xEA695CBDu,
+        0xFD13B8F0u, 0xFCD1D2C7u, 0xFE976C9Eu, 0xFF5506A9u,
+        0xFA1A102Cu, 0xFBD87A1Bu, 0xF99EC442u, 0xF85CAE75u,
+        0xF300E948u, 0xF2C2837Fu, 0xF0843D26u, 0xF1465711u,
+        0xF4094194u, 0xF5CB2BA3u, 0xF78D95FAu, 0xF64FFFCDu,
+        0xD9785D60u, 0xD8BA3757u, 0xDAFC890Eu, 0xDB3EE339u,
+        0xDE71F5BCu, 0xDFB39F8Bu, 0xDDF521D2u, 0xDC374BE5u,
+        0xD76B0CD8u, 0xD6A966EFu, 0xD4EFD8B6u, 0xD52DB281u,
+        0xD062A404u, 0xD1A0CE33u, 0xD3E6706Au, 0xD2241A5Du,
+        0xC55EFE10u, 0xC49C9427u, 0xC6DA2A7Eu, 0xC7184049u,
+        0xC25756CCu, 0xC3953CFBu, 0xC1D382A2u, 0xC011E895u,
+        0xCB4DAFA8u, 0xCA8FC59Fu, 0xC8C97BC6u, 0xC90B11F1u,
+        0xCC440774u, 0xCD866D43u, 0xCFC0D31Au, 0xCE02B92Du,
+        0x91AF9640u, 0x906DFC77u, 0x922B422Eu, 0x93E92819u,
+        0x96A63E9Cu, 0x976454ABu, 0x9522EAF2u, 0x94E080C5u,
+        0x9FBCC7F8u, 0x9E7EADCFu, 0x9C381396u, 0x9DFA79A1u,
+        0x98B56F24u, 0x99770513u, 0x9B31BB4Au, 0x9AF3D17Du,
+        0x8D893530u, 0x8C4B5F07u, 0x8E0DE15Eu, 0x8FCF8B69u,
+        0x8A809DECu, 0x8B42F7DBu, 0x89044982u, 0x88C623B5u,
+        0x839A6488u, 0x82580EBFu, 0x801EB0E6u, 0x81DCDAD1u,
+        0x8493CC54u, 0x8551A663u, 0x8717183Au, 0x86D5720Du,
+        0xA9E2D0A0u, 0xA820BA97u, 0xAA6604CEu, 0xABA46EF9u,
+        0xAEEB787Cu, 0xAF29124Bu, 0xAD6FAC12u, 0xACADC625u,
+        0xA7F18118u, 0xA633EB2Fu, 0xA4755576u, 0xA5B73F41u,
+        0xA0F829C4u, 0xA13A43F3u, 0xA37CFDAAu, 0xA2BE979Du,
+        0xB5C473D0u, 0xB40619E7u, 0xB640A7BEu, 0xB782CD89u,
+        0xB2CDDB0Cu, 0xB30FB13Bu, 0xB1490F62u, 0xB08B6555u,
+        0xBBD72268u, 0xBA15485Fu, 0xB853F606u, 0xB9919C31u,
+        0xBCDE8AB4u, 0xBD1CE083u, 0xBF5A5EDAu, 0xBE9834EDu
+    }
+    ,{
+        0x00000000u, 0xB8BC6765u, 0xAA09C88Bu, 0x12B5AFEEu,
+        0x8F629757u, 0x37DEF032u, 0x256B5FDCu, 0x9DD738B9u,
+        0xC5B428EFu, 0x7D084F8Au, 0x6FBDE064u, 0xD7018701u,
+        0x4AD6BFB8u, 0xF26AD8DDu, 0xE0DF7733u, 0x58631056u,
+        0x5019579Fu, 0xE8A530FAu, 0xFA109F14u, 0x42ACF871u,
+        0xDF7BC0C8u, 0x67C7A7ADu, 0x75720843u, 0xCDCE6F26u,
+        0x95AD7F70u, 0x2D111815u, 0x3FA4B7FBu, 0x8718D09Eu,
+        0x1ACFE827u, 0xA2738F42u, 0xB0C620ACu, 0x087A47C9u,
+        0xA032AF3Eu, 0x188EC85Bu, 0x0A3B67B5u, 0xB28700D0u,
+        0x2F503869u, 0x97EC5F0Cu, 0x8559F0E2u, 0x3DE59787u,
+        0x658687D1u, 0xDD3AE0B4u, 0xCF8F4F5Au, 0x7733283Fu,
+        0xEAE41086u, 0x525877E3u, 0x40EDD80Du, 0xF851BF68u,
+        0xF02BF8A1u, 0x48979FC4u, 0x5A22302Au, 0xE29E574Fu,
+        0x7F496FF6u, 0xC7F50893u, 0xD540A77Du, 0x6DFCC018u,
+        0x359FD04Eu, 0x8D23B72Bu, 0x9F9618C5u, 0x272A7FA0u,
+        0xBAFD4719u, 0x0241207Cu, 0x10F48F92u, 0xA848E8F7u,
+        0x9B14583Du, 0x23A83F58u, 0x311D90B6u, 0x89A1F7D3u,
+        0x1476CF6Au, 0xACCAA80Fu, 0xBE7F07E1u, 0x06C36084u,
+        0x5EA070D2u, 0xE61C17B7u, 0xF4A9B859u, 0x4C15DF3Cu,
+        0xD1C2E785u, 0x697E80E0u, 0x7BCB2F0Eu, 0xC377486Bu,
+        0xCB0D0FA2u, 0x73B168C7u, 0x6104C729u, 0xD9B8A04Cu,
+        0x446F98F5u, 0xFCD3FF90u, 0xEE66507Eu, 0x56DA371Bu,
+        0x0EB9274Du, 0xB6054028u, 0xA4B0EFC6u, 0x1C0C88A3u,
+        0x81DBB01Au, 0x3967D77Fu, 0x2BD27891u, 0x936E1FF4u,
+        0x3B26F703u, 0x839A9066u, 0x912F3F88u, 0x299358EDu,
+        0xB4446054u, 0x0CF80731u, 0x1E4DA8DFu, 0xA6F1CFBAu,
+        0xFE92DFECu, 0x462EB889u, 0x549B1767u, 0xEC277002u,
+        0x71F048BBu, 0xC94C2FDEu, 0xDBF98030u, 0x6345E755u,
+        0x6B3FA09Cu, 0xD383C7F9u, 0xC1366817u, 0x798A0F72u,
+        0xE45D37CBu, 0x5CE150AEu, 0x4E54FF40u, 0xF6E89825u,
+        0xAE8B8873u, 0x1637EF16u, 0x048240F8u, 0xBC3E279Du,
+        0x21E91F24u, 0x99557841u, 0x8BE0D7AFu, 0x335CB0CAu,
+        0xED59B63Bu, 0x55E5D15Eu, 0x47507EB0u, 0xFFEC19D5u,
+        0x623B216Cu, 0xDA874609u, 0xC832E9E7u, 0x708E8E82u,
+        0x28ED9ED4u, 0x9051F9B1u, 0x82E4565Fu, 0x3A58313Au,
+        0xA78F0983u, 0x1F336EE6u, 0x0D86C108u, 0xB53AA66Du,
+        0xBD40E1A4u, 0x05FC86C1u, 0x1749292Fu, 0xAFF54E4Au,
+        0x322276F3u, 0x8A9E1196u, 0x982BBE78u, 0x2097D91Du,
+        0x78F4C94Bu, 0xC048AE2Eu, 0xD2FD01C0u, 0x6A4166A5u,
+        0xF7965E1Cu, 0x4F2A3979u, 0x5D9F9697u, 0xE523F1F2u,
+        0x4D6B1905u, 0xF5D77E60u, 0xE762D18Eu, 0x5FDEB6EBu,
+        0xC2098E52u, 0x7AB5E937u, 0x680046D9u, 0xD0BC21BCu,
+        0x88DF31EAu, 0x3063568Fu, 0x22D6F961u, 0x9A6A9E04u,
+        0x07BDA6BDu, 0xBF01C1D8u, 0xADB46E36u, 0x15080953u,
+        0x1D724E9Au, 0xA5CE29FFu, 0xB77B8611u, 0x0FC7E174u,
+        0x9210D9CDu, 0x2AACBEA8u, 0x38191146u, 0x80A57623u,
+        0xD8C66675u, 0x607A0110u, 0x72CFAEFEu, 0xCA73C99Bu,
+        0x57A4F122u, 0xEF189647u, 0xFDAD39A9u, 0x45115ECCu,
+        0x764DEE06u, 0xCEF18963u, 0xDC44268Du, 0x64F841E8u,
+        0xF92F7951u, 0x41931E34u, 0x5326B1DAu, 0xEB9AD6BFu,
+        0xB3F9C6E9u, 0x0B45A18Cu, 0x19F00E62u, 0xA14C6907u,
+        0x3C9B51BEu, 0x842736DBu, 0x96929935u, 0x2E2EFE50u,
+        0x2654B999u, 0x9EE8DEFCu, 0x8C5D7112u, 0x34E11677u,
+        0xA9362ECEu, 0x118A49ABu, 0x033FE645u, 0xBB838120u,
+        0xE3E09176u, 0x5B5CF613u, 0x49E959FDu, 0xF1553E98u,
+        0x6C820621u, 0xD43E6144u, 0xC68BCEAAu, 0x7E37A9CFu,
+        0xD67F4138u, 0x6EC3265Du, 0x7C7689B3u, 0xC4CAEED6u,
+        0x591DD66Fu, 0xE1A1B10Au, 0xF3141EE4u, 0x4BA87981u,
+        0x13CB69D7u, 0xAB770EB2u, 0xB9C2A15Cu, 0x017EC639u,
+        0x9CA9FE80u, 0x241599E5u, 0x36A0360Bu, 0x8E1C516Eu,
+        0x866616A7u, 0x3EDA71C2u, 0x2C6FDE2Cu, 0x94D3B949u,
+        0x090481F0u, 0xB1B8E695u, 0xA30D497Bu, 0x1BB12E1Eu,
+        0x43D23E48u, 0xFB6E592Du, 0xE9DBF6C3u, 0x516791A6u,
+        0xCCB0A91Fu, 0x740CCE7Au, 0x66B96194u, 0xDE0506F1u
+    }
+#endif
+};
+
 /*======================= C O D E =================================*/
 
 
@@ -165,47 +592,6 @@ a2b_alphaToDigit
 } /* a2b_alphaToDigit */
 
 
-/*!****************************************************************************
-*  \ingroup        a2bstack_util_priv
-* 
-*  \b              a2b_doCrc8
-*
-*  Do the actual work to calculate the CRC8 using the ADI algorithm.
-*
-*  \param          [in]    crc_in   current CRC value
-*  \param          [in]    data     single byte of data
-*
-*  \pre            None
-*
-*  \post           None
-*
-*  \return         new CRC value
-*
-******************************************************************************/
-static a2b_UInt8
-a2b_doCrc8
-    (
-    a2b_UInt8   crc_in,
-    a2b_UInt8   data
-    )
-{
-    a2b_UInt8 crc_out;
-    a2b_UInt8 xor_mask;
-    a2b_UInt8 i, j;
-
-    crc_out = crc_in;
-    for ( i = 0u; i < 8u; i++ )
-    {
-        j = 7u - i;
-        xor_mask = (a2b_UInt8)((((a2b_UInt32)crc_out & 0x80u) >> (a2b_UInt32)7u) ^ (((a2b_UInt32)data >> (a2b_UInt32)j) & (a2b_UInt32)1u));
-        xor_mask = xor_mask | (a2b_UInt8)(((a2b_UInt32)xor_mask << (a2b_UInt32)1u) | ((a2b_UInt32)xor_mask << (a2b_UInt32)2u));
-        crc_out  = (a2b_UInt8)((((a2b_UInt32)crc_out << (a2b_UInt32)1u) & (a2b_UInt32)0xffu) ^ (a2b_UInt32)xor_mask);
-    }
-
-    return crc_out;
-} /* a2b_doCrc8 */
-
-
 /*!****************************************************************************
 *  \ingroup        a2bstack_util_priv
 * 
@@ -537,6 +923,7 @@ a2b_crc8Cont
     )
 {
     a2b_UInt32  i;
+    a2b_UInt32  endIdx;
     a2b_UInt8   crc8_val = initCrc8;
 
     if (( dataArr == A2B_NULL ) || ( startIdx > crcLen ))
@@ -544,9 +931,25 @@ a2b_crc8Cont
         return crc8_val;
     }
 
-    for ( i = startIdx; i < (startIdx+crcLen); i++ )
+    i = startIdx;
+    endIdx = startIdx + crcLen;
+
+#if (A2B_CONF_CRC_SLICES == 4u)
+    /* Four bytes per step, each through the table of its distance
+     * from the end of the step
+     */
+    for ( ; (endIdx - i) >= 4u; i += 4u )
     {
-        crc8_val = a2b_doCrc8( crc8_val, dataArr[i] );
+        crc8_val = (a2b_UInt8)(gCrc8Table[3][((a2b_UInt32)crc8_val ^ (a2b_UInt32)dataArr[i]) & 0xFFu] ^
+                               gCrc8Table[2][(a2b_UInt32)dataArr[i + 1u] & 0xFFu] ^
+                               gCrc8Table[1][(a2b_UInt32)dataArr[i + 2u] & 0xFFu] ^
+                               gCrc8Table[0][(a2b_UInt32)dataArr[i + 3u] & 0xFFu]);
+    }
+#endif
+
+    for ( ; i < endIdx; i++ )
+    {
+        crc8_val = gCrc8Table[0][((a2b_UInt32)crc8_val ^ (a2b_UInt32)dataArr[i]) & 0xFFu];
     }
 
     return crc8_val;
@@ -595,6 +998,117 @@ a2b_crc8
 } /* a2b_crc8 */
 
 
+/*!****************************************************************************
+*
+*  \b              a2b_crc32Cont
+*
+*  Calculate a CRC-32 using the IEEE 802.3 polynomial (reflected,
+*  0xEDB88320), starting from 0xFFFFFFFF and inverting the result. This is
+*  the CRC-32 of zlib and Ethernet, for checksumming tuning data, captured
+*  logs and other blobs exchanged with host tools.
+*
+*  \note Passing the result for one buffer as 'initCrc32' continues the
+*        CRC with the next buffer; #a2b_crc32 is this routine with an
+*        'initCrc32' of zero.
+*
+*  \param          [in]    dataArr      data array
+*
+*  \param          [in]    initCrc32    CRC-32 of the preceding data, or
+*                                       zero to start
+*
+*  \param          [in]    startIdx     starting point of CRC
+*
+*  \param          [in]    crcLen       number of bytes to CRC
+*
+*  \pre            User MUST ensure the (startIdx + crcLen) does not
+*                  exceed the size of the dataArr.
+*
+*  \post           None
+*
+*  \return         CRC value for the data
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32
+a2b_crc32Cont
+    (
+    const a2b_UInt8*  dataArr,
+    a2b_UInt32        initCrc32,
+    a2b_UInt32        startIdx,
+    a2b_UInt32        crcLen
+    )
+{
+    a2b_UInt32  i;
+    a2b_UInt32  endIdx;
+    a2b_UInt32  crc32_val;
+
+    if ( dataArr == A2B_NULL )
+    {
+        return initCrc32;
+    }
+
+    crc32_val = ~initCrc32;
+    i = startIdx;
+    endIdx = startIdx + crcLen;
+
+#if (A2B_CONF_CRC_SLICES == 4u)
+    /* Four bytes per step, assembled byte by byte so neither alignment
+     * nor endianness matter
+     */
+    for ( ; (endIdx - i) >= 4u; i += 4u )
+    {
+        crc32_val ^= ((a2b_UInt32)dataArr[i] & 0xFFu) |
+                     (((a2b_UInt32)dataArr[i + 1u] & 0xFFu) << 8u) |
+                     (((a2b_UInt32)dataArr[i + 2u] & 0xFFu) << 16u) |
+                     (((a2b_UInt32)dataArr[i + 3u] & 0xFFu) << 24u);
+        crc32_val = gCrc32Table[3][crc32_val & 0xFFu] ^
+                    gCrc32Table[2][(crc32_val >> 8u) & 0xFFu] ^
+                    gCrc32Table[1][(crc32_val >> 16u) & 0xFFu] ^
+                    gCrc32Table[0][(crc32_val >> 24u) & 0xFFu];
+    }
+#endif
+
+    for ( ; i < endIdx; i++ )
+    {
+        crc32_val = (crc32_val >> 8u) ^
+                    gCrc32Table[0][(crc32_val ^ (a2b_UInt32)dataArr[i]) & 0xFFu];
+    }
+
+    return ~crc32_val;
+} /* a2b_crc32Cont */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_crc32
+*
+*  Calculate a CRC-32 using the IEEE 802.3 polynomial, see #a2b_crc32Cont.
+*
+*  \param          [in]    dataArr      data array
+*
+*  \param          [in]    startIdx     starting point of CRC
+*
+*  \param          [in]    crcLen       number of bytes to CRC
+*
+*  \pre            User MUST ensure the (startIdx + crcLen) does not
+*                  exceed the size of the dataArr.
+*
+*  \post           None
+*
+*  \return         CRC value for the data
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32
+a2b_crc32
+    (
+    const a2b_UInt8*  dataArr,
+    a2b_UInt32        startIdx,
+    a2b_UInt32        crcLen
+    )
+{
+    return a2b_crc32Cont( dataArr, 0u, startIdx, crcLen );
+} /* a2b_crc32 */
+
+
 /*!****************************************************************************
 *
 *  \b              a2b_memset
@@ -1249,3 +1763,315 @@ a2b_vsnprintf
 
     return nWritten;
 } /* a2b_vsnprintf */
+
+
+#if defined(A2B_FEATURE_TRACE_BINARY) || defined(A2B_FEATURE_SEQ_CHART_BINARY)
+/*!****************************************************************************
+*
+*  \b              a2b_vsnprintfArgKinds
+*
+*  Returns the kinds of the arguments a format string takes, following the
+*  conversions of a2b_vsnprintfStringBuffer().
+*
+*  \param          [in]    fmt      The format string.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY or
+*                  #A2B_FEATURE_SEQ_CHART_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         The argument kinds (#A2B_TRCBIN_DESC_KIND) and count
+*                  (#A2B_TRCBIN_DESC_COUNT), at most #A2B_TRCBIN_MAX_ARGS.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32
+a2b_vsnprintfArgKinds
+    (
+    const a2b_Char*     fmt
+    )
+{
+    const a2b_Char* pos = fmt;
+    a2b_UInt32 desc = 0u;
+    a2b_UInt32 count = 0u;
+    a2b_UInt32 size;
+    a2b_UInt32 kind;
+    a2b_Char ch;
+
+    if ( A2B_NULL != fmt )
+    {
+        while ( (*pos != '\0') && (count < A2B_TRCBIN_MAX_ARGS) )
+        {
+            ch = *pos;
+            pos++;
+            if ( ch == '%' )
+            {
+                ch = *pos;
+                if ( '0' == ch )
+                {
+                    pos++;
+                    ch = *pos;
+                }
+
+                /* The width is read as by a2b_textToUnsigned(), which also
+                 * takes 'a' and 'A' - 'F' once it has seen a digit.
+                 */
+                if ( (ch >= '0') && (ch <= '9') )
+                {
+                    while ( ((ch >= '0') && (ch <= '9')) || (ch == 'a') ||
+                            ((ch >= 'A') && (ch <= 'F')) )
+                    {
+                        pos++;
+                        ch = *pos;
+                    }
+                }
+
+                size = A2B_TRCBIN_ARG_32;
+                if ( ch == 'b' )
+                {
+                    size = A2B_TRCBIN_ARG_8;
+                    pos++;
+                    ch = *pos;
+                }
+                if ( ch == 'h' )
+                {
+                    size = A2B_TRCBIN_ARG_16;
+                    pos++;
+                    ch = *pos;
+                }
+                if ( ch == 'l' )
+                {
+                    size = A2B_TRCBIN_ARG_32;
+                    pos++;
+                    ch = *pos;
+                }
+#ifdef A2B_FEATURE_64_BIT_INTEGER
+                if ( ch == 'L' )
+                {
+                    size = A2B_TRCBIN_ARG_64;
+                    pos++;
+                    ch = *pos;
+                }
+#endif
+
+                switch ( ch )
+                {
+                    case 'u':
+                    case 'x':
+                    case 'X':
+                    case 'i':
+                    case 'd':
+                        kind = size;
+                        break;
+                    case 'c':
+                        kind = A2B_TRCBIN_ARG_8;
+                        break;
+                    case 'p':
+                    case 'P':
+                        kind = A2B_TRCBIN_ARG_PTR;
+                        break;
+                    case 's':
+                        kind = A2B_TRCBIN_ARG_STR;
+                        break;
+                    default:
+                        kind = 0u;
+                        break;
+                }
+
+                if ( ch != '\0' )
+                {
+                    pos++;
+                }
+                if ( 0u != kind )
+                {
+                    desc |= kind << (3u * count);
+                    count++;
+                }
+            }
+        }
+    }
+
+    return desc | (count << 24u);
+} /* a2b_vsnprintfArgKinds */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_binPutPtr
+*
+*  Stores an address in #A2B_TRCBIN_PTR_WORDS words, low word first.
+*
+*  \param          [in]    rec      The record.
+*
+*  \param          [in]    pos      Word offset in the record.
+*
+*  \param          [in]    ptr      The address.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY or
+*                  #A2B_FEATURE_SEQ_CHART_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         The word offset following the address.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UInt32
+a2b_binPutPtr
+    (
+    a2b_UInt32*     rec,
+    a2b_UInt32      pos,
+    const void*     ptr
+    )
+{
+    a2b_UIntPtr value = (a2b_UIntPtr)ptr;
+    a2b_UInt32 idx;
+
+    for ( idx = 0u; idx < A2B_TRCBIN_PTR_WORDS; idx++ )
+    {
+        rec[pos + idx] = (a2b_UInt32)value;
+        /* Two shifts, a single one would be the full width on 32 bits */
+        value = (value >> 16u) >> 16u;
+    }
+
+    return pos + A2B_TRCBIN_PTR_WORDS;
+} /* a2b_binPutPtr */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_binGetPtr
+*
+*  Reads an address stored by a2b_binPutPtr().
+*
+*  \param          [in]    rec      The record.
+*
+*  \param          [in]    pos      Word offset in the record.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY or
+*                  #A2B_FEATURE_SEQ_CHART_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         The address.
+*
+******************************************************************************/
+A2B_DSO_PUBLIC a2b_UIntPtr
+a2b_binGetPtr
+    (
+    const a2b_UInt32*   rec,
+    a2b_UInt32          pos
+    )
+{
+    a2b_UIntPtr value = 0u;
+    a2b_UInt32 idx;
+
+    for ( idx = A2B_TRCBIN_PTR_WORDS; idx > 0u; idx-- )
+    {
+        value = ((value << 16u) << 16u) | (a2b_UIntPtr)rec[pos + idx - 1u];
+    }
+
+    return value;
+} /* a2b_binGetPtr */
+
+
+/*!****************************************************************************
+*
+*  \b              a2b_binDumpStr
+*
+*  Writes a string referenced by the records to a binary dump
+*  (#A2B_TRCBIN_STR_MAGIC, address, byte count, bytes padded to a word),
+*  once for the first maxKnown distinct addresses.
+*
+*  \param          [in]        writeFunc    Receives the dump.
+*
+*  \param          [in]        hnd          Handle for writeFunc.
+*
+*  \param          [in]        addr         Address of the string, 0 for
+*                                           none.
+*
+*  \param          [in]        baseName     Write only the part after the
+*                                           last path separator (file
+*                                           names).
+*
+*  \param          [in,out]    known        Addresses written so far.
+*
+*  \param          [in]        maxKnown     Entries of known.
+*
+*  \param          [in,out]    nStrings     Strings written so far, 0 at
+*                                           the start of a dump.
+*
+*  \pre            Only available when #A2B_FEATURE_TRACE_BINARY or
+*                  #A2B_FEATURE_SEQ_CHART_BINARY is enabled.
+*
+*  \post           None
+*
+*  \return         None
+*
+******************************************************************************/
+A2B_DSO_PUBLIC void
+a2b_binDumpStr
+    (
+    a2b_BinWriteFunc    writeFunc,
+    a2b_Handle          hnd,
+    a2b_UIntPtr         addr,
+    a2b_Bool            baseName,
+    a2b_UIntPtr*        known,
+    a2b_UInt32          maxKnown,
+    a2b_UInt32*         nStrings
+    )
+{
+    static const a2b_UInt32 zero = 0u;
+    a2b_UInt32 hdr[2u + A2B_TRCBIN_PTR_WORDS];
+    const a2b_Char* str = (const a2b_Char*)addr;
+    const a2b_Char* text;
+    a2b_UInt32 nKnown = A2B_MIN(*nStrings, maxKnown);
+    a2b_UInt32 idx;
+    a2b_UInt32 len;
+
+    if ( 0u == addr )
+    {
+        return;
+    }
+
+    for ( idx = 0u; idx < nKnown; idx++ )
+    {
+        if ( known[idx] == addr )
+        {
+            return;
+        }
+    }
+    if ( idx < maxKnown )
+    {
+        known[idx] = addr;
+    }
+    (*nStrings)++;
+
+    text = A2B_NULL;
+    if ( baseName )
+    {
+        text = a2b_strrchr(str, A2B_CONF_PATH_SEPARATOR);
+    }
+    if ( A2B_NULL != text )
+    {
+        /* Point one past the path separator */
+        text++;
+    }
+    else
+    {
+        text = str;
+    }
+
+    len = (a2b_UInt32)a2b_strlen(text);
+    len = A2B_MIN(len, A2B_BIN_MAX_TEXT);
+
+    hdr[0u] = A2B_TRCBIN_STR_MAGIC;
+    idx = a2b_binPutPtr(hdr, 1u, str);
+    hdr[idx] = len;
+    writeFunc(hnd, (const a2b_Byte*)hdr, (idx + 1u) * 4u);
+    writeFunc(hnd, (const a2b_Byte*)text, len);
+    if ( 0u != (len & 3u) )
+    {
+        writeFunc(hnd, (const a2b_Byte*)&zero, 4u - (len & 3u));
+    }
+} /* a2b_binDumpStr */
+
+#endif /* A2B_FEATURE_TRACE_BINARY || A2B_FEATURE_SEQ_CHART_BINARY */
@@ -0,0 +1,250 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : adi_a2b_audiochain.c
+
+   Description: This file holds the per-block audio processing behind the
+                SPORT DMA buffers: deinterleave, RNC engine, interleave, and
+                the loop-back copy for A2B_LOOP_BACKTEST builds. It has no
+                driver dependencies so that it can also be run on a host.
+
+   Functions  :  adi_a2b_AudioChainInit()
+                 adi_a2b_AudioChainProcess()
+                 adi_a2b_RncGetEngine()
+
+   Prepared &
+   Reviewed by: Automotive Software and Systems team,
+                IPDC, Analog Devices,  Bangalore, India
+
+******************************************************************************/
+/*! \addtogroup Target_Independent
+ *  @{
+ */
+
+/*! \addtogroup AUDIO_CHAIN
+ *  @{
+ */
+
+/*============= I N C L U D E S =============*/
+
+#include <string.h>
+#include "adi_a2b_audiochain.h"
+
+/*============= D E F I N E S =============*/
+/*#define A2B_LOOP_BACKTEST*/
+
+/* RNC slot map: references and error microphones arrive on consecutive
+ * upstream TDM slots, anti-noise leaves on the first DAC slots */
+#define RNC_REF_SLOT0           (0u)
+#define RNC_ERR_SLOT0           (RNC_REF_SLOT0 + ADI_A2B_FXLMS_NUM_REF)
+#define RNC_SPK_SLOT0           (0u)
+
+A2B_STATIC_ASSERT((DMA_NUM_DESC * ADI_A2B_AUDIO_MAX_FRAMES) <= ADI_A2B_FXLMS_MAX_SEC_DELAY,
+                  "DMA ring latency exceeds the RNC secondary path delay line");
+A2B_STATIC_ASSERT(ADI_A2B_AUDIO_MAX_FRAMES <= ADI_A2B_FXLMS_MAX_FRAMES,
+                  "RNC engine cannot take the largest audio block");
+
+A2B_STATIC_ASSERT((RNC_ERR_SLOT0 + ADI_A2B_FXLMS_NUM_ERR) <= RxNUM_CHANNELS,
+                  "RNC sensor slots exceed upstream TDM slots");
+A2B_STATIC_ASSERT((RNC_SPK_SLOT0 + ADI_A2B_FXLMS_NUM_SPK) <= TxNUM_CHANNELS,
+                  "RNC speaker slots exceed DAC TDM slots");
+
+/*============= D A T A =============*/
+
+/* Frames per block */
+static uint32 nChainFrames = ADI_A2B_AUDIO_DEFAULT_FRAMES;
+
+/* Channel-major view of one upstream and one DAC block */
+#pragma section("seg_l1_block2")
+static float aRxChannel[RxNUM_CHANNELS][ADI_A2B_AUDIO_MAX_FRAMES];
+#pragma section("seg_l1_block2")
+static float aTxChannel[TxNUM_CHANNELS][ADI_A2B_AUDIO_MAX_FRAMES];
+static float *apRxChannel[RxNUM_CHANNELS];
+static const float *apTxChannel[TxNUM_CHANNELS];
+
+/* RNC engine and its view of the channel blocks */
+#pragma section("seg_l1_block2")
+static ADI_A2B_FXLMS oRncEngine;
+static const float *apRncRef[ADI_A2B_FXLMS_NUM_REF];
+static const float *apRncErr[ADI_A2B_FXLMS_NUM_ERR];
+static float *apRncOut[ADI_A2B_FXLMS_NUM_SPK];
+
+/*============= C O D E =============*/
+/*
+** Function Prototype section
+** (static-scoped functions)
+*/
+
+static void AudioStageInit(void);
+static void RncInit(void);
+
+/*
+** Function Definition section
+*/
+
+/*****************************************************************************/
+/*!
+@brief      Binds the channel pointers of the deinterleave/interleave stage to
+            the channel-major block buffers. DAC channels that no processing
+            module writes stay silent.
+
+@return     None
+*/
+/*****************************************************************************/
+static void AudioStageInit(void)
+{
+    uint32  nCh;
+
+    memset(aRxChannel, 0, sizeof(aRxChannel));
+    memset(aTxChannel, 0, sizeof(aTxChannel));
+
+    for(nCh = 0u; nCh < RxNUM_CHANNELS; nCh++)
+    {
+        apRxChannel[nCh] = aRxChannel[nCh];
+    }
+    for(nCh = 0u; nCh < TxNUM_CHANNELS; nCh++)
+    {
+        apTxChannel[nCh] = aTxChannel[nCh];
+    }
+}
+
+/*****************************************************************************/
+/*!
+@brief      Sets up the RNC engine with the default adaptation parameters and
+            a unit secondary path from each speaker to the error microphone
+            on the same index. The bulk delay is one block per DMA
+            descriptor at the selected block size. Measured secondary paths can be loaded over
+            these with adi_a2b_RncGetEngine() and
+            adi_a2b_FxlmsSetSecondaryPath().
+
+@return     None
+*/
+/*****************************************************************************/
+static void RncInit(void)
+{
+    ADI_A2B_FXLMS_CONFIG    oConfig;
+    const float             aUnitPath[1] = { 1.0f };
+    uint32                  nCh;
+
+    oConfig.fStepSize       = 0.5f;
+    oConfig.fLeakage        = 0.99999f;
+    oConfig.fRegularization = 1.0e-6f;
+    oConfig.fPowerSmoothing = 0.9f;
+    oConfig.nSecDelay       = DMA_NUM_DESC * nChainFrames;
+    oConfig.bAdapt          = A2B_TRUE;
+
+    adi_a2b_FxlmsInit(&oRncEngine, &oConfig);
+
+    for(nCh = 0u; nCh < ADI_A2B_FXLMS_NUM_REF; nCh++)
+    {
+        apRncRef[nCh] = aRxChannel[RNC_REF_SLOT0 + nCh];
+    }
+    for(nCh = 0u; nCh < ADI_A2B_FXLMS_NUM_ERR; nCh++)
+    {
+        apRncErr[nCh] = aRxChannel[RNC_ERR_SLOT0 + nCh];
+    }
+    for(nCh = 0u; nCh < ADI_A2B_FXLMS_NUM_SPK; nCh++)
+    {
+        apRncOut[nCh] = aTxChannel[RNC_SPK_SLOT0 + nCh];
+        if(nCh < ADI_A2B_FXLMS_NUM_ERR)
+        {
+            (void)adi_a2b_FxlmsSetSecondaryPath(&oRncEngine, nCh, nCh, aUnitPath, 1u);
+        }
+    }
+}
+
+/*****************************************************************************/
+/*!
+@brief      Sets up the chain for a block size: clears the channel blocks,
+            and initialises the RNC engine (secondary path delay of
+            DMA_NUM_DESC blocks). Must be called before the first block is
+            processed.
+
+@param [in] nFrames         Frames per block (ADI_A2B_AUDIO_MIN_FRAMES to
+                            ADI_A2B_AUDIO_MAX_FRAMES)
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioChainInit(uint32 nFrames)
+{
+    nChainFrames = A2B_MIN(A2B_MAX(nFrames, ADI_A2B_AUDIO_MIN_FRAMES), ADI_A2B_AUDIO_MAX_FRAMES);
+
+    AudioStageInit();
+    RncInit();
+}
+
+/*****************************************************************************/
+/*!
+@brief      Runs one block of the audio chain. The upstream TDM frames are
+            deinterleaved into channel-major float blocks, the RNC engine
+            reads its sensor channels and writes its speaker channels, and
+            the DAC channels are interleaved back, rounded and saturated to
+            24 bits.
+
+            With A2B_LOOP_BACKTEST defined the DAC slots are a plain copy of
+            the first upstream slots instead.
+
+            This is the whole per-block processing: the SPORT driver calls it
+            for each completed DMA block and the host replay tool calls it
+            on blocks read from a capture.
+
+@param [in]  aRxBlock   Interleaved upstream block (RxNUM_CHANNELS slots)
+@param [out] aTxBlock   Interleaved DAC block (TxNUM_CHANNELS slots)
+
+@return     None
+*/
+/*****************************************************************************/
+ADI_MEM_A2B_CODE_CRIT
+void adi_a2b_AudioChainProcess(const int32_t aRxBlock[], int32_t aTxBlock[])
+{
+#ifdef A2B_LOOP_BACKTEST
+    uint32  nFrame;
+    uint32  nSlot;
+
+    for(nFrame = 0u; nFrame < nChainFrames; nFrame++)
+    {
+        /* Copy ADC slots to DAC slots */
+        for(nSlot = 0u; nSlot < TxNUM_CHANNELS; nSlot++)
+        {
+            aTxBlock[(nFrame * TxNUM_CHANNELS) + nSlot] = aRxBlock[(nFrame * RxNUM_CHANNELS) + nSlot];
+        }
+    }
+#else
+    adi_a2b_AudioDeinterleave(aRxBlock, RxNUM_CHANNELS, 0u, RxNUM_CHANNELS, apRxChannel, nChainFrames);
+
+    adi_a2b_FxlmsProcess(&oRncEngine, apRncRef, apRncErr, apRncOut, nChainFrames);
+
+    adi_a2b_AudioInterleave(apTxChannel, TxNUM_CHANNELS, aTxBlock, TxNUM_CHANNELS, 0u, nChainFrames);
+#endif /* A2B_LOOP_BACKTEST */
+}
+
+/*****************************************************************************/
+/*!
+@brief      Returns the RNC engine instance, e.g. to load identified
+            secondary paths or to freeze adaptation.
+
+@return     Pointer to the engine
+*/
+/*****************************************************************************/
+ADI_A2B_FXLMS *adi_a2b_RncGetEngine(void)
+{
+    return &oRncEngine;
+}
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
+
+/*
+**
+** EOF: $URL$
+**
+*/
@@ -0,0 +1,63 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+******************************************************************************
+* @file: adi_a2b_audiochain.h
+* @brief: Per-block audio processing between the upstream and DAC SPORT
+*         DMA buffers.
+* Developed by: Automotive Software and Systems team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Target_Independent
+* @{
+*/
+
+/** @defgroup AUDIO_CHAIN
+*
+* The chain takes one interleaved upstream block (RxNUM_CHANNELS slots per
+* frame, the layout of int_SP0ABuffer) and produces one interleaved DAC
+* block (TxNUM_CHANNELS slots per frame, the layout of int_SP4ABuffer). The
+* SPORT driver only moves blocks and keeps time; everything that touches
+* the samples lives here, so the same code can be fed from a capture file
+* on a host.
+*
+*/
+
+/*! \addtogroup AUDIO_CHAIN AUDIO_CHAIN
+* @{
+*/
+
+#ifndef __ADI_A2B_AUDIOCHAIN_H__
+#define __ADI_A2B_AUDIOCHAIN_H__
+
+/*============= I N C L U D E S =============*/
+#include <stdint.h>
+#include "adi_a2b_datatypes.h"
+#include "adi_a2b_audioconfig.h"
+#include "adi_a2b_fxlms.h"
+#include "adi_a2b_audiostage.h"
+
+/*======= P U B L I C P R O T O T Y P E S ========*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void adi_a2b_AudioChainInit(uint32 nFrames);
+void adi_a2b_AudioChainProcess(const int32_t aRxBlock[], int32_t aTxBlock[]);
+ADI_A2B_FXLMS *adi_a2b_RncGetEngine(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ADI_A2B_AUDIOCHAIN_H__ */
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
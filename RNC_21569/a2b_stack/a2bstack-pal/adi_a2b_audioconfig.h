@@ -0,0 +1,57 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+******************************************************************************
+* @file: adi_a2b_audioconfig.h
+* @brief: Audio stream geometry shared by the SPORT driver and the audio
+*         processing chain. This header has no SSLDD dependencies so that
+*         the processing modules can also be built on a host.
+* Developed by: Automotive Software and Systems team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup SPORT
+* @{
+*/
+
+/*! \addtogroup SPORT_Configuration SPORT Configuration
+* @{
+*/
+#ifndef __ADI_A2B_AUDIOCONFIG_H__
+#define __ADI_A2B_AUDIOCONFIG_H__
+
+/*============== D E F I N E S ===============*/
+
+#define SAMPLE_RATE   			        (48000u)       /* DAC sample rate */
+
+#define REFERENCE_FREQ 				    (2000u)
+#define SAMPLES_PER_PERIOD 			    ((SAMPLE_RATE) / (REFERENCE_FREQ))
+#define SAMPLE_SIZE 				    (4u)
+
+#define RxNUM_CHANNELS				    (20u)
+#define TxNUM_CHANNELS				    (8u)
+
+/* Block size in frames: default and the range selectable at init */
+#define ADI_A2B_AUDIO_MIN_FRAMES        (1u)
+#define ADI_A2B_AUDIO_MAX_FRAMES        (64u)
+#define ADI_A2B_AUDIO_DEFAULT_FRAMES    (SAMPLES_PER_PERIOD)
+
+/* Macro to set buffer size (per descriptor, sized for the largest block) */
+#define A2B_BUFFER_SIZE 	            (ADI_A2B_AUDIO_MAX_FRAMES * RxNUM_CHANNELS)
+#define DAC_BUFFER_SIZE 	            (ADI_A2B_AUDIO_MAX_FRAMES * TxNUM_CHANNELS)
+
+/* Descriptors in the circular RX/TX DMA chains. Each descriptor beyond
+ * two absorbs one block of main-loop jitter and adds one block of latency. */
+#ifndef DMA_NUM_DESC
+#define DMA_NUM_DESC 				    (2u)
+#endif
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
+
+#endif /* __ADI_A2B_AUDIOCONFIG_H__ */
@@ -0,0 +1,292 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : adi_a2b_audioprofile.c
+
+   Description: This file implements the per-block timing statistics of the
+                audio path.
+
+   Functions  :  adi_a2b_AudioProfileInit()
+                 adi_a2b_AudioProfileReset()
+                 adi_a2b_AudioProfileEnd()
+                 adi_a2b_AudioProfileGetStats()
+                 adi_a2b_AudioProfileDump()
+                 adi_a2b_AudioProfileHostClock()
+
+   Prepared &
+   Reviewed by: Automotive Software and Systems team,
+                IPDC, Analog Devices,  Bangalore, India
+
+******************************************************************************/
+/*! \addtogroup Target_Independent
+ *  @{
+ */
+
+/*! \addtogroup AUDIO_PROFILE
+ *  @{
+ */
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <string.h>
+#include "adi_a2b_audioprofile.h"
+
+#if !defined(__ADSP21000__)
+#include <time.h>
+#endif
+
+/*============= C O D E =============*/
+/*
+** Function Prototype section
+** (static-scoped functions)
+*/
+
+static void adi_a2b_AudioProfileAdd(ADI_A2B_PROFILE_METRIC *pMetric, uint32 nTicks, uint32 nBinShift);
+static void adi_a2b_AudioProfilePrint(const char *pName, const ADI_A2B_PROFILE_METRIC *pMetric,
+                                      uint32 nBlocks, uint32 nBinShift, float fTickUs);
+
+/*
+** Function Definition section
+*/
+
+/*****************************************************************************/
+/*!
+@brief      Adds one sample to a metric.
+
+@param [in] pMetric     Metric
+@param [in] nTicks      Duration in clock ticks
+@param [in] nBinShift   log2 of the histogram bin width
+
+@return     None
+*/
+/*****************************************************************************/
+static void adi_a2b_AudioProfileAdd(ADI_A2B_PROFILE_METRIC *pMetric, uint32 nTicks, uint32 nBinShift)
+{
+    uint32 nBin = nTicks >> nBinShift;
+
+    if(nTicks < pMetric->nMin)
+    {
+        pMetric->nMin = nTicks;
+    }
+    if(nTicks > pMetric->nMax)
+    {
+        pMetric->nMax = nTicks;
+    }
+    pMetric->nSum += nTicks;
+    pMetric->aHist[A2B_MIN(nBin, ADI_A2B_PROFILE_NUM_BINS - 1u)]++;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Sets up the profiler. The histogram bin width is the smallest
+            power of two that puts the deadline in the middle bin.
+
+@param [in] pProfile        Profiler
+@param [in] nTicksPerSecond Rate of ADI_A2B_PROFILE_NOW()
+@param [in] nPeriod         Block period in ticks
+@param [in] nDeadline       Latest block end after DMA completion, in ticks
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioProfileInit(ADI_A2B_AUDIO_PROFILE *pProfile, uint32 nTicksPerSecond,
+                              uint32 nPeriod, uint32 nDeadline)
+{
+    uint32 nBinShift = 0u;
+
+    while((nDeadline >> nBinShift) >= (ADI_A2B_PROFILE_NUM_BINS / 2u))
+    {
+        nBinShift++;
+    }
+
+    pProfile->nTicksPerSecond   = nTicksPerSecond;
+    pProfile->nPeriod           = nPeriod;
+    pProfile->nDeadline         = nDeadline;
+    pProfile->nBinShift         = nBinShift;
+    memset((void *)pProfile->aDoneStamp, 0, sizeof(pProfile->aDoneStamp));
+
+    adi_a2b_AudioProfileReset(pProfile);
+}
+
+/*****************************************************************************/
+/*!
+@brief      Clears the statistics; the clock settings are kept.
+
+@param [in] pProfile    Profiler
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioProfileReset(ADI_A2B_AUDIO_PROFILE *pProfile)
+{
+    memset(&pProfile->oLatency, 0, sizeof(pProfile->oLatency));
+    memset(&pProfile->oProcess, 0, sizeof(pProfile->oProcess));
+    pProfile->oLatency.nMin = 0xFFFFFFFFu;
+    pProfile->oProcess.nMin = 0xFFFFFFFFu;
+    pProfile->nBlocks       = 0u;
+    pProfile->nDeadlineMiss = 0u;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Closes the measurement of one block: stamps the end of
+            processing and updates latency, processing time and the
+            deadline counter. Tick differences are taken modulo 2^32, so
+            counter wrap is harmless.
+
+@param [in] pProfile    Profiler
+@param [in] nSlot       DMA descriptor index of the block
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioProfileEnd(ADI_A2B_AUDIO_PROFILE *pProfile, uint32 nSlot)
+{
+    uint32 nEnd   = ADI_A2B_PROFILE_NOW();
+    uint32 nDone  = pProfile->aDoneStamp[nSlot];
+    uint32 nStart = pProfile->nStartStamp;
+
+    adi_a2b_AudioProfileAdd(&pProfile->oLatency, nStart - nDone, pProfile->nBinShift);
+    adi_a2b_AudioProfileAdd(&pProfile->oProcess, nEnd - nStart, pProfile->nBinShift);
+
+    if((nEnd - nDone) > pProfile->nDeadline)
+    {
+        pProfile->nDeadlineMiss++;
+    }
+    pProfile->nBlocks++;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Takes a snapshot of the statistics. Means are rounded down.
+
+@param [in]  pProfile   Profiler
+@param [out] pStats     Snapshot
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioProfileGetStats(const ADI_A2B_AUDIO_PROFILE *pProfile,
+                                  ADI_A2B_AUDIO_PROFILE_STATS *pStats)
+{
+    uint32 nBlocks = pProfile->nBlocks;
+
+    pStats->nBlocks         = nBlocks;
+    pStats->nDeadlineMiss   = pProfile->nDeadlineMiss;
+    pStats->nTicksPerSecond = pProfile->nTicksPerSecond;
+    pStats->nPeriod         = pProfile->nPeriod;
+    pStats->nDeadline       = pProfile->nDeadline;
+    pStats->nBinWidth       = (uint32)1u << pProfile->nBinShift;
+
+    pStats->nLatencyMin     = (nBlocks != 0u) ? pProfile->oLatency.nMin : 0u;
+    pStats->nLatencyMax     = pProfile->oLatency.nMax;
+    pStats->nLatencyMean    = (nBlocks != 0u) ? (uint32)(pProfile->oLatency.nSum / nBlocks) : 0u;
+
+    pStats->nProcessMin     = (nBlocks != 0u) ? pProfile->oProcess.nMin : 0u;
+    pStats->nProcessMax     = pProfile->oProcess.nMax;
+    pStats->nProcessMean    = (nBlocks != 0u) ? (uint32)(pProfile->oProcess.nSum / nBlocks) : 0u;
+
+    memcpy(pStats->aLatencyHist, pProfile->oLatency.aHist, sizeof(pStats->aLatencyHist));
+    memcpy(pStats->aProcessHist, pProfile->oProcess.aHist, sizeof(pStats->aProcessHist));
+}
+
+/*****************************************************************************/
+/*!
+@brief      Prints one metric: min/mean/max in microseconds and the
+            non-empty histogram bins.
+
+@param [in] pName       Metric name
+@param [in] pMetric     Metric
+@param [in] nBlocks     Number of samples in the metric (non-zero)
+@param [in] nBinShift   log2 of the histogram bin width
+@param [in] fTickUs     Microseconds per clock tick
+
+@return     None
+*/
+/*****************************************************************************/
+static void adi_a2b_AudioProfilePrint(const char *pName, const ADI_A2B_PROFILE_METRIC *pMetric,
+                                      uint32 nBlocks, uint32 nBinShift, float fTickUs)
+{
+    uint32 nBin;
+
+    printf("%s: min %.1f us, mean %.1f us, max %.1f us\n", pName,
+           (double)((float)pMetric->nMin * fTickUs),
+           (double)(((float)pMetric->nSum / (float)nBlocks) * fTickUs),
+           (double)((float)pMetric->nMax * fTickUs));
+
+    for(nBin = 0u; nBin < ADI_A2B_PROFILE_NUM_BINS; nBin++)
+    {
+        if(pMetric->aHist[nBin] != 0u)
+        {
+            printf("  %8.1f us%s %lu\n",
+                   (double)((float)(nBin << nBinShift) * fTickUs),
+                   (nBin == (ADI_A2B_PROFILE_NUM_BINS - 1u)) ? "+" : " ",
+                   (unsigned long)pMetric->aHist[nBin]);
+        }
+    }
+}
+
+/*****************************************************************************/
+/*!
+@brief      Prints the statistics on stdout. Meant for a periodic dump from
+            the main loop, never from the audio path itself.
+
+@param [in] pProfile    Profiler
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioProfileDump(const ADI_A2B_AUDIO_PROFILE *pProfile)
+{
+    float fTickUs = 1.0e6f / (float)pProfile->nTicksPerSecond;
+
+    printf("audio profile: %lu blocks, %lu deadline misses, period %.1f us, deadline %.1f us\n",
+           (unsigned long)pProfile->nBlocks, (unsigned long)pProfile->nDeadlineMiss,
+           (double)((float)pProfile->nPeriod * fTickUs),
+           (double)((float)pProfile->nDeadline * fTickUs));
+
+    if(pProfile->nBlocks != 0u)
+    {
+        adi_a2b_AudioProfilePrint("latency", &pProfile->oLatency, pProfile->nBlocks, pProfile->nBinShift, fTickUs);
+        adi_a2b_AudioProfilePrint("process", &pProfile->oProcess, pProfile->nBlocks, pProfile->nBinShift, fTickUs);
+    }
+}
+
+#if !defined(__ADSP21000__)
+/*****************************************************************************/
+/*!
+@brief      Host clock for ADI_A2B_PROFILE_NOW(), in nanoseconds modulo 2^32.
+
+@return     Current time
+*/
+/*****************************************************************************/
+uint32 adi_a2b_AudioProfileHostClock(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec oTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (uint32)(((uint64)oTs.tv_sec * 1000000000u) + (uint64)oTs.tv_nsec);
+#else
+    return (uint32)(((uint64)clock() * 1000000000u) / CLOCKS_PER_SEC);
+#endif
+}
+#endif
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
+
+/*
+**
+** EOF: $URL$
+**
+*/
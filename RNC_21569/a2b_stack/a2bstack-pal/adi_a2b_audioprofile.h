@@ -0,0 +1,171 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+******************************************************************************
+* @file: adi_a2b_audioprofile.h
+* @brief: Per-block timing of the audio path: DMA completion to processing
+*         start (latency) and processing start to end (processing time).
+* Developed by: Automotive Software and Systems team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Target_Independent
+* @{
+*/
+
+/** @defgroup AUDIO_PROFILE
+*
+* Three time stamps are taken per block: when the RX DMA completes the
+* block (SPORT callback), when processing starts and when it ends. The
+* stamps are raw cycle counts (EMUCLK on the SHARC) or nanoseconds on a
+* host. Taking a stamp is a single counter read and store; the end of
+* block update is a handful of compares, adds and one shift, so the
+* instrumentation stays enabled in production builds.
+*
+* Histograms have ADI_A2B_PROFILE_NUM_BINS bins of equal power-of-two
+* width, chosen at init so that the deadline falls in the middle bin. The
+* last bin collects everything above the range.
+*
+*/
+
+/*! \addtogroup AUDIO_PROFILE AUDIO_PROFILE
+* @{
+*/
+
+#ifndef __ADI_A2B_AUDIOPROFILE_H__
+#define __ADI_A2B_AUDIOPROFILE_H__
+
+/*============= I N C L U D E S =============*/
+#include "adi_a2b_datatypes.h"
+#include "adi_a2b_audioconfig.h"
+
+#if defined(__ADSP21000__)
+#include <builtins.h>
+#endif
+
+/*============= D E F I N E S =============*/
+
+#ifndef ADI_A2B_PROFILE_NUM_BINS
+#define ADI_A2B_PROFILE_NUM_BINS        (32u)   /*!< Histogram bins per metric */
+#endif
+
+#if defined(__ADSP21000__)
+/*! Current time in core cycles */
+#define ADI_A2B_PROFILE_NOW()           ((uint32)emuclk())
+#else
+/*! Current time in nanoseconds */
+#define ADI_A2B_PROFILE_NOW()           adi_a2b_AudioProfileHostClock()
+#endif
+
+/*! Stamps the DMA completion of the block in descriptor nSlot (SPORT callback) */
+#define ADI_A2B_PROFILE_DMA_DONE(pProfile, nSlot)   ((pProfile)->aDoneStamp[(nSlot)] = ADI_A2B_PROFILE_NOW())
+
+/*! Stamps the start of processing */
+#define ADI_A2B_PROFILE_START(pProfile)             ((pProfile)->nStartStamp = ADI_A2B_PROFILE_NOW())
+
+/*============= D A T A T Y P E S=============*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*! \struct ADI_A2B_PROFILE_METRIC
+    Running statistics of one per-block duration, in clock ticks
+*/
+typedef struct
+{
+    uint32      nMin;
+    uint32      nMax;
+    uint64      nSum;
+    uint32      aHist[ADI_A2B_PROFILE_NUM_BINS];
+
+}ADI_A2B_PROFILE_METRIC;
+
+/*! \struct ADI_A2B_AUDIO_PROFILE
+    Profiler state
+*/
+typedef struct
+{
+    /*! DMA completion stamp per descriptor (written by the SPORT callback) */
+    volatile uint32 aDoneStamp[DMA_NUM_DESC];
+
+    /*! Start stamp of the block being processed */
+    uint32      nStartStamp;
+
+    /*! DMA completion to processing start */
+    ADI_A2B_PROFILE_METRIC oLatency;
+
+    /*! Processing start to end */
+    ADI_A2B_PROFILE_METRIC oProcess;
+
+    /*! Blocks measured */
+    uint32      nBlocks;
+
+    /*! Blocks that ended later than nDeadline after their DMA completion */
+    uint32      nDeadlineMiss;
+
+    /*! Clock ticks per second */
+    uint32      nTicksPerSecond;
+
+    /*! Block period in ticks */
+    uint32      nPeriod;
+
+    /*! Deadline in ticks after DMA completion */
+    uint32      nDeadline;
+
+    /*! log2 of the histogram bin width in ticks */
+    uint32      nBinShift;
+
+}ADI_A2B_AUDIO_PROFILE;
+
+/*! \struct ADI_A2B_AUDIO_PROFILE_STATS
+    Snapshot returned by adi_a2b_AudioProfileGetStats()
+*/
+typedef struct
+{
+    uint32      nBlocks;
+    uint32      nDeadlineMiss;
+    uint32      nTicksPerSecond;
+    uint32      nPeriod;
+    uint32      nDeadline;
+    uint32      nBinWidth;
+
+    uint32      nLatencyMin;
+    uint32      nLatencyMax;
+    uint32      nLatencyMean;
+
+    uint32      nProcessMin;
+    uint32      nProcessMax;
+    uint32      nProcessMean;
+
+    uint32      aLatencyHist[ADI_A2B_PROFILE_NUM_BINS];
+    uint32      aProcessHist[ADI_A2B_PROFILE_NUM_BINS];
+
+}ADI_A2B_AUDIO_PROFILE_STATS;
+
+/*======= P U B L I C P R O T O T Y P E S ========*/
+
+void adi_a2b_AudioProfileInit(ADI_A2B_AUDIO_PROFILE *pProfile, uint32 nTicksPerSecond,
+                              uint32 nPeriod, uint32 nDeadline);
+void adi_a2b_AudioProfileReset(ADI_A2B_AUDIO_PROFILE *pProfile);
+void adi_a2b_AudioProfileEnd(ADI_A2B_AUDIO_PROFILE *pProfile, uint32 nSlot);
+void adi_a2b_AudioProfileGetStats(const ADI_A2B_AUDIO_PROFILE *pProfile,
+                                  ADI_A2B_AUDIO_PROFILE_STATS *pStats);
+void adi_a2b_AudioProfileDump(const ADI_A2B_AUDIO_PROFILE *pProfile);
+#if !defined(__ADSP21000__)
+uint32 adi_a2b_AudioProfileHostClock(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ADI_A2B_AUDIOPROFILE_H__ */
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
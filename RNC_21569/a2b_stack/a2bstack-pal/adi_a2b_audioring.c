@@ -0,0 +1,165 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : adi_a2b_audioring.c
+
+   Description: This file implements the single producer / single consumer
+                bookkeeping of the SPORT DMA descriptor ring.
+
+   Functions  :  adi_a2b_AudioRingInit()
+                 adi_a2b_AudioRingProduce()
+                 adi_a2b_AudioRingAcquire()
+                 adi_a2b_AudioRingRelease()
+                 adi_a2b_AudioRingGetStats()
+
+   Prepared &
+   Reviewed by: Automotive Software and Systems team,
+                IPDC, Analog Devices,  Bangalore, India
+
+******************************************************************************/
+/*! \addtogroup Target_Independent
+ *  @{
+ */
+
+/*! \addtogroup AUDIO_RING
+ *  @{
+ */
+
+/*============= I N C L U D E S =============*/
+
+#include "adi_a2b_audioring.h"
+
+/*============= C O D E =============*/
+
+/*****************************************************************************/
+/*!
+@brief      Resets the ring. Must be called before the DMA is started.
+
+@param [in] pRing       Ring instance
+@param [in] nDepth      Number of descriptors in the DMA chain (>= 2)
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioRingInit(ADI_A2B_AUDIO_RING *pRing, uint32 nDepth)
+{
+    pRing->nWriteSeq        = 0u;
+    pRing->nReadSeq         = 0u;
+    pRing->nDepth           = nDepth;
+    pRing->nOverrunBlocks   = 0u;
+    pRing->nUnderrunBlocks  = 0u;
+    pRing->nMaxFill         = 0u;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Records the completion of one RX block. Called from the SPORT
+            callback; this is the only writer of nWriteSeq.
+
+@param [in] pRing       Ring instance
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioRingProduce(ADI_A2B_AUDIO_RING *pRing)
+{
+    pRing->nWriteSeq = pRing->nWriteSeq + 1u;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Gets the next block to process. If the consumer fell so far
+            behind that the DMA already overwrote the oldest unread block,
+            the ring resynchronises to the newest completed block and the
+            skipped blocks are counted as overrun.
+
+@param [in]  pRing      Ring instance
+@param [out] pSeq       Sequence number of the block
+@param [out] pSlot      DMA descriptor index of the block
+
+@return     A2B_TRUE if a block is ready, A2B_FALSE otherwise
+*/
+/*****************************************************************************/
+a2b_Bool adi_a2b_AudioRingAcquire(ADI_A2B_AUDIO_RING *pRing, uint32 *pSeq, uint32 *pSlot)
+{
+    uint32  nWriteSeq = pRing->nWriteSeq;
+    uint32  nFill = nWriteSeq - pRing->nReadSeq;
+
+    if(nFill == 0u)
+    {
+        return A2B_FALSE;
+    }
+
+    if(nFill > pRing->nMaxFill)
+    {
+        pRing->nMaxFill = nFill;
+    }
+
+    if(nFill >= pRing->nDepth)
+    {
+        pRing->nOverrunBlocks += (nFill - 1u);
+        pRing->nReadSeq = nWriteSeq - 1u;
+    }
+
+    *pSeq  = pRing->nReadSeq;
+    *pSlot = pRing->nReadSeq % pRing->nDepth;
+
+    return A2B_TRUE;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Marks a block as processed. The block counts as underrun if its
+            TX slot was already being sent again when processing finished.
+
+@param [in] pRing       Ring instance
+@param [in] nSeq        Sequence number returned by adi_a2b_AudioRingAcquire()
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioRingRelease(ADI_A2B_AUDIO_RING *pRing, uint32 nSeq)
+{
+    if((pRing->nWriteSeq - nSeq) >= pRing->nDepth)
+    {
+        pRing->nUnderrunBlocks++;
+    }
+
+    pRing->nReadSeq = nSeq + 1u;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Takes a snapshot of the ring counters.
+
+@param [in]  pRing      Ring instance
+@param [out] pStats     Counters
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioRingGetStats(const ADI_A2B_AUDIO_RING *pRing, ADI_A2B_AUDIO_RING_STATS *pStats)
+{
+    pStats->nProduced       = pRing->nWriteSeq;
+    pStats->nConsumed       = pRing->nReadSeq;
+    pStats->nOverrunBlocks  = pRing->nOverrunBlocks;
+    pStats->nUnderrunBlocks = pRing->nUnderrunBlocks;
+    pStats->nMaxFill        = pRing->nMaxFill;
+}
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
+
+/*
+**
+** EOF: $URL$
+**
+*/
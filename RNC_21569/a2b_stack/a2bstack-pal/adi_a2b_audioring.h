@@ -0,0 +1,112 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+******************************************************************************
+* @file: adi_a2b_audioring.h
+* @brief: Single producer / single consumer bookkeeping for the circular
+*         chain of SPORT DMA descriptors.
+* Developed by: Automotive Software and Systems team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Target_Independent
+* @{
+*/
+
+/** @defgroup AUDIO_RING
+*
+* The RX and TX DMA chains run in lock step over nDepth descriptors. The
+* SPORT callback (producer) only advances the write sequence; the audio
+* loop (consumer) only advances the read sequence. Both are free running
+* 32-bit counters, so the fill level is their difference and the DMA slot
+* of a block is its sequence number modulo the depth. No lock is needed as
+* each counter has a single writer.
+*
+* Once block s + nDepth - 1 completes, the DMA starts refilling the RX slot
+* of block s and sending its TX slot again. Input not read by then is lost
+* (overrun) and output written after that point is late (underrun). Extra
+* descriptors therefore absorb main-loop jitter at the cost of one block of
+* latency each.
+*
+*/
+
+/*! \addtogroup AUDIO_RING AUDIO_RING
+* @{
+*/
+
+#ifndef __ADI_A2B_AUDIORING_H__
+#define __ADI_A2B_AUDIORING_H__
+
+/*============= I N C L U D E S =============*/
+#include "adi_a2b_datatypes.h"
+
+/*============= D A T A T Y P E S=============*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*! \struct ADI_A2B_AUDIO_RING_STATS
+    Ring counters
+*/
+typedef struct
+{
+    /*! Blocks completed by the RX DMA */
+    uint32      nProduced;
+
+    /*! Blocks handed to the audio chain */
+    uint32      nConsumed;
+
+    /*! Blocks skipped because the DMA had overwritten them */
+    uint32      nOverrunBlocks;
+
+    /*! Blocks whose output was written after its TX slot was sent */
+    uint32      nUnderrunBlocks;
+
+    /*! Highest fill level seen by the consumer */
+    uint32      nMaxFill;
+
+}ADI_A2B_AUDIO_RING_STATS;
+
+/*! \struct ADI_A2B_AUDIO_RING
+    Ring state
+*/
+typedef struct
+{
+    /*! Sequence number of the next block the DMA completes (producer) */
+    volatile uint32 nWriteSeq;
+
+    /*! Sequence number of the next block to process (consumer) */
+    uint32      nReadSeq;
+
+    /*! Number of DMA descriptors in the chain */
+    uint32      nDepth;
+
+    /*! Consumer side counters */
+    uint32      nOverrunBlocks;
+    uint32      nUnderrunBlocks;
+    uint32      nMaxFill;
+
+}ADI_A2B_AUDIO_RING;
+
+/*======= P U B L I C P R O T O T Y P E S ========*/
+
+void adi_a2b_AudioRingInit(ADI_A2B_AUDIO_RING *pRing, uint32 nDepth);
+void adi_a2b_AudioRingProduce(ADI_A2B_AUDIO_RING *pRing);
+a2b_Bool adi_a2b_AudioRingAcquire(ADI_A2B_AUDIO_RING *pRing, uint32 *pSeq, uint32 *pSlot);
+void adi_a2b_AudioRingRelease(ADI_A2B_AUDIO_RING *pRing, uint32 nSeq);
+void adi_a2b_AudioRingGetStats(const ADI_A2B_AUDIO_RING *pRing, ADI_A2B_AUDIO_RING_STATS *pStats);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ADI_A2B_AUDIORING_H__ */
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
@@ -0,0 +1,128 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : adi_a2b_audiostage.c
+
+   Description: This file implements the conversion between interleaved TDM
+                frames and channel-major float blocks.
+
+   Functions  :  adi_a2b_AudioDeinterleave()
+                 adi_a2b_AudioInterleave()
+
+   Prepared &
+   Reviewed by: Automotive Software and Systems team,
+                IPDC, Analog Devices,  Bangalore, India
+
+******************************************************************************/
+/*! \addtogroup Target_Independent
+ *  @{
+ */
+
+/*! \addtogroup AUDIO_STAGE
+ *  @{
+ */
+
+/*============= I N C L U D E S =============*/
+
+#include "adi_a2b_audiostage.h"
+
+/*============= C O D E =============*/
+
+/*****************************************************************************/
+/*!
+@brief      Gathers nChannels consecutive TDM slots, starting at nFirstSlot,
+            into per-channel float blocks. Each channel is one stride-nSlots
+            pass over the frame buffer with a contiguous write, which the
+            compiler vectorises.
+
+@param [in]  aFrame         Interleaved frames (nSlots words per frame)
+@param [in]  nSlots         TDM slots per frame
+@param [in]  nFirstSlot     First slot to extract
+@param [in]  nChannels      Number of slots to extract
+@param [out] apChannel      nChannels blocks of nFrames samples
+@param [in]  nFrames        Frames in the block
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioDeinterleave(const int32_t aFrame[], uint32 nSlots,
+                               uint32 nFirstSlot, uint32 nChannels,
+                               float * const apChannel[], uint32 nFrames)
+{
+    uint32          nCh, nFrame;
+    const int32_t   *pIn;
+    float           *pOut;
+
+    for(nCh = 0u; nCh < nChannels; nCh++)
+    {
+        pIn  = &aFrame[nFirstSlot + nCh];
+        pOut = apChannel[nCh];
+
+#pragma vector_for
+        for(nFrame = 0u; nFrame < nFrames; nFrame++)
+        {
+            /* Arithmetic shift sign-fills the 24-bit sample */
+            pOut[nFrame] = (float)(pIn[nFrame * nSlots] >> ADI_A2B_AUDIO_SAMPLE_SHIFT) *
+                           ADI_A2B_AUDIO_INV_FULL_SCALE;
+        }
+    }
+}
+
+/*****************************************************************************/
+/*!
+@brief      Scatters per-channel float blocks into nChannels consecutive TDM
+            slots starting at nFirstSlot. Samples are saturated to the 24-bit
+            range, rounded to nearest and left justified. Other slots of the
+            frame are not touched.
+
+@param [in]  apChannel      nChannels blocks of nFrames samples
+@param [in]  nChannels      Number of slots to fill
+@param [out] aFrame         Interleaved frames (nSlots words per frame)
+@param [in]  nSlots         TDM slots per frame
+@param [in]  nFirstSlot     First slot to fill
+@param [in]  nFrames        Frames in the block
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioInterleave(const float * const apChannel[], uint32 nChannels,
+                             int32_t aFrame[], uint32 nSlots,
+                             uint32 nFirstSlot, uint32 nFrames)
+{
+    uint32          nCh, nFrame;
+    const float     *pIn;
+    int32_t         *pOut;
+    float           fSample;
+
+    for(nCh = 0u; nCh < nChannels; nCh++)
+    {
+        pIn  = apChannel[nCh];
+        pOut = &aFrame[nFirstSlot + nCh];
+
+#pragma vector_for
+        for(nFrame = 0u; nFrame < nFrames; nFrame++)
+        {
+            fSample = pIn[nFrame] * ADI_A2B_AUDIO_FULL_SCALE;
+            fSample = A2B_MIN(A2B_MAX(fSample, ADI_A2B_AUDIO_MIN_24BIT), ADI_A2B_AUDIO_MAX_24BIT);
+            fSample = fSample + ((fSample >= 0.0f) ? 0.5f : -0.5f);
+            pOut[nFrame * nSlots] = (int32_t)((uint32_t)(int32_t)fSample << ADI_A2B_AUDIO_SAMPLE_SHIFT);
+        }
+    }
+}
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
+
+/*
+**
+** EOF: $URL$
+**
+*/
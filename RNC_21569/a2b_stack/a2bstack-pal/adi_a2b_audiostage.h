@@ -0,0 +1,75 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+******************************************************************************
+* @file: adi_a2b_audiostage.h
+* @brief: Conversion between the interleaved 32-bit TDM frames of the SPORT
+*         DMA buffers and per-channel contiguous float blocks.
+* Developed by: Automotive Software and Systems team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Target_Independent
+* @{
+*/
+
+/** @defgroup AUDIO_STAGE
+*
+* The SPORT DMA buffers hold whole TDM frames, so a channel is spread over
+* the buffer with a stride equal to the slot count. Processing modules work
+* on channel-major float blocks instead: the upstream buffer is
+* deinterleaved once per block, the modules run on contiguous data, and the
+* result is interleaved back into the DAC buffer.
+*
+* Samples are 24-bit, left justified in the 32-bit slot. On the way in the
+* low byte is dropped with an arithmetic shift (sign fill) and the sample is
+* scaled to [-1, 1). On the way out it is rounded to 24 bits and saturated.
+* The round trip is bit exact for 24-bit data.
+*
+*/
+
+/*! \addtogroup AUDIO_STAGE AUDIO_STAGE
+* @{
+*/
+
+#ifndef __ADI_A2B_AUDIOSTAGE_H__
+#define __ADI_A2B_AUDIOSTAGE_H__
+
+/*============= I N C L U D E S =============*/
+#include <stdint.h>
+#include "adi_a2b_datatypes.h"
+
+/*============= D E F I N E S =============*/
+
+#define ADI_A2B_AUDIO_SAMPLE_SHIFT      (8u)                    /*!< Left justification of the 24-bit sample */
+#define ADI_A2B_AUDIO_FULL_SCALE        (8388608.0f)            /*!< 2^23                                    */
+#define ADI_A2B_AUDIO_INV_FULL_SCALE    (1.0f / 8388608.0f)     /*!< 2^-23                                   */
+#define ADI_A2B_AUDIO_MAX_24BIT         (8388607.0f)            /*!< Largest 24-bit sample                   */
+#define ADI_A2B_AUDIO_MIN_24BIT         (-8388608.0f)           /*!< Smallest 24-bit sample                  */
+
+/*======= P U B L I C P R O T O T Y P E S ========*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void adi_a2b_AudioDeinterleave(const int32_t aFrame[], uint32 nSlots,
+                               uint32 nFirstSlot, uint32 nChannels,
+                               float * const apChannel[], uint32 nFrames);
+void adi_a2b_AudioInterleave(const float * const apChannel[], uint32 nChannels,
+                             int32_t aFrame[], uint32 nSlots,
+                             uint32 nFirstSlot, uint32 nFrames);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ADI_A2B_AUDIOSTAGE_H__ */
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
@@ -38,6 +38,10 @@ uint32_t adi_a2b_TimerOpen(uint32_t nTimerNo,void* pUserArgument);
 uint32_t adi_a2b_TimerStop(uint32_t nTimerNo);
 uint32_t adi_a2b_TimerClose(uint32_t nTimerNo);
 uint32_t adi_a2b_TimerStart(uint32_t nTimerNo, uint32_t nTime);
+uint32_t adi_a2b_TimerCycles(void);
+uint64_t adi_a2b_TimerCycles64(void);
+uint32_t adi_a2b_TimerCoreClk(void);
+uint32_t adi_a2b_TimerWait(uint32_t nTimerNo, uint32_t nTime);
 void  adi_a2b_Delay(uint32_t nTime);
 
 /* TWI / I2C */
@@ -19,6 +19,7 @@ and its licensors.
 
 /*============= I N C L U D E S =============*/
 #include "a2bstack/inc/a2b/pal.h"
+#include "adi_a2b_twidriver.h"
 /*============= D E F I N E S =============*/
 
 /*============= E X T E R N A L S ============*/
@@ -55,8 +56,15 @@ a2b_HResult a2b_pal_I2cWriteReadFunc(a2b_Handle hnd,
         a2b_Byte* rBuf);
 a2b_UInt32 a2b_pal_I2cShutdownFunc(A2B_ECB* ecb);
 a2b_HResult a2b_pal_I2cCloseFunc(a2b_Handle hnd);
+a2b_HResult adi_a2b_TwiXferSubmit(a2b_UInt16 addr, a2b_UInt16 nWrite,
+        const a2b_Byte* wBuf, a2b_UInt16 nRead, a2b_Byte* rBuf,
+        ADI_A2B_TWI_DONE_CB pfDone, void* pCbParam);
+a2b_UInt32 adi_a2b_TwiXferStatus(void);
+void adi_a2b_TwiGetStats(ADI_A2B_TWI_STATS* pStats);
+void adi_a2b_TwiResetStats(void);
 a2b_HResult a2b_pal_TimerInitFunc(A2B_ECB* ecb);
 a2b_UInt32 a2b_pal_TimerGetSysTimeFunc();
+a2b_HResult a2b_pal_TimerWaitFunc(a2b_UInt32 nTime);
 a2b_HResult a2b_pal_TimerShutdownFunc(A2B_ECB* ecb);
 a2b_HResult a2b_pal_AudioInitFunc(A2B_ECB* ecb);
 a2b_Handle a2b_pal_AudioOpenFunc(void);
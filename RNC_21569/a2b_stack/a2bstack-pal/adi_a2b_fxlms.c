@@ -0,0 +1,335 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : adi_a2b_fxlms.c
+
+   Description: This file implements the block based multichannel filtered-x
+                LMS road noise cancellation engine.
+
+   Functions  :  adi_a2b_FxlmsInit()
+                 adi_a2b_FxlmsReset()
+                 adi_a2b_FxlmsSetSecondaryPath()
+                 adi_a2b_FxlmsProcess()
+
+   Prepared &
+   Reviewed by: Automotive Software and Systems team,
+                IPDC, Analog Devices,  Bangalore, India
+
+******************************************************************************/
+/*! \addtogroup Target_Independent
+ *  @{
+ */
+
+/*! \addtogroup FXLMS
+ *  @{
+ */
+
+/*============= I N C L U D E S =============*/
+
+#include <string.h>
+#include "adi_a2b_fxlms.h"
+
+/*============= D E F I N E S =============*/
+
+/*============= C O D E =============*/
+/*
+** Function Prototype section
+** (static-scoped functions)
+*/
+
+static float adi_a2b_FxlmsDot(const float aX[], const float aY[], uint32 nLen);
+
+/*
+** Function Definition section
+*/
+
+/*****************************************************************************/
+/*!
+@brief      Dot product of two forward running vectors. All filters in the
+            engine are stored time reversed so every inner loop has this
+            form, which the compiler maps onto the SIMD MAC units.
+
+@param [in] aX      First vector
+@param [in] aY      Second vector
+@param [in] nLen    Number of elements
+
+@return     Sum of element-wise products
+*/
+/*****************************************************************************/
+static float adi_a2b_FxlmsDot(const float aX[], const float aY[], uint32 nLen)
+{
+    uint32  nIndex;
+    float   fAcc = 0.0f;
+
+#pragma vector_for
+    for(nIndex = 0u; nIndex < nLen; nIndex++)
+    {
+        fAcc += aX[nIndex] * aY[nIndex];
+    }
+
+    return fAcc;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Initializes an FxLMS engine instance. Control filters, histories
+            and secondary path models are cleared.
+
+@param [in] pFxlms      Engine instance
+@param [in] pConfig     Adaptation parameters
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_FxlmsInit(ADI_A2B_FXLMS *pFxlms, const ADI_A2B_FXLMS_CONFIG *pConfig)
+{
+    memset(pFxlms, 0, sizeof(*pFxlms));
+
+    pFxlms->oConfig = *pConfig;
+    if(pFxlms->oConfig.nSecDelay > ADI_A2B_FXLMS_MAX_SEC_DELAY)
+    {
+        pFxlms->oConfig.nSecDelay = ADI_A2B_FXLMS_MAX_SEC_DELAY;
+    }
+}
+
+/*****************************************************************************/
+/*!
+@brief      Restarts adaptation from zero control filters. The secondary path
+            models and the configuration are retained.
+
+@param [in] pFxlms      Engine instance
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_FxlmsReset(ADI_A2B_FXLMS *pFxlms)
+{
+    memset(pFxlms->aCtrlCoef, 0, sizeof(pFxlms->aCtrlCoef));
+    memset(pFxlms->aRefHist, 0, sizeof(pFxlms->aRefHist));
+    memset(pFxlms->aFxHist, 0, sizeof(pFxlms->aFxHist));
+    pFxlms->fFxPower    = 0.0f;
+    pFxlms->nBlockCount = 0u;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Loads the secondary path model from speaker nSpk to error
+            microphone nErr. Coefficients are given in natural order
+            (aCoef[0] applies to the sample right after the bulk delay);
+            taps beyond ADI_A2B_FXLMS_SEC_LEN are ignored. When the taps
+            change, the filtered reference history of the pair is cleared:
+            it was filtered by the old model, or not kept at all while the
+            pair was inactive.
+
+@param [in] pFxlms      Engine instance
+@param [in] nSpk        Speaker index
+@param [in] nErr        Error microphone index
+@param [in] aCoef       Impulse response
+@param [in] nLen        Number of taps in aCoef
+
+@return     Return code
+            - 0: Success
+            - 1: Failure
+*/
+/*****************************************************************************/
+uint32 adi_a2b_FxlmsSetSecondaryPath(ADI_A2B_FXLMS *pFxlms, uint32 nSpk, uint32 nErr,
+                                     const float aCoef[], uint32 nLen)
+{
+    uint32  nTap;
+    float   *pSec;
+    float   fCoef;
+    uint32  bChanged = 0u;
+
+    if((nSpk >= ADI_A2B_FXLMS_NUM_SPK) || (nErr >= ADI_A2B_FXLMS_NUM_ERR))
+    {
+        return 1u;
+    }
+
+    pSec = pFxlms->aSecCoef[nSpk][nErr];
+    pFxlms->aSecActive[nSpk][nErr] = 0u;
+
+    for(nTap = 0u; nTap < ADI_A2B_FXLMS_SEC_LEN; nTap++)
+    {
+        fCoef = (nTap < nLen) ? aCoef[nTap] : 0.0f;
+        if(pSec[ADI_A2B_FXLMS_SEC_LEN - 1u - nTap] != fCoef)
+        {
+            bChanged = 1u;
+        }
+        pSec[ADI_A2B_FXLMS_SEC_LEN - 1u - nTap] = fCoef;
+        if(fCoef != 0.0f)
+        {
+            pFxlms->aSecActive[nSpk][nErr] = 1u;
+        }
+    }
+
+    if(bChanged != 0u)
+    {
+        memset(pFxlms->aFxHist[nSpk][nErr], 0, sizeof(pFxlms->aFxHist[nSpk][nErr]));
+    }
+
+    return 0u;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Processes one block.
+
+            1. The reference block is appended to the reference history.
+            2. The new references are filtered through every loaded
+               secondary path model.
+            3. The control filters are updated with the block gradient
+               sum_m sum_t e_m(t) x'_knm(t - D - i), normalised by the
+               smoothed filtered reference power.
+            4. The anti-noise block is produced with the updated filters.
+
+            Input and output channels are contiguous float blocks
+            (channel-major). Outputs are not saturated here.
+
+@param [in]  pFxlms     Engine instance
+@param [in]  apRef      ADI_A2B_FXLMS_NUM_REF reference blocks
+@param [in]  apErr      ADI_A2B_FXLMS_NUM_ERR error microphone blocks
+@param [out] apOut      ADI_A2B_FXLMS_NUM_SPK speaker blocks
+@param [in]  nFrames    Frames in this block (1..ADI_A2B_FXLMS_MAX_FRAMES)
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_FxlmsProcess(ADI_A2B_FXLMS *pFxlms,
+                          const float * const apRef[],
+                          const float * const apErr[],
+                          float * const apOut[],
+                          uint32 nFrames)
+{
+    uint32          nSpk, nErr, nRef, nTap, nFrame;
+    uint32          nRefNew, nFxNew, nActive;
+    float           fPower, fAcc, fStep, fLeak;
+    float           *pFx, *pCoef;
+    const float     *pFxOld;
+
+    if((nFrames == 0u) || (nFrames > ADI_A2B_FXLMS_MAX_FRAMES))
+    {
+        return;
+    }
+
+    /* Index of the first sample of this block in each history */
+    nRefNew = ADI_A2B_FXLMS_REF_HIST_LEN - nFrames;
+    nFxNew  = ADI_A2B_FXLMS_FX_HIST_LEN - nFrames;
+
+    /* 1. Slide the reference history and append the new block */
+    for(nRef = 0u; nRef < ADI_A2B_FXLMS_NUM_REF; nRef++)
+    {
+        memmove(&pFxlms->aRefHist[nRef][0], &pFxlms->aRefHist[nRef][nFrames], nRefNew * sizeof(float));
+        memcpy(&pFxlms->aRefHist[nRef][nRefNew], apRef[nRef], nFrames * sizeof(float));
+    }
+
+    /* 2. Filtered reference for the new block */
+    fPower  = 0.0f;
+    nActive = 0u;
+    for(nSpk = 0u; nSpk < ADI_A2B_FXLMS_NUM_SPK; nSpk++)
+    {
+        for(nErr = 0u; nErr < ADI_A2B_FXLMS_NUM_ERR; nErr++)
+        {
+            if(pFxlms->aSecActive[nSpk][nErr] == 0u)
+            {
+                continue;
+            }
+            nActive++;
+
+            for(nRef = 0u; nRef < ADI_A2B_FXLMS_NUM_REF; nRef++)
+            {
+                pFx = pFxlms->aFxHist[nSpk][nErr][nRef];
+                memmove(&pFx[0], &pFx[nFrames], nFxNew * sizeof(float));
+
+                for(nFrame = 0u; nFrame < nFrames; nFrame++)
+                {
+                    fAcc = adi_a2b_FxlmsDot(pFxlms->aSecCoef[nSpk][nErr],
+                                            &pFxlms->aRefHist[nRef][nRefNew + nFrame + 1u - ADI_A2B_FXLMS_SEC_LEN],
+                                            ADI_A2B_FXLMS_SEC_LEN);
+                    pFx[nFxNew + nFrame] = fAcc;
+                    fPower += fAcc * fAcc;
+                }
+            }
+        }
+    }
+
+    /* 3. Block gradient and coefficient update */
+    if((pFxlms->oConfig.bAdapt) && (nActive != 0u))
+    {
+        fPower /= (float)(nFrames * nActive * ADI_A2B_FXLMS_NUM_REF);
+        pFxlms->fFxPower = (pFxlms->oConfig.fPowerSmoothing * pFxlms->fFxPower) +
+                           ((1.0f - pFxlms->oConfig.fPowerSmoothing) * fPower);
+
+        fStep = pFxlms->oConfig.fStepSize /
+                ((pFxlms->oConfig.fRegularization +
+                  ((float)(ADI_A2B_FXLMS_CTRL_LEN * ADI_A2B_FXLMS_NUM_REF * nActive) * pFxlms->fFxPower)) *
+                 (float)nFrames);
+        fLeak = pFxlms->oConfig.fLeakage;
+
+        for(nSpk = 0u; nSpk < ADI_A2B_FXLMS_NUM_SPK; nSpk++)
+        {
+            for(nRef = 0u; nRef < ADI_A2B_FXLMS_NUM_REF; nRef++)
+            {
+                memset(pFxlms->aGrad, 0, sizeof(pFxlms->aGrad));
+
+                for(nErr = 0u; nErr < ADI_A2B_FXLMS_NUM_ERR; nErr++)
+                {
+                    if(pFxlms->aSecActive[nSpk][nErr] == 0u)
+                    {
+                        continue;
+                    }
+
+                    /* Oldest filtered reference sample that meets the error block,
+                     * i.e. x'(t - D - (L - 1)) for the first frame of the block */
+                    pFxOld = &pFxlms->aFxHist[nSpk][nErr][nRef][nFxNew - pFxlms->oConfig.nSecDelay
+                                                               + 1u - ADI_A2B_FXLMS_CTRL_LEN];
+                    for(nTap = 0u; nTap < ADI_A2B_FXLMS_CTRL_LEN; nTap++)
+                    {
+                        pFxlms->aGrad[nTap] += adi_a2b_FxlmsDot(apErr[nErr], &pFxOld[nTap], nFrames);
+                    }
+                }
+
+                pCoef = pFxlms->aCtrlCoef[nSpk][nRef];
+#pragma vector_for
+                for(nTap = 0u; nTap < ADI_A2B_FXLMS_CTRL_LEN; nTap++)
+                {
+                    pCoef[nTap] = (fLeak * pCoef[nTap]) - (fStep * pFxlms->aGrad[nTap]);
+                }
+            }
+        }
+    }
+
+    /* 4. Anti-noise with the updated control filters */
+    for(nSpk = 0u; nSpk < ADI_A2B_FXLMS_NUM_SPK; nSpk++)
+    {
+        for(nFrame = 0u; nFrame < nFrames; nFrame++)
+        {
+            fAcc = 0.0f;
+            for(nRef = 0u; nRef < ADI_A2B_FXLMS_NUM_REF; nRef++)
+            {
+                fAcc += adi_a2b_FxlmsDot(pFxlms->aCtrlCoef[nSpk][nRef],
+                                         &pFxlms->aRefHist[nRef][nRefNew + nFrame + 1u - ADI_A2B_FXLMS_CTRL_LEN],
+                                         ADI_A2B_FXLMS_CTRL_LEN);
+            }
+            apOut[nSpk][nFrame] = fAcc;
+        }
+    }
+
+    pFxlms->nBlockCount++;
+}
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
+
+/*
+**
+** EOF: $URL$
+**
+*/
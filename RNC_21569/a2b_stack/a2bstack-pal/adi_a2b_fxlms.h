@@ -0,0 +1,177 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+******************************************************************************
+* @file: adi_a2b_fxlms.h
+* @brief: Block based multichannel filtered-x LMS road noise cancellation
+*         engine. The engine is target independent and is also built on a
+*         host by tools/fxlms_host.
+* Developed by: Automotive Software and Systems team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Target_Independent
+* @{
+*/
+
+/** @defgroup FXLMS
+*
+* N reference sensors are filtered through a K x N bank of adaptive FIR
+* control filters to drive K speakers. The control filters are adapted once
+* per block from M error microphones using the reference signals filtered
+* through the K x M secondary path model. Each secondary path is modelled as
+* a common bulk delay (SPORT ping-pong and converter latency) followed by a
+* short FIR, which keeps the filtered-x cost independent of the I/O latency.
+*
+*/
+
+/*! \addtogroup FXLMS FXLMS
+* @{
+*/
+
+#ifndef __ADI_A2B_FXLMS_H__
+#define __ADI_A2B_FXLMS_H__
+
+/*============= I N C L U D E S =============*/
+#include "adi_a2b_datatypes.h"
+#include "adi_a2b_audioconfig.h"
+
+/*============= D E F I N E S =============*/
+
+#ifndef ADI_A2B_FXLMS_NUM_REF
+#define ADI_A2B_FXLMS_NUM_REF           (4u)    /*!< Reference sensors (upstream TDM slots)     */
+#endif
+
+#ifndef ADI_A2B_FXLMS_NUM_ERR
+#define ADI_A2B_FXLMS_NUM_ERR           (4u)    /*!< Error microphones (upstream TDM slots)     */
+#endif
+
+#ifndef ADI_A2B_FXLMS_NUM_SPK
+#define ADI_A2B_FXLMS_NUM_SPK           (4u)    /*!< Speakers (DAC TDM slots)                   */
+#endif
+
+#ifndef ADI_A2B_FXLMS_CTRL_LEN
+#define ADI_A2B_FXLMS_CTRL_LEN          (32u)   /*!< Taps per control filter                    */
+#endif
+
+#ifndef ADI_A2B_FXLMS_SEC_LEN
+#define ADI_A2B_FXLMS_SEC_LEN           (16u)   /*!< Taps per secondary path model (after delay) */
+#endif
+
+#ifndef ADI_A2B_FXLMS_MAX_SEC_DELAY
+#define ADI_A2B_FXLMS_MAX_SEC_DELAY     (DMA_NUM_DESC * ADI_A2B_AUDIO_MAX_FRAMES) /*!< Max secondary path bulk delay */
+#endif
+
+/*! Largest block the engine accepts in one call */
+#define ADI_A2B_FXLMS_MAX_FRAMES        (ADI_A2B_AUDIO_MAX_FRAMES)
+
+/*! Reference history: enough for the longer of the two FIRs plus one block */
+#define ADI_A2B_FXLMS_REF_HIST_LEN      (A2B_MAX(ADI_A2B_FXLMS_CTRL_LEN, ADI_A2B_FXLMS_SEC_LEN) - 1u + \
+                                         ADI_A2B_FXLMS_MAX_FRAMES)
+
+/*! Filtered reference history: bulk delay plus control filter span plus one block */
+#define ADI_A2B_FXLMS_FX_HIST_LEN       (ADI_A2B_FXLMS_MAX_SEC_DELAY + ADI_A2B_FXLMS_CTRL_LEN - 1u + \
+                                         ADI_A2B_FXLMS_MAX_FRAMES)
+
+/*! Multiply-accumulates per frame with every secondary path active
+ *  (filtered-x + gradient + control filtering). Used for cycle budgeting. */
+#define ADI_A2B_FXLMS_MACS_PER_FRAME    (ADI_A2B_FXLMS_NUM_SPK * ADI_A2B_FXLMS_NUM_REF * \
+                                         ((ADI_A2B_FXLMS_NUM_ERR * (ADI_A2B_FXLMS_SEC_LEN + ADI_A2B_FXLMS_CTRL_LEN)) + \
+                                          ADI_A2B_FXLMS_CTRL_LEN))
+
+/* References and error microphones share the upstream TDM frame, speakers the DAC frame */
+A2B_STATIC_ASSERT((ADI_A2B_FXLMS_NUM_REF + ADI_A2B_FXLMS_NUM_ERR) <= RxNUM_CHANNELS,
+                  "FxLMS sensors exceed upstream TDM slots");
+A2B_STATIC_ASSERT(ADI_A2B_FXLMS_NUM_SPK <= TxNUM_CHANNELS,
+                  "FxLMS speakers exceed DAC TDM slots");
+
+/*============= D A T A T Y P E S=============*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*! \struct ADI_A2B_FXLMS_CONFIG
+    Adaptation parameters of the FxLMS engine
+*/
+typedef struct
+{
+    /*! Normalised step size (0 < fStepSize < 2) */
+    float       fStepSize;
+
+    /*! Coefficient leakage applied once per block (1.0 = no leakage) */
+    float       fLeakage;
+
+    /*! Regularisation added to the filtered reference power */
+    float       fRegularization;
+
+    /*! Filtered reference power smoothing factor (0..1, per block) */
+    float       fPowerSmoothing;
+
+    /*! Secondary path bulk delay in samples */
+    uint32      nSecDelay;
+
+    /*! Adaptation enable; when false the control filters are frozen */
+    a2b_Bool    bAdapt;
+
+}ADI_A2B_FXLMS_CONFIG;
+
+/*! \struct ADI_A2B_FXLMS
+    FxLMS engine instance
+*/
+typedef struct
+{
+    /*! Adaptation parameters */
+    ADI_A2B_FXLMS_CONFIG oConfig;
+
+    /*! Control filters W[k][n], stored time reversed (newest tap last) */
+    float       aCtrlCoef[ADI_A2B_FXLMS_NUM_SPK][ADI_A2B_FXLMS_NUM_REF][ADI_A2B_FXLMS_CTRL_LEN];
+
+    /*! Secondary path models S[k][m] excluding bulk delay, stored time reversed */
+    float       aSecCoef[ADI_A2B_FXLMS_NUM_SPK][ADI_A2B_FXLMS_NUM_ERR][ADI_A2B_FXLMS_SEC_LEN];
+
+    /*! Reference history per sensor, oldest sample first */
+    float       aRefHist[ADI_A2B_FXLMS_NUM_REF][ADI_A2B_FXLMS_REF_HIST_LEN];
+
+    /*! Filtered reference history per speaker/mic/sensor, oldest sample first */
+    float       aFxHist[ADI_A2B_FXLMS_NUM_SPK][ADI_A2B_FXLMS_NUM_ERR][ADI_A2B_FXLMS_NUM_REF][ADI_A2B_FXLMS_FX_HIST_LEN];
+
+    /*! Gradient accumulator for one control filter */
+    float       aGrad[ADI_A2B_FXLMS_CTRL_LEN];
+
+    /*! Non-zero for secondary paths that have been loaded */
+    uint8       aSecActive[ADI_A2B_FXLMS_NUM_SPK][ADI_A2B_FXLMS_NUM_ERR];
+
+    /*! Smoothed filtered reference power */
+    float       fFxPower;
+
+    /*! Number of blocks processed */
+    uint32      nBlockCount;
+
+}ADI_A2B_FXLMS;
+
+/*======= P U B L I C P R O T O T Y P E S ========*/
+
+void adi_a2b_FxlmsInit(ADI_A2B_FXLMS *pFxlms, const ADI_A2B_FXLMS_CONFIG *pConfig);
+void adi_a2b_FxlmsReset(ADI_A2B_FXLMS *pFxlms);
+uint32 adi_a2b_FxlmsSetSecondaryPath(ADI_A2B_FXLMS *pFxlms, uint32 nSpk, uint32 nErr,
+                                     const float aCoef[], uint32 nLen);
+void adi_a2b_FxlmsProcess(ADI_A2B_FXLMS *pFxlms,
+                          const float * const apRef[],
+                          const float * const apErr[],
+                          float * const apOut[],
+                          uint32 nFrames);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ADI_A2B_FXLMS_H__ */
+
+/**
+ @}
+*/
+
+/**
+ @}
+*/
@@ -15,6 +15,10 @@ and its licensors.
                 a2b_I2cWriteFunc()
                 a2b_I2cWriteReadFunc()
                 a2b_I2cShutdownFunc()
+                adi_a2b_TwiXferSubmit()
+                adi_a2b_TwiXferStatus()
+                adi_a2b_TwiGetStats()
+                adi_a2b_TwiResetStats()
                
                  
    Prepared &
@@ -64,6 +68,7 @@ and its licensors.
 #include "adi_a2b_sys.h"
 #include "adi_a2b_audiorouting.h"
 #include "adi_a2b_sportdriver.h"
+#include "adi_a2b_audioprofile.h"
 
 /*============= D E F I N E S =============*/
 
@@ -91,13 +96,42 @@ ADI_TWI_HANDLE adi_twi_hDevice;
  Timer object for TWI */
 static ADI_A2B_TIMER_HANDLER oTWITimer;
 
-/*!\var nBufferProcessCount
- Number of processed buffers  */
-static volatile a2b_UInt8 nBufferProcessCount = 0;
+/*! \struct ADI_A2B_TWI_XFER
+    State of the TWI transfer in flight. Written by the submitting thread
+    while no transfer is busy, and by the TWI and timer callbacks while one is.
+*/
+typedef struct
+{
+    /*! Transfer state (ADI_A2B_TWI_XFER_xxx) */
+    volatile a2b_UInt32 eState;
+
+    /*! Driver callbacks still expected for this transfer */
+    volatile a2b_UInt32 nPending;
+
+    /*! Sequence number of this transfer, the driver callback parameter */
+    volatile a2b_UInt32 nSeq;
+
+    /*! Completion callback and its parameter */
+    ADI_A2B_TWI_DONE_CB pfDone;
+    void*               pCbParam;
+
+    /*! Bytes written and read by this transfer */
+    a2b_UInt32          nBytes;
+
+    /*! Cycle count at submit */
+    a2b_UInt32          nStartStamp;
+
+    /*! Statistics over all transfers */
+    ADI_A2B_TWI_STATS   oStats;
 
-/*!\var nExpectedCallbackCount
- Total number of expected callbacks */
-static a2b_UInt8 nExpectedCallbackCount = 0;
+    /*! Write data, kept here so that the caller's buffer may be reused at once */
+    a2b_UInt8           aTxData[MAX_NUMBER_TWI_BYTES];
+
+}ADI_A2B_TWI_XFER;
+
+/*!\var oTwiXfer
+ TWI transfer in flight */
+static ADI_A2B_TWI_XFER oTwiXfer;
 
 static a2b_Bool bA2BSportOpen=false;
 
@@ -123,18 +157,14 @@ adi_a2b_audio goA2bAudio;
 
 static ADI_SPORT_RESULT adi_a2b_EnableAudioHost(void);
 
-static a2b_UInt8 adi_a2b_TwiWriteComplete(a2b_UInt8 nTWIDeviceNo);
-static a2b_UInt8 adi_a2b_TwiReadComplete(a2b_UInt8 nTWIDeviceNo);
-static a2b_UInt32 adi_a2b_HandleError(a2b_UInt8 nTWIDeviceNo ,  a2b_UInt8 bComplete );
+static a2b_HResult adi_a2b_TwiXferWait(void);
+static void adi_a2b_TwiXferFinish(a2b_UInt32 eState);
+static void adi_a2b_TwiXferFlush(void);
 static void adi_a2b_TimerCallback(ADI_A2B_TIMER_HANDLER_PTR pTimerHandle);
 
 static void adi_a2b_TWICallbackFunction(void* pCBParam, a2b_UInt32 Event, void* pArg);
 static void adi_a2b_TWITimeoutHandler(ADI_A2B_TIMER_HANDLER_PTR pTWITimerHandlePtr);
 
-#if A2B_USE_CODEC
-static void adi_a2b_UpstreamToDACRouting(ADI_A2B_SCOMM_HANDLER* pAudioRoutingHandle, a2b_UInt32 anDACBuffer[], a2b_UInt32 anUpstreamBuffer[][SPORT_BUFFER_SIZE], a2b_UInt32 nChannel );
-#endif
-
 /*
 ** Function Definition section
 */
@@ -334,7 +364,9 @@ a2b_Handle a2b_pal_I2cOpenFunc(a2b_I2cAddrFmt fmt,
 
 /****************************************************************************/
 /*!
-    @brief          This function handles TWI timeout event. It sets 'Timeout' flag
+    @brief          This function handles TWI timeout event. It sets 'Timeout'
+                    flag, stops the TWI device and fails the transfer in
+                    flight.
 
     @param [in]     pTWITimerHandlePtr  Pointer to TWI Timer configuration structure
 
@@ -351,37 +383,61 @@ static void adi_a2b_TWITimeoutHandler(ADI_A2B_TIMER_HANDLER_PTR pTWITimerHandleP
     /* Reset timer0 */
     adi_a2b_TimerStop(pTWITimerHandlePtr->nTimerNo);
 
+#if TIME_OUT_ENABLE
+    if(oTwiXfer.eState == ADI_A2B_TWI_XFER_BUSY)
+    {
+        adi_a2b_TwiXferFlush();
+        adi_a2b_TwiXferFinish(ADI_A2B_TWI_XFER_ERROR);
+    }
+#endif
 }
 
 /*****************************************************************************/
 /*!
-@brief  This API Reads a bytes of data from an I2C device
+@brief  This API starts a TWI transfer and returns without waiting for it:
+        nWrite bytes from wBuf, then nRead bytes into rBuf after a repeated
+        start. Either count may be zero, not both. The write data is copied;
+        rBuf must stay valid until the transfer completes.
+
+        Completion is reported by pfDone (if not NULL) from interrupt context
+        and by adi_a2b_TwiXferStatus(). A job of the stack can submit, return
+        A2B_EXEC_SUSPEND and be rescheduled once the transfer has finished.
 
-@param [in]:hnd  - Handle to the I2C Sub-system.
 @param [in]:addr  - Device Address to which I2C communication
                     should happen.
+@param [in]:nWrite  - Number of bytes to be written.
+@param [in]:wBuf  - Pointer to the buffer from where bytes are
+                    to be written.
 @param [in]:nRead  - Number of bytes to be read.
 @param [in]:rBuf  - Pointer to the buffer where read bytes are
                     to be stored.
+@param [in]:pfDone  - Completion callback, may be NULL.
+@param [in]:pCbParam  - Parameter passed to pfDone.
+
 @return Return code
-        -1: Failure
+        -1: Failure, nothing was started and pfDone will not be called
         -0: Success
 
 */
 /*****************************************************************************/
 ADI_MEM_A2B_CODE_CRIT
-a2b_HResult a2b_pal_I2cReadFunc(a2b_Handle hnd,
-        a2b_UInt16 addr, a2b_UInt16 nRead, a2b_Byte* rBuf)
+a2b_HResult adi_a2b_TwiXferSubmit(a2b_UInt16 addr, a2b_UInt16 nWrite,
+        const a2b_Byte* wBuf, a2b_UInt16 nRead, a2b_Byte* rBuf,
+        ADI_A2B_TWI_DONE_CB pfDone, void* pCbParam)
 {
-    a2b_UInt32 					nReturnValue 	= (a2b_UInt32)0 ;
-    ADI_TWI_RESULT 				eTwiResult 	;
-    static a2b_UInt8 			nTWIData[4];
-    a2b_UInt32 					nWCount    = 0u,nRCount;
-    a2b_UInt32                  delay1 = 0xffff;
+    ADI_TWI_RESULT 	eTwiResult;
+    a2b_UInt32 		nIndex;
 
-    nTWIData[nWCount++]=0x0;/*Read from offset 0 always */
+    if((oTwiXfer.eState == ADI_A2B_TWI_XFER_BUSY) || (nWrite > MAX_NUMBER_TWI_BYTES) ||
+       ((nWrite + nRead) == 0u))
+    {
+    	return (1);
+    }
 
-    nRCount=nRead;
+    for(nIndex = 0u; nIndex < nWrite; nIndex++)
+    {
+    	oTwiXfer.aTxData[nIndex] = wBuf[nIndex];
+    }
 
     eTwiResult = adi_twi_SetHardwareAddress (adi_twi_hDevice, addr);
     if(eTwiResult != 0)
@@ -389,54 +445,139 @@ a2b_HResult a2b_pal_I2cReadFunc(a2b_Handle hnd,
     	return (1);
     }
 
-	/* Support for zero byte addressing */
-	if(nWCount > 0u )
-   	{
-   		nExpectedCallbackCount++;
-   		eTwiResult = adi_twi_SubmitTxBuffer(adi_twi_hDevice, (void *)&nTWIData[0U], nWCount, FALSE);
-   		if(eTwiResult != 0)
-		{
-			return (1);
-		}
-   	}
+    /* Callbacks carry the sequence number, a completion reported for an
+     * earlier transfer is ignored */
+    oTwiXfer.nSeq++;
+    eTwiResult = adi_twi_RegisterCallback(adi_twi_hDevice, (ADI_CALLBACK)&adi_a2b_TWICallbackFunction,
+                                          (void*)(a2b_UIntPtr)oTwiXfer.nSeq);
+    if(eTwiResult != 0)
+    {
+    	return (1);
+    }
 
-   	eTwiResult = adi_twi_Enable(adi_twi_hDevice); //write/read i2c device
-   	if(eTwiResult != 0)
-	{
-		return (1);
-	}
+    /* Both buffers are queued before the single enable, so the read follows
+     * the write with a repeated start and no wait in between. A buffer that
+     * was queued is dropped again if the rest of the transfer fails. */
+    oTwiXfer.nPending = 0u;
+    if(nWrite > 0u)
+    {
+    	oTwiXfer.nPending++;
+    	eTwiResult = adi_twi_SubmitTxBuffer(adi_twi_hDevice, (void *)&oTwiXfer.aTxData[0U], nWrite,
+    	                                    (nRead > 0u) ? TRUE : FALSE);
+    	if(eTwiResult != 0)
+    	{
+    		adi_a2b_TwiXferFlush();
+    		return (1);
+    	}
+    }
+    if(nRead > 0u)
+    {
+    	oTwiXfer.nPending++;
+    	eTwiResult = adi_twi_SubmitRxBuffer(adi_twi_hDevice, (void *)rBuf, nRead, FALSE);
+    	if(eTwiResult != 0)
+    	{
+    		adi_a2b_TwiXferFlush();
+    		return (1);
+    	}
+    }
 
-   	while(delay1--)
-	{
-		NOP();
-	}
+    oTwiXfer.pfDone      = pfDone;
+    oTwiXfer.pCbParam    = pCbParam;
+    oTwiXfer.nBytes      = (a2b_UInt32)nWrite + (a2b_UInt32)nRead;
+    oTwiXfer.nStartStamp = ADI_A2B_PROFILE_NOW();
+    oTwiXfer.eState      = ADI_A2B_TWI_XFER_BUSY;
 
-   	nExpectedCallbackCount++;
-	eTwiResult= adi_twi_SubmitRxBuffer(adi_twi_hDevice, (void *)rBuf, nRCount, FALSE);
-	if(eTwiResult != 0)
-	{
-		return (1);
-	}
+    /* Start the timer before the bus, the transfer may complete at once */
+    oTWITimer.bTimeout = (a2b_UInt8)0;
+    (void)adi_a2b_TimerStart(TWI_TIMER, TWI_TIMEOUT_PERIOD * oTwiXfer.nBytes);
 
-	eTwiResult = adi_twi_Enable(adi_twi_hDevice); //write/read i2c device
-	if(eTwiResult != 0)
-	{
-		return (1);
-	}
+    eTwiResult = adi_twi_Enable(adi_twi_hDevice);
+    if(eTwiResult != 0)
+    {
+    	(void)adi_a2b_TimerStop(TWI_TIMER);
+    	adi_a2b_TwiXferFlush();
+    	oTwiXfer.eState = ADI_A2B_TWI_XFER_ERROR;
+    	return (1);
+    }
 
-	/* Start Timer */
-	oTWITimer.bTimeout = (a2b_UInt8)0;
-	nReturnValue = adi_a2b_TimerStart(TWI_TIMER,TWI_TIMEOUT_PERIOD*(nRCount + nWCount));
+    return (0);
+}
 
-	while ( (!adi_a2b_TwiReadComplete(A2B_TWI_NO) ) && (!oTWITimer.bTimeout))
-	{
-	 /* Wait till time out or read complete */
-	}
-	nReturnValue = adi_a2b_TimerStop(TWI_TIMER);
+/*****************************************************************************/
+/*!
+@brief  This API returns the state of the last submitted transfer.
 
-	nReturnValue = adi_a2b_HandleError(A2B_TWI_NO, adi_a2b_TwiReadComplete(A2B_TWI_NO));
+@return ADI_A2B_TWI_XFER_IDLE, ADI_A2B_TWI_XFER_BUSY, ADI_A2B_TWI_XFER_DONE
+        or ADI_A2B_TWI_XFER_ERROR
 
-	return(nReturnValue);
+*/
+/*****************************************************************************/
+ADI_MEM_A2B_CODE_CRIT
+a2b_UInt32 adi_a2b_TwiXferStatus(void)
+{
+    return (oTwiXfer.eState);
+}
+
+/*****************************************************************************/
+/*!
+@brief  This API copies the TWI transfer statistics.
+
+@param [out]:pStats  - Statistics.
+
+@return None
+
+*/
+/*****************************************************************************/
+ADI_MEM_A2B_CODE_NO_CRIT
+void adi_a2b_TwiGetStats(ADI_A2B_TWI_STATS* pStats)
+{
+    *pStats = oTwiXfer.oStats;
+}
+
+/*****************************************************************************/
+/*!
+@brief  This API clears the TWI transfer statistics.
+
+@return None
+
+*/
+/*****************************************************************************/
+ADI_MEM_A2B_CODE_NO_CRIT
+void adi_a2b_TwiResetStats(void)
+{
+    memset(&oTwiXfer.oStats, 0, sizeof(oTwiXfer.oStats));
+}
+
+/*****************************************************************************/
+/*!
+@brief  This API Reads a bytes of data from an I2C device
+
+@param [in]:hnd  - Handle to the I2C Sub-system.
+@param [in]:addr  - Device Address to which I2C communication
+                    should happen.
+@param [in]:nRead  - Number of bytes to be read.
+@param [in]:rBuf  - Pointer to the buffer where read bytes are
+                    to be stored.
+@return Return code
+        -1: Failure
+        -0: Success
+
+*/
+/*****************************************************************************/
+ADI_MEM_A2B_CODE_CRIT
+a2b_HResult a2b_pal_I2cReadFunc(a2b_Handle hnd,
+        a2b_UInt16 addr, a2b_UInt16 nRead, a2b_Byte* rBuf)
+{
+    static const a2b_Byte nOffset = 0x0; /*Read from offset 0 always */
+
+    A2B_UNUSED( hnd );
+
+    if(adi_a2b_TwiXferSubmit(addr, 1u, &nOffset, nRead, rBuf, A2B_NULL, A2B_NULL) != 0)
+    {
+    	return (1);
+    }
+
+    return (adi_a2b_TwiXferWait());
 }
 
 /*****************************************************************************/
@@ -461,47 +602,14 @@ a2b_HResult a2b_pal_I2cWriteFunc(a2b_Handle hnd,
         a2b_UInt16 addr, a2b_UInt16 nWrite,
         const a2b_Byte* wBuf)
 {
-	a2b_UInt32 			nReturnValue 	= (a2b_UInt32)0;
-	ADI_TWI_RESULT 		eTwiResult 	;
-    a2b_UInt32 			nIndex;
-    a2b_UInt32 			nWCount    = 0u;
-    static a2b_UInt8 	nTWIData[MAX_NUMBER_TWI_BYTES];
-
-    for(nIndex=0;nIndex < nWrite; nIndex++)
-    	nTWIData[nWCount++]=wBuf[nIndex];
-
-    /* Submit buffer*/
-      eTwiResult = adi_twi_SetHardwareAddress (adi_twi_hDevice, addr);
-      if(eTwiResult != 0)
-	  {
-		return (1);
-	  }
-
-      eTwiResult = adi_twi_SubmitTxBuffer(adi_twi_hDevice, (void *)&nTWIData[0U], nWCount, FALSE );
-      if(eTwiResult != 0)
-	  {
-		return (1);
-	  }
-      eTwiResult = adi_twi_Enable(adi_twi_hDevice);
-      if(eTwiResult != 0)
-	  {
-		return (1);
-	  }
-
-      /* Start the timer */
-      oTWITimer.bTimeout = (a2b_UInt8)0;
-      nReturnValue = adi_a2b_TimerStart(TWI_TIMER,TWI_TIMEOUT_PERIOD * nWCount);
-
-      while ( (!adi_a2b_TwiWriteComplete(A2B_TWI_NO) ) && (!oTWITimer.bTimeout) )
-      {
-          /* Wait till time out or write complete */
-      }
-      nReturnValue = adi_a2b_TimerStop(TWI_TIMER);
+    A2B_UNUSED( hnd );
 
+    if(adi_a2b_TwiXferSubmit(addr, nWrite, wBuf, 0u, A2B_NULL, A2B_NULL, A2B_NULL) != 0)
+    {
+    	return (1);
+    }
 
-      nReturnValue = adi_a2b_HandleError(A2B_TWI_NO , adi_a2b_TwiWriteComplete(A2B_TWI_NO));
-
-      return(nReturnValue);
+    return (adi_a2b_TwiXferWait());
 }
 
 /*****************************************************************************/
@@ -529,154 +637,106 @@ a2b_HResult a2b_pal_I2cWriteReadFunc(a2b_Handle hnd,
         const a2b_Byte* wBuf, a2b_UInt16 nRead,
         a2b_Byte* rBuf)
 {
-    a2b_UInt32			nReturnValue 	= (a2b_UInt32)0 ;
-    ADI_TWI_RESULT 		eTwiResult 	;
-    static a2b_UInt8 	nTWIData[8];
-    a2b_UInt32 			nWCount = 0u, nRCount, nIndex;
-    a2b_UInt32          delay1=0xffff;
+    A2B_UNUSED( hnd );
 
-	nReturnValue = ((a2b_UInt8)TRUE);
-
-	for(nIndex=0;nIndex < nWrite; nIndex++)
-	{
-	   nTWIData[nWCount++]=wBuf[nIndex];
-	}
-
-	nRCount=nRead;
-
-	eTwiResult = adi_twi_SetHardwareAddress (adi_twi_hDevice, addr);
-	if(eTwiResult != 0)
-	{
-		return (1);
-	}
-
-   	/* Support for zero byte addressing */
-   	if(nWCount > 0u )
-   	{
-   		nExpectedCallbackCount++;
-   		eTwiResult = adi_twi_SubmitTxBuffer(adi_twi_hDevice, (void *)&nTWIData[0U], nWCount, FALSE);
-   		if(eTwiResult != 0)
-		{
-			return (1);
-		}
-   	}
-
-   	eTwiResult = adi_twi_Enable(adi_twi_hDevice);
-   	if(eTwiResult != 0)
-	{
-		return (1);
-	}
-
-   	while(delay1--)
-   	{
-   		NOP();
-   	}
-
-	nExpectedCallbackCount++;
-	eTwiResult= adi_twi_SubmitRxBuffer(adi_twi_hDevice, (void *)rBuf, nRCount, FALSE);
-	if(eTwiResult != 0)
-	{
-		return (1);
-	}
-
-   	eTwiResult = adi_twi_Enable(adi_twi_hDevice);
-   	if(eTwiResult != 0)
-	{
-		return (1);
-	}
-
-   	/* Start Timer */
-   	oTWITimer.bTimeout = (a2b_UInt8)0;
-   	nReturnValue = adi_a2b_TimerStart(TWI_TIMER,TWI_TIMEOUT_PERIOD*(nRCount + nWCount));
-
-   	while ( (!adi_a2b_TwiReadComplete(A2B_TWI_NO) ) && (!oTWITimer.bTimeout))
-   	{
-   	 /* Wait till time out or read complete */
-   	}
-   	nReturnValue = adi_a2b_TimerStop(TWI_TIMER);
-
-   	nReturnValue = adi_a2b_HandleError(A2B_TWI_NO, adi_a2b_TwiReadComplete(A2B_TWI_NO));
+    if(adi_a2b_TwiXferSubmit(addr, nWrite, wBuf, nRead, rBuf, A2B_NULL, A2B_NULL) != 0)
+    {
+    	return (1);
+    }
 
-   	return(nReturnValue);
+    return (adi_a2b_TwiXferWait());
 }
 
 /****************************************************************************/
 /*!
-@brief  This function returns the TWI read completion status
-
-@param [in]     nTWIDeviceNo  TWI device number
+@brief  This function waits for the transfer in flight. There is no fixed
+        delay: the wait ends with the last driver callback, or with the TWI
+        timer if the bus does not answer.
 
 @return            Return code
-                   - 1: Read is complete
-                   - 0: Incomplete
+                   - 1: Transfer failed
+                   - 0: Success
 
 */
 /*****************************************************************************/
-static a2b_UInt8 adi_a2b_TwiReadComplete(a2b_UInt8 nTWIDeviceNo)
+ADI_MEM_A2B_CODE_CRIT
+static a2b_HResult adi_a2b_TwiXferWait(void)
 {
-   a2b_UInt8 nReturnValue = 0u;
+    a2b_HResult nRet = 0u;
 
-   if(nBufferProcessCount == nExpectedCallbackCount)
-   {
-   	nReturnValue = 1u;
-   }
-   return(nReturnValue);
+    while(oTwiXfer.eState == ADI_A2B_TWI_XFER_BUSY)
+    {
+    	/* Wait till time out or transfer complete */
+    }
+
+    if(oTwiXfer.eState != ADI_A2B_TWI_XFER_DONE)
+    {
+#if A2B_PRINT_FOR_DEBUG
+        printf(" \n TWI Transaction Failure  ");
+        printf(" \n ");
+#endif
+        /* Return failure */
+        nRet = 1u;
+    }
+
+    return(nRet);
 }
 
-/*****************************************************************************/
+/****************************************************************************/
 /*!
-@brief      This function returns TWI write completion status
+@brief  This function ends the transfer in flight. Called from the TWI
+        callback on the last processed buffer and from the TWI timer on
+        time-out.
 
-@param [in]    nTWIDeviceNo    TWI device number
+@param [in]     eState  ADI_A2B_TWI_XFER_DONE or ADI_A2B_TWI_XFER_ERROR
 
-@return        Return code
-                    - 1: Write is complete
-                    - 0: Incomplete
+@return         None
 
 */
 /*****************************************************************************/
-static a2b_UInt8 adi_a2b_TwiWriteComplete(a2b_UInt8 nTWIDeviceNo)
+ADI_MEM_A2B_CODE_CRIT
+static void adi_a2b_TwiXferFinish(a2b_UInt32 eState)
 {
-    a2b_UInt8 nReturnValue = 0u;
+    ADI_A2B_TWI_STATS   *pStats = &oTwiXfer.oStats;
+    a2b_UInt32          nTicks  = ADI_A2B_PROFILE_NOW() - oTwiXfer.nStartStamp;
 
-    if(nBufferProcessCount == 1u)
+    if(eState == ADI_A2B_TWI_XFER_DONE)
+    {
+    	(void)adi_a2b_TimerStop(TWI_TIMER);
+    }
+    else
     {
-    	nReturnValue = 1u;
+    	pStats->nErrors++;
     }
+    pStats->nTransfers++;
+    pStats->nBytes    += oTwiXfer.nBytes;
+    pStats->nBusTicks += nTicks;
+    pStats->nMaxTicks  = A2B_MAX(pStats->nMaxTicks, nTicks);
+
+    oTwiXfer.nPending = 0u;
+    oTwiXfer.eState   = eState;
 
-    return(nReturnValue);
+    if(oTwiXfer.pfDone != A2B_NULL)
+    {
+    	oTwiXfer.pfDone(oTwiXfer.pCbParam, (eState == ADI_A2B_TWI_XFER_DONE) ? 0u : 1u);
+    }
 }
 
 /****************************************************************************/
 /*!
-@brief  This function handles error after TWI read/write is complete
+@brief  This function stops the TWI device, which drops the buffers queued
+        with the driver. Called when a transfer is abandoned (time-out or
+        failed submit) so that its late callbacks cannot reach the next one.
 
-@param [in]     nTWIDeviceNo  TWI device number
-
-@return            Return code
-                   - 1: Read is complete
-                   - 0: Incomplete
+@return         None
 
 */
 /*****************************************************************************/
-static a2b_UInt32 adi_a2b_HandleError(a2b_UInt8 nTWIDeviceNo ,  a2b_UInt8 bComplete )
+ADI_MEM_A2B_CODE_CRIT
+static void adi_a2b_TwiXferFlush(void)
 {
-    a2b_UInt32 nRet = 0u;
-    nExpectedCallbackCount = 0u;
-    nBufferProcessCount = 0u;
-
-    if(bComplete == 0u)
-    {
-#if A2B_PRINT_FOR_DEBUG
-        printf(" \n TWI Transaction Failure  ");
-        printf(" \n ");
-#endif
-        /* Return failure */
-        nRet = 1u;
-    }
-
-    return(nRet);
-
+    (void)adi_twi_Disable(adi_twi_hDevice);
+    oTwiXfer.nPending = 0u;
 }
 
 /*****************************************************************************/
@@ -736,6 +796,9 @@ a2b_HResult a2b_pal_I2cCloseFunc(a2b_Handle hnd)
 /*****************************************************************************/
 /*!
 @brief  This API initializes Timer subsystem.
+        The system time is derived from the free-running core cycle counter,
+        the hardware timer is only used to wake the core from idle (see
+        a2b_pal_TimerWaitFunc()).
 
 @param [in]:ecb  - PAL ECB structure.
 
@@ -758,15 +821,14 @@ a2b_HResult a2b_pal_TimerInitFunc(A2B_ECB* ecb)
     nDummy 		= (a2b_UInt32)&adi_a2b_TimerCallback;
 
     ecb->palEcb.nCurrTime = 0u;
+    ecb->palEcb.nLastCycles = adi_a2b_TimerCycles64();
+    ecb->palEcb.nCyclesPerMsec = adi_a2b_TimerCoreClk() / 1000u;
+    ecb->palEcb.nMsecMult = (a2b_UInt32)(((uint64_t)1u << 32u) / ecb->palEcb.nCyclesPerMsec);
     ecb->palEcb.oTimerHandler.pCallbackhandle = (TIMER_CALL_BACK)nDummy;
-    ecb->palEcb.oTimerHandler.nTimerExpireVal = 1000u;  /* One millisec counter */
+    ecb->palEcb.oTimerHandler.nTimerExpireVal = 0u;  /* Armed by a2b_pal_TimerWaitFunc() */
     ecb->palEcb.oTimerHandler.nTimerNo = A2B_TIMER_NO;
     nReturnValue = adi_a2b_TimerOpen(ecb->palEcb.oTimerHandler.nTimerNo, &ecb->palEcb.oTimerHandler);
-    if(nReturnValue == 0u)
-    {
-		nReturnValue = adi_a2b_TimerStart(ecb->palEcb.oTimerHandler.nTimerNo,
-				ecb->palEcb.oTimerHandler.nTimerExpireVal);
-    }
+
     return nReturnValue;
 }
 
@@ -774,6 +836,13 @@ a2b_HResult a2b_pal_TimerInitFunc(A2B_ECB* ecb)
 /*!
 @brief  This API gives the current system time
 
+        The cycles elapsed since the last call are read from the 64-bit
+        cycle counter and converted with a multiply by 2^32 / cycles per
+        msec; the quotient is corrected so the time is exact, and the cycles
+        of the part of a msec not yet counted are carried to the next call.
+        Only a gap of 2^32 core cycles or more between two calls takes a
+        64-bit divide.
+
 @return Return : Current time in millisec
 
 \note I2C and TWI terms are used  interchangeably
@@ -783,13 +852,70 @@ a2b_HResult a2b_pal_TimerInitFunc(A2B_ECB* ecb)
 ADI_MEM_A2B_CODE_CRIT
 a2b_UInt32 a2b_pal_TimerGetSysTimeFunc()
 {
+    uint64_t nDelta = adi_a2b_TimerCycles64() - pTimerEcb->nLastCycles;
+    a2b_UInt32 nCycles;
+    a2b_UInt32 nMsec;
+
+    if(nDelta <= (uint64_t)0xFFFFFFFFu)
+    {
+        nCycles = (a2b_UInt32)nDelta;
+        /* Short by at most 1 msec, corrected from the remainder */
+        nMsec = (a2b_UInt32)(((uint64_t)nCycles * pTimerEcb->nMsecMult) >> 32u);
+        nCycles -= nMsec * pTimerEcb->nCyclesPerMsec;
+        while(nCycles >= pTimerEcb->nCyclesPerMsec)
+        {
+            nCycles -= pTimerEcb->nCyclesPerMsec;
+            nMsec++;
+        }
+    }
+    else
+    {
+        nMsec = (a2b_UInt32)(nDelta / pTimerEcb->nCyclesPerMsec);
+        nCycles = (a2b_UInt32)(nDelta % pTimerEcb->nCyclesPerMsec);
+    }
+
+    /* Keep the cycles of the started msec for the next call */
+    pTimerEcb->nLastCycles += nDelta - (uint64_t)nCycles;
+    pTimerEcb->nCurrTime += nMsec;
+
     return pTimerEcb->nCurrTime;
 }
 
+/*****************************************************************************/
+/*!
+@brief  This API idles the core until the given time has elapsed or an
+        interrupt (e.g. SPORT) occurs, whichever is first. Intended for the
+        application main loop with the value of a2b_stackNextDeadline().
+
+@param [in]:nTime  - Maximum time to idle in millisec. 0 returns at once,
+                     longer than A2B_TIMER_MAX_WAIT is limited to it.
+
+@return Return code
+        -1: Failure
+        -0: Success
+
+*/
+/*****************************************************************************/
+ADI_MEM_A2B_CODE_CRIT
+a2b_HResult a2b_pal_TimerWaitFunc(a2b_UInt32 nTime)
+{
+	a2b_HResult nReturnValue = (a2b_UInt32)0;
+
+	if((pTimerEcb != A2B_NULL) && (pTimerEcb->oTimerHandler.pCallbackhandle != NULL) &&
+	   (nTime != 0u))
+	{
+		nReturnValue = adi_a2b_TimerWait(pTimerEcb->oTimerHandler.nTimerNo, nTime);
+	}
+
+	return nReturnValue;
+}
+
 /****************************************************************************/
 /*!
     @brief          A2B timer(timer1)call back function. It
-                    is called from timer driver ISR.
+                    is called from timer driver ISR. The interrupt
+                    itself wakes the core from idle; the timer is
+                    stopped so that it fires only once.
 
     @param [in]     pTimerHandle    Pointer to Timer configuration structure
 
@@ -799,11 +925,7 @@ a2b_UInt32 a2b_pal_TimerGetSysTimeFunc()
 ADI_MEM_A2B_CODE_CRIT
 static void adi_a2b_TimerCallback(ADI_A2B_TIMER_HANDLER_PTR pTimerHandle)
 {
-
 	adi_a2b_TimerStop(pTimerEcb->oTimerHandler.nTimerNo);
-	adi_a2b_TimerStart(pTimerEcb->oTimerHandler.nTimerNo,
-			pTimerEcb->oTimerHandler.nTimerExpireVal);
-    pTimerEcb->nCurrTime += 1u;
 }
 
 /*****************************************************************************/
@@ -833,7 +955,7 @@ a2b_HResult a2b_pal_TimerShutdownFunc(A2B_ECB* ecb)
 
 	ecb->palEcb.nCurrTime = 0u;
 	pTimerEcb->oTimerHandler.pCallbackhandle = NULL;
-	pTimerEcb->oTimerHandler.nTimerExpireVal = 0u;  /* One millisec counter */
+	pTimerEcb->oTimerHandler.nTimerExpireVal = 0u;
 
     return nReturnValue;
 }
@@ -862,8 +984,8 @@ a2b_HResult a2b_pal_AudioInitFunc(A2B_ECB* ecb)
 
 	a2b_UInt8 nReturn = 0xFFu;
 	a2b_UInt8 nIndex;
-	ADI_A2B_PERI_DEVICE_CONFIG* psDeviceConfig;
-	ADI_A2B_NODE_PERICONFIG *psPeriConfig;
+	const ADI_A2B_PERI_DEVICE_CONFIG* psDeviceConfig;
+	const ADI_A2B_NODE_PERICONFIG *psPeriConfig;
 	a2b_UInt8 wBuf[2];
 	a2b_UInt8 rBuf[8];
 	int aResult;
@@ -893,7 +1015,6 @@ a2b_HResult a2b_pal_AudioInitFunc(A2B_ECB* ecb)
 	/* Opened as pair, bidirectional format */
 	pAudioCommHandler->nCodecTDMSize = 8u;
 
-
 	pCodecTxSportConfig->nMultChDelay  			= 1u;
 	pCodecTxSportConfig->bActiveLowFrameSync 	= 1u;
 	pCodecTxSportConfig->nSamplingRisingClkEdge = 0u;
@@ -947,7 +1068,8 @@ a2b_Handle a2b_pal_AudioOpenFunc(void)
 /****************************************************************************/
 /*!
     @brief          This function configures devices connected to slave node
-                    through remote I2C
+                    through remote I2C. Consecutive register writes are
+                    merged by adi_a2b_PeriCfgBurst().
 
     @param [in]     pNode                   Pointer to A2B node
     @param [in]     psDeviceConfig          Pointer to peripheral device configuration structure
@@ -957,7 +1079,7 @@ a2b_Handle a2b_pal_AudioOpenFunc(void)
                     - 1: Failure
 */
 /********************************************************************************/
-int adi_a2b_AudioHostConfig(A2B_ECB* ecb, ADI_A2B_PERI_DEVICE_CONFIG* psDeviceConfig)
+int adi_a2b_AudioHostConfig(A2B_ECB* ecb, const ADI_A2B_PERI_DEVICE_CONFIG* psDeviceConfig)
 {
 	A2B_PAL_L1_DATA
     static a2b_UInt8 aDataBuffer[ADI_A2B_MAX_PERI_CONFIG_UNIT_SIZE];
@@ -968,6 +1090,7 @@ int adi_a2b_AudioHostConfig(A2B_ECB* ecb, ADI_A2B_PERI_DEVICE_CONFIG* psDeviceCo
     a2b_UInt8 nIndex, nIndex1;
     a2b_UInt32 nNumOpUnits;
     a2b_UInt32 nDelayVal;
+    a2b_UInt32 nBurst, nLen;
     a2b_Int16 nodeAddr;
 
     nNumOpUnits = psDeviceConfig->nNumPeriConfigUnit;
@@ -980,11 +1103,13 @@ int adi_a2b_AudioHostConfig(A2B_ECB* ecb, ADI_A2B_PERI_DEVICE_CONFIG* psDeviceCo
         {
            /* write */
             case 0u:
-				adi_a2b_Concat_Addr_Data(&aDataBuffer[0u], pOPUnit->nAddrWidth, pOPUnit->nAddr);
-				memcpy(&aDataBuffer[pOPUnit->nAddrWidth], pOPUnit->paConfigData, pOPUnit->nDataCount);
+				nBurst = adi_a2b_PeriCfgBurst(psDeviceConfig->paPeriConfigUnit, nNumOpUnits, nIndex,
+						A2B_MIN(A2B_PERI_CFG_MAX_BURST, ADI_A2B_MAX_PERI_CONFIG_UNIT_SIZE));
+				nLen   = adi_a2b_PeriCfgLoadBurst(&aDataBuffer[0u], pOPUnit, nBurst);
 
 				a2b_pal_I2cWriteFunc(ecb->palEcb.i2chnd, (a2b_UInt16)psDeviceConfig->nDeviceAddress,
-						(pOPUnit->nAddrWidth + pOPUnit->nDataCount), &aDataBuffer[0u]);
+						nLen, &aDataBuffer[0u]);
+				nIndex += (a2b_UInt8)(nBurst - 1u);
 				break;
             /* read */
             case 1u:
@@ -1240,9 +1365,11 @@ void a2b_pal_infoGetBuild(a2b_UInt32* buildNum,
 /*****************************************************************************/
 /*!
 
-@brief  Callback function for TWI events. It is invoked upon TWI events
+@brief  Callback function for TWI events. It is invoked upon TWI events and
+        completes the transfer in flight on its last processed buffer.
+        Events of an earlier (abandoned) transfer are ignored.
 
-@param [in]     pCBParam       TWI device handle
+@param [in]     pCBParam       Sequence number of the transfer
 @param [in]     Event               TWI event
 @param [in]     pArg                pointer to user argument
 
@@ -1257,11 +1384,16 @@ static void adi_a2b_TWICallbackFunction(void* pCBParam, a2b_UInt32 Event, void*
 
     switch (event) {
         case ADI_TWI_EVENT_MSTR_XMT_PROCESSED:
-        	nBufferProcessCount++;
-            break;
-
         case ADI_TWI_EVENT_MSTR_RCV_PROCESSED:
-			nBufferProcessCount++;
+        	if(((a2b_UInt32)(a2b_UIntPtr)pCBParam == oTwiXfer.nSeq) &&
+        	   (oTwiXfer.eState == ADI_A2B_TWI_XFER_BUSY) && (oTwiXfer.nPending > 0u))
+        	{
+        		oTwiXfer.nPending--;
+        		if(oTwiXfer.nPending == 0u)
+        		{
+        			adi_a2b_TwiXferFinish(ADI_A2B_TWI_XFER_DONE);
+        		}
+        	}
 			break;
 
     default:
@@ -1271,52 +1403,6 @@ static void adi_a2b_TWICallbackFunction(void* pCBParam, a2b_UInt32 Event, void*
 
 }
 
-#if A2B_USE_CODEC
-
-
-/***********************************************************************************/
-/*!
-    @brief          This function copies upstream data to DAC
-
-    @param [in]     pHandle       Pointer to serial port structure.
-    @param [in]     iTxBuffer     Destination buffer address.
-    @param [in]     iRxBuffer     Source buffer address  .
-    @param [in]     nSize         Size of the buffer .
-
-    @return         Return code
-                    - 0: Success
-                    - 1: Failure
-*/
-/***********************************************************************************/
-static void adi_a2b_UpstreamToDACRouting(ADI_A2B_SCOMM_HANDLER* pAudioRoutingHandle, a2b_UInt32 anDACBuffer[], a2b_UInt32 anUpstreamBuffer[][SPORT_BUFFER_SIZE], a2b_UInt32 nChannel )
-{
-    a2b_UInt16 	nIndex1, nIndex2, nIndex3;
-    a2b_UInt8 	nRoutingIndex;
-
-    /* Outer most loop */
-    for(nIndex1 = 0u ; nIndex1 < nChannel ; nIndex1++)
-    {
-    	nIndex3 = 0u;
-		nRoutingIndex = pAudioRoutingHandle->pRoutingTable[nIndex1];
-
-		if(nRoutingIndex <= (a2b_UInt8)A2B_UPSTREAM_CH31)
-		{
-			nRoutingIndex -= (a2b_UInt8)A2B_UPSTREAM_CH00;
-			/* Transfer the data from Rx to Tx */
-			for(nIndex2 = 0u ; nIndex2 < nChannel * SPORT_BUFFER_SIZE ; nIndex2 += (a2b_UInt16)nChannel  )
-			{
-				anDACBuffer[ nIndex1 + nIndex2 ]  =  anUpstreamBuffer[nRoutingIndex ][nIndex3++];
-			}
-		}
-
-    }
-
-}
-
-
-#endif
-
-
 #if defined(A2B_FEATURE_SEQ_CHART) || defined(A2B_FEATURE_TRACE)
 /*!****************************************************************************
 *
@@ -15,6 +15,11 @@ and its licensors.
                  adi_TxSPORT_ISR()
                  adi_a2b_SerialPortConfigure()
                  adi_a2b_OutputSerialPortEnable()
+                 adi_a2b_AudioGetRingStats()
+                 adi_a2b_AudioSetBlockSize()
+                 adi_a2b_AudioGetBlockSize()
+                 adi_a2b_AudioGetProfileStats()
+                 adi_a2b_AudioSetProfileDump()
 
 
    Prepared &
@@ -44,34 +49,46 @@ and its licensors.
 
 #include <sys/platform.h>
 #include <stdio.h>
+#include <string.h>
 #include "adi_a2b_datatypes.h"
 #include "adi_a2b_sportdriver.h"
 #include <services/int/adi_int.h>  /* Interrupt Handler API header. */
+#include <services/pwr/adi_pwr.h>
 #include "adi_a2b_driverprototypes.h"
 #include "adi_a2b_sys.h"
 /*============= D E F I N E S =============*/
-/*#define A2B_LOOP_BACKTEST*/
+/* Core clock assumed by the profiler if the power service cannot tell */
+#define AUDIO_PROFILE_CCLK      (1000000000u)
+
+A2B_STATIC_ASSERT(DMA_NUM_DESC >= 2u, "DMA ring needs at least two descriptors");
 
 void process_audioBlocks(void);
 
 static ADI_SPORT_RESULT Sport_Init(void);
-static void ProcessBuffers(int32_t *adcbuf,int32_t *dacbuf);
+static void AudioProfileInit(void);
 
 /* Prepares descriptors for SPORT DMA */
 static void RXPrepareDescriptors (void);
 static void TXPrepareDescriptors (void);
 
-/* Count to track the number of callBacks for SPORT transfer */
-volatile uint8_t CallbackCount = 0;
-uint8_t InputReady = 0;
+/* Block ring over the DMA descriptors, filled by SPORTCallback */
+static ADI_A2B_AUDIO_RING oAudioRing;
+
+/* Frames per block, applied when the DMA chains are built */
+static uint32 nAudioFrames = ADI_A2B_AUDIO_DEFAULT_FRAMES;
+
+/* Per-block timing, stamped by SPORTCallback and process_audioBlocks */
+static ADI_A2B_AUDIO_PROFILE oAudioProfile;
+
+/* Blocks between periodic profile dumps (0: off) and block count at the last dump */
+static uint32 nProfileDumpBlocks = 0u;
+static uint32 nProfileLastDump = 0u;
 
 /* Destination SPORT PDMA Lists */
-ADI_PDMA_DESC_LIST iDESC_LIST_1_SP4A;
-ADI_PDMA_DESC_LIST iDESC_LIST_2_SP4A;
+ADI_PDMA_DESC_LIST iDESC_LIST_SP4A[DMA_NUM_DESC];
 
 /* Source SPORT PDMA Lists */
-ADI_PDMA_DESC_LIST iSRC_LIST_1_SP0A;
-ADI_PDMA_DESC_LIST iSRC_LIST_2_SP0A;
+ADI_PDMA_DESC_LIST iSRC_LIST_SP0A[DMA_NUM_DESC];
 
 /* Memory required for SPORT */
 static uint8_t SPORTMemory4A[ADI_SPORT_MEMORY_SIZE];
@@ -97,13 +114,9 @@ ADI_MEM_A2B_DATA_CRIT_NO_CACHE
 static ADI_SPORT_HANDLE hSPORT[NUM_SPORT_DEVICES]; 
 
 #pragma section("seg_l1_block1")
-ADI_CACHE_ALIGN int32_t int_SP4ABuffer1[DAC_BUFFER_SIZE];
-#pragma section("seg_l1_block1")
-ADI_CACHE_ALIGN int32_t int_SP4ABuffer2[DAC_BUFFER_SIZE];
-#pragma section("seg_l1_block1")
-ADI_CACHE_ALIGN int32_t int_SP0ABuffer1[A2B_BUFFER_SIZE];
+ADI_CACHE_ALIGN int32_t int_SP4ABuffer[DMA_NUM_DESC][DAC_BUFFER_SIZE];
 #pragma section("seg_l1_block1")
-ADI_CACHE_ALIGN int32_t int_SP0ABuffer2[A2B_BUFFER_SIZE];
+ADI_CACHE_ALIGN int32_t int_SP0ABuffer[DMA_NUM_DESC][A2B_BUFFER_SIZE];
 
 /*============= C O D E =============*/ 
 static void SPORTCallback(void *pAppHandle, uint32_t nEvent, void *pArg)
@@ -113,8 +126,8 @@ static void SPORTCallback(void *pAppHandle, uint32_t nEvent, void *pArg)
     {
         case ADI_SPORT_EVENT_RX_BUFFER_PROCESSED: /* CASE (buffer processed) */
 
-        		CallbackCount ++;
-        		InputReady = 1;
+        		ADI_A2B_PROFILE_DMA_DONE(&oAudioProfile, oAudioRing.nWriteSeq % DMA_NUM_DESC);
+        		adi_a2b_AudioRingProduce(&oAudioRing);
 
         		break;
         default:
@@ -124,62 +137,146 @@ static void SPORTCallback(void *pAppHandle, uint32_t nEvent, void *pArg)
 }
 
 
-void ProcessBuffers(int32_t* adcbuf,int32_t* dacbuf)
-{
-
-	int  i;
+/*****************************************************************************/
+/*!
+@brief      Sets up the audio profiler in core clock cycles. The deadline is
+            the point where the DMA starts sending the TX slot of a block
+            again, DMA_NUM_DESC - 1 block periods after its RX completion.
 
-	for(i=0;i<24;i++)
-	{
-	   /*Copy ADC buffer to DAC buffer */
-	   dacbuf[8*i] = adcbuf[20*i];
-	   dacbuf[8*i+1] = adcbuf[20*i+1];
-	   dacbuf[8*i+2] = adcbuf[20*i+2];
-	   dacbuf[8*i+3] = adcbuf[20*i+3];
-	   dacbuf[8*i+4] = adcbuf[20*i+4];
-	   dacbuf[8*i+5] = adcbuf[20*i+5];
-	   dacbuf[8*i+6] = adcbuf[20*i+6];
-	   dacbuf[8*i+7] = adcbuf[20*i+7];
-/*		dacbuf[0+i] = 0;
-		dacbuf[8+i] = 111161<<8;
-		dacbuf[16+i] = 214748<<8;
-		dacbuf[24+i] = 303700<<8;
-		dacbuf[32+i] = 371955<<8;
-		dacbuf[40+i] = 414861<<8;
-		dacbuf[48+i] = 429496<<8;
-		dacbuf[56+i] = 414861<<8;
-		dacbuf[64+i] = 371955<<8;
-		dacbuf[72+i] = 303700<<8;
-		dacbuf[80+i] = 214748<<8;
-		dacbuf[88+i] = 111161<<8;
-		dacbuf[96+i] = 0;
-		dacbuf[104+i] = -111161<<8;
-		dacbuf[112+i] = -214748<<8;
-		dacbuf[120+i] = -303700<<8;
-		dacbuf[128+i] = -371955<<8;
-		dacbuf[136+i] = -414861<<8;
-		dacbuf[144+i] = -429496<<8;
-		dacbuf[152+i] = -414861<<8;
-		dacbuf[160+i] = -371955<<8;
-		dacbuf[168+i] = -303700<<8;
-		dacbuf[176+i] = -214748<<8;
-		dacbuf[184+i] = -111161<<8;*/
+@return     None
+*/
+/*****************************************************************************/
+static void AudioProfileInit(void)
+{
+    uint32_t    nCClk = AUDIO_PROFILE_CCLK;
+    uint32      nPeriod;
 
-	}
+    if(adi_pwr_GetCoreClkFreq(ADI_A2B_SYS_POWER_CGUDEV_0, &nCClk) != ADI_PWR_SUCCESS)
+    {
+        nCClk = AUDIO_PROFILE_CCLK;
+    }
 
+    nPeriod = (nCClk / SAMPLE_RATE) * nAudioFrames;
+    adi_a2b_AudioProfileInit(&oAudioProfile, nCClk, nPeriod, nPeriod * (DMA_NUM_DESC - 1u));
+    nProfileLastDump = 0u;
 }
 
+/*****************************************************************************/
+/*!
+@brief      Processes every block the RX DMA has completed since the last
+            call, oldest first. Called from the main loop; returns at once
+            when no block is pending. Each block is timed by the audio
+            profiler, and the profile is printed here when a periodic dump
+            is due.
+
+@return     None
+*/
+/*****************************************************************************/
 void process_audioBlocks(void)
 {
-	if (CallbackCount == 1)
+	uint32 nSeq, nSlot;
+
+	while(adi_a2b_AudioRingAcquire(&oAudioRing, &nSeq, &nSlot) == A2B_TRUE)
+	{
+		ADI_A2B_PROFILE_START(&oAudioProfile);
+		adi_a2b_AudioChainProcess(int_SP0ABuffer[nSlot], int_SP4ABuffer[nSlot]);
+		adi_a2b_AudioProfileEnd(&oAudioProfile, nSlot);
+		adi_a2b_AudioRingRelease(&oAudioRing, nSeq);
+	}
+
+	if((nProfileDumpBlocks != 0u) && ((oAudioProfile.nBlocks - nProfileLastDump) >= nProfileDumpBlocks))
 	{
-		ProcessBuffers(int_SP0ABuffer1, int_SP4ABuffer1);
+		nProfileLastDump = oAudioProfile.nBlocks;
+		adi_a2b_AudioProfileDump(&oAudioProfile);
 	}
-	if (CallbackCount == 2)
+}
+
+/*****************************************************************************/
+/*!
+@brief      Selects the number of frames per audio block. The RX/TX
+            descriptor chains, the RNC secondary path delay and the
+            processing chain pick the new size up when the SPORTs are opened,
+            so this must be called at init, before the audio path is set up.
+            Latency is about DMA_NUM_DESC blocks from input to output.
+
+@param [in] nFrames     Frames per block (ADI_A2B_AUDIO_MIN_FRAMES to
+                        ADI_A2B_AUDIO_MAX_FRAMES)
+
+@return     Return code
+            - 0: Success
+            - 1: Failure
+*/
+/*****************************************************************************/
+uint32 adi_a2b_AudioSetBlockSize(uint32 nFrames)
+{
+	if((nFrames < ADI_A2B_AUDIO_MIN_FRAMES) || (nFrames > ADI_A2B_AUDIO_MAX_FRAMES))
 	{
-		ProcessBuffers(int_SP0ABuffer2, int_SP4ABuffer2);
-		CallbackCount = 0;
+		return 1u;
 	}
+
+	nAudioFrames = nFrames;
+
+	return 0u;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Returns the number of frames per audio block.
+
+@return     Frames per block
+*/
+/*****************************************************************************/
+uint32 adi_a2b_AudioGetBlockSize(void)
+{
+	return nAudioFrames;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Returns the per-block timing statistics: latency from DMA
+            completion to processing start, processing time, their
+            histograms and the deadline misses, in core clock cycles.
+
+@param [out] pStats     Statistics
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioGetProfileStats(ADI_A2B_AUDIO_PROFILE_STATS *pStats)
+{
+	adi_a2b_AudioProfileGetStats(&oAudioProfile, pStats);
+}
+
+/*****************************************************************************/
+/*!
+@brief      Enables the periodic profile dump on stdout. Printing goes
+            through the debugger and can itself cause deadline misses, so
+            use long periods.
+
+@param [in] nBlocks     Blocks between dumps (0: off)
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioSetProfileDump(uint32 nBlocks)
+{
+	nProfileDumpBlocks = nBlocks;
+	nProfileLastDump   = oAudioProfile.nBlocks;
+}
+
+/*****************************************************************************/
+/*!
+@brief      Returns the block ring counters (sequence numbers, overrun and
+            underrun blocks, peak fill level).
+
+@param [out] pStats     Counters
+
+@return     None
+*/
+/*****************************************************************************/
+void adi_a2b_AudioGetRingStats(ADI_A2B_AUDIO_RING_STATS *pStats)
+{
+	adi_a2b_AudioRingGetStats(&oAudioRing, pStats);
 }
 
 
@@ -195,40 +292,34 @@ void process_audioBlocks(void)
  */
 static void RXPrepareDescriptors (void)
 {
-	iSRC_LIST_1_SP0A.pStartAddr		=(int *)int_SP0ABuffer1;
-	iSRC_LIST_1_SP0A.Config			= ENUM_DMA_CFG_XCNT_INT ;
-	iSRC_LIST_1_SP0A.XCount			= A2B_BUFFER_SIZE;
-	iSRC_LIST_1_SP0A.XModify		= 4;
-	iSRC_LIST_1_SP0A.YCount			= 0;
-	iSRC_LIST_1_SP0A.YModify		= 0;
-	iSRC_LIST_1_SP0A.pNxtDscp		= &iSRC_LIST_2_SP0A;
-
-	iSRC_LIST_2_SP0A.pStartAddr		=(int *)int_SP0ABuffer2;
-	iSRC_LIST_2_SP0A.Config			= ENUM_DMA_CFG_XCNT_INT;
-	iSRC_LIST_2_SP0A.XCount			= A2B_BUFFER_SIZE;
-	iSRC_LIST_2_SP0A.XModify		= 4;
-	iSRC_LIST_2_SP0A.YCount			= 0;
-	iSRC_LIST_2_SP0A.YModify		= 0;
-	iSRC_LIST_2_SP0A.pNxtDscp		= &iSRC_LIST_1_SP0A;
+	uint32 nDesc;
+
+	for(nDesc = 0u; nDesc < DMA_NUM_DESC; nDesc++)
+	{
+		iSRC_LIST_SP0A[nDesc].pStartAddr	= (int *)int_SP0ABuffer[nDesc];
+		iSRC_LIST_SP0A[nDesc].Config		= ENUM_DMA_CFG_XCNT_INT;
+		iSRC_LIST_SP0A[nDesc].XCount		= nAudioFrames * RxNUM_CHANNELS;
+		iSRC_LIST_SP0A[nDesc].XModify		= 4;
+		iSRC_LIST_SP0A[nDesc].YCount		= 0;
+		iSRC_LIST_SP0A[nDesc].YModify		= 0;
+		iSRC_LIST_SP0A[nDesc].pNxtDscp		= &iSRC_LIST_SP0A[(nDesc + 1u) % DMA_NUM_DESC];
+	}
 }
 
 static void TXPrepareDescriptors (void)
 {
-	iDESC_LIST_1_SP4A.pStartAddr	= (int *)int_SP4ABuffer1;
-	iDESC_LIST_1_SP4A.Config		= ENUM_DMA_CFG_XCNT_INT ;
-	iDESC_LIST_1_SP4A.XCount		= DAC_BUFFER_SIZE;
-	iDESC_LIST_1_SP4A.XModify		= 4;
-	iDESC_LIST_1_SP4A.YCount		= 0;
-	iDESC_LIST_1_SP4A.YModify		= 0;
-	iDESC_LIST_1_SP4A.pNxtDscp		= &iDESC_LIST_2_SP4A;
-
-	iDESC_LIST_2_SP4A.pStartAddr	= (int *)int_SP4ABuffer2;
-	iDESC_LIST_2_SP4A.Config		= ENUM_DMA_CFG_XCNT_INT ;
-	iDESC_LIST_2_SP4A.XCount		= DAC_BUFFER_SIZE;
-	iDESC_LIST_2_SP4A.XModify		= 4;
-	iDESC_LIST_2_SP4A.YCount		= 0;
-	iDESC_LIST_2_SP4A.YModify		= 0;
-	iDESC_LIST_2_SP4A.pNxtDscp		= &iDESC_LIST_1_SP4A;
+	uint32 nDesc;
+
+	for(nDesc = 0u; nDesc < DMA_NUM_DESC; nDesc++)
+	{
+		iDESC_LIST_SP4A[nDesc].pStartAddr	= (int *)int_SP4ABuffer[nDesc];
+		iDESC_LIST_SP4A[nDesc].Config		= ENUM_DMA_CFG_XCNT_INT;
+		iDESC_LIST_SP4A[nDesc].XCount		= nAudioFrames * TxNUM_CHANNELS;
+		iDESC_LIST_SP4A[nDesc].XModify		= 4;
+		iDESC_LIST_SP4A[nDesc].YCount		= 0;
+		iDESC_LIST_SP4A[nDesc].YModify		= 0;
+		iDESC_LIST_SP4A[nDesc].pNxtDscp		= &iDESC_LIST_SP4A[(nDesc + 1u) % DMA_NUM_DESC];
+	}
 }
 
 
@@ -267,15 +358,19 @@ ADI_SPORT_RESULT Sport_Init(void)
 
 	eResult = adi_sport_RegisterCallback(hSPORTDev0ARx,SPORTCallback,NULL);
 
+	adi_a2b_AudioRingInit(&oAudioRing, DMA_NUM_DESC);
+	AudioProfileInit();
+	adi_a2b_AudioChainInit(nAudioFrames);
+
 	/* Prepare descriptors */
 	TXPrepareDescriptors();
 	RXPrepareDescriptors();
 
 	/* Submit the first buffer for Rx.  */
-	eResult = adi_sport_DMATransfer(hSPORTDev0ARx,&iSRC_LIST_1_SP0A,(DMA_NUM_DESC),ADI_PDMA_DESCRIPTOR_LIST, ADI_SPORT_CHANNEL_PRIM);
+	eResult = adi_sport_DMATransfer(hSPORTDev0ARx,&iSRC_LIST_SP0A[0],(DMA_NUM_DESC),ADI_PDMA_DESCRIPTOR_LIST, ADI_SPORT_CHANNEL_PRIM);
 
 	/* Submit the first buffer for Tx.  */
-	eResult = adi_sport_DMATransfer(hSPORTDev4ATx,&iDESC_LIST_1_SP4A,(DMA_NUM_DESC),ADI_PDMA_DESCRIPTOR_LIST, ADI_SPORT_CHANNEL_PRIM);
+	eResult = adi_sport_DMATransfer(hSPORTDev4ATx,&iDESC_LIST_SP4A[0],(DMA_NUM_DESC),ADI_PDMA_DESCRIPTOR_LIST, ADI_SPORT_CHANNEL_PRIM);
 
 	/*Enable the Sport Device 0A */
 	eResult = adi_sport_Enable(hSPORTDev0ARx,true);
@@ -413,15 +508,18 @@ ADI_SPORT_RESULT adi_a2b_SerialPortOpen(uint8 nSportDeviceNo, ADI_SPORT_PERI_CON
 	switch (pConfig->eDirection)
 	{
 		case ADI_SPORT_DIR_RX:
+			adi_a2b_AudioRingInit(&oAudioRing, DMA_NUM_DESC);
+			AudioProfileInit();
+			adi_a2b_AudioChainInit(nAudioFrames);
 			RXPrepareDescriptors();
 			eSportResult = adi_sport_RegisterCallback(hSPORT[nSportDeviceNo], SPORTCallback, NULL);
-			eSportResult = adi_a2b_sport_ProcessBuffer(hSPORT[nSportDeviceNo], &iSRC_LIST_1_SP0A, DMA_NUM_DESC, ADI_PDMA_DESCRIPTOR_LIST, ADI_SPORT_CHANNEL_PRIM);
+			eSportResult = adi_a2b_sport_ProcessBuffer(hSPORT[nSportDeviceNo], &iSRC_LIST_SP0A[0], DMA_NUM_DESC, ADI_PDMA_DESCRIPTOR_LIST, ADI_SPORT_CHANNEL_PRIM);
 			break;
 
 		case ADI_SPORT_DIR_TX:
 			TXPrepareDescriptors();
 //		    eSportResult = adi_sport_RegisterCallback(hSPORT[nSportDeviceNo], (ADI_CALLBACK)&adi_TxSPORT_ISR, &(oSportBuffInfo[nSportDeviceNo]));
-			eSportResult = adi_a2b_sport_ProcessBuffer(hSPORT[nSportDeviceNo], &iDESC_LIST_1_SP4A,DMA_NUM_DESC, ADI_PDMA_DESCRIPTOR_LIST, ADI_SPORT_CHANNEL_PRIM);
+			eSportResult = adi_a2b_sport_ProcessBuffer(hSPORT[nSportDeviceNo], &iDESC_LIST_SP4A[0],DMA_NUM_DESC, ADI_PDMA_DESCRIPTOR_LIST, ADI_SPORT_CHANNEL_PRIM);
 			break;
 
 		default:
@@ -23,26 +23,15 @@ and its licensors.
 /*============= I N C L U D E S =============*/ 
 #include <drivers/sport/adi_sport.h>            /*!< ADI SPORT(Serial Port) Device driver definitions include file */
 #include "adi_a2b_hal.h"
+#include "adi_a2b_audioconfig.h"
+#include "adi_a2b_audiochain.h"
+#include "adi_a2b_audioring.h"
+#include "adi_a2b_audioprofile.h"
 /*============== D E F I N E S ===============*/ 
 
-#define SAMPLE_RATE   			        (48000u)       /* DAC sample rate */
-
-#define REFERENCE_FREQ 				    (2000u)
-#define SAMPLES_PER_PERIOD 			    (SAMPLE_RATE) / (REFERENCE_FREQ)
-#define SAMPLE_SIZE 				    (4u)
-
-#define RxNUM_CHANNELS				    (20u)
-#define TxNUM_CHANNELS				    (8u)
-
-/* Macro to set buffer size */
-#define A2B_BUFFER_SIZE 	            (SAMPLES_PER_PERIOD * RxNUM_CHANNELS)
-#define DAC_BUFFER_SIZE 	            (SAMPLES_PER_PERIOD * TxNUM_CHANNELS)
-
 #define SPORT_DEVICE_4A 			    4u			/* SPORT device number */
 #define SPORT_DEVICE_0A 			    0u			/* SPORT device number */
 
-#define DMA_NUM_DESC 				    2u
-
 #define CHECK_RESULT(Result) \
         if(eResult != 0)\
 		{\
@@ -217,6 +206,11 @@ void adi_RxSPORT_ISR(void *pCBParam, uint32 Event, void  *pArg);
 void adi_TxSPORT_ISR(void *pCBParam, uint32 Event, void  *pArg);
 
 extern void process_audioBlocks(void);
+void adi_a2b_AudioGetRingStats(ADI_A2B_AUDIO_RING_STATS *pStats);
+uint32 adi_a2b_AudioSetBlockSize(uint32 nFrames);
+uint32 adi_a2b_AudioGetBlockSize(void);
+void adi_a2b_AudioGetProfileStats(ADI_A2B_AUDIO_PROFILE_STATS *pStats);
+void adi_a2b_AudioSetProfileDump(uint32 nBlocks);
 
 #ifdef __cplusplus 
 } 
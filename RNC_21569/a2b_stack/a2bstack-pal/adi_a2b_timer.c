@@ -13,6 +13,10 @@ and its licensors.
                  adi_a2b_TimerStop()
                  adi_a2b_TimerCallbackFunction()
                  adi_a2b_TimerClose()
+                 adi_a2b_TimerCycles()
+                 adi_a2b_TimerCycles64()
+                 adi_a2b_TimerCoreClk()
+                 adi_a2b_TimerWait()
                  void  adi_a2b_Delay()
                  
 
@@ -48,6 +52,8 @@ and its licensors.
 
 #include <services/tmr/adi_tmr.h>
 #include <services/pwr/adi_pwr.h>
+#include <builtins.h>
+#include <sysreg.h>
 #include "adi_a2b_sys.h"
 
 /*============= D E F I N E S =============*/
@@ -215,6 +221,103 @@ uint32_t adi_a2b_TimerClose(uint32_t nTimerNo)
     return((uint32_t)eTmrResult);
 }
 
+/****************************************************************************/
+/*!
+@brief  This function returns the free-running core cycle counter (EMUCLK).
+        It counts at the core clock and wraps every 2^32 cycles.
+
+@return         Core cycles
+*/
+/******************************************************************************/
+ADI_MEM_A2B_CODE_CRIT
+uint32_t adi_a2b_TimerCycles(void)
+{
+    return ((uint32_t)emuclk());
+}
+
+/****************************************************************************/
+/*!
+@brief  This function returns the 64-bit core cycle counter (EMUCLK2:EMUCLK),
+        which does not wrap in practice. EMUCLK2 is read again after EMUCLK
+        so a carry between the two reads is not missed.
+
+@return         Core cycles
+*/
+/******************************************************************************/
+ADI_MEM_A2B_CODE_CRIT
+uint64_t adi_a2b_TimerCycles64(void)
+{
+    uint32_t nHigh;
+    uint32_t nLow;
+
+    do
+    {
+        nHigh = (uint32_t)sysreg_read(sysreg_EMUCLK2);
+        nLow  = (uint32_t)sysreg_read(sysreg_EMUCLK);
+    } while(nHigh != (uint32_t)sysreg_read(sysreg_EMUCLK2));
+
+    return (((uint64_t)nHigh << 32u) | (uint64_t)nLow);
+}
+
+/****************************************************************************/
+/*!
+@brief  This function returns the core clock frequency, which is the rate
+        of adi_a2b_TimerCycles().
+
+@return         Core clock in Hz
+*/
+/******************************************************************************/
+ADI_MEM_A2B_CODE_NO_CRIT
+uint32_t adi_a2b_TimerCoreClk(void)
+{
+    uint32_t nReturnValue;
+    uint32_t nCClk = A2B_TIMER_CCLK;
+
+    nReturnValue = (uint32_t)adi_pwr_GetCoreClkFreq (ADI_A2B_SYS_POWER_CGUDEV_0, &nCClk);
+
+    if((nReturnValue != 0u) || (nCClk == 0u))
+    {
+    	nCClk = A2B_TIMER_CCLK;
+    }
+
+    return nCClk;
+}
+
+/****************************************************************************/
+/*!
+@brief  This function idles the core until the specified timer expires or
+        any other interrupt (e.g. SPORT DMA) occurs, whichever is first.
+        The timer shall have been opened; it is stopped on return.
+
+@param [in] nTimerNo    Timer number
+@param [in] nTime       Maximum time to idle in milli-seconds, at most
+                        A2B_TIMER_MAX_WAIT
+
+@return         Return code
+                - 0: Success
+                - 1: Failure
+*/
+/******************************************************************************/
+ADI_MEM_A2B_CODE_CRIT
+uint32_t adi_a2b_TimerWait(uint32_t nTimerNo, uint32_t nTime)
+{
+    uint32_t nReturnValue;
+
+    if(nTime > A2B_TIMER_MAX_WAIT)
+    {
+    	nTime = A2B_TIMER_MAX_WAIT;
+    }
+
+    nReturnValue = adi_a2b_TimerStart(nTimerNo, nTime * 1000u);
+    if(nReturnValue == 0u)
+    {
+    	asm("idle;");
+    	nReturnValue = adi_a2b_TimerStop(nTimerNo);
+    }
+
+    return nReturnValue;
+}
+
 /********************************************************************************/
 /*!
 @brief This function implements software delay.
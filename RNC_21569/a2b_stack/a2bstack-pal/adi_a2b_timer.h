@@ -22,6 +22,11 @@ and its licensors.
 
 /*============= D E F I N E S =============*/
 
+/*! Longest idle of adi_a2b_TimerWait() in milli-seconds. Keeps the timer
+    period within 32 bits and bounds the time between two reads of the
+    cycle counter well below its wrap period. */
+#define A2B_TIMER_MAX_WAIT		(1000u)
+
 /*============= D A T A T Y P E S=============*/
 
 /*======= P U B L I C P R O T O T Y P E S ========*/
@@ -52,8 +52,40 @@ and its licensors.
                                                            For details refer silicon Anamoly list - ID 18000016  */
 #define A2B_TWI_RATE_400						(400u)
 
+/*! Transfer states reported by adi_a2b_TwiXferStatus() */
+#define ADI_A2B_TWI_XFER_IDLE               (0u)    /*!< Nothing submitted yet         */
+#define ADI_A2B_TWI_XFER_BUSY               (1u)    /*!< Transfer on the bus           */
+#define ADI_A2B_TWI_XFER_DONE               (2u)    /*!< Last transfer completed       */
+#define ADI_A2B_TWI_XFER_ERROR              (3u)    /*!< Last transfer timed out       */
+
 /*============= D A T A T Y P E S=============*/
 
+/*! Completion callback of an asynchronous transfer. Called from interrupt
+    context (TWI or TWI timer) with 0 on success and 1 on time-out. */
+typedef void (*ADI_A2B_TWI_DONE_CB)(void *pCbParam, a2b_HResult nResult);
+
+/*! \struct ADI_A2B_TWI_STATS
+    TWI transfer statistics, in core cycles (EMUCLK)
+*/
+typedef struct
+{
+    /*! Completed and failed transfers */
+    uint32_t nTransfers;
+
+    /*! Transfers that timed out */
+    uint32_t nErrors;
+
+    /*! Bytes written and read */
+    uint32_t nBytes;
+
+    /*! Longest submit to completion time */
+    uint32_t nMaxTicks;
+
+    /*! Sum of submit to completion times */
+    uint64_t nBusTicks;
+
+}ADI_A2B_TWI_STATS;
+
 /*! \struct ADI_A2B_TWI_ADDR_CONFIG
     TWI Sub address(Register) configuration structure
 */
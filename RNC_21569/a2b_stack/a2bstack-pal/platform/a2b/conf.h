@@ -41,6 +41,12 @@
 #define A2B_CONF_MEMORY_ALIGNMENT           (4u)
 #endif
 
+/** Header defining A2B_POOL_TABLE(ENTRY) to replace the default pool table
+ *  of the stack memory manager, e.g. the table printed by the application
+ *  pool profile (A2BAPP_POOL_PROFILE) sized from measured high watermarks.
+ */
+/* #define A2B_CONF_POOL_TABLE_HEADER          "a2b_pooltable.h" */
+
 /** Define the number of bits in a pointer for this platform. Typical
  *  values include 64, 32, 16, etc.. */
 #ifndef A2B_CONF_POINTER_SIZE
@@ -91,6 +97,39 @@
 #define A2B_CONF_TRACE_BUF_SIZE             (256u)
 #endif
 
+/** Define the size (in 32-bit words) of the binary trace ring. A message
+ *  takes 7 words plus its arguments (pointers and 64-bit values take two
+ *  words on 64-bit hosts). Only used with #A2B_FEATURE_TRACE_BINARY.
+ */
+#ifndef A2B_CONF_TRACE_BIN_SIZE
+#define A2B_CONF_TRACE_BIN_SIZE             (4096u)
+#endif
+
+/** Define the number of format strings whose argument layout is cached by
+ *  the binary trace (power of two). Only used with
+ *  #A2B_FEATURE_TRACE_BINARY.
+ */
+#ifndef A2B_CONF_TRACE_BIN_FMT_CACHE
+#define A2B_CONF_TRACE_BIN_FMT_CACHE        (64u)
+#endif
+
+/** Define the number of distinct strings a binary trace dump writes only
+ *  once; further strings may be written repeatedly. Only used with
+ *  #A2B_FEATURE_TRACE_BINARY.
+ */
+#ifndef A2B_CONF_TRACE_BIN_DUMP_STRINGS
+#define A2B_CONF_TRACE_BIN_DUMP_STRINGS     (128u)
+#endif
+
+/** Define the size (in 32-bit words) of the binary sequence chart capture.
+ *  An I2C transfer takes 11 words, a message 5 words plus its arguments.
+ *  Events that do not fit are counted and dropped. Only used with
+ *  #A2B_FEATURE_SEQ_CHART_BINARY.
+ */
+#ifndef A2B_CONF_SEQ_CHART_BIN_SIZE
+#define A2B_CONF_SEQ_CHART_BIN_SIZE         (8192u)
+#endif
+
 /** Define the number of log channels dedicated for tracing. */
 #ifndef A2B_CONF_TRACE_NUM_CHANNELS
 #define A2B_CONF_TRACE_NUM_CHANNELS         (1u)
@@ -104,14 +143,25 @@
 
 
 /**
- * Define the frequency to run the msg/job scheduler based on a multiple
- * of the stack "tick". The "tick" provided to the stack ultimately sets the
- * time base for the entire stack.
+ * Define the interval, in msec of PAL system time, to re-run jobs that
+ * asked to be run again (e.g. to poll). Jobs made ready by an event
+ * (submitted, resumed or next in line) run on the next stack "tick". The
+ * PAL system time, not the number of ticks, is the time base for the
+ * entire stack.
  */
 #ifndef A2B_CONF_SCHEDULER_TICK_MULTIPLE
 #define A2B_CONF_SCHEDULER_TICK_MULTIPLE    (2u)
 #endif
 
+/**
+ * Define the maximum number of jobs the msg/job scheduler runs per stack
+ * "tick". Bounds the time spent in a2b_stackTick() when many jobs are
+ * ready.
+ */
+#ifndef A2B_CONF_SCHEDULER_JOB_BUDGET
+#define A2B_CONF_SCHEDULER_JOB_BUDGET       (8u)
+#endif
+
 
 /** Define the maximum number of I2C master devices to support per stack
  *  instance.
@@ -188,6 +238,14 @@
  */
 #define A2B_CONF_CONSECUTIVE_INTERRUPTS     (3u)
 
+/** Number of bytes a2b_crc8() and a2b_crc32() fold per step, 1 or 4.
+ *  Each slice is a 256 entry table: 4 slices take 1 KB (CRC-8) plus
+ *  4 KB (CRC-32) of constant data, 1 slice a quarter of that.
+ */
+#ifndef A2B_CONF_CRC_SLICES
+#define A2B_CONF_CRC_SLICES                 (4u)
+#endif
+
 /** This macro detects whether the A2B chip is an older AD241X
  * series chips.
  */
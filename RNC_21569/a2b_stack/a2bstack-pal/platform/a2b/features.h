@@ -68,11 +68,29 @@
  */
 /* #define A2B_FEATURE_SEQ_CHART */
 
+/**
+ * When sequence charts are enabled, this option captures the chart events
+ * (entities, level, format address and raw arguments, I2C transfers) into
+ * a preallocated RAM buffer instead of writing PlantUML text to the log
+ * channel. The capture is dumped with a2b_seqChartBinDump() and rendered
+ * to the usual chart on a host (tools/seqchart_host.c).
+ */
+/* #define A2B_FEATURE_SEQ_CHART_BINARY */
+
 /**
  * This options controls whether trace is support or not.
  */
 /* #define A2B_FEATURE_TRACE */
 
+/**
+ * When tracing is enabled, this option records trace messages in binary
+ * form (format string address, time stamp and raw arguments) into a RAM
+ * ring instead of formatting them and writing them to the log channel.
+ * The ring is dumped with a2b_traceBinDump() and rendered to the usual
+ * text on a host (tools/tracebin_host.c).
+ */
+/* #define A2B_FEATURE_TRACE_BINARY */
+
 /**
  * This option controls whether the internal fixed pool based memory
  * management services are built into the A2B stack.
@@ -139,6 +157,34 @@
  */
 /* #define A2B_FEATURE_EEPROM_PROCESSING */
 
+/**
+ * When enabled, a BDD read from the SoC EEPROM (A2B_BCF_FROM_SOC_EEPROM)
+ * or from a file (A2B_THIRD_PARTY) is decoded by a2b_bddDecodeStream()
+ * as it is read, in A2B_BDD_STREAM_CHUNK_SIZE pieces, instead of being
+ * read whole into a heap buffer first.
+ */
+/* #define A2B_FEATURE_BDD_STREAM */
+
+/**
+ * When enabled, a cable fault located below a slave node (shorted,
+ * open or reversed cable) leaves the nodes up to that slave, and
+ * their plugins, running.  A2B_MSGREQ_NET_PARTIAL_DISCOVERY then
+ * re-discovers and configures only the nodes below it, without
+ * resetting the master.
+ */
+/* #define A2B_FEATURE_PARTIAL_DISCOVERY */
+
+/**
+ * When enabled together with #A2B_FEATURE_WAIT_ON_PERIPHERAL_CFG_DELAY,
+ * Simple discovery sends the plugin init of every slave node without
+ * waiting for the previous one to complete.  Slave plugins park on the
+ * delay opcodes of their peripheral config, so the bring-up takes the
+ * longest per-node delay chain rather than the sum of all delays.
+ * Has no effect when #A2B_FEATURE_EEPROM_PROCESSING is enabled, where
+ * the EEPROM cfg blocks keep the node by node order.
+ */
+/* #define A2B_FEATURE_PARALLEL_PLUGIN_INIT */
+
 /** Internal Feature Definitions */
 /**
  * This option controls whether 242x is supported in the BDD
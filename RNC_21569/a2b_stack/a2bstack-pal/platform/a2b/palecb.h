@@ -70,13 +70,16 @@ typedef struct a2b_PalEcb
 	ADI_A2B_TIMER_HANDLER            oTWITimer;
 	ADI_A2B_TWI_CONFIG               oTWIConfig;
 	ADI_A2B_TIMER_HANDLER            oTimerHandler;
-	uint64_t                         nCurrTime;
+	uint64_t                         nLastCycles;    /* Cycle count (EMUCLK2:EMUCLK) nCurrTime is up to */
+	uint32_t                         nCurrTime;      /* Msec since timer init */
+	uint32_t                         nCyclesPerMsec;
+	uint32_t                         nMsecMult;      /* 2^32 / nCyclesPerMsec */
 	a2b_Int32						 nChainIndex;
 #if defined(A2B_FEATURE_SEQ_CHART) || defined(A2B_FEATURE_TRACE)
 	A2B_LOG_INFO                   oLogConfig[A2B_TOTAL_LOG_CH];
 #endif
 	/*! Table to get peripheral configuration structure */
-	ADI_A2B_NODE_PERICONFIG *pAudioHostDeviceConfig;
+	const ADI_A2B_NODE_PERICONFIG *pAudioHostDeviceConfig;
 #else
 	a2b_Handle                       i2chnd;
 #endif /* A2B_QAC */
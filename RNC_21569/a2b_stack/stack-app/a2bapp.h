@@ -61,6 +61,32 @@ and its licensors.
 #define A2B_APP_TMRTOHANDLE_BECOVF_AFTER_INTERVAL	(1000)	/* In milliseconds */
 #define A2B_APP_TMRTOHANDLE_BECOVF_REPEAT_INTERVAL	(1000)	/* In milliseconds */
 
+/*! Link health monitor: BECNT samples (one per BECOVF timer tick) kept per node */
+#define A2B_LINKMON_DEPTH			(16u)
+/*! Bit errors within the newer half of the samples that flag a link as degrading,
+    provided they also exceed the errors of the older half */
+#define A2B_LINKMON_MIN_ERRORS		(8u)
+/*! Bit errors per sample, averaged over the newer half of the samples, that flag
+    a link as degrading whatever the older half holds (a link that is already bad) */
+#define A2B_LINKMON_MAX_RATE		(4u)
+
+/*! Pool profile: a2b_poolProfile() runs discovery and fault cycles and prints
+    an A2B_POOL_TABLE sized from the measured high watermarks (see
+    A2B_CONF_POOL_TABLE_HEADER). Needs A2B_PRINT_CONSOLE. */
+/* #define A2BAPP_POOL_PROFILE */
+#define A2BAPP_POOL_PROFILE_CYCLES		(20u)	/* Discovery/fault cycles */
+#define A2BAPP_POOL_PROFILE_DWELL		(2000u)	/* In milliseconds of operation per cycle */
+#define A2BAPP_POOL_PROFILE_MARGIN		(25u)	/* Percent added to the peak, rounded down */
+
+/*! Upper bound of pools and pool table entries queried from the stack */
+#define A2BAPP_MAX_HEAP_POOLS			(16u)
+
+/*! Fault snapshot: the register map of all nodes is captured when discovery
+    completes and again on every post discovery line fault, and the registers
+    that changed are logged. */
+/* #define A2BAPP_FAULT_SNAPSHOT */
+#define A2BAPP_FAULT_SNAPSHOT_MAX_DIFFS	(64u)	/* Changed registers logged per fault */
+
 
 #ifdef A2B_PRINT_CONSOLE
 #ifndef A2B_PRINT_DEFINED
@@ -86,6 +112,20 @@ and its licensors.
 
 /*============= D A T A T Y P E S=============*/
 
+/*! \struct a2b_AppLinkMon
+    Link health monitor state. BECNT of each node is sampled before it is
+    cleared by the BECOVF timer, into a ring of A2B_LINKMON_DEPTH rows.
+*/
+typedef struct {
+	a2b_UInt8 anBecnt[A2B_LINKMON_DEPTH][A2B_CONF_MAX_NUM_SLAVE_NODES + 1];	/*!< BECNT samples, master first then slave 0.. */
+	a2b_UInt8 nHead;										/*!< Row written by the next sample */
+	a2b_UInt8 nFill;										/*!< Rows holding samples */
+	a2b_UInt32 nDegraded;									/*!< Bit per node (master is bit 0) flagged as degrading */
+	a2b_UInt32 nTransfers;									/*!< TWI transfers of the last monitoring cycle */
+	a2b_UInt32 nBusUs;										/*!< TWI bus time (us) of the last monitoring cycle */
+	a2b_UInt32 nMaxBusUs;									/*!< Longest TWI bus time (us) of a monitoring cycle */
+} a2b_AppLinkMon;
+
 typedef struct {
 
 	/* Input flags */
@@ -98,10 +138,16 @@ typedef struct {
 	A2B_ECB ecb;											/*!< App envirnment control block  */   
 	a2b_StackPal pal;										/*!< PAL layer  */
 	struct a2b_StackContext *ctx;							/*!< Stack context  */  
+#ifndef A2B_APP_BDD_IMAGE
 	bdd_Network bdd;										/*!< BDD Info  */
+#endif
+	const bdd_Network* pBdd;								/*!< BDD in use, bdd or the prebuilt image */
 	ADI_A2B_BCD* pBusDescription;							/*!< Pointer to Bus Description File */
 	ADI_A2B_NETWORK_CONFIG* pTargetProperties;				 /*!< Pointer to Bus Description File */
+#ifndef A2B_APP_BDD_IMAGE
 	ADI_A2B_NODE_PERICONFIG  aPeriNetworkTable[A2B_CONF_MAX_NUM_SLAVE_NODES + 1]; 	/*!< Table to get peripheral configuration structure */
+#endif
+	const ADI_A2B_NODE_PERICONFIG* pPeriNetworkTable;		/*!< Peripheral table in use, aPeriNetworkTable or the prebuilt image */
 	a2b_UInt8 anEeepromPeriCfgInfo[2 * (A2B_CONF_MAX_NUM_SLAVE_NODES + 1)];
 	struct a2b_MsgNotifier *notifyInterrupt;				/*!< Interrupt Notifier  */
 	struct a2b_MsgNotifier *notifyPowerFault;				/*!< Power Fault message notifier */
@@ -116,9 +162,15 @@ typedef struct {
 	a2b_UInt32 nDiscTryCnt;									/*!< Count of no of re-discovery attempts  */
 	a2b_Bool bBecovfTimerEnable;							/*!< Enable flag for starting timer for resetting bit error count */
 	a2b_UInt32 nBecovfRstCnt;
+	a2b_AppLinkMon oLinkMon;								/*!< Link health monitor */
+#ifdef A2BAPP_FAULT_SNAPSHOT
+	a2b_DiagSnapshot oSnapDisc;								/*!< Register map when discovery completed */
+	a2b_DiagSnapshot oSnapFault;							/*!< Register map at the last line fault */
+#endif
 	a2b_UInt8 nNumBCD;
 	a2b_UInt8 nDefaultBCDIndex;
 	a2b_UInt8 bIntrptLatch;
+	a2b_UInt32 nIntrptCycles;								/*!< Core cycles at the IRQ pin edge being serviced */
 
 	/* Output flags */
 	a2b_UInt8 nodesDiscovered;								/*!< Number of slave nodes discovered  */
@@ -140,6 +192,19 @@ typedef struct {
 extern a2b_UInt32 a2b_setup(a2b_App_t *pApp_Info);
 extern a2b_UInt32 a2b_fault_monitor(a2b_App_t *pApp_Info);
 extern a2b_Int32 a2b_stop(a2b_App_t *pApp_Info);
+extern void a2b_AppIdle(a2b_App_t *pApp_Info);
+#ifdef A2B_FEATURE_TRACE_BINARY
+extern a2b_UInt32 a2b_AppTraceDump(const a2b_Char* pUrl);
+#endif
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+extern a2b_UInt32 a2b_AppSeqChartDump(const a2b_Char* pUrl);
+#endif
+#ifdef A2B_FEATURE_MEMORY_MANAGER
+extern void a2b_AppDumpHeapStats(a2b_App_t *pApp_Info);
+#ifdef A2BAPP_POOL_PROFILE
+extern a2b_UInt32 a2b_poolProfile(a2b_App_t *pApp_Info);
+#endif
+#endif
 #endif /* __A2BAPP_H__ */
 
 /**
@@ -23,12 +23,24 @@ and its licensors.
 #define A2B_CONF_DEFAULT_TRACE_LVL		(A2B_TRC_DOM_ALL | A2B_TRC_LVL_DEBUG | A2B_TRC_LVL_INFO | A2B_TRC_LVL_DEFAULT)
 /* DEFAULT TRACE FILE */
 #define A2B_CONF_DEFAULT_TRACE_CHAN_URL     "..//a2b_trace.txt"
+/* BINARY TRACE DUMP FILE (A2B_FEATURE_TRACE_BINARY), written on each bus fault */
+#define A2B_CONF_DEFAULT_TRACE_DUMP_URL     "..//a2b_trace.bin"
 
-/* DEFAULT SEQUENCE CHART FILE */
+/* DEFAULT SEQUENCE CHART FILE, a binary dump with A2B_FEATURE_SEQ_CHART_BINARY */
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+#define A2B_CONF_DEFAULT_SEQCHART_CHAN_URL     "..//SequenceFile.bin"
+#else
 #define A2B_CONF_DEFAULT_SEQCHART_CHAN_URL     "..//SequenceFile.txt"
+#endif
 
 /* #define A2B_PRINT_CONSOLE */
 
 /* #define ENABLE_SUPERBCF */
 
+/* Use the network description prebuilt from adi_a2b_busconfig.c by
+ * tools/bddgen_host.c (adi_a2b_bddimage.c) instead of parsing the BCF in
+ * every a2b_load(). adi_a2b_busconfig.c can then be left out of the build.
+ * Only for an uncompressed BCF without ENABLE_SUPERBCF. */
+/* #define A2B_APP_BDD_IMAGE */
+
 #endif /* __A2BAPP_DEFS_H__ */
@@ -0,0 +1,1428 @@
+/*******************************************************************************
+Copyright (c) 2020 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+******************************************************************************
+* @file: adi_a2b_bddimage.c
+* @brief: Prebuilt network description of adi_a2b_busconfig.c (A2B_APP_BDD_IMAGE)
+* THIS FILE IS GENERATED BY tools/bddgen_host.c FROM adi_a2b_busconfig.c.
+* REGENERATE IT WHENEVER THE BCF CHANGES, DO NOT EDIT.
+*****************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include "adi_a2b_datatypes.h"
+#include "a2bstack-protobuf/inc/adi_a2b_graphdata.h"
+#include "a2bstack-protobuf/inc/adi_a2b_busconfig.h"
+#include "a2bapp_defs.h"
+#include "adi_a2b_bddimage.h"
+
+#ifdef A2B_APP_BDD_IMAGE
+
+#if (A2B_CONF_MAX_NUM_MASTER_NODES < 1) || ((A2B_CONF_MAX_NUM_SLAVE_NODES + 1) < 11)
+#error "adi_a2b_bddimage.c needs more master or slave nodes than conf.h allows"
+#endif
+
+/*============= D A T A =============*/
+
+/* Peripheral configuration units */
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_0_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_1_Data[1] =
+{
+	0x4u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_2_Data[1] =
+{
+	0x74u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_3_Data[1] =
+{
+	0x5Fu
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_4_Data[1] =
+{
+	0x2Fu
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_5_Data[1] =
+{
+	0x7Fu
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_6_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_7_Data[1] =
+{
+	0xFu
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_8_Data[6] =
+{
+	0x0u,	0xFDu,	0x0u,	0xCu,	0x20u,	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_9_Data[4] =
+{
+	0x64u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_10_Data[2] =
+{
+	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_11_Data[4] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_12_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_13_Data[8] =
+{
+	0x0u,	0x1u,	0x5u,	0x1u,	0x5u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_14_Data[3] =
+{
+	0x13u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_15_Data[14] =
+{
+	0x21u,	0x0u,	0x41u,	0x0u,	0x0u,	0x0u,	0x1u,	0xE7u,	0xE7u,	0x0u,	0x0u,	0xE5u,	0x0u,	0x3u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_16_Data[2] =
+{
+	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_17_Data[3] =
+{
+	0x3u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_18_Data[1] =
+{
+	0xAAu
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_19_Data[2] =
+{
+	0xAAu,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_20_Data[1] =
+{
+	0x8u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_21_Data[1020] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_22_Data[1020] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_23_Data[1020] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_24_Data[1020] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_25_Data[15] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_26_Data[1] =
+{
+	0x10u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_27_Data[1] =
+{
+	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_28_Data[5] =
+{
+	0x7Fu,	0x74u,	0x5Fu,	0x2Fu,	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_29_Data[4] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_30_Data[2] =
+{
+	0x10u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_31_Data[5] =
+{
+	0x0u,	0x4u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_32_Data[1] =
+{
+	0x7Fu
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_33_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_34_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_35_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_36_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_37_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_38_Data[2] =
+{
+	0x7Fu,	0x3u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_39_Data[275] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0xFEu,	0xE0u,	0x0u,	0x0u,	0x0u,	0xFFu,	0x34u,	0x0u,	0x0u,	0x0u,	0xFFu,	0x2Cu,	0x0u,	0x0u,	0x0u,	0xFFu,	0x54u,	0x0u,	0x0u,	0x0u,	0xFFu,	0x5Cu,	0x0u,	0x0u,	0x0u,	0xFFu,	0xF5u,	0x8u,	0x20u,	0x0u,	0xFFu,	0x38u,	0x0u,	0x0u,	0x0u,	0xFFu,	0x80u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0xFEu,	0xE8u,	0xCu,	0x0u,	0x0u,	0xFEu,	0x30u,	0x0u,	0xE2u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0xFFu,	0xE8u,	0x7u,	0x20u,	0x8u,	0x0u,	0x0u,	0x6u,	0xA0u,	0x0u,	0xFFu,	0xE0u,	0x0u,	0xC0u,	0x0u,	0xFFu,	0x80u,	0x7u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0xFFu,	0x0u,	0x0u,	0x0u,	0x0u,	0xFEu,	0xC0u,	0x22u,	0x0u,	0x27u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0xFEu,	0xE8u,	0x1Eu,	0x0u,	0x0u,	0xFFu,	0xE8u,	0x1u,	0x20u,	0x0u,	0xFFu,	0xD8u,	0x1u,	0x3u,	0x0u,	0x0u,	0x7u,	0xC6u,	0x0u,	0x0u,	0xFFu,	0x8u,	0x0u,	0x0u,	0x0u,	0xFFu,	0xF4u,	0x0u,	0x20u,	0x0u,	0xFFu,	0xD8u,	0x7u,	0x2u,	0x0u,	0xFDu,	0xA5u,	0x8u,	0x20u,	0x0u,	0x0u,	0x0u,	0x0u,	0xE2u,	0x0u,	0xFDu,	0xADu,	0x8u,	0x20u,	0x0u,	0x0u,	0x8u,	0x0u,	0xE2u,	0x0u,	0xFDu,	0x25u,	0x8u,	0x20u,	0x0u,	0x0u,	0x10u,	0x0u,	0xE2u,	0x0u,	0xFDu,	0x2Du,	0x8u,	0x20u,	0x0u,	0x0u,	0x18u,	0x0u,	0xE2u,	0x0u,	0x0u,	0x5u,	0x8u,	0x20u,	0x0u,	0xFDu,	0x60u,	0x0u,	0xE2u,	0x0u,	0x0u,	0xDu,	0x8u,	0x20u,	0x0u,	0xFDu,	0x68u,	0x0u,	0xE2u,	0x0u,	0x0u,	0x15u,	0x8u,	0x20u,	0x0u,	0xFDu,	0xB0u,	0x0u,	0xE2u,	0x0u,	0x0u,	0x1Du,	0x8u,	0x20u,	0x0u,	0xFDu,	0xB8u,	0x0u,	0xE2u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0xFEu,	0x30u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0xFEu,	0xC0u,	0xFu,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_40_Data[32] =
+{
+	0x0u,	0x0u,	0x10u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_41_Data[6] =
+{
+	0x0u,	0x0u,	0x0u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_42_Data[1] =
+{
+	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_43_Data[1] =
+{
+	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_44_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_FF_39_45_Data[1] =
+{
+	0x3u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	ADI_A2B_PERI_CONFIG_UNIT gaPeriCfg_0_FF_39_Unit[46] =
+{
+	{A2B_WRITE_OP,	0x2u,	0x40D0u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_0_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40D1u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_1_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40C1u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_2_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40C2u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_3_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40C3u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_4_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40EBu,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_5_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F6u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_6_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4000u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_7_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4002u,	0x1u,	0x6u,	&gaPeriCfg_0_FF_39_8_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_FF_39_9_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4015u,	0x1u,	0x2u,	&gaPeriCfg_0_FF_39_10_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4011u,	0x1u,	0x4u,	&gaPeriCfg_0_FF_39_11_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4008u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_12_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4009u,	0x1u,	0x8u,	&gaPeriCfg_0_FF_39_13_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4019u,	0x1u,	0x3u,	&gaPeriCfg_0_FF_39_14_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x401Cu,	0x1u,	0xEu,	&gaPeriCfg_0_FF_39_15_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4017u,	0x1u,	0x2u,	&gaPeriCfg_0_FF_39_16_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x402Au,	0x1u,	0x3u,	&gaPeriCfg_0_FF_39_17_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x402Du,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_18_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x402Fu,	0x1u,	0x2u,	&gaPeriCfg_0_FF_39_19_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4031u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_20_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x800u,	0x1u,	0x3FCu,	&gaPeriCfg_0_FF_39_21_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x8CCu,	0x1u,	0x3FCu,	&gaPeriCfg_0_FF_39_22_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x998u,	0x1u,	0x3FCu,	&gaPeriCfg_0_FF_39_23_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0xA64u,	0x1u,	0x3FCu,	&gaPeriCfg_0_FF_39_24_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0xBFCu,	0x1u,	0xFu,	&gaPeriCfg_0_FF_39_25_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40E9u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_26_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F5u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_27_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40C0u,	0x1u,	0x5u,	&gaPeriCfg_0_FF_39_28_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40C6u,	0x1u,	0x4u,	&gaPeriCfg_0_FF_39_29_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40E9u,	0x1u,	0x2u,	&gaPeriCfg_0_FF_39_30_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40D0u,	0x1u,	0x5u,	&gaPeriCfg_0_FF_39_31_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40EBu,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_32_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F2u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_33_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F3u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_34_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F4u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_35_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F7u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_36_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F8u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_37_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F9u,	0x1u,	0x2u,	&gaPeriCfg_0_FF_39_38_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x800u,	0x1u,	0x113u,	&gaPeriCfg_0_FF_39_39_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x0u,	0x1u,	0x20u,	&gaPeriCfg_0_FF_39_40_Data[0]},
+	{A2B_READ_OP,	0x2u,	0x4002u,	0x1u,	0x6u,	&gaPeriCfg_0_FF_39_41_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40EBu,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_42_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x40F6u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_43_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4036u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_44_Data[0]},
+	{A2B_WRITE_OP,	0x2u,	0x4036u,	0x1u,	0x1u,	&gaPeriCfg_0_FF_39_45_Data[0]}
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_1_19_0_Data[4] =
+{
+	0xAu,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_1_19_1_Data[1] =
+{
+	0x64u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_1_19_2_Data[4] =
+{
+	0x1u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_1_19_3_Data[1] =
+{
+	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_1_19_4_Data[4] =
+{
+	0x1u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_1_19_5_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_1_19_6_Data[4] =
+{
+	0xAu,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	ADI_A2B_PERI_CONFIG_UNIT gaPeriCfg_0_1_19_Unit[7] =
+{
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_1_19_0_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x2Eu,	0x1u,	0x1u,	&gaPeriCfg_0_1_19_1_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_1_19_2_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x30u,	0x1u,	0x1u,	&gaPeriCfg_0_1_19_3_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_1_19_4_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x26u,	0x1u,	0x1u,	&gaPeriCfg_0_1_19_5_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_1_19_6_Data[0]}
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_2_19_0_Data[4] =
+{
+	0xAu,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_2_19_1_Data[1] =
+{
+	0x64u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_2_19_2_Data[4] =
+{
+	0x1u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_2_19_3_Data[1] =
+{
+	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_2_19_4_Data[4] =
+{
+	0x1u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_2_19_5_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_2_19_6_Data[4] =
+{
+	0xAu,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	ADI_A2B_PERI_CONFIG_UNIT gaPeriCfg_0_2_19_Unit[7] =
+{
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_2_19_0_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x2Eu,	0x1u,	0x1u,	&gaPeriCfg_0_2_19_1_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_2_19_2_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x30u,	0x1u,	0x1u,	&gaPeriCfg_0_2_19_3_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_2_19_4_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x26u,	0x1u,	0x1u,	&gaPeriCfg_0_2_19_5_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_2_19_6_Data[0]}
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_6_19_0_Data[4] =
+{
+	0xAu,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_6_19_1_Data[1] =
+{
+	0x64u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_6_19_2_Data[4] =
+{
+	0x1u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_6_19_3_Data[1] =
+{
+	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_6_19_4_Data[4] =
+{
+	0x1u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_6_19_5_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_6_19_6_Data[4] =
+{
+	0xAu,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	ADI_A2B_PERI_CONFIG_UNIT gaPeriCfg_0_6_19_Unit[7] =
+{
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_6_19_0_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x2Eu,	0x1u,	0x1u,	&gaPeriCfg_0_6_19_1_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_6_19_2_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x30u,	0x1u,	0x1u,	&gaPeriCfg_0_6_19_3_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_6_19_4_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x26u,	0x1u,	0x1u,	&gaPeriCfg_0_6_19_5_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_6_19_6_Data[0]}
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_7_19_0_Data[4] =
+{
+	0xAu,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_7_19_1_Data[1] =
+{
+	0x64u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_7_19_2_Data[4] =
+{
+	0x1u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_7_19_3_Data[1] =
+{
+	0x1u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_7_19_4_Data[4] =
+{
+	0x1u,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_7_19_5_Data[1] =
+{
+	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	uint8 gaPeriCfg_0_7_19_6_Data[4] =
+{
+	0xAu,	0x0u,	0x0u,	0x0u
+};
+
+ ADI_A2B_MEM_PERI_CONFIG_DATA
+static	ADI_A2B_PERI_CONFIG_UNIT gaPeriCfg_0_7_19_Unit[7] =
+{
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_7_19_0_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x2Eu,	0x1u,	0x1u,	&gaPeriCfg_0_7_19_1_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_7_19_2_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x30u,	0x1u,	0x1u,	&gaPeriCfg_0_7_19_3_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_7_19_4_Data[0]},
+	{A2B_WRITE_OP,	0x1u,	0x26u,	0x1u,	0x1u,	&gaPeriCfg_0_7_19_5_Data[0]},
+	{A2B_DEALY_OP,	0x0u,	0x0u,	0x1u,	0x4u,	&gaPeriCfg_0_7_19_6_Data[0]}
+};
+
+/* Number of chains (master nodes) in the BCF */
+const a2b_UInt8 gnA2bBddImageNumChains = 1u;
+
+/* Network control guidance. The peripheral pointers are left out,
+   gaA2bBddImagePeriTable carries the peripheral configuration. */
+ADI_A2B_NETWORK_CONFIG goA2bBddImageTargetProperties =
+{
+	.eDiscoveryMode = 0u,
+	.bLineDiagnostics = 0u,
+	.bAutoDiscCriticalFault = 0u,
+	.nAttemptsCriticalFault = 0u,
+	.bAutoRediscOnFault = 0u,
+	.nNumPeriDevice = 3u,
+	.nRediscInterval = 100u,
+	.nDiscoveryStartDelay = 25u
+};
+
+/* Peripheral download table of each chain, row 0 is the target processor */
+const ADI_A2B_NODE_PERICONFIG gaA2bBddImagePeriTable[][A2B_CONF_MAX_NUM_SLAVE_NODES + 1] =
+{
+	/* chain 0 */
+	{
+		{
+			{
+				{ 0x39u, 1u, 0xFFu, 46u, &gaPeriCfg_0_FF_39_Unit[0] },
+			},
+			1u
+		},
+		{
+			{
+				{ 0 }
+			},
+			0u
+		},
+		{
+			{
+				{ 0x19u, 1u, 0x1u, 7u, &gaPeriCfg_0_1_19_Unit[0] },
+			},
+			1u
+		},
+		{
+			{
+				{ 0x19u, 1u, 0x2u, 7u, &gaPeriCfg_0_2_19_Unit[0] },
+			},
+			1u
+		},
+		{
+			{
+				{ 0 }
+			},
+			0u
+		},
+		{
+			{
+				{ 0 }
+			},
+			0u
+		},
+		{
+			{
+				{ 0 }
+			},
+			0u
+		},
+		{
+			{
+				{ 0x19u, 1u, 0x6u, 7u, &gaPeriCfg_0_6_19_Unit[0] },
+			},
+			1u
+		},
+		{
+			{
+				{ 0x19u, 1u, 0x7u, 7u, &gaPeriCfg_0_7_19_Unit[0] },
+			},
+			1u
+		},
+		{
+			{
+				{ 0 }
+			},
+			0u
+		},
+		{
+			{
+				{ 0 }
+			},
+			0u
+		},
+	},
+};
+
+/* Network description of each chain, as a2b_bcfParse_bdd() builds it */
+const bdd_Network gaA2bBddImage[] =
+{
+	/* chain 0 */
+	{
+		{ 0 },	/* 1 */
+		0x68u,	/* 2 */
+		{
+			0,	/* 1 */
+			2,	/* 2 */
+			1,	/* 3 */
+			0,	/* 4 */
+			0,	/* 5 */
+			0x19u,	/* 6 */
+		},	/* 3 */
+		11, {
+			/* [0] */ {
+				1,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0x12u,	/* 5 */
+					1, 0x57u,	/* 6 */
+					1, 0x44u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x3u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					1, 0xFu,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					1, 0x2u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					1, 0x25u,	/* 3 */
+					1, 0x91u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					1, 0x81u,	/* 11 */
+					1, 0x20u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x1u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x25u,	/* 2 */
+					0x2u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				18, { 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u, 0x0u },	/* 13 */
+				0, { 0 },	/* 14 */
+				1, { 0 },	/* 15 */
+				0, { 0 },	/* 16 */
+			},
+			/* [1] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x1u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0x11u,	/* 5 */
+					1, 0x57u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					1, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					0, 0x0u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x19u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x1u,	/* 9 */
+					1, 0x81u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x27u,	/* 2 */
+					0x0u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, { 0 },	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [2] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x3u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0xEu,	/* 5 */
+					1, 0x53u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					0, 0x0u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					1, 0x71u,	/* 3 */
+					1, 0x98u,	/* 4 */
+					1, 0x1u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x18u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x81u,	/* 9 */
+					1, 0x1u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x25u,	/* 2 */
+					0x2u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, {
+					1, 0x7u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [3] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x3u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0xBu,	/* 5 */
+					1, 0x4Fu,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					0, 0x0u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					1, 0x71u,	/* 3 */
+					1, 0x98u,	/* 4 */
+					1, 0x1u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x18u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x81u,	/* 9 */
+					1, 0x1u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x25u,	/* 2 */
+					0x2u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, {
+					1, 0x7u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [4] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x1u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0xAu,	/* 5 */
+					1, 0x4Bu,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					1, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					1, 0x1u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x19u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x1u,	/* 9 */
+					1, 0x81u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x27u,	/* 2 */
+					0x0u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, { 0 },	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [5] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x1u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0x9u,	/* 5 */
+					1, 0x47u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					1, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					1, 0x1u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x19u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x1u,	/* 9 */
+					1, 0x81u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x27u,	/* 2 */
+					0x0u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, { 0 },	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [6] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x1u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0x8u,	/* 5 */
+					1, 0x43u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					1, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					1, 0x1u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x19u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x1u,	/* 9 */
+					1, 0x81u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x27u,	/* 2 */
+					0x0u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, { 0 },	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [7] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x3u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0x5u,	/* 5 */
+					1, 0x3Fu,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					0, 0x0u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					1, 0x71u,	/* 3 */
+					1, 0x98u,	/* 4 */
+					1, 0x1u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x18u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x81u,	/* 9 */
+					1, 0x1u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x25u,	/* 2 */
+					0x2u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, { 0 },	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [8] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x3u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0x2u,	/* 5 */
+					1, 0x3Bu,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					0, 0x0u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					1, 0x71u,	/* 3 */
+					1, 0x98u,	/* 4 */
+					1, 0x1u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x18u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x81u,	/* 9 */
+					1, 0x1u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x25u,	/* 2 */
+					0x2u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, {
+					1, 0x7u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					0, 0x0u,	/* 10 */
+				},	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [9] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x1u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					1, 0x1u,	/* 5 */
+					1, 0x37u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					1, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					1, 0x1u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x19u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x1u,	/* 9 */
+					1, 0x81u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x27u,	/* 2 */
+					0x0u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, { 0 },	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+			/* [10] */ {
+				2,	/* 1 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x80u,	/* 2 */
+					1, 0x1u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					1, 0x33u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					0, 0x0u,	/* 9 */
+					1, 0x0u,	/* 10 */
+				},	/* 2 */
+				1, {
+					1, 0x77u,	/* 1 */
+					1, 0x7Fu,	/* 2 */
+					0, 0x0u,	/* 3 */
+					1, 0xEFu,	/* 4 */
+				},	/* 3 */
+				0, { 0 },	/* 4 */
+				{
+					1, 0x1u,	/* 1 */
+					0, 0x0u,	/* 2 */
+					0, 0x0u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					0, 0x0u,	/* 7 */
+					0, 0x0u,	/* 8 */
+					1, 0x19u,	/* 9 */
+					0, 0x0u,	/* 10 */
+					0, 0x0u,	/* 11 */
+					0, 0x0u,	/* 12 */
+					0, 0x0u,	/* 13 */
+					0, 0x0u,	/* 14 */
+				},	/* 5 */
+				{
+					0, 0x0u,	/* 1 */
+					1, 0x10u,	/* 3 */
+					0, 0x0u,	/* 4 */
+					0, 0x0u,	/* 5 */
+					0, 0x0u,	/* 6 */
+					1, 0x0u,	/* 7 */
+					1, 0x10u,	/* 8 */
+					1, 0x1u,	/* 9 */
+					1, 0x81u,	/* 10 */
+				},	/* 6 */
+				1,	/* 7 */
+				0,	/* 8 */
+				{
+					0xADu,	/* 1 */
+					0x27u,	/* 2 */
+					0x0u,	/* 3 */
+					0, { 0 },	/* 4 */
+				},	/* 9 */
+				0x0u,	/* 10 */
+				0, { 0 },	/* 11 */
+				0x0u,	/* 12 */
+				0, { 0 },	/* 13 */
+				1, { 0 },	/* 14 */
+				1, { 0 },	/* 15 */
+				1, { 0 },	/* 16 */
+			},
+		},	/* 4 */
+		0, { {
+			"",	/* 1 */
+			0x0u,	/* 2 */
+			0x0u,	/* 3 */
+			0x0u,	/* 4 */
+		} },	/* 5 */
+		0x0u,	/* 6 */
+	},
+};
+
+#endif /* A2B_APP_BDD_IMAGE */
@@ -0,0 +1,35 @@
+/*******************************************************************************
+Copyright (c) 2020 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+******************************************************************************
+* @file: adi_a2b_bddimage.h
+* @brief: Prebuilt network description used with A2B_APP_BDD_IMAGE. The data
+*         in adi_a2b_bddimage.c is generated from adi_a2b_busconfig.c by
+*         tools/bddgen_host.c.
+* Developed by: Automotive Software and Systems team, Bangalore, India
+*****************************************************************************/
+
+#ifndef __ADI_A2B_BDDIMAGE_H__
+#define __ADI_A2B_BDDIMAGE_H__
+
+/*============= I N C L U D E S =============*/
+
+#include "a2bstack-protobuf/inc/adi_a2b_busconfig.h"
+#include "a2bstack-protobuf/inc/bdd_pb2.pb.h"
+
+/*============= D A T A =============*/
+
+/*! Number of chains (master nodes) in the image */
+extern const a2b_UInt8 gnA2bBddImageNumChains;
+
+/*! Network description of each chain, as a2b_bcfParse_bdd() builds it */
+extern const bdd_Network gaA2bBddImage[];
+
+/*! Peripheral download table of each chain, as adi_a2b_ParsePeriCfgTable() builds it */
+extern const ADI_A2B_NODE_PERICONFIG gaA2bBddImagePeriTable[][A2B_CONF_MAX_NUM_SLAVE_NODES + 1];
+
+/*! Network control guidance of the BCF, updated by the application */
+extern ADI_A2B_NETWORK_CONFIG goA2bBddImageTargetProperties;
+
+#endif /* __ADI_A2B_BDDIMAGE_H__ */
@@ -11,6 +11,9 @@
  Functions  : main()
  a2b_setup()
  a2b_fault_monitor()
+ a2b_AppIdle()
+ a2b_AppTraceDump()
+ a2b_AppSeqChartDump()
  a2bapp_ProcessSuperBcf()
  a2bapp_onInterrupt()
  a2bapp_onDiscoveryComplete()
@@ -59,6 +62,10 @@
 #include "a2bstack/src/timer_priv.h"
 #include "platform/a2b/conf.h"
 #include "adi_a2b_externs.h"
+#include "adi_a2b_driverprototypes.h"
+#ifdef A2B_APP_BDD_IMAGE
+#include "adi_a2b_bddimage.h"
+#endif
 #include <assert.h>
 #include <stdio.h>
 
@@ -72,6 +79,14 @@
 #error "A2B_BCF_FROM_SOC_EEPROM & ADI_SIGMASTUDIO_BCF features are mutually exclusive. Define only one to proceed further"
 #endif
 
+#if defined(A2B_APP_BDD_IMAGE) && (!defined(ADI_SIGMASTUDIO_BCF) || defined(ADI_A2B_BCF_COMPRESSED) || defined(ENABLE_SUPERBCF))
+#error "A2B_APP_BDD_IMAGE needs ADI_SIGMASTUDIO_BCF with an uncompressed BCF and no ENABLE_SUPERBCF"
+#endif
+
+#if defined(A2BAPP_POOL_PROFILE) && (!defined(A2B_FEATURE_MEMORY_MANAGER) || !defined(A2B_PRINT_CONSOLE))
+#error "A2BAPP_POOL_PROFILE needs A2B_FEATURE_MEMORY_MANAGER and A2B_PRINT_CONSOLE"
+#endif
+
 /*! Array of pointers to store App context */
 a2b_App_t *gpApp_Info[A2B_CONF_MAX_NUM_MASTER_NODES];
 
@@ -81,6 +96,14 @@ a2b_App_t *gpApp_Info[A2B_CONF_MAX_NUM_MASTER_NODES];
 static a2b_UInt32 nCurrBCFIndex = 0, nDiscTryCnt = 0;
 #endif
 
+#ifdef A2BAPP_POOL_PROFILE
+/*! Pool usage merged over every stack instance torn down while profiling.
+    Kept outside a2b_App_t, which is cleared on every set up. */
+static a2b_HeapPoolStats gaPoolPeak[A2BAPP_MAX_HEAP_POOLS];
+static a2b_UInt32 gnPoolPeakCount = 0u;
+static a2b_UInt32 gnPoolSamples = 0u;
+#endif
+
 /*============= C O D E =============*/
 
 #ifdef ENABLE_SUPERBCF
@@ -93,6 +116,9 @@ static a2b_Int32 a2b_load(a2b_App_t *pApp_Info);
 static a2b_Int32 a2b_start(a2b_App_t *pApp_Info);
 static a2b_Int32 a2b_discover(a2b_App_t *pApp_Info);
 static a2b_Int32 a2b_sendDiscoveryMessage(a2b_App_t *pApp_Info);
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+static a2b_Int32 a2b_rediscoverPartial(a2b_App_t *pApp_Info);
+#endif
 static a2b_Int32 a2b_setupPwrDiag(a2b_App_t *pApp_Info);
 static void a2b_appCtxReset(a2b_App_t *pApp_Info);
 
@@ -103,7 +129,16 @@ static void a2bapp_onPowerFault(struct a2b_Msg *msg, a2b_Handle userData);
 a2b_UInt32 a2b_fault_monitor(a2b_App_t *pApp_Info);
 static void a2b_app_handle_becovf(void* pParam);
 static a2b_HResult a2b_AppDetectBusDrop(a2b_App_t *pApp_Info);
-static a2b_HResult a2b_AppReadReg(struct a2b_StackContext* ctx, a2b_Int16 nodeAddr, a2b_UInt8 reg, a2b_UInt8* value);
+static void a2b_AppLinkMonSample(a2b_App_t *pApp_Info, a2b_Bool bPresence);
+static void a2b_AppFlagBusDrop(a2b_App_t *pApp_Info, a2b_Int16 nodeAddr);
+static a2b_HResult a2b_AppReadReg(struct a2b_StackContext* mCtx, a2b_Int16 nodeAddr, a2b_UInt8 reg, a2b_UInt8* value);
+#ifdef A2BAPP_FAULT_SNAPSHOT
+static void a2b_AppFaultSnapshot(a2b_App_t *pApp_Info);
+#endif
+#ifdef A2BAPP_POOL_PROFILE
+static void a2b_AppPoolProfileSample(a2b_App_t *pApp_Info);
+static void a2b_AppEmitPoolTable(void);
+#endif
 
 #ifndef ADI_SIGMASTUDIO_BCF
 static a2b_Bool a2b_loadBdd ( const a2b_Char* bddPath, bdd_Network* bdd);
@@ -121,6 +156,11 @@ static a2b_HResult a2b_processIntrpt(a2b_App_t *pApp_Info);
 #ifdef ENABLE_INTRRUPT_PROCESS
 static void a2b_IntrptCallbk(a2b_App_t *pApp_Info)
 {
+	if (pApp_Info->bIntrptLatch == 0u)
+	{
+		/* Time of the first pin edge not yet serviced */
+		pApp_Info->nIntrptCycles = adi_a2b_TimerCycles();
+	}
 	pApp_Info->bIntrptLatch = 1u;
 }
 #endif
@@ -276,6 +316,19 @@ static a2b_Int32 a2b_load(a2b_App_t *pApp_Info)
 
 	A2B_APP_LOG("\n\rUsing SigmaStudio BCF File\n\r");
 
+#ifdef A2B_APP_BDD_IMAGE
+
+	/* BDD and peripheral table were built from the BCF by tools/bddgen_host.c */
+	if (pApp_Info->ecb.palEcb.nChainIndex >= gnA2bBddImageNumChains)
+	{
+		return 1;
+	}
+	pApp_Info->pBdd = &gaA2bBddImage[pApp_Info->ecb.palEcb.nChainIndex];
+	pApp_Info->pPeriNetworkTable = &gaA2bBddImagePeriTable[pApp_Info->ecb.palEcb.nChainIndex][0u];
+	pApp_Info->pTargetProperties = &goA2bBddImageTargetProperties;
+
+#else /* A2B_APP_BDD_IMAGE */
+
 #ifdef ADI_A2B_BCF_COMPRESSED
 
 #ifndef ENABLE_SUPERBCF
@@ -325,8 +378,13 @@ static a2b_Int32 a2b_load(a2b_App_t *pApp_Info)
 
 #endif
 
+	pApp_Info->pBdd = &pApp_Info->bdd;
+	pApp_Info->pPeriNetworkTable = &pApp_Info->aPeriNetworkTable[0u];
+
+#endif /* A2B_APP_BDD_IMAGE */
+
 	/* assign the peripheral configuration table (including audio host) */
-	pApp_Info->ecb.palEcb.pAudioHostDeviceConfig = &pApp_Info->aPeriNetworkTable[0u];
+	pApp_Info->ecb.palEcb.pAudioHostDeviceConfig = pApp_Info->pPeriNetworkTable;
 
 
 #elif defined(A2B_BCF_FROM_SOC_EEPROM)
@@ -338,23 +396,33 @@ static a2b_Int32 a2b_load(a2b_App_t *pApp_Info)
 
 	a2b_pal_I2cOpenFunc(pApp_Info->ecb.baseEcb.i2cAddrFmt, pApp_Info->ecb.baseEcb.i2cBusSpeed, &pApp_Info->ecb);
 
-	/* Assuming the max size of I2C burst read */
-	panTempBuff = malloc( 4096 );
+	/* Scratch for the EEPROM headers (and the whole BDD without A2B_FEATURE_BDD_STREAM) */
+	panTempBuff = malloc( A2B_BDD_EEPROM_SCRATCH_SIZE );
 
 	/* Create A2B Target properties */
 	pApp_Info->pTargetProperties = malloc(sizeof(ADI_A2B_NETWORK_CONFIG));
 	memset(pApp_Info->pTargetProperties, 0, sizeof(ADI_A2B_NETWORK_CONFIG));
 
 	/* Populate BDD from local EEPROM */
-	(void)a2b_get_bddFromEEPROM(&pApp_Info->ecb, &pApp_Info->bdd, panTempBuff, pApp_Info->anEeepromPeriCfgInfo, pApp_Info->pTargetProperties);
+	nResult = a2b_get_bddFromEEPROM(&pApp_Info->ecb, &pApp_Info->bdd, panTempBuff, pApp_Info->anEeepromPeriCfgInfo, pApp_Info->pTargetProperties);
+	free(panTempBuff);
+	pApp_Info->pBdd = &pApp_Info->bdd;
 	/* Find the pointer where audio host config info is stored */
 	pApp_Info->ecb.palEcb.pEepromAudioHostConfig = &pApp_Info->anEeepromPeriCfgInfo[0];
 
 	/* Closing the I2C handle */
 	a2b_pal_I2cCloseFunc(pApp_Info->ecb.palEcb.i2chnd);
 
+	if (A2B_FAILED(nResult))
+	{
+		/* bdd may be partly decoded, do not discover with it */
+		A2B_APP_LOG("\n\rFailed to read the BDD from EEPROM\n\r");
+		return 1;
+	}
+
 #else
 	/* From Third party tools */
+	pApp_Info->pBdd = &pApp_Info->bdd;
 
 #endif
 
@@ -362,7 +430,7 @@ static a2b_Int32 a2b_load(a2b_App_t *pApp_Info)
 	/* Clock for ADSP-BF7xx SPORT's is generated by SigmaDSP part. SPORT's should be enabled before starting discovery, so that A2B chip is clocked.
 	 * Call to below function copies the TDM settings from BDD to palecb so that SPORT's configuration is done during PAL audio init function.
 	 * */
-	a2bapp_initTdmSettings(&pApp_Info->ecb, &pApp_Info->bdd);
+	a2bapp_initTdmSettings(&pApp_Info->ecb, pApp_Info->pBdd);
 #endif  /* __ADSPBF7xx__ */
 #ifdef A2B_FEATURE_TRACE
 	pApp_Info->ecb.baseEcb.traceLvl = A2B_CONF_DEFAULT_TRACE_LVL;
@@ -372,7 +440,7 @@ static a2b_Int32 a2b_load(a2b_App_t *pApp_Info)
 	/*
 	 * Initialize vendor, product, and version information in the ECB.
 	 */
-	a2b_bddPalInit(&pApp_Info->ecb, &pApp_Info->bdd);
+	a2b_bddPalInit(&pApp_Info->ecb, pApp_Info->pBdd);
 	A2B_APP_DBG_LOG("BDD PAL Init done \n\r");
 
 	/*
@@ -476,12 +544,12 @@ static a2b_Int32 a2b_sendDiscoveryMessage(a2b_App_t *pApp_Info)
 
 	/* Attach the BDD information to the message */
 	discReq = (a2b_NetDiscovery*)a2b_msgGetPayload(msg);
-	discReq->req.bdd = &pApp_Info->bdd;
+	discReq->req.bdd = pApp_Info->pBdd;
 
 #ifdef ADI_SIGMASTUDIO_BCF
 
 	/* Attach additional peripheral initialization data as generated.*/
-	discReq->req.periphPkg = (const a2b_Byte *)&pApp_Info->aPeriNetworkTable[0u];
+	discReq->req.periphPkg = (const a2b_Byte *)pApp_Info->pPeriNetworkTable;
 	discReq->req.pkgLen = sizeof(ADI_A2B_NETWORK_PERICONFIG);
 
 #elif defined(A2B_BCF_FROM_SOC_EEPROM)
@@ -534,6 +602,12 @@ static a2b_Int32 a2b_sendDiscoveryMessage(a2b_App_t *pApp_Info)
 static a2b_Int32 a2b_discover(a2b_App_t *pApp_Info)
 {
 	a2b_HResult result = 0;
+	a2b_UInt32 nStartTime;
+	ADI_A2B_TWI_STATS oTwiStats;
+
+	/* Bus setup time and TWI traffic are reported once discovery ends */
+	adi_a2b_TwiResetStats();
+	nStartTime = a2b_pal_TimerGetSysTimeFunc();
 
 	result = a2b_sendDiscoveryMessage(pApp_Info);
 
@@ -559,6 +633,12 @@ static a2b_Int32 a2b_discover(a2b_App_t *pApp_Info)
 #ifdef ENABLE_INTRRUPT_PROCESS
 		a2b_processIntrpt(pApp_Info);
 #endif
+		/* Nothing to do until the next stack deadline or interrupt */
+		if (!pApp_Info->discoveryDone)
+		{
+			a2b_AppIdle(pApp_Info);
+		}
+
 		if (pApp_Info->discoveryDone)
 		{
 			if (pApp_Info->discoverySuccessful == true)
@@ -603,17 +683,102 @@ static a2b_Int32 a2b_discover(a2b_App_t *pApp_Info)
 		}
 	}
 
+	adi_a2b_TwiGetStats(&oTwiStats);
+	A2B_APP_LOG("Bus setup took %u ms: %u TWI transfers, %u bytes, %u failed, %u kcycles on the bus\n\r",
+			(unsigned)(a2b_pal_TimerGetSysTimeFunc() - nStartTime), (unsigned)oTwiStats.nTransfers,
+			(unsigned)oTwiStats.nBytes, (unsigned)oTwiStats.nErrors, (unsigned)(oTwiStats.nBusTicks / 1000u));
+	A2B_UNUSED(nStartTime);
+
 #ifdef A2B_FEATURE_SEQ_CHART
 	if ( A2B_NULL != pApp_Info->seqFile )
 	{
 		/* Do clean up after discovery is done */
 		a2b_seqChartStop(pApp_Info->ctx);
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+		(void)a2b_AppSeqChartDump(pApp_Info->seqFile);
+#endif
 	}
 #endif
 
 	return result;
 }
 
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+/*!****************************************************************************
+ *
+ *  \b               a2b_rediscoverPartial
+ *
+ *  This function asks the master plugin to re-discover only the nodes below
+ *  the slave node that reported the last cable fault, and ticks till
+ *  completion. The nodes above the fault keep running, audio included.
+ *
+ *  \param           [in]    pApp_Info   Pointer to a2b_App_t instance
+ *
+ *  \pre             A post discovery cable fault was reported on a slave node
+ *
+ *  \post            None
+ *
+ *  \return          0 on Success
+ *					 1 on Failure
+ ******************************************************************************/
+static a2b_Int32 a2b_rediscoverPartial(a2b_App_t *pApp_Info)
+{
+	a2b_NetDiscovery *discReq;
+	struct a2b_Msg *msg;
+	a2b_HResult result;
+	a2b_UInt32 nStartTime;
+	ADI_A2B_TWI_STATS oTwiStats;
+
+	adi_a2b_TwiResetStats();
+	nStartTime = a2b_pal_TimerGetSysTimeFunc();
+
+	msg = a2b_msgAlloc(pApp_Info->ctx, A2B_MSG_REQUEST, A2B_MSGREQ_NET_PARTIAL_DISCOVERY);
+	if (msg == A2B_NULL)
+	{
+		return 1;
+	}
+
+	/* The master plugin resumes with the BDD of the last discovery */
+	discReq = (a2b_NetDiscovery*)a2b_msgGetPayload(msg);
+	discReq->req.bdd = pApp_Info->pBdd;
+
+	pApp_Info->discoveryDone = false;
+	pApp_Info->discoverySuccessful = false;
+
+	a2b_msgSetUserData(msg, (a2b_Handle)pApp_Info, A2B_NULL);
+	result = a2b_msgRtrSendRequest(msg, A2B_NODEADDR_MASTER, a2bapp_onDiscoveryComplete);
+	a2b_msgUnref(msg);
+
+	if (result != 0)
+	{
+		A2B_APP_LOG("Error while sending partial discovery message \n\r");
+		return 1;
+	}
+
+	while (!pApp_Info->discoveryDone)
+	{
+		a2b_stackTick(pApp_Info->ctx);
+
+#ifdef ENABLE_INTRRUPT_PROCESS
+		a2b_processIntrpt(pApp_Info);
+#endif
+		if (!pApp_Info->discoveryDone)
+		{
+			a2b_AppIdle(pApp_Info);
+		}
+	}
+
+	/* Compare with the "Bus setup took" line of a full restart */
+	adi_a2b_TwiGetStats(&oTwiStats);
+	A2B_APP_LOG("Partial rediscovery below node %d took %u ms: %u TWI transfers, %u bytes, %u failed\n\r",
+			(int)pApp_Info->faultNode, (unsigned)(a2b_pal_TimerGetSysTimeFunc() - nStartTime),
+			(unsigned)oTwiStats.nTransfers, (unsigned)oTwiStats.nBytes, (unsigned)oTwiStats.nErrors);
+	A2B_UNUSED(nStartTime);
+
+	return (pApp_Info->discoverySuccessful == true) ? 0 : 1;
+}
+#endif /* A2B_FEATURE_PARTIAL_DISCOVERY */
+
 #ifdef ENABLE_SUPERBCF
 /*!****************************************************************************
  *
@@ -738,6 +903,11 @@ a2b_Int32 a2b_stop(a2b_App_t *pApp_Info)
 	}
 #endif
 
+#ifdef A2BAPP_POOL_PROFILE
+	/* Every teardown, including re-discovery after a fault, is a sample */
+	a2b_AppPoolProfileSample(pApp_Info);
+#endif
+
 	/* Free the stack and heap */
 	a2b_stackFree(pApp_Info->ctx);
 
@@ -779,7 +949,9 @@ a2b_UInt32 a2b_multimasterSetup(a2b_App_t *pApp_Info)
 	uint32_t nResult = 0;
 
 #if (defined (ADI_SIGMASTUDIO_BCF)) && (!defined(ENABLE_SUPERBCF))
-#ifndef ADI_A2B_BCF_COMPRESSED
+#if defined(A2B_APP_BDD_IMAGE)
+	nNumMasters = gnA2bBddImageNumChains;
+#elif !defined(ADI_A2B_BCF_COMPRESSED)
 	nNumMasters = sBusDescription.nNumMasterNode;
 #else
 	nNumMasters = sCmprBusDescription.nNumMasterNode;
@@ -905,7 +1077,9 @@ a2b_UInt32 a2b_multiMasterFault_monitor(a2b_App_t *pApp_Info)
 	uint32_t nResult = 0;
 
 #if (defined (ADI_SIGMASTUDIO_BCF)) && (!defined(ENABLE_SUPERBCF))
-#ifndef ADI_A2B_BCF_COMPRESSED
+#if defined(A2B_APP_BDD_IMAGE)
+	nNumMasters = gnA2bBddImageNumChains;
+#elif !defined(ADI_A2B_BCF_COMPRESSED)
 	nNumMasters = sBusDescription.nNumMasterNode;
 #else
 	nNumMasters = sCmprBusDescription.nNumMasterNode;
@@ -960,13 +1134,36 @@ a2b_UInt32 a2b_fault_monitor(a2b_App_t *pApp_Info)
 			pApp_Info->bRetry = A2B_FALSE;
 			nChainIndex = pApp_Info->ecb.palEcb.nChainIndex;
 
-#ifdef A2B_ENABLE_AUDIO_FROM_APP
+#if defined(A2B_ENABLE_AUDIO_FROM_APP) && !defined(A2B_FEATURE_PARTIAL_DISCOVERY)
 			adi_a2b_EnableAudioHost(nChainIndex, false);
 #endif
 
+#ifdef A2B_FEATURE_TRACE_BINARY
+			/* Keep the trace leading up to the fault */
+			(void)a2b_AppTraceDump(A2B_CONF_DEFAULT_TRACE_DUMP_URL);
+#endif
+
 			/* delay between re-discovery attempt */
 			a2b_ActiveDelay(pApp_Info->ctx, pApp_Info->pTargetProperties->nRediscInterval);
 
+#ifdef A2B_FEATURE_PARTIAL_DISCOVERY
+			/* A cable fault below a slave node leaves the nodes above it
+			 * running, so try re-discovering only the nodes below it first.
+			 * The master plugin refuses when that is not possible, e.g. for
+			 * a fault at the master or one that turned the bus off.
+			 */
+			if ((pApp_Info->faultNode >= 0) && (a2b_rediscoverPartial(pApp_Info) == 0))
+			{
+				return 0u;
+			}
+
+			/* Fall back to restarting the whole chain */
+			pApp_Info->bRetry = A2B_FALSE;
+#ifdef A2B_ENABLE_AUDIO_FROM_APP
+			adi_a2b_EnableAudioHost(nChainIndex, false);
+#endif
+#endif /* A2B_FEATURE_PARTIAL_DISCOVERY */
+
 			/* stop a2b stack */
 			nResult = a2b_stop(pApp_Info);
 
@@ -989,6 +1186,359 @@ a2b_UInt32 a2b_fault_monitor(a2b_App_t *pApp_Info)
 
 	return (nResult);
 }
+
+/*!****************************************************************************
+ *
+ *  \b               a2b_AppIdle
+ *
+ *  Idles the core until the stack has work to do or an interrupt occurs
+ *  (SPORT DMA, A2B IRQ, ...). Call it after a2b_stackTick() in place of
+ *  ticking in a tight loop; it returns at once when a job is ready. The
+ *  wait is bounded by the PAL (A2B_TIMER_MAX_WAIT) so the system time keeps
+ *  up with its cycle counter.
+ *
+ *  \param           [in]    pApp_Info   Application Context Info
+ *
+ *  \pre             None
+ *
+ *  \post            None
+ *
+ *  \return          None
+ ******************************************************************************/
+void a2b_AppIdle(a2b_App_t *pApp_Info)
+{
+	a2b_UInt32 nDeadline;
+
+	if (pApp_Info->ctx != A2B_NULL)
+	{
+		nDeadline = a2b_stackNextDeadline(pApp_Info->ctx);
+		if (nDeadline != 0u)
+		{
+			(void)a2b_pal_TimerWaitFunc(nDeadline);
+		}
+	}
+}
+
+#if defined(A2B_FEATURE_TRACE_BINARY) || defined(A2B_FEATURE_SEQ_CHART_BINARY)
+static void A2B_CALL a2b_AppTraceDumpWrite(a2b_Handle hnd, const a2b_Byte* data, a2b_UInt32 nBytes)
+{
+	(void)fwrite(data, 1u, nBytes, (FILE *)hnd);
+}
+#endif
+
+#ifdef A2B_FEATURE_TRACE_BINARY
+
+/*!****************************************************************************
+ *
+ *  \b               a2b_AppTraceDump
+ *
+ *  Writes the binary trace ring to a file, to be rendered to text on a host
+ *  with tools/tracebin_host.c. The ring is kept, so each dump holds the
+ *  latest messages.
+ *
+ *  \param           [in]    pUrl        File to write
+ *
+ *  \pre             None
+ *
+ *  \post            None
+ *
+ *  \return          0 on Success
+ *					 1 on Failure
+ ******************************************************************************/
+a2b_UInt32 a2b_AppTraceDump(const a2b_Char* pUrl)
+{
+	FILE *pFile;
+
+	pFile = fopen(pUrl, "wb");
+	if (pFile == NULL)
+	{
+		A2B_APP_LOG("Cannot open trace dump %s \n\r", pUrl);
+		return 1u;
+	}
+
+	a2b_traceBinDump(&a2b_AppTraceDumpWrite, (a2b_Handle)pFile);
+	(void)fclose(pFile);
+
+	return 0u;
+}
+#endif
+
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+/*!****************************************************************************
+ *
+ *  \b               a2b_AppSeqChartDump
+ *
+ *  Writes the binary sequence chart captured since a2b_seqChartStart() to a
+ *  file, to be rendered to PlantUML text on a host with
+ *  tools/seqchart_host.c.
+ *
+ *  \param           [in]    pUrl        File to write
+ *
+ *  \pre             None
+ *
+ *  \post            None
+ *
+ *  \return          0 on Success
+ *					 1 on Failure
+ ******************************************************************************/
+a2b_UInt32 a2b_AppSeqChartDump(const a2b_Char* pUrl)
+{
+	FILE *pFile;
+
+	pFile = fopen(pUrl, "wb");
+	if (pFile == NULL)
+	{
+		A2B_APP_LOG("Cannot open sequence chart dump %s \n\r", pUrl);
+		return 1u;
+	}
+
+	a2b_seqChartBinDump(&a2b_AppTraceDumpWrite, (a2b_Handle)pFile);
+	(void)fclose(pFile);
+
+	return 0u;
+}
+#endif
+
+#ifdef A2B_FEATURE_MEMORY_MANAGER
+/*!****************************************************************************
+ *
+ *  \b               a2b_AppDumpHeapStats
+ *
+ *  Prints the usage of every memory pool of the stack heap: block size,
+ *  capacity, current use, high watermark and the allocations the pool
+ *  could not serve.
+ *
+ *  \param           [in]    pApp_Info   Application Context Info
+ *
+ *  \pre             Stack allocated
+ *
+ *  \post            None
+ *
+ *  \return          None
+ ******************************************************************************/
+void a2b_AppDumpHeapStats(a2b_App_t *pApp_Info)
+{
+	a2b_HeapPoolStats aStats[A2BAPP_MAX_HEAP_POOLS];
+	a2b_UInt32 nPools, nIndex;
+
+	nPools = a2b_stackGetHeapStats(pApp_Info->ctx, aStats, A2BAPP_MAX_HEAP_POOLS);
+
+	A2B_APP_LOG("pool  block  blocks  in use  peak  missed  failed\n\r");
+	for (nIndex = 0u; nIndex < nPools; nIndex++)
+	{
+		A2B_APP_LOG("%4u  %5u  %6u  %6u  %4u  %6u  %6u\n\r", (unsigned)nIndex,
+				(unsigned)aStats[nIndex].blockSize, (unsigned)aStats[nIndex].numBlocks,
+				(unsigned)aStats[nIndex].numInUse, (unsigned)aStats[nIndex].maxInUse,
+				(unsigned)aStats[nIndex].numMissed, (unsigned)aStats[nIndex].numFailed);
+	}
+	A2B_UNUSED(nPools);
+}
+#endif
+
+#ifdef A2BAPP_POOL_PROFILE
+/*!****************************************************************************
+ *
+ *  \b               a2b_poolProfile
+ *
+ *  Profiles the stack heap. Each cycle sets up the network (discovery and
+ *  peripheral configuration), keeps it running for A2BAPP_POOL_PROFILE_DWELL
+ *  msec or until a fault is reported and tears it down again, which is what
+ *  a re-discovery after a fault does. Faults can be injected on the bench
+ *  during the dwell (e.g. by opening a link) to cover the fault paths.
+ *
+ *  Afterwards the merged pool usage is printed along with an A2B_POOL_TABLE
+ *  sized to the high watermarks plus A2BAPP_POOL_PROFILE_MARGIN percent.
+ *  Saved as a header and named by A2B_CONF_POOL_TABLE_HEADER it replaces the
+ *  default table of the stack memory manager.
+ *
+ *  \param           [in]    pApp_Info   Application Context Info
+ *
+ *  \pre             None
+ *
+ *  \post            The stack is stopped
+ *
+ *  \return          0 on Success
+ *					 1 if no cycle discovered the network
+ ******************************************************************************/
+a2b_UInt32 a2b_poolProfile(a2b_App_t *pApp_Info)
+{
+	a2b_UInt32 nCycle, nStartTime, nDiscovered = 0u;
+	a2b_UInt8 nChainIndex = pApp_Info->ecb.palEcb.nChainIndex;
+
+	gnPoolPeakCount = 0u;
+	gnPoolSamples = 0u;
+
+	for (nCycle = 0u; nCycle < A2BAPP_POOL_PROFILE_CYCLES; nCycle++)
+	{
+		pApp_Info->ecb.palEcb.nChainIndex = nChainIndex;
+		if (a2b_setup(pApp_Info) == 0u)
+		{
+			nDiscovered++;
+		}
+
+		nStartTime = a2b_pal_TimerGetSysTimeFunc();
+		while ((pApp_Info->ctx != A2B_NULL) && (pApp_Info->bfaultDone == A2B_FALSE) &&
+				((a2b_pal_TimerGetSysTimeFunc() - nStartTime) < A2BAPP_POOL_PROFILE_DWELL))
+		{
+			a2b_stackTick(pApp_Info->ctx);
+#ifdef ENABLE_INTRRUPT_PROCESS
+			a2b_processIntrpt(pApp_Info);
+#endif
+			a2b_AppIdle(pApp_Info);
+		}
+
+		if (pApp_Info->ctx != A2B_NULL)
+		{
+			a2b_AppDumpHeapStats(pApp_Info);
+			(void)a2b_stop(pApp_Info);
+		}
+		A2B_APP_LOG("Pool profile cycle %u: %s\n\r", (unsigned)(nCycle + 1u),
+				(pApp_Info->bfaultDone == A2B_TRUE) ? "fault" : "no fault");
+	}
+
+	a2b_AppEmitPoolTable();
+
+	return ((nDiscovered != 0u) ? 0u : 1u);
+}
+
+/*!****************************************************************************
+ *
+ *  \b               a2b_AppPoolProfileSample
+ *
+ *  Merges the pool usage of the stack about to be freed into the profile:
+ *  the highest watermark and the sum of missed and failed allocations.
+ *
+ *  \param           [in]    pApp_Info   Application Context Info
+ *
+ *  \pre             Stack allocated
+ *
+ *  \post            None
+ *
+ *  \return          None
+ ******************************************************************************/
+static void a2b_AppPoolProfileSample(a2b_App_t *pApp_Info)
+{
+	a2b_HeapPoolStats aStats[A2BAPP_MAX_HEAP_POOLS];
+	a2b_UInt32 nPools, nIndex;
+
+	nPools = a2b_stackGetHeapStats(pApp_Info->ctx, aStats, A2BAPP_MAX_HEAP_POOLS);
+	if (nPools != 0u)
+	{
+		if (gnPoolPeakCount == 0u)
+		{
+			memcpy(gaPoolPeak, aStats, nPools * sizeof(aStats[0]));
+			gnPoolPeakCount = nPools;
+		}
+		else
+		{
+			for (nIndex = 0u; nIndex < A2B_MIN(nPools, gnPoolPeakCount); nIndex++)
+			{
+				gaPoolPeak[nIndex].maxInUse = A2B_MAX(gaPoolPeak[nIndex].maxInUse, aStats[nIndex].maxInUse);
+				gaPoolPeak[nIndex].numMissed += aStats[nIndex].numMissed;
+				gaPoolPeak[nIndex].numFailed += aStats[nIndex].numFailed;
+			}
+		}
+		gnPoolSamples++;
+	}
+}
+
+/*!****************************************************************************
+ *
+ *  \b               a2b_AppEmitPoolTable
+ *
+ *  Prints the profiled pool usage and an A2B_POOL_TABLE sized from it.
+ *
+ *  Table entries sharing a pool (same block size) get the whole count on
+ *  the first of them. A pool that ran out while profiling keeps its
+ *  configured size: its watermark is capped by the capacity and says
+ *  nothing about the real demand.
+ *
+ *  \pre             a2b_AppPoolProfileSample() called at least once
+ *
+ *  \post            None
+ *
+ *  \return          None
+ ******************************************************************************/
+static void a2b_AppEmitPoolTable(void)
+{
+	a2b_HeapPoolEntry aEntry[A2BAPP_MAX_HEAP_POOLS];
+	const a2b_HeapPoolStats *pPool;
+	a2b_UInt32 nEntries, nIndex, nPrev, nCount, nHeapSize = 0u;
+	a2b_Bool bShared;
+
+	if (gnPoolSamples == 0u)
+	{
+		A2B_APP_LOG("Pool profile: no samples\n\r");
+		return;
+	}
+
+	A2B_APP_LOG("Pool profile over %u stack instances\n\r", (unsigned)gnPoolSamples);
+	A2B_APP_LOG("pool  block  blocks  peak  missed  failed\n\r");
+	for (nIndex = 0u; nIndex < gnPoolPeakCount; nIndex++)
+	{
+		A2B_APP_LOG("%4u  %5u  %6u  %4u  %6u  %6u\n\r", (unsigned)nIndex,
+				(unsigned)gaPoolPeak[nIndex].blockSize, (unsigned)gaPoolPeak[nIndex].numBlocks,
+				(unsigned)gaPoolPeak[nIndex].maxInUse, (unsigned)gaPoolPeak[nIndex].numMissed,
+				(unsigned)gaPoolPeak[nIndex].numFailed);
+	}
+
+	nEntries = a2b_stackGetHeapPoolTable(aEntry, A2BAPP_MAX_HEAP_POOLS);
+
+	A2B_APP_LOG("\n/* A2B_POOL_TABLE: peak of %u stack instances + %u%% */\n",
+			(unsigned)gnPoolSamples, (unsigned)A2BAPP_POOL_PROFILE_MARGIN);
+	A2B_APP_LOG("#define A2B_POOL_TABLE(ENTRY) \\\n");
+	for (nIndex = 0u; nIndex < nEntries; nIndex++)
+	{
+		bShared = A2B_FALSE;
+		for (nPrev = 0u; nPrev < nIndex; nPrev++)
+		{
+			if (aEntry[nPrev].poolIdx == aEntry[nIndex].poolIdx)
+			{
+				bShared = A2B_TRUE;
+				break;
+			}
+		}
+
+		if (aEntry[nIndex].poolIdx >= gnPoolPeakCount)
+		{
+			nCount = aEntry[nIndex].numBlocks;
+			A2B_APP_LOG("    ENTRY(%s, %uu, %s) /* not profiled */",
+					aEntry[nIndex].name, (unsigned)nCount, aEntry[nIndex].typeName);
+			nHeapSize += nCount * aEntry[nIndex].blockSize;
+		}
+		else if (bShared)
+		{
+			A2B_APP_LOG("    ENTRY(%s, 0u, %s) /* counted in %s */",
+					aEntry[nIndex].name, aEntry[nIndex].typeName, aEntry[nPrev].name);
+		}
+		else
+		{
+			pPool = &gaPoolPeak[aEntry[nIndex].poolIdx];
+			if (pPool->numMissed != 0u)
+			{
+				nCount = pPool->numBlocks;
+				A2B_APP_LOG("    ENTRY(%s, %uu, %s) /* ran out %u times, enlarge and profile again */",
+						aEntry[nIndex].name, (unsigned)nCount, aEntry[nIndex].typeName,
+						(unsigned)pPool->numMissed);
+			}
+			else
+			{
+				nCount = pPool->maxInUse + ((pPool->maxInUse * A2BAPP_POOL_PROFILE_MARGIN) / 100u);
+				nCount = A2B_MAX(nCount, 1u);
+				A2B_APP_LOG("    ENTRY(%s, %uu, %s) /* peak %u of %u */",
+						aEntry[nIndex].name, (unsigned)nCount, aEntry[nIndex].typeName,
+						(unsigned)pPool->maxInUse, (unsigned)pPool->numBlocks);
+			}
+			nHeapSize += nCount * pPool->blockSize;
+		}
+		A2B_APP_LOG("%s\n", ((nIndex + 1u) < nEntries) ? " \\" : "");
+	}
+
+	A2B_APP_LOG("/* Stack heap about %u bytes, currently %u */\n\n\r", (unsigned)nHeapSize,
+			(unsigned)a2b_stackGetMinHeapSize(A2B_NULL));
+	A2B_UNUSED(nHeapSize);
+}
+#endif
 /*!****************************************************************************
  *
  *  \b               a2bapp_onInterrupt
@@ -1089,6 +1639,13 @@ static void a2bapp_onDiscoveryComplete(struct a2b_Msg* msg, a2b_Bool isCancelled
 				pApp_Info->discoverySuccessful = true;
 				pApp_Info->nodesDiscovered = results->resp.numNodes;
 
+				/* Link history does not carry over a (re-)discovery */
+				memset(&pApp_Info->oLinkMon, 0, sizeof(pApp_Info->oLinkMon));
+#ifdef A2BAPP_FAULT_SNAPSHOT
+				/* Reference the fault snapshots are compared with */
+				(void)a2b_diagSnapshot(pApp_Info->ctx, pApp_Info->nodesDiscovered, &pApp_Info->oSnapDisc);
+#endif
+
 				/* When line fault monitoring is enabled, Allocate a timer to periodically clear BECNT register to reset the error counter */
 				if ((pApp_Info->bBecovfTimerEnable == A2B_FALSE) && (pApp_Info->pTargetProperties->bLineDiagnostics == 1))
 				{
@@ -1289,6 +1846,9 @@ static void a2bapp_onPowerFault(struct a2b_Msg *msg, a2b_Handle userData)
 
 	if (pAppInfo->discoveryDone)
 	{
+#ifdef A2BAPP_FAULT_SNAPSHOT
+		a2b_AppFaultSnapshot(pAppInfo);
+#endif
 		/* Set flags to indicate fault post discovery */
 		/* Possibly a node has dropped off the network.. try finding it out */
 		a2b_AppDetectBusDrop(pAppInfo);
@@ -1345,12 +1905,12 @@ a2b_HResult a2bapp_pluginsLoad(struct a2b_PluginApi** plugins, a2b_UInt16* numPl
 	int i = 0;
 
 	A2B_UNUSED(ecb);
-	appPlugins = calloc(gpApp_Info[ecb->palEcb.nChainIndex]->bdd.nodes_count, sizeof(**plugins));
+	appPlugins = calloc(gpApp_Info[ecb->palEcb.nChainIndex]->pBdd->nodes_count, sizeof(**plugins));
 
 	A2B_MASTER_PLUGIN_INIT(&appPlugins[0]);
 	A2B_APP_DBG_LOG("Master plugin load done \r\n");
 
-	for (i = 1; i < (gpApp_Info[ecb->palEcb.nChainIndex]->bdd.nodes_count); i++)
+	for (i = 1; i < (gpApp_Info[ecb->palEcb.nChainIndex]->pBdd->nodes_count); i++)
 	{
 		A2B_SLAVE_PLUGIN_INIT(&appPlugins[i]);
 	}
@@ -1358,7 +1918,7 @@ a2b_HResult a2bapp_pluginsLoad(struct a2b_PluginApi** plugins, a2b_UInt16* numPl
 	A2B_APP_DBG_LOG("Slave plugins load done \r\n");
 
 	*plugins = appPlugins;
-	*numPlugins = gpApp_Info[ecb->palEcb.nChainIndex]->bdd.nodes_count;
+	*numPlugins = gpApp_Info[ecb->palEcb.nChainIndex]->pBdd->nodes_count;
 
 	return 0u;
 }
@@ -1403,8 +1963,10 @@ a2b_HResult a2bapp_pluginsUnload(struct a2b_PluginApi* plugins, a2b_UInt16 numPl
  *
  *  \b               a2b_app_handle_becovf
  *
- *  The routine to periodically reset BECNT and BECOVF registers
- *
+ *  The routine to periodically reset BECNT and BECOVF registers. The bit
+ *  error counts are sampled into the link health monitor before they are
+ *  cleared, and node presence is checked every A2B_BUS_DROP_CHK_PERIOD
+ *  ticks within the same sweep.
  *
  *  \pre             pParam
  *
@@ -1417,32 +1979,228 @@ static void a2b_app_handle_becovf(void* pParam)
 {
 	a2b_App_t* pApp_Info;
 	a2b_Timer* pTimer;
+	a2b_Bool bPresence;
+	ADI_A2B_TWI_STATS oTwiBefore;
+	ADI_A2B_TWI_STATS oTwiAfter;
+	a2b_AppLinkMon* pMon;
 
 	pTimer = (a2b_Timer*)pParam;
 	pApp_Info = (a2b_App_t*)(pTimer->userData);
 
 	if ((pApp_Info->pTargetProperties->bLineDiagnostics) && (pApp_Info->bfaultDone == false))
 	{
+		pMon = &pApp_Info->oLinkMon;
+		adi_a2b_TwiGetStats(&oTwiBefore);
+
+		/* Check for bus drop periodically */
+		bPresence = ((pApp_Info->nBecovfRstCnt % A2B_BUS_DROP_CHK_PERIOD == 0) && (pApp_Info->bBusDropDetected == false));
+		if (bPresence)
+		{
+			pApp_Info->nBecovfRstCnt = 0;
+		}
+		a2b_AppLinkMonSample(pApp_Info, bPresence);
+
 		/* Reset the BECNT register for every call back of the timer */
-		if (a2b_diagWriteReg(pApp_Info->ctx, A2B_NODEADDR_NOTUSED, A2B_REG_BECNT, A2B_REG_BECNT_RESET) != 0)
+		if ((pApp_Info->bfaultDone == false) &&
+			(a2b_diagWriteReg(pApp_Info->ctx, A2B_NODEADDR_NOTUSED, A2B_REG_BECNT, A2B_REG_BECNT_RESET) != 0))
 		{
-			/* reset now to force a bus drop check */
-			pApp_Info->nBecovfRstCnt = A2B_BUS_DROP_CHK_PERIOD;
+			/* force a bus drop check on the next tick */
+			pApp_Info->nBecovfRstCnt = 0;
 		}
 		else
 		{
 			pApp_Info->nBecovfRstCnt++;
 		}
 
-		/* Check for bus drop periodically */
-		if ((pApp_Info->nBecovfRstCnt % A2B_BUS_DROP_CHK_PERIOD == 0) && (pApp_Info->bBusDropDetected == false))
+		/* I2C bus occupancy of this monitoring cycle */
+		adi_a2b_TwiGetStats(&oTwiAfter);
+		pMon->nTransfers = oTwiAfter.nTransfers - oTwiBefore.nTransfers;
+		pMon->nBusUs = (a2b_UInt32)((oTwiAfter.nBusTicks - oTwiBefore.nBusTicks) / (adi_a2b_TimerCoreClk() / 1000000u));
+		if (pMon->nBusUs > pMon->nMaxBusUs)
 		{
-			pApp_Info->nBecovfRstCnt = 0;
-			a2b_AppDetectBusDrop(pApp_Info);
+			pMon->nMaxBusUs = pMon->nBusUs;
 		}
+		A2B_APP_DBG_LOG("Link monitor: %u TWI transfers, %u us on the bus (max %u us)\n\r",
+				(unsigned)pMon->nTransfers, (unsigned)pMon->nBusUs, (unsigned)pMon->nMaxBusUs);
 	}
 }
 
+/********************************************************************************/
+/*!
+* \b a2b_AppLinkMonSample
+*
+*  Reads BECNT of every node into the next row of the link health monitor
+* ring and re-evaluates the error trend of each link. A node whose BECNT
+* read fails, or every node when bPresence is set, also has its Vendor Id
+* checked while NODEADR still points to it. A node that does not answer
+* with the expected Vendor Id is flagged as a bus drop.
+*
+* The newer half of the samples is compared with an older half of the same
+* number of samples. A link is flagged as degrading when the newer half holds
+* at least A2B_LINKMON_MIN_ERRORS bit errors and more than the older half, or
+* on average at least A2B_LINKMON_MAX_RATE bit errors per sample; the flag is
+* cleared once the newer half is error free.
+*
+* @param [in] pApp_Info				Application Context Info
+* @param [in] bPresence				Check the Vendor Id of every node
+*
+* @return	None
+* */
+/***********************************************************************************/
+static void a2b_AppLinkMonSample(a2b_App_t *pApp_Info, a2b_Bool bPresence)
+{
+	a2b_AppLinkMon* pMon = &pApp_Info->oLinkMon;
+	struct a2b_StackContext* mCtx;
+	a2b_UInt32 nNodes;
+	a2b_UInt32 i;
+	a2b_UInt32 nRow;
+	a2b_UInt32 nHalf;
+	a2b_UInt32 nNewer;
+	a2b_UInt32 nOlder;
+	a2b_UInt8 nBecnt;
+	a2b_UInt8 nVal;
+	a2b_HResult nRet;
+
+	mCtx = a2b_stackContextFind(pApp_Info->ctx, A2B_NODEADDR_MASTER);
+	if (mCtx == A2B_NULL)
+	{
+		return;
+	}
+
+	nNodes = pApp_Info->pBdd->nodes_count;
+	if (nNodes > (A2B_CONF_MAX_NUM_SLAVE_NODES + 1u))
+	{
+		nNodes = A2B_CONF_MAX_NUM_SLAVE_NODES + 1u;
+	}
+
+	for (i = 0u; i < nNodes; i++)
+	{
+		nBecnt = 0u;
+		nRet = a2b_AppReadReg(mCtx, (a2b_Int16)(i - 1), A2B_REG_BECNT, &nBecnt);
+		if ((bPresence) || (A2B_FAILED(nRet)))
+		{
+			nVal = 0u;
+			(void)a2b_AppReadReg(mCtx, (a2b_Int16)(i - 1), A2B_REG_VENDOR, &nVal);
+			if (nVal != 0xAD)
+			{
+				a2b_AppFlagBusDrop(pApp_Info, (a2b_Int16)(i - 1));
+				return;
+			}
+		}
+		pMon->anBecnt[pMon->nHead][i] = A2B_SUCCEEDED(nRet) ? nBecnt : 0u;
+	}
+
+	pMon->nHead = (a2b_UInt8)((pMon->nHead + 1u) % A2B_LINKMON_DEPTH);
+	if (pMon->nFill < A2B_LINKMON_DEPTH)
+	{
+		pMon->nFill++;
+	}
+
+	/* With an odd fill the oldest row is left out so both halves span the same time */
+	nHalf = pMon->nFill / 2u;
+	for (i = 0u; i < nNodes; i++)
+	{
+		/* Newer half: the last nHalf rows before nHead, older half: the nHalf rows before them */
+		nNewer = 0u;
+		nOlder = 0u;
+		for (nRow = 0u; nRow < (2u * nHalf); nRow++)
+		{
+			nBecnt = pMon->anBecnt[(pMon->nHead + A2B_LINKMON_DEPTH - 1u - nRow) % A2B_LINKMON_DEPTH][i];
+			if (nRow < nHalf)
+			{
+				nNewer += nBecnt;
+			}
+			else
+			{
+				nOlder += nBecnt;
+			}
+		}
+
+		if ((nHalf != 0u) && ((pMon->nDegraded & (1u << i)) == 0u) &&
+			(((nNewer >= A2B_LINKMON_MIN_ERRORS) && (nNewer > nOlder)) ||
+			 (nNewer >= (nHalf * A2B_LINKMON_MAX_RATE))))
+		{
+			pMon->nDegraded |= (1u << i);
+			A2B_APP_LOG("\n\r Link degrading @ Node: %d, %u bit errors in the last %u s, %u in the %u s before",
+					(int)i - 1, (unsigned)nNewer, (unsigned)nHalf, (unsigned)nOlder, (unsigned)nHalf);
+		}
+		else if ((nNewer == 0u) && ((pMon->nDegraded & (1u << i)) != 0u))
+		{
+			pMon->nDegraded &= ~(1u << i);
+			A2B_APP_LOG("\n\r Link recovered @ Node: %d", (int)i - 1);
+		}
+		else
+		{
+			/* Trend unchanged */
+		}
+	}
+}
+
+#ifdef A2BAPP_FAULT_SNAPSHOT
+/********************************************************************************/
+/*!
+* \b a2b_AppFaultSnapshot
+*
+*  This function captures the register map of all nodes and logs the
+* registers that changed since discovery completed, along with the time
+* and TWI transfers the capture took.
+*
+* @param [in] pApp_Info				Application Context Info
+*
+* @return	None
+* */
+/***********************************************************************************/
+static void a2b_AppFaultSnapshot(a2b_App_t *pApp_Info)
+{
+	a2b_DiagRegDiff aDiffs[A2BAPP_FAULT_SNAPSHOT_MAX_DIFFS];
+	ADI_A2B_TWI_STATS oTwiBefore;
+	ADI_A2B_TWI_STATS oTwiAfter;
+	a2b_UInt32 nStartTime;
+	a2b_UInt32 nTime;
+	a2b_UInt16 nDiffs;
+	a2b_UInt16 i;
+
+	adi_a2b_TwiGetStats(&oTwiBefore);
+	nStartTime = a2b_pal_TimerGetSysTimeFunc();
+	(void)a2b_diagSnapshot(pApp_Info->ctx, pApp_Info->nodesDiscovered, &pApp_Info->oSnapFault);
+	nTime = a2b_pal_TimerGetSysTimeFunc() - nStartTime;
+	adi_a2b_TwiGetStats(&oTwiAfter);
+
+	nDiffs = a2b_diagSnapshotDiff(&pApp_Info->oSnapDisc, &pApp_Info->oSnapFault, &aDiffs[0], A2BAPP_FAULT_SNAPSHOT_MAX_DIFFS);
+	A2B_APP_LOG("\n\r Fault snapshot took %u ms, %u TWI transfers: %u registers changed since discovery",
+			(unsigned)nTime, (unsigned)(oTwiAfter.nTransfers - oTwiBefore.nTransfers), (unsigned)nDiffs);
+	for (i = 0u; i < A2B_MIN(nDiffs, A2BAPP_FAULT_SNAPSHOT_MAX_DIFFS); i++)
+	{
+		A2B_APP_LOG("\n\r   Node %d reg 0x%02X: 0x%02X -> 0x%02X", aDiffs[i].nodeAddr,
+				(unsigned)aDiffs[i].reg, (unsigned)aDiffs[i].before, (unsigned)aDiffs[i].after);
+	}
+	A2B_UNUSED(nTime);
+}
+#endif
+
+/********************************************************************************/
+/*!
+* \b a2b_AppFlagBusDrop
+*
+*  This function declares a bus drop at the given node.
+*
+* @param [in] pApp_Info				Application Context Info
+* @param [in] nodeAddr				Node that did not respond
+*
+* @return	None
+* */
+/***********************************************************************************/
+static void a2b_AppFlagBusDrop(a2b_App_t *pApp_Info, a2b_Int16 nodeAddr)
+{
+	pApp_Info->faultNode = (a2b_Int8)nodeAddr;
+	pApp_Info->bBusDropDetected = true;
+
+	pApp_Info->bfaultDone = A2B_TRUE;
+	pApp_Info->bRetry = A2B_TRUE;
+
+	A2B_APP_LOG("\n\r Bus Drop Detected @ Node: %d", nodeAddr);
+}
+
 /********************************************************************************/
 /*!
 * \b a2b_AppDetectBusDrop
@@ -1461,21 +2219,24 @@ static a2b_HResult a2b_AppDetectBusDrop(a2b_App_t *pApp_Info)
 	a2b_UInt32 i;
 	a2b_UInt8 nVal;
 	a2b_HResult nRet = 0;
+	struct a2b_StackContext* mCtx;
+
+	/* Need a master plugin context to do I2C calls */
+	mCtx = a2b_stackContextFind(pApp_Info->ctx, A2B_NODEADDR_MASTER);
+	if (mCtx == A2B_NULL)
+	{
+		/* This should *never* happen */
+		return A2B_MAKE_HRESULT(A2B_SEV_FAILURE, A2B_FAC_DIAG, A2B_EC_INTERNAL);
+	}
+
 	/* Let us detect bus drop fault */
-	for (i = 0; i < pApp_Info->bdd.nodes_count; i++)
+	for (i = 0; i < pApp_Info->pBdd->nodes_count; i++)
 	{
 		nVal = 0;
-		nRet = a2b_AppReadReg(pApp_Info->ctx, (i - 1), A2B_REG_VENDOR, &nVal);
+		nRet = a2b_AppReadReg(mCtx, (i - 1), A2B_REG_VENDOR, &nVal);
 		if (nVal != 0xAD)
 		{
-			pApp_Info->faultNode = (i - 1);
-			pApp_Info->bBusDropDetected = true;
-
-			pApp_Info->bfaultDone = A2B_TRUE;
-			pApp_Info->bRetry = A2B_TRUE;
-
-			A2B_APP_LOG("\n\r Bus Drop Detected @ Node: %d", i-1);
-
+			a2b_AppFlagBusDrop(pApp_Info, (a2b_Int16)(i - 1));
 			break;
 		}
 	}
@@ -1488,7 +2249,7 @@ static a2b_HResult a2b_AppDetectBusDrop(a2b_App_t *pApp_Info)
 
  This function  reads a register value of a particular A2B node
 
- @param [in] ctx				Stack Context
+ @param [in] mCtx			Master plugin context
  @param [in] nodeAddr		Application context Information
  @param [in] reg				A2B register address
  @param [out] value			Value
@@ -1497,33 +2258,22 @@ static a2b_HResult a2b_AppDetectBusDrop(a2b_App_t *pApp_Info)
  1 on Failure
  */
 /***********************************************************************************/
-static a2b_HResult a2b_AppReadReg(struct a2b_StackContext* ctx, a2b_Int16 nodeAddr, a2b_UInt8 reg, a2b_UInt8* value)
+static a2b_HResult a2b_AppReadReg(struct a2b_StackContext* mCtx, a2b_Int16 nodeAddr, a2b_UInt8 reg, a2b_UInt8* value)
 {
 	a2b_HResult result = A2B_RESULT_SUCCESS;
 	a2b_Byte wBuf[1];
-	struct a2b_StackContext* mCtx;
 
-	/* Need a master plugin context to do I2C calls */
-	mCtx = (a2b_StackContext*)a2b_stackContextFind(ctx, A2B_NODEADDR_MASTER);
-	if ( A2B_NULL == mCtx)
+	wBuf[0] = reg;
+
+	if ( A2B_NODEADDR_MASTER == nodeAddr)
 	{
-		/* This should *never* happen */
-		result = A2B_MAKE_HRESULT(A2B_SEV_FAILURE, A2B_FAC_DIAG, A2B_EC_INTERNAL);
+		result = a2b_i2cMasterWriteRead(mCtx, 1u, &wBuf[0u], 1u, value);
 	}
+	/* Else a write/read to a single slave node */
 	else
 	{
-		wBuf[0] = reg;
+		result = a2b_i2cSlaveWriteRead(mCtx, nodeAddr, 1u, &wBuf[0u], 1u, value);
 
-		if ( A2B_NODEADDR_MASTER == nodeAddr)
-		{
-			result = a2b_i2cMasterWriteRead(mCtx, 1u, &wBuf[0u], 1u, value);
-		}
-		/* Else a write/read to a single slave node */
-		else
-		{
-			result = a2b_i2cSlaveWriteRead(mCtx, nodeAddr, 1u, &wBuf[0u], 1u, value);
-
-		}
 	}
 
 	return (result);
@@ -1531,7 +2281,10 @@ static a2b_HResult a2b_AppReadReg(struct a2b_StackContext* ctx, a2b_Int16 nodeAd
 #ifdef ENABLE_INTRRUPT_PROCESS
 /********************************************************************************/
 /*!
- @brief This function process a2b interrupts
+ @brief This function process a2b interrupts once the IRQ pin has fired.
+ 		The pending interrupts are drained with a2b_intrServiceIrq(), which
+ 		fetches the first one in a single TWI transfer. The pin to handler
+ 		latency and the TWI transfers taken are logged for each service.
 
  @param [in] void				Stack Context
 
@@ -1543,10 +2296,21 @@ static a2b_HResult a2b_AppReadReg(struct a2b_StackContext* ctx, a2b_Int16 nodeAd
 static a2b_HResult a2b_processIntrpt(a2b_App_t *pApp_Info)
 {
 	 a2b_HResult nResult = 0;
+	 ADI_A2B_TWI_STATS oTwiBefore;
+	 ADI_A2B_TWI_STATS oTwiAfter;
+	 uint32_t nLatency;
+
 	 if(pApp_Info->bIntrptLatch == 1u)
 	 {
 		 pApp_Info->bIntrptLatch = 0u;
-		 nResult = a2b_intrQueryIrq(pApp_Info->ctx);
+		 nLatency = adi_a2b_TimerCycles() - pApp_Info->nIntrptCycles;
+		 adi_a2b_TwiGetStats(&oTwiBefore);
+		 nResult = a2b_intrServiceIrq(pApp_Info->ctx);
+		 adi_a2b_TwiGetStats(&oTwiAfter);
+		 A2B_APP_DBG_LOG("IRQ serviced %u us after the pin: %u TWI transfers\n\r",
+				 (unsigned)(nLatency / (adi_a2b_TimerCoreClk() / 1000000u)),
+				 (unsigned)(oTwiAfter.nTransfers - oTwiBefore.nTransfers));
+		 A2B_UNUSED(nLatency);
 	 }
 	 return nResult;
 
@@ -1554,6 +2318,33 @@ static a2b_HResult a2b_processIntrpt(a2b_App_t *pApp_Info)
 #endif
 
 #ifdef A2B_THIRD_PARTY
+#ifdef A2B_FEATURE_BDD_STREAM
+/********************************************************************************/
+/*!
+ @brief 		a2b_BddReadFunc reading a BDD from the file opened by a2b_loadBdd
+
+ @param [in]   pCtx 		FILE pointer
+ @param [in]   nOffset 	File offset to read from
+ @param [in]   nLen 		Number of bytes to read
+ @param [out]  pBuf 		Destination
+
+ @return		0 on Success
+ 1 on failure
+ */
+/***********************************************************************************/
+static a2b_HResult A2B_CALL a2b_loadBddFileRead(void* pCtx, a2b_UInt32 nOffset, a2b_UInt32 nLen, a2b_Byte* pBuf)
+{
+	FILE* fp = (FILE*)pCtx;
+
+	if ( ( 0 != fseek(fp, (long)nOffset, SEEK_SET) ) || ( nLen != fread(pBuf, 1, nLen, fp) ) )
+	{
+		return 1u;
+	}
+
+	return 0u;
+}
+#endif
+
 /********************************************************************************/
 /*!
  @brief 		This function  attempts to load a BDD stored as a binary Protobuf encoded file
@@ -1574,7 +2365,9 @@ static a2b_Bool a2b_loadBdd ( const a2b_Char* bddPath, bdd_Network* bdd)
 	a2b_Bool bIsError = A2B_FALSE;
 	a2b_Byte* a2bNetwork = (a2b_Byte*)gA2bNetwork;
 	a2b_UInt32 a2bNetworkLen = gA2bNetworkLen;
+#ifndef A2B_FEATURE_BDD_STREAM
 	a2b_UInt32 nRead;
+#endif
 	FILE* fp = A2B_NULL;
 
 	if ( A2B_NULL != bddPath )
@@ -1592,14 +2385,23 @@ static a2b_Bool a2b_loadBdd ( const a2b_Char* bddPath, bdd_Network* bdd)
 		{
 			fseek(fp, 0L, SEEK_END);
 			a2bNetworkLen = ftell(fp);
+#ifdef A2B_FEATURE_BDD_STREAM
+			/* Decode the file as it is read, no copy of it is kept */
+			if ( !a2b_bddDecodeStream(&a2b_loadBddFileRead, fp, 0u, a2bNetworkLen, bdd) )
+			{
+				bIsError = A2B_TRUE;
+			}
+#else
 			a2bNetwork = malloc(a2bNetworkLen);
 			if ( a2bNetwork == A2B_NULL )
 			{
 				bIsError = A2B_TRUE;
 			}
 			fseek(fp, 0L, SEEK_SET);
+#endif
 		}
 
+#ifndef A2B_FEATURE_BDD_STREAM
 		if ( !bIsError )
 		{
 			nRead = fread(a2bNetwork, 1, a2bNetworkLen, fp);
@@ -1608,10 +2410,16 @@ static a2b_Bool a2b_loadBdd ( const a2b_Char* bddPath, bdd_Network* bdd)
 				bIsError = A2B_TRUE;
 			}
 		}
+#endif
 	}
 
 	/* If no error so far then try to decode the BDD binary */
+#ifdef A2B_FEATURE_BDD_STREAM
+	/* A BDD file has already been decoded as it was read */
+	if ( ( !bIsError ) && ( A2B_NULL == bddPath ) )
+#else
 	if ( !bIsError )
+#endif
 	{
 		if ( !a2b_bddDecode(a2bNetwork, a2bNetworkLen, bdd) )
 		{
@@ -100,11 +100,7 @@ void main(int argc, char *argv[])
 
 	while(1)
 	{
-		if(InputReady)
-		{
-			InputReady = 0;
-			process_audioBlocks();
-		}
+		process_audioBlocks();                 // Process every audio block completed by the SPORT DMA
 		Result = a2b_fault_monitor(&gApp_Info);// Monitor a2b network for faults and initiate re-discovery if enabled
 		if (Result != 0)                       // condition to exit the program
 		{
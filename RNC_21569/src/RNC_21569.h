@@ -28,8 +28,6 @@ to the terms of the associated Analog Devices License Agreement.
 #define SUCCESS                         0
 #define FAILED                          -1
 
-extern uint8_t InputReady;
-
 #define REPORT_ERROR        	       printf
 #define DEBUG_INFORMATION              printf
 
@@ -0,0 +1,235 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : audiostage_host.c
+
+   Description: Host benchmark of the channel-major audio stage
+                (adi_a2b_audiostage.c) against processing straight out of
+                the interleaved SPORT buffers.
+
+                Both variants run the same 32-tap FIR on the 8 DAC channels
+                fed from the first 8 upstream slots:
+
+                strided  - FIR taps read straight from an interleaved
+                           history of upstream frames (stride-20 gathers,
+                           conversion per tap, stride-8 writes)
+                stage    - deinterleave all 20 slots, FIR as a contiguous
+                           dot product per output, interleave the 8 DAC slots
+
+                The deinterleave/interleave pair alone is also timed, and
+                the round trip is checked to be bit exact for 24-bit data.
+
+                audiostage_host [-b frames] [-n blocks]
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    audiostage_host.c ../RNC_21569/a2b_stack/a2bstack-pal/adi_a2b_audiostage.c
+                    -o audiostage_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "adi_a2b_audioconfig.h"
+#include "adi_a2b_audiostage.h"
+
+/*============= D E F I N E S =============*/
+
+#define MAX_FRAMES      (64u)
+#define NUM_PROC_CH     (TxNUM_CHANNELS)
+#define FIR_LEN         (32u)
+#define HIST_LEN        (FIR_LEN - 1u + MAX_FRAMES)
+
+/*============= D A T A =============*/
+
+static int32_t aRxFrame[MAX_FRAMES * RxNUM_CHANNELS];
+static int32_t aTxFrame[MAX_FRAMES * TxNUM_CHANNELS];
+static int32_t aTxRef[MAX_FRAMES * TxNUM_CHANNELS];
+
+static float aRxChannel[RxNUM_CHANNELS][MAX_FRAMES];
+static float aTxChannel[TxNUM_CHANNELS][MAX_FRAMES];
+
+/* Interleaved upstream history for the strided variant, oldest frame first */
+static int32_t aRxHist[HIST_LEN * RxNUM_CHANNELS];
+
+/* Channel-major history for the stage variant, oldest sample first */
+static float aChHist[NUM_PROC_CH][HIST_LEN];
+
+/* FIR coefficients, time reversed (newest tap last) */
+static float aCoef[FIR_LEN];
+
+/*============= C O D E =============*/
+
+static double host_Seconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (double)oTs.tv_sec + ((double)oTs.tv_nsec * 1e-9);
+}
+
+static void host_FillRx(unsigned nFrames)
+{
+    unsigned nIndex;
+
+    for(nIndex = 0u; nIndex < (nFrames * RxNUM_CHANNELS); nIndex++)
+    {
+        /* Random 24-bit samples, left justified */
+        aRxFrame[nIndex] = (int32_t)((uint32_t)((rand() & 0xFFFFFF) - 0x800000) << 8u);
+    }
+}
+
+static float host_Saturate(float fOut)
+{
+    fOut = fOut * ADI_A2B_AUDIO_FULL_SCALE;
+    fOut = (fOut > ADI_A2B_AUDIO_MAX_24BIT) ? ADI_A2B_AUDIO_MAX_24BIT : fOut;
+    fOut = (fOut < ADI_A2B_AUDIO_MIN_24BIT) ? ADI_A2B_AUDIO_MIN_24BIT : fOut;
+    return fOut + ((fOut >= 0.0f) ? 0.5f : -0.5f);
+}
+
+static void host_ProcessStrided(unsigned nFrames)
+{
+    unsigned nFrame, nCh, nTap, nNew = (HIST_LEN - nFrames);
+    float fOut;
+
+    memmove(&aRxHist[0], &aRxHist[nFrames * RxNUM_CHANNELS], nNew * RxNUM_CHANNELS * sizeof(int32_t));
+    memcpy(&aRxHist[nNew * RxNUM_CHANNELS], aRxFrame, nFrames * RxNUM_CHANNELS * sizeof(int32_t));
+
+    for(nFrame = 0u; nFrame < nFrames; nFrame++)
+    {
+        for(nCh = 0u; nCh < NUM_PROC_CH; nCh++)
+        {
+            const int32_t *pIn = &aRxHist[((nNew + nFrame + 1u - FIR_LEN) * RxNUM_CHANNELS) + nCh];
+
+            fOut = 0.0f;
+            for(nTap = 0u; nTap < FIR_LEN; nTap++)
+            {
+                fOut += aCoef[nTap] * ((float)(pIn[nTap * RxNUM_CHANNELS] >> 8) * ADI_A2B_AUDIO_INV_FULL_SCALE);
+            }
+            aTxFrame[(nFrame * TxNUM_CHANNELS) + nCh] = (int32_t)((uint32_t)(int32_t)host_Saturate(fOut) << 8u);
+        }
+    }
+}
+
+static void host_ProcessStage(unsigned nFrames, float * const apRx[], const float * const apTx[])
+{
+    unsigned nFrame, nCh, nTap, nNew = (HIST_LEN - nFrames);
+    const float *pIn;
+    float fOut;
+
+    adi_a2b_AudioDeinterleave(aRxFrame, RxNUM_CHANNELS, 0u, RxNUM_CHANNELS, apRx, nFrames);
+
+    for(nCh = 0u; nCh < NUM_PROC_CH; nCh++)
+    {
+        memmove(&aChHist[nCh][0], &aChHist[nCh][nFrames], nNew * sizeof(float));
+        memcpy(&aChHist[nCh][nNew], aRxChannel[nCh], nFrames * sizeof(float));
+
+        for(nFrame = 0u; nFrame < nFrames; nFrame++)
+        {
+            pIn  = &aChHist[nCh][nNew + nFrame + 1u - FIR_LEN];
+            fOut = 0.0f;
+            for(nTap = 0u; nTap < FIR_LEN; nTap++)
+            {
+                fOut += aCoef[nTap] * pIn[nTap];
+            }
+            aTxChannel[nCh][nFrame] = fOut;
+        }
+    }
+
+    adi_a2b_AudioInterleave(apTx, TxNUM_CHANNELS, aTxFrame, TxNUM_CHANNELS, 0u, nFrames);
+}
+
+int main(int argc, char *argv[])
+{
+    float *apRx[RxNUM_CHANNELS];
+    const float *apTx[TxNUM_CHANNELS];
+    const float *apRxConst[RxNUM_CHANNELS];
+    unsigned nFrames = SAMPLES_PER_PERIOD, nBlocks = 200000u;
+    unsigned nBlock, nCh, nIndex, nTap, nMismatch = 0u;
+    double dT0, dStrided, dStage, dConvert;
+    int nArg;
+
+    for(nArg = 1; (nArg + 1) < argc; nArg += 2)
+    {
+        if(strcmp(argv[nArg], "-b") == 0)      { nFrames = (unsigned)atoi(argv[nArg + 1]); }
+        else if(strcmp(argv[nArg], "-n") == 0) { nBlocks = (unsigned)atoi(argv[nArg + 1]); }
+    }
+    if((nFrames == 0u) || (nFrames > MAX_FRAMES))
+    {
+        fprintf(stderr, "block size must be 1..%u\n", MAX_FRAMES);
+        return 1;
+    }
+
+    for(nCh = 0u; nCh < RxNUM_CHANNELS; nCh++)
+    {
+        apRx[nCh] = aRxChannel[nCh];
+        apRxConst[nCh] = aRxChannel[nCh];
+    }
+    for(nCh = 0u; nCh < TxNUM_CHANNELS; nCh++)
+    {
+        apTx[nCh] = aTxChannel[nCh];
+    }
+    for(nTap = 0u; nTap < FIR_LEN; nTap++)
+    {
+        aCoef[nTap] = 1.0f / (float)(FIR_LEN + nTap);
+    }
+
+    /* Bit exactness: deinterleave then interleave the first 8 slots */
+    host_FillRx(nFrames);
+    adi_a2b_AudioDeinterleave(aRxFrame, RxNUM_CHANNELS, 0u, RxNUM_CHANNELS, apRx, nFrames);
+    adi_a2b_AudioInterleave(apRxConst, TxNUM_CHANNELS, aTxFrame, TxNUM_CHANNELS, 0u, nFrames);
+    for(nIndex = 0u; nIndex < (nFrames * TxNUM_CHANNELS); nIndex++)
+    {
+        if(aTxFrame[nIndex] != aRxFrame[((nIndex / TxNUM_CHANNELS) * RxNUM_CHANNELS) + (nIndex % TxNUM_CHANNELS)])
+        {
+            nMismatch++;
+        }
+    }
+
+    /* Both chains must produce identical DAC frames */
+    host_ProcessStrided(nFrames);
+    memcpy(aTxRef, aTxFrame, sizeof(aTxRef));
+    host_ProcessStage(nFrames, apRx, apTx);
+    if(memcmp(aTxRef, aTxFrame, nFrames * TxNUM_CHANNELS * sizeof(int32_t)) != 0)
+    {
+        nMismatch++;
+    }
+
+    dT0 = host_Seconds();
+    for(nBlock = 0u; nBlock < nBlocks; nBlock++)
+    {
+        host_ProcessStrided(nFrames);
+    }
+    dStrided = host_Seconds() - dT0;
+
+    dT0 = host_Seconds();
+    for(nBlock = 0u; nBlock < nBlocks; nBlock++)
+    {
+        host_ProcessStage(nFrames, apRx, apTx);
+    }
+    dStage = host_Seconds() - dT0;
+
+    dT0 = host_Seconds();
+    for(nBlock = 0u; nBlock < nBlocks; nBlock++)
+    {
+        adi_a2b_AudioDeinterleave(aRxFrame, RxNUM_CHANNELS, 0u, RxNUM_CHANNELS, apRx, nFrames);
+        adi_a2b_AudioInterleave(apTx, TxNUM_CHANNELS, aTxFrame, TxNUM_CHANNELS, 0u, nFrames);
+    }
+    dConvert = host_Seconds() - dT0;
+
+    printf("block %u frames, %u rx slots, %u tx slots, %u blocks\n",
+           nFrames, RxNUM_CHANNELS, TxNUM_CHANNELS, nBlocks);
+    printf("round trip / chain mismatches: %u\n", nMismatch);
+    printf("strided FIR              : %8.1f ns/block\n", (dStrided * 1e9) / (double)nBlocks);
+    printf("stage + FIR              : %8.1f ns/block\n", (dStage * 1e9) / (double)nBlocks);
+    printf("deinterleave + interleave: %8.1f ns/block\n", (dConvert * 1e9) / (double)nBlocks);
+
+    return (nMismatch == 0u) ? 0 : 1;
+}
@@ -0,0 +1,799 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : bddgen_host.c
+
+   Description: Generates stack-app/adi_a2b_bddimage.c, the prebuilt network
+                description used by the application with A2B_APP_BDD_IMAGE.
+                The tool links the SigmaStudio adi_a2b_busconfig.c, runs the
+                same a2b_bcfParse_bdd() and adi_a2b_ParsePeriCfgTable() the
+                application runs in a2b_load(), and writes the results as
+                initialized data: one const bdd_Network and one peripheral
+                download table per chain, the peripheral config units and
+                data they point to, and the target properties. Regenerate
+                the file whenever the BCF changes.
+
+                The bdd_Network initializers are written by walking the
+                nanopb field descriptors (bdd_Network_fields), so they follow
+                bdd_pb2.pb.h without a hand kept field list. They are
+                positional, which the tool checks against the host struct
+                layout, and do not depend on the target's sizes.
+
+                bddgen_host [-o file]   write the image (default stdout)
+                bddgen_host -b          host timing of the parse and sizes
+
+                Built with -DBDDGEN_VERIFY -DA2B_APP_BDD_IMAGE and the
+                generated file, the tool compares the image against a fresh
+                parse instead:
+
+                  ./bddgen_host -o ../RNC_21569/a2b_stack/stack-app/adi_a2b_bddimage.c
+                  ./bddgen_verify
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    [-DBDDGEN_VERIFY -DA2B_APP_BDD_IMAGE]
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    -I../RNC_21569/a2b_stack/stack-app
+                    bddgen_host.c
+                    ../RNC_21569/a2b_stack/stack-app/adi_a2b_busconfig.c
+                    [../RNC_21569/a2b_stack/stack-app/adi_a2b_bddimage.c]
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack-protobuf/src/a2b_bdd_helper.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack-protobuf/src/bdd_pb2.pb.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack-protobuf/src/pb_common.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack-protobuf/src/pb_decode.c
+                    -o bddgen_host (or bddgen_verify)
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "adi_a2b_datatypes.h"
+#include "a2bstack-protobuf/inc/adi_a2b_graphdata.h"
+#include "a2bstack-protobuf/inc/adi_a2b_busconfig.h"
+#include "a2bstack-protobuf/inc/a2b_bdd_helper.h"
+#include "a2bstack-protobuf/inc/pb_common.h"
+#ifdef BDDGEN_VERIFY
+#include "adi_a2b_bddimage.h"
+#endif
+
+/*============= D E F I N E S =============*/
+
+#define HOST_REPEAT         (5u)
+#define HOST_PARSE_LOOPS    (2000u)
+#define HOST_MAX_UNITS      (A2B_CONF_MAX_NUM_MASTER_NODES * (A2B_CONF_MAX_NUM_SLAVE_NODES + 1) * ADI_A2B_MAX_DEVICES_PER_NODE)
+#define HOST_PERI_ROWS      (A2B_CONF_MAX_NUM_SLAVE_NODES + 1)
+#define HOST_MAX_PAD        (8u)     /* largest gap between two members taken as padding */
+
+/*============= D A T A =============*/
+
+/* Peripheral config unit array written to the image */
+typedef struct
+{
+    const ADI_A2B_PERI_CONFIG_UNIT  *pUnits;
+    uint32_t                        nUnits;
+    char                            aName[48];
+} HOST_UNIT_ARRAY;
+
+static bdd_Network aBdd[A2B_CONF_MAX_NUM_MASTER_NODES];
+static ADI_A2B_NODE_PERICONFIG aPeri[A2B_CONF_MAX_NUM_MASTER_NODES][HOST_PERI_ROWS];
+#ifndef BDDGEN_VERIFY
+static HOST_UNIT_ARRAY aUnitArrays[HOST_MAX_UNITS];
+static uint32_t nUnitArrays;
+static int bLayoutError;
+#endif
+
+/*============= C O D E =============*/
+
+static double host_Seconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (double)oTs.tv_sec + ((double)oTs.tv_nsec * 1e-9);
+}
+
+/* What a2b_load() does for one chain on the parse path */
+static void host_Parse(uint8_t nChain)
+{
+    memset(&aPeri[nChain][0], 0, sizeof(aPeri[nChain]));
+    a2b_bcfParse_bdd(&sBusDescription, &aBdd[nChain], nChain);
+    adi_a2b_ParsePeriCfgTable(&sBusDescription, &aPeri[nChain][0], nChain);
+}
+
+#ifndef BDDGEN_VERIFY
+static int host_IsZero(const void *pData, size_t nSize)
+{
+    const uint8_t *pByte = (const uint8_t *)pData;
+    size_t nIdx;
+
+    for(nIdx = 0u; nIdx < nSize; nIdx++)
+    {
+        if(pByte[nIdx] != 0u)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void host_Indent(FILE *pOut, uint32_t nDepth)
+{
+    uint32_t nIdx;
+
+    for(nIdx = 0u; nIdx < nDepth; nIdx++)
+    {
+        fputc('\t', pOut);
+    }
+}
+
+/* Positional initializers need the members in descriptor order, each
+   has_/_count member right before its data and nothing else in between */
+static void host_CheckMember(const uint8_t **ppEnd, const void *pSize, const void *pData,
+                             const pb_field_t *pField)
+{
+    const uint8_t *pEnd = *ppEnd;
+
+    if(pSize != NULL)
+    {
+        if(((const uint8_t *)pSize < pEnd) || ((const uint8_t *)pSize >= (const uint8_t *)pData) ||
+           (((const uint8_t *)pSize - pEnd) >= (ptrdiff_t)HOST_MAX_PAD))
+        {
+            bLayoutError = 1;
+        }
+        pEnd = (const uint8_t *)pSize +
+               ((PB_HTYPE(pField->type) == PB_HTYPE_REPEATED) ? sizeof(pb_size_t) : sizeof(bool));
+    }
+    if(((const uint8_t *)pData < pEnd) || (((const uint8_t *)pData - pEnd) >= (ptrdiff_t)HOST_MAX_PAD))
+    {
+        bLayoutError = 1;
+    }
+    *ppEnd = (const uint8_t *)pData + ((size_t)pField->data_size *
+             ((PB_HTYPE(pField->type) == PB_HTYPE_REPEATED) ? pField->array_size : 1u));
+}
+
+static void host_EmitString(FILE *pOut, const char *pStr, size_t nMax)
+{
+    size_t nIdx;
+
+    fputc('"', pOut);
+    for(nIdx = 0u; (nIdx < nMax) && (pStr[nIdx] != '\0'); nIdx++)
+    {
+        if((pStr[nIdx] == '"') || (pStr[nIdx] == '\\'))
+        {
+            fprintf(pOut, "\\%c", pStr[nIdx]);
+        }
+        else if((pStr[nIdx] < ' ') || (pStr[nIdx] > '~'))
+        {
+            fprintf(pOut, "\\%03o", (unsigned)(uint8_t)pStr[nIdx]);
+        }
+        else
+        {
+            fputc(pStr[nIdx], pOut);
+        }
+    }
+    fputc('"', pOut);
+}
+
+static void host_EmitMessage(FILE *pOut, const pb_field_t *pFields, const void *pMsg,
+                             size_t nSize, uint32_t nDepth);
+
+/* Strings and submessages without a has_ member start with a char array or a struct */
+static int host_IsAggregate(const pb_field_t *pField)
+{
+    return (PB_HTYPE(pField->type) == PB_HTYPE_REQUIRED) &&
+           ((PB_LTYPE(pField->type) == PB_LTYPE_STRING) || (PB_LTYPE(pField->type) == PB_LTYPE_SUBMESSAGE));
+}
+
+static void host_EmitValue(FILE *pOut, const pb_field_t *pField, const void *pData, uint32_t nDepth)
+{
+    switch(PB_LTYPE(pField->type))
+    {
+        case PB_LTYPE_VARINT:
+        case PB_LTYPE_SVARINT:
+            if(pField->data_size == sizeof(int32_t))
+            {
+                fprintf(pOut, "%ld", (long)*(const int32_t *)pData);
+            }
+            else if(pField->data_size == sizeof(int16_t))
+            {
+                fprintf(pOut, "%d", (int)*(const int16_t *)pData);
+            }
+            else if(pField->data_size == sizeof(int8_t))
+            {
+                /* bool */
+                fprintf(pOut, "%u", (unsigned)*(const uint8_t *)pData);
+            }
+            else
+            {
+                bLayoutError = 1;
+            }
+            break;
+
+        case PB_LTYPE_UVARINT:
+        case PB_LTYPE_FIXED32:
+            if(pField->data_size == sizeof(uint32_t))
+            {
+                fprintf(pOut, "0x%lXu", (unsigned long)*(const uint32_t *)pData);
+            }
+            else if(pField->data_size == sizeof(uint16_t))
+            {
+                fprintf(pOut, "0x%Xu", (unsigned)*(const uint16_t *)pData);
+            }
+            else if(pField->data_size == sizeof(uint8_t))
+            {
+                fprintf(pOut, "0x%Xu", (unsigned)*(const uint8_t *)pData);
+            }
+            else
+            {
+                bLayoutError = 1;
+            }
+            break;
+
+        case PB_LTYPE_STRING:
+            host_EmitString(pOut, (const char *)pData, pField->data_size);
+            break;
+
+        case PB_LTYPE_SUBMESSAGE:
+            host_EmitMessage(pOut, (const pb_field_t *)pField->ptr, pData, pField->data_size, nDepth);
+            break;
+
+        default:
+            /* bytes, 64 bit and extension fields are not used by bdd_pb2 */
+            bLayoutError = 1;
+            break;
+    }
+}
+
+static void host_EmitMessage(FILE *pOut, const pb_field_t *pFields, const void *pMsg,
+                             size_t nSize, uint32_t nDepth)
+{
+    pb_field_iter_t oIter;
+    const pb_field_t *pField;
+    const uint8_t *pEnd = (const uint8_t *)pMsg;
+    const uint8_t *pElem;
+    uint32_t nLast, nIdx;
+    pb_size_t nCount;
+
+    if(!pb_field_iter_begin(&oIter, pFields, (void *)pMsg))
+    {
+        fprintf(pOut, "{ 0 }");
+        return;
+    }
+    /* A zero message is left to the zero fill, unless its first member is
+       an aggregate that would need braces of its own */
+    if(host_IsZero(pMsg, nSize) && !host_IsAggregate(&pFields[0]))
+    {
+        fprintf(pOut, "{ 0 }");
+        return;
+    }
+
+    fprintf(pOut, "{\n");
+    do
+    {
+        pField = oIter.pos;
+        host_CheckMember(&pEnd, (PB_HTYPE(pField->type) == PB_HTYPE_REQUIRED) ? NULL : oIter.pSize,
+                         oIter.pData, pField);
+
+        host_Indent(pOut, nDepth + 1u);
+        if(PB_HTYPE(pField->type) == PB_HTYPE_OPTIONAL)
+        {
+            fprintf(pOut, "%u, ", (unsigned)*(const bool *)oIter.pSize);
+        }
+        if(PB_HTYPE(pField->type) == PB_HTYPE_REPEATED)
+        {
+            nCount = *(const pb_size_t *)oIter.pSize;
+            fprintf(pOut, "%u, ", (unsigned)nCount);
+
+            /* Trailing zero entries are left to the zero fill */
+            pElem = (const uint8_t *)oIter.pData;
+            nLast = pField->array_size;
+            while((nLast > nCount) &&
+                  host_IsZero(&pElem[(nLast - 1u) * pField->data_size], pField->data_size))
+            {
+                nLast--;
+            }
+
+            if(nLast == 0u)
+            {
+                if((PB_LTYPE(pField->type) == PB_LTYPE_STRING) || (PB_LTYPE(pField->type) == PB_LTYPE_SUBMESSAGE))
+                {
+                    fprintf(pOut, "{ ");
+                    host_EmitValue(pOut, pField, pElem, nDepth + 1u);
+                    fprintf(pOut, " }");
+                }
+                else
+                {
+                    fprintf(pOut, "{ 0 }");
+                }
+            }
+            else if(PB_LTYPE(pField->type) == PB_LTYPE_SUBMESSAGE)
+            {
+                fprintf(pOut, "{\n");
+                for(nIdx = 0u; nIdx < nLast; nIdx++)
+                {
+                    host_Indent(pOut, nDepth + 2u);
+                    fprintf(pOut, "/* [%u] */ ", nIdx);
+                    host_EmitValue(pOut, pField, &pElem[nIdx * pField->data_size], nDepth + 2u);
+                    fprintf(pOut, ",\n");
+                }
+                host_Indent(pOut, nDepth + 1u);
+                fprintf(pOut, "}");
+            }
+            else
+            {
+                fprintf(pOut, "{ ");
+                for(nIdx = 0u; nIdx < nLast; nIdx++)
+                {
+                    host_EmitValue(pOut, pField, &pElem[nIdx * pField->data_size], nDepth + 1u);
+                    fprintf(pOut, (nIdx + 1u < nLast) ? ", " : " }");
+                }
+            }
+        }
+        else
+        {
+            host_EmitValue(pOut, pField, oIter.pData, nDepth + 1u);
+        }
+        fprintf(pOut, ",\t/* %u */\n", (unsigned)pField->tag);
+    } while(pb_field_iter_next(&oIter));
+
+    if(((const uint8_t *)pMsg + nSize) - pEnd >= (ptrdiff_t)HOST_MAX_PAD)
+    {
+        bLayoutError = 1;
+    }
+    host_Indent(pOut, nDepth);
+    fprintf(pOut, "}");
+}
+
+static const char *host_OpCode(a2b_UInt32 nOpCode)
+{
+    switch(nOpCode)
+    {
+        case A2B_WRITE_OP:  return "A2B_WRITE_OP";
+        case A2B_READ_OP:   return "A2B_READ_OP";
+        case A2B_DEALY_OP:  return "A2B_DEALY_OP";
+        default:            return NULL;
+    }
+}
+
+/* Config units and their data, once per distinct unit array of the BCF */
+static int host_EmitUnits(FILE *pOut, uint8_t nChain, const ADI_A2B_PERI_DEVICE_CONFIG *pDev)
+{
+    const ADI_A2B_PERI_CONFIG_UNIT *pUnit;
+    HOST_UNIT_ARRAY *pArray;
+    uint32_t nIdx, nByte;
+
+    for(nIdx = 0u; nIdx < nUnitArrays; nIdx++)
+    {
+        if(aUnitArrays[nIdx].pUnits == pDev->paPeriConfigUnit)
+        {
+            return 0;
+        }
+    }
+    if((nUnitArrays >= HOST_MAX_UNITS) || (pDev->nNumPeriConfigUnit == 0u))
+    {
+        fprintf(stderr, "unsupported peripheral config (node 0x%X, device 0x%X)\n",
+                (unsigned)pDev->nConnectedNodeID, (unsigned)pDev->nDeviceAddress);
+        return 1;
+    }
+
+    pArray = &aUnitArrays[nUnitArrays++];
+    pArray->pUnits = pDev->paPeriConfigUnit;
+    pArray->nUnits = pDev->nNumPeriConfigUnit;
+    (void)snprintf(pArray->aName, sizeof(pArray->aName), "gaPeriCfg_%u_%X_%X",
+                   (unsigned)nChain, (unsigned)pDev->nConnectedNodeID, (unsigned)pDev->nDeviceAddress);
+
+    for(nIdx = 0u; nIdx < pArray->nUnits; nIdx++)
+    {
+        pUnit = &pArray->pUnits[nIdx];
+        fprintf(pOut, " ADI_A2B_MEM_PERI_CONFIG_DATA\nstatic\tuint8 %s_%u_Data[%lu] =\n{\n\t",
+                pArray->aName, nIdx, (unsigned long)((pUnit->nDataCount != 0u) ? pUnit->nDataCount : 1u));
+        for(nByte = 0u; nByte < pUnit->nDataCount; nByte++)
+        {
+            fprintf(pOut, "0x%Xu%s", (unsigned)pUnit->paConfigData[nByte],
+                    (nByte + 1u < pUnit->nDataCount) ? ",\t" : "");
+        }
+        fprintf(pOut, "%s\n};\n\n", (pUnit->nDataCount == 0u) ? "0u" : "");
+    }
+
+    fprintf(pOut, " ADI_A2B_MEM_PERI_CONFIG_DATA\nstatic\tADI_A2B_PERI_CONFIG_UNIT %s_Unit[%lu] =\n{\n",
+            pArray->aName, (unsigned long)pArray->nUnits);
+    for(nIdx = 0u; nIdx < pArray->nUnits; nIdx++)
+    {
+        pUnit = &pArray->pUnits[nIdx];
+        if(host_OpCode(pUnit->eOpCode) == NULL)
+        {
+            fprintf(stderr, "unknown peripheral op code %lu\n", (unsigned long)pUnit->eOpCode);
+            return 1;
+        }
+        fprintf(pOut, "\t{%s,\t0x%lXu,\t0x%lXu,\t0x%lXu,\t0x%lXu,\t&%s_%u_Data[0]}%s\n",
+                host_OpCode(pUnit->eOpCode), (unsigned long)pUnit->nAddrWidth,
+                (unsigned long)pUnit->nAddr, (unsigned long)pUnit->nDataWidth,
+                (unsigned long)pUnit->nDataCount, pArray->aName, nIdx,
+                (nIdx + 1u < pArray->nUnits) ? "," : "");
+    }
+    fprintf(pOut, "};\n\n");
+
+    return 0;
+}
+
+static const char *host_UnitName(const ADI_A2B_PERI_CONFIG_UNIT *pUnits)
+{
+    uint32_t nIdx;
+
+    for(nIdx = 0u; nIdx < nUnitArrays; nIdx++)
+    {
+        if(aUnitArrays[nIdx].pUnits == pUnits)
+        {
+            return aUnitArrays[nIdx].aName;
+        }
+    }
+    return NULL;
+}
+
+static void host_EmitPeriRow(FILE *pOut, const ADI_A2B_NODE_PERICONFIG *pRow)
+{
+    const ADI_A2B_PERI_DEVICE_CONFIG *pDev;
+    uint32_t nDev, nLast;
+
+    nLast = ADI_A2B_MAX_DEVICES_PER_NODE;
+    while((nLast > 0u) && host_IsZero(&pRow->aDeviceConfig[nLast - 1u], sizeof(pRow->aDeviceConfig[0])))
+    {
+        nLast--;
+    }
+
+    fprintf(pOut, "\t\t{\n\t\t\t{\n");
+    for(nDev = 0u; nDev < nLast; nDev++)
+    {
+        pDev = &pRow->aDeviceConfig[nDev];
+        fprintf(pOut, "\t\t\t\t{ 0x%lXu, %uu, 0x%lXu, %luu, ", (unsigned long)pDev->nDeviceAddress,
+                (unsigned)pDev->bActive, (unsigned long)pDev->nConnectedNodeID,
+                (unsigned long)pDev->nNumPeriConfigUnit);
+        if(pDev->paPeriConfigUnit == NULL)
+        {
+            fprintf(pOut, "NULL_PTR },\n");
+        }
+        else
+        {
+            fprintf(pOut, "&%s_Unit[0] },\n", host_UnitName(pDev->paPeriConfigUnit));
+        }
+    }
+    if(nLast == 0u)
+    {
+        fprintf(pOut, "\t\t\t\t{ 0 }\n");
+    }
+    fprintf(pOut, "\t\t\t},\n\t\t\t%uu\n\t\t},\n", (unsigned)pRow->nNumConfig);
+}
+
+static int host_Generate(FILE *pOut)
+{
+    const ADI_A2B_NETWORK_CONFIG *pTgt = &sBusDescription.sTargetProperties;
+    uint8_t nChains = sBusDescription.nNumMasterNode;
+    uint32_t nMaxRows = 0u;
+    uint8_t nChain;
+    uint32_t nRow, nDev;
+
+    if((nChains == 0u) || (nChains > A2B_CONF_MAX_NUM_MASTER_NODES))
+    {
+        fprintf(stderr, "BCF has %u chains\n", (unsigned)nChains);
+        return 1;
+    }
+
+    fprintf(pOut,
+        "/*******************************************************************************\n"
+        "Copyright (c) 2020 - Analog Devices Inc. All Rights Reserved.\n"
+        "This software is proprietary & confidential to Analog Devices, Inc.\n"
+        "and its licensors.\n"
+        "******************************************************************************\n"
+        "* @file: adi_a2b_bddimage.c\n"
+        "* @brief: Prebuilt network description of adi_a2b_busconfig.c (A2B_APP_BDD_IMAGE)\n"
+        "* THIS FILE IS GENERATED BY tools/bddgen_host.c FROM adi_a2b_busconfig.c.\n"
+        "* REGENERATE IT WHENEVER THE BCF CHANGES, DO NOT EDIT.\n"
+        "*****************************************************************************/\n\n"
+        "/*============= I N C L U D E S =============*/\n\n"
+        "#include \"adi_a2b_datatypes.h\"\n"
+        "#include \"a2bstack-protobuf/inc/adi_a2b_graphdata.h\"\n"
+        "#include \"a2bstack-protobuf/inc/adi_a2b_busconfig.h\"\n"
+        "#include \"a2bapp_defs.h\"\n"
+        "#include \"adi_a2b_bddimage.h\"\n\n"
+        "#ifdef A2B_APP_BDD_IMAGE\n\n");
+
+    for(nChain = 0u; nChain < nChains; nChain++)
+    {
+        host_Parse(nChain);
+        if(aBdd[nChain].nodes_count > nMaxRows)
+        {
+            nMaxRows = aBdd[nChain].nodes_count;
+        }
+    }
+    fprintf(pOut,
+        "#if (A2B_CONF_MAX_NUM_MASTER_NODES < %u) || ((A2B_CONF_MAX_NUM_SLAVE_NODES + 1) < %lu)\n"
+        "#error \"adi_a2b_bddimage.c needs more master or slave nodes than conf.h allows\"\n"
+        "#endif\n\n",
+        (unsigned)nChains, (unsigned long)nMaxRows);
+
+    fprintf(pOut, "/*============= D A T A =============*/\n\n");
+    fprintf(pOut, "/* Peripheral configuration units */\n\n");
+    for(nChain = 0u; nChain < nChains; nChain++)
+    {
+        for(nRow = 0u; nRow < HOST_PERI_ROWS; nRow++)
+        {
+            for(nDev = 0u; nDev < ADI_A2B_MAX_DEVICES_PER_NODE; nDev++)
+            {
+                if((aPeri[nChain][nRow].aDeviceConfig[nDev].paPeriConfigUnit != NULL) &&
+                   (host_EmitUnits(pOut, nChain, &aPeri[nChain][nRow].aDeviceConfig[nDev]) != 0))
+                {
+                    return 1;
+                }
+            }
+        }
+    }
+
+    fprintf(pOut, "/* Number of chains (master nodes) in the BCF */\n"
+                  "const a2b_UInt8 gnA2bBddImageNumChains = %uu;\n\n", (unsigned)nChains);
+
+    fprintf(pOut, "/* Network control guidance. The peripheral pointers are left out,\n"
+                  "   gaA2bBddImagePeriTable carries the peripheral configuration. */\n"
+                  "ADI_A2B_NETWORK_CONFIG goA2bBddImageTargetProperties =\n{\n"
+                  "\t.eDiscoveryMode = %uu,\n\t.bLineDiagnostics = %uu,\n"
+                  "\t.bAutoDiscCriticalFault = %uu,\n\t.nAttemptsCriticalFault = %uu,\n"
+                  "\t.bAutoRediscOnFault = %uu,\n\t.nNumPeriDevice = %uu,\n"
+                  "\t.nRediscInterval = %uu,\n\t.nDiscoveryStartDelay = %uu\n};\n\n",
+            (unsigned)pTgt->eDiscoveryMode, (unsigned)pTgt->bLineDiagnostics,
+            (unsigned)pTgt->bAutoDiscCriticalFault, (unsigned)pTgt->nAttemptsCriticalFault,
+            (unsigned)pTgt->bAutoRediscOnFault, (unsigned)pTgt->nNumPeriDevice,
+            (unsigned)pTgt->nRediscInterval, (unsigned)pTgt->nDiscoveryStartDelay);
+
+    fprintf(pOut, "/* Peripheral download table of each chain, row 0 is the target processor */\n"
+                  "const ADI_A2B_NODE_PERICONFIG gaA2bBddImagePeriTable[][A2B_CONF_MAX_NUM_SLAVE_NODES + 1] =\n{\n");
+    for(nChain = 0u; nChain < nChains; nChain++)
+    {
+        fprintf(pOut, "\t/* chain %u */\n\t{\n", (unsigned)nChain);
+        for(nRow = 0u; nRow < (uint32_t)aBdd[nChain].nodes_count; nRow++)
+        {
+            host_EmitPeriRow(pOut, &aPeri[nChain][nRow]);
+        }
+        fprintf(pOut, "\t},\n");
+    }
+    fprintf(pOut, "};\n\n");
+
+    fprintf(pOut, "/* Network description of each chain, as a2b_bcfParse_bdd() builds it */\n"
+                  "const bdd_Network gaA2bBddImage[] =\n{\n");
+    for(nChain = 0u; nChain < nChains; nChain++)
+    {
+        fprintf(pOut, "\t/* chain %u */\n\t", (unsigned)nChain);
+        host_EmitMessage(pOut, bdd_Network_fields, &aBdd[nChain], sizeof(bdd_Network), 1u);
+        fprintf(pOut, ",\n");
+    }
+    fprintf(pOut, "};\n\n#endif /* A2B_APP_BDD_IMAGE */\n");
+
+    if(bLayoutError)
+    {
+        fprintf(stderr, "bdd_Network does not match its field descriptors, image not usable\n");
+        return 1;
+    }
+    return 0;
+}
+#endif
+
+/* Host bytes of the BCF data reachable from sBusDescription */
+static size_t host_BcfSize(size_t *pPeriData)
+{
+    const ADI_A2B_MASTER_SLAVE_CONFIG *pChain;
+    const ADI_A2B_SLAVE_NCD *pSlave;
+    const A2B_PERIPHERAL_DEVICE_CONFIG *pDev;
+    size_t nSize = sizeof(ADI_A2B_BCD);
+    uint32_t nChain, nSlave, nDev, nUnit;
+
+    *pPeriData = 0u;
+    for(nDev = 0u; nDev < sBusDescription.sTargetProperties.nNumPeriDevice; nDev++)
+    {
+        pDev = sBusDescription.sTargetProperties.apPeriConfig[nDev];
+        nSize += sizeof(*pDev);
+        for(nUnit = 0u; (pDev->paPeriConfigUnit != NULL) && (nUnit < pDev->nNumPeriConfigUnit); nUnit++)
+        {
+            *pPeriData += sizeof(ADI_A2B_PERI_CONFIG_UNIT) + pDev->paPeriConfigUnit[nUnit].nDataCount;
+        }
+    }
+    for(nChain = 0u; nChain < sBusDescription.nNumMasterNode; nChain++)
+    {
+        pChain = sBusDescription.apNetworkconfig[nChain];
+        nSize += sizeof(*pChain) + sizeof(*pChain->pMasterConfig);
+        for(nSlave = 0u; nSlave < pChain->nNumSlaveNode; nSlave++)
+        {
+            pSlave = pChain->apSlaveConfig[nSlave];
+            nSize += sizeof(*pSlave);
+            for(nDev = 0u; nDev < pSlave->nNumPeriDevice; nDev++)
+            {
+                pDev = pSlave->apPeriConfig[nDev];
+                nSize += sizeof(*pDev);
+                for(nUnit = 0u; (pDev->paPeriConfigUnit != NULL) && (nUnit < pDev->nNumPeriConfigUnit); nUnit++)
+                {
+                    *pPeriData += sizeof(ADI_A2B_PERI_CONFIG_UNIT) + pDev->paPeriConfigUnit[nUnit].nDataCount;
+                }
+            }
+        }
+    }
+
+    return nSize + *pPeriData;
+}
+
+static int host_Bench(void)
+{
+    uint8_t nChains = sBusDescription.nNumMasterNode;
+    uint32_t nRepeat, nLoop;
+    uint8_t nChain;
+    double dT0, dUs, dBest = 0.0;
+    size_t nBcf, nPeriData, nWork, nImage;
+
+    for(nRepeat = 0u; nRepeat < HOST_REPEAT; nRepeat++)
+    {
+        dT0 = host_Seconds();
+        for(nLoop = 0u; nLoop < HOST_PARSE_LOOPS; nLoop++)
+        {
+            for(nChain = 0u; nChain < nChains; nChain++)
+            {
+                host_Parse(nChain);
+            }
+        }
+        dUs = ((host_Seconds() - dT0) * 1e6) / (double)HOST_PARSE_LOOPS;
+        dBest = ((nRepeat == 0u) || (dUs < dBest)) ? dUs : dBest;
+    }
+
+    nBcf = host_BcfSize(&nPeriData);
+    nWork = nChains * (sizeof(bdd_Network) + sizeof(aPeri[0]));
+    nImage = nWork + nPeriData + sizeof(ADI_A2B_NETWORK_CONFIG) + 1u;
+
+    printf("BCF parse in a2b_load(), host timings, best of %u x %u, %u chain(s)\n",
+           HOST_REPEAT, HOST_PARSE_LOOPS, (unsigned)nChains);
+    printf("  a2b_bcfParse_bdd + adi_a2b_ParsePeriCfgTable   %8.2f us\n", dBest);
+    printf("  with A2B_APP_BDD_IMAGE                          pointer set up only\n");
+    printf("data, host sizes in bytes (pointers are 8 bytes here)\n");
+    printf("  parse path  adi_a2b_busconfig.c data            %8lu\n", (unsigned long)nBcf);
+    printf("              bdd + peripheral table (RAM)        %8lu\n", (unsigned long)nWork);
+    printf("              total                               %8lu\n", (unsigned long)(nBcf + nWork));
+    printf("  image       adi_a2b_bddimage.c data             %8lu\n", (unsigned long)nImage);
+    printf("              of which const                      %8lu\n", (unsigned long)nWork);
+    printf("  saved                                           %8ld\n", (long)(nBcf + nWork) - (long)nImage);
+
+    return 0;
+}
+
+#ifdef BDDGEN_VERIFY
+static int host_VerifyPeri(const ADI_A2B_NODE_PERICONFIG *pRef, const ADI_A2B_NODE_PERICONFIG *pImg)
+{
+    const ADI_A2B_PERI_DEVICE_CONFIG *pA, *pB;
+    uint32_t nDev, nUnit;
+
+    if(pRef->nNumConfig != pImg->nNumConfig)
+    {
+        return 1;
+    }
+    for(nDev = 0u; nDev < ADI_A2B_MAX_DEVICES_PER_NODE; nDev++)
+    {
+        pA = &pRef->aDeviceConfig[nDev];
+        pB = &pImg->aDeviceConfig[nDev];
+        if((pA->nDeviceAddress != pB->nDeviceAddress) || (pA->bActive != pB->bActive) ||
+           (pA->nConnectedNodeID != pB->nConnectedNodeID) ||
+           (pA->nNumPeriConfigUnit != pB->nNumPeriConfigUnit) ||
+           ((pA->paPeriConfigUnit == NULL) != (pB->paPeriConfigUnit == NULL)))
+        {
+            return 1;
+        }
+        for(nUnit = 0u; (pA->paPeriConfigUnit != NULL) && (nUnit < pA->nNumPeriConfigUnit); nUnit++)
+        {
+            if((memcmp(&pA->paPeriConfigUnit[nUnit], &pB->paPeriConfigUnit[nUnit],
+                       offsetof(ADI_A2B_PERI_CONFIG_UNIT, paConfigData)) != 0) ||
+               (memcmp(pA->paPeriConfigUnit[nUnit].paConfigData, pB->paPeriConfigUnit[nUnit].paConfigData,
+                       pA->paPeriConfigUnit[nUnit].nDataCount) != 0))
+            {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int host_Verify(void)
+{
+    const ADI_A2B_NETWORK_CONFIG *pTgt = &sBusDescription.sTargetProperties;
+    const ADI_A2B_NETWORK_CONFIG *pImgTgt = &goA2bBddImageTargetProperties;
+    uint8_t nChain;
+    uint32_t nRow;
+    int nErrors = 0;
+
+    if(gnA2bBddImageNumChains != sBusDescription.nNumMasterNode)
+    {
+        printf("chain count differs\n");
+        return 1;
+    }
+    if((pTgt->eDiscoveryMode != pImgTgt->eDiscoveryMode) ||
+       (pTgt->bLineDiagnostics != pImgTgt->bLineDiagnostics) ||
+       (pTgt->bAutoDiscCriticalFault != pImgTgt->bAutoDiscCriticalFault) ||
+       (pTgt->nAttemptsCriticalFault != pImgTgt->nAttemptsCriticalFault) ||
+       (pTgt->bAutoRediscOnFault != pImgTgt->bAutoRediscOnFault) ||
+       (pTgt->nNumPeriDevice != pImgTgt->nNumPeriDevice) ||
+       (pTgt->nRediscInterval != pImgTgt->nRediscInterval) ||
+       (pTgt->nDiscoveryStartDelay != pImgTgt->nDiscoveryStartDelay))
+    {
+        printf("target properties differ\n");
+        nErrors++;
+    }
+
+    for(nChain = 0u; nChain < gnA2bBddImageNumChains; nChain++)
+    {
+        /* The parse clears the network first, so padding compares as zero */
+        host_Parse(nChain);
+        if(memcmp(&aBdd[nChain], &gaA2bBddImage[nChain], sizeof(bdd_Network)) != 0)
+        {
+            printf("chain %u: bdd_Network differs\n", (unsigned)nChain);
+            nErrors++;
+        }
+        for(nRow = 0u; nRow < HOST_PERI_ROWS; nRow++)
+        {
+            if(host_VerifyPeri(&aPeri[nChain][nRow], &gaA2bBddImagePeriTable[nChain][nRow]) != 0)
+            {
+                printf("chain %u: peripheral table row %lu differs\n", (unsigned)nChain, (unsigned long)nRow);
+                nErrors++;
+            }
+        }
+    }
+
+    printf("%s: image %s the BCF parse (%u chain(s))\n", (nErrors == 0) ? "ok" : "FAIL",
+           (nErrors == 0) ? "matches" : "does not match", (unsigned)gnA2bBddImageNumChains);
+
+    return (nErrors == 0) ? 0 : 1;
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+    const char *pPath = NULL;
+    int nArg, bBench = 0;
+    FILE *pOut = stdout;
+    int nRet;
+
+    for(nArg = 1; nArg < argc; nArg++)
+    {
+        if(strcmp(argv[nArg], "-b") == 0) { bBench = 1; }
+        else if((strcmp(argv[nArg], "-o") == 0) && ((nArg + 1) < argc)) { pPath = argv[++nArg]; }
+        else
+        {
+            fprintf(stderr, "usage: bddgen_host [-o file] | -b\n");
+            return 2;
+        }
+    }
+
+    if(bBench)
+    {
+        return host_Bench();
+    }
+
+#ifdef BDDGEN_VERIFY
+    (void)pPath;
+    (void)pOut;
+    (void)nRet;
+    return host_Verify();
+#else
+    if(pPath != NULL)
+    {
+        pOut = fopen(pPath, "w");
+        if(pOut == NULL)
+        {
+            fprintf(stderr, "cannot open %s\n", pPath);
+            return 2;
+        }
+    }
+    nRet = host_Generate(pOut);
+    if(pOut != stdout)
+    {
+        fclose(pOut);
+    }
+    return nRet;
+#endif
+}
@@ -0,0 +1,410 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : bddstream_host.c
+
+   Description: Checks and measures a2b_bddDecodeStream() (A2B_FEATURE_BDD_STREAM)
+                against the buffered a2b_bddDecode() on the host.
+
+                The tool parses chain 0 of the linked adi_a2b_busconfig.c with
+                a2b_bcfParse_bdd(), protobuf encodes the result by walking the
+                nanopb descriptors (bdd_Network_fields) and appends an unknown
+                field so the skip path is exercised too. The encoded BDD is
+                placed in a fake EEPROM and decoded both ways:
+
+                  buffered  one read of the whole BDD into a heap buffer, then
+                            a2b_bddDecode(), as a2b_get_bddFromEEPROM() and
+                            a2b_loadBdd() do without the feature
+                  streamed  a2b_bddDecodeStream() reading the fake EEPROM in
+                            A2B_BDD_STREAM_CHUNK_SIZE pieces
+
+                Both results must be identical and must re-encode to the
+                original bytes. The report gives the host decode time, the
+                buffer sizes of both paths, the EEPROM transactions and a
+                modelled I2C time (400 kHz, 9 bit clocks per byte, start,
+                device address, 2 address bytes and repeated start per
+                transaction). The I2C time is arithmetic, not a measurement.
+
+                bddstream_host          verify and report
+
+                Rebuild with -DA2B_BDD_STREAM_CHUNK_SIZE=<n> to try other
+                chunk sizes (a size below the longest field exercises the
+                direct read past the chunk buffer).
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64 -DA2B_FEATURE_BDD_STREAM
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    -I../RNC_21569/a2b_stack/stack-app
+                    bddstream_host.c
+                    ../RNC_21569/a2b_stack/stack-app/adi_a2b_busconfig.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack-protobuf/src/a2b_bdd_helper.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack-protobuf/src/bdd_pb2.pb.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack-protobuf/src/pb_common.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack-protobuf/src/pb_decode.c
+                    -o bddstream_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "adi_a2b_datatypes.h"
+#include "a2bstack-protobuf/inc/adi_a2b_graphdata.h"
+#include "a2bstack-protobuf/inc/adi_a2b_busconfig.h"
+#include "a2bstack-protobuf/inc/a2b_bdd_helper.h"
+#include "a2bstack-protobuf/inc/pb_common.h"
+
+#ifndef A2B_FEATURE_BDD_STREAM
+#error "build with -DA2B_FEATURE_BDD_STREAM"
+#endif
+
+/*============= D E F I N E S =============*/
+
+#define HOST_REPEAT         (5u)
+#define HOST_DECODE_LOOPS   (2000u)
+#define HOST_MAX_ENCODED    (16384u)
+#define HOST_UNKNOWN_TAG    (2047u)  /* not used by bdd_Network */
+#define HOST_UNKNOWN_LEN    (40u)
+#define HOST_EEPROM_BDD     (64u)    /* EEPROM offset of the BDD, past the headers */
+#define HOST_EEPROM_SCRATCH (4096u)  /* A2B_BDD_EEPROM_SCRATCH_SIZE without the feature */
+#define HOST_STREAM_SCRATCH (17u)    /* A2B_BDD_EEPROM_SCRATCH_SIZE with the feature */
+
+#define HOST_I2C_HZ         (400000.0)
+#define HOST_I2C_TXN_BYTES  (4u)     /* device address W, 2 address bytes, device address R */
+
+/*============= D A T A =============*/
+
+/* Encoder output */
+typedef struct
+{
+    uint8_t     *pBuf;
+    size_t      nLen;
+    size_t      nMax;
+    int         bOverflow;
+} HOST_OSTREAM;
+
+static bdd_Network oRef;
+static bdd_Network oBuffered;
+static bdd_Network oStreamed;
+static uint8_t aEncoded[HOST_MAX_ENCODED];
+static uint8_t aReencoded[HOST_MAX_ENCODED];
+static uint8_t aEeprom[HOST_EEPROM_BDD + HOST_MAX_ENCODED];
+
+/* Fake EEPROM statistics */
+static uint32_t nTxns;
+static uint32_t nTxnBytes;
+
+/*============= C O D E =============*/
+
+static double host_Seconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (double)oTs.tv_sec + ((double)oTs.tv_nsec * 1e-9);
+}
+
+static void host_Put(HOST_OSTREAM *pOs, const uint8_t *pData, size_t nLen)
+{
+    if((pOs->nLen + nLen) > pOs->nMax)
+    {
+        pOs->bOverflow = 1;
+        return;
+    }
+    if(pOs->pBuf != NULL)
+    {
+        memcpy(&pOs->pBuf[pOs->nLen], pData, nLen);
+    }
+    pOs->nLen += nLen;
+}
+
+static void host_PutVarint(HOST_OSTREAM *pOs, uint64_t nValue)
+{
+    uint8_t aByte[10];
+    size_t nLen = 0u;
+
+    do
+    {
+        aByte[nLen] = (uint8_t)(nValue & 0x7Fu);
+        nValue >>= 7u;
+        if(nValue != 0u)
+        {
+            aByte[nLen] |= 0x80u;
+        }
+        nLen++;
+    } while(nValue != 0u);
+
+    host_Put(pOs, aByte, nLen);
+}
+
+static void host_PutTag(HOST_OSTREAM *pOs, uint32_t nTag, uint32_t nWireType)
+{
+    host_PutVarint(pOs, ((uint64_t)nTag << 3u) | nWireType);
+}
+
+static int64_t host_Signed(const void *pData, size_t nSize)
+{
+    if(nSize == sizeof(int32_t)) { return *(const int32_t *)pData; }
+    if(nSize == sizeof(int16_t)) { return *(const int16_t *)pData; }
+    return *(const int8_t *)pData;
+}
+
+static uint64_t host_Unsigned(const void *pData, size_t nSize)
+{
+    if(nSize == sizeof(uint32_t)) { return *(const uint32_t *)pData; }
+    if(nSize == sizeof(uint16_t)) { return *(const uint16_t *)pData; }
+    return *(const uint8_t *)pData;
+}
+
+static int host_EncodeMessage(HOST_OSTREAM *pOs, const pb_field_t *pFields, const void *pMsg);
+
+static int host_EncodeValue(HOST_OSTREAM *pOs, const pb_field_t *pField, const void *pData)
+{
+    HOST_OSTREAM oSize = { NULL, 0u, HOST_MAX_ENCODED, 0 };
+    int64_t nSigned;
+    uint32_t nFixed;
+    size_t nLen;
+
+    switch(PB_LTYPE(pField->type))
+    {
+        case PB_LTYPE_VARINT:
+            host_PutTag(pOs, pField->tag, PB_WT_VARINT);
+            host_PutVarint(pOs, (uint64_t)host_Signed(pData, pField->data_size));
+            break;
+
+        case PB_LTYPE_UVARINT:
+            host_PutTag(pOs, pField->tag, PB_WT_VARINT);
+            host_PutVarint(pOs, host_Unsigned(pData, pField->data_size));
+            break;
+
+        case PB_LTYPE_SVARINT:
+            nSigned = host_Signed(pData, pField->data_size);
+            host_PutTag(pOs, pField->tag, PB_WT_VARINT);
+            host_PutVarint(pOs, ((uint64_t)nSigned << 1u) ^ (uint64_t)(nSigned >> 63));
+            break;
+
+        case PB_LTYPE_FIXED32:
+            nFixed = (uint32_t)host_Unsigned(pData, pField->data_size);
+            host_PutTag(pOs, pField->tag, PB_WT_32BIT);
+            host_Put(pOs, (const uint8_t *)&nFixed, 4u);  /* little endian host */
+            break;
+
+        case PB_LTYPE_STRING:
+            nLen = strnlen((const char *)pData, pField->data_size);
+            host_PutTag(pOs, pField->tag, PB_WT_STRING);
+            host_PutVarint(pOs, nLen);
+            host_Put(pOs, (const uint8_t *)pData, nLen);
+            break;
+
+        case PB_LTYPE_SUBMESSAGE:
+            if(host_EncodeMessage(&oSize, (const pb_field_t *)pField->ptr, pData) != 0)
+            {
+                return 1;
+            }
+            host_PutTag(pOs, pField->tag, PB_WT_STRING);
+            host_PutVarint(pOs, oSize.nLen);
+            return host_EncodeMessage(pOs, (const pb_field_t *)pField->ptr, pData);
+
+        default:
+            /* bytes, 64 bit and extension fields are not used by bdd_pb2 */
+            return 1;
+    }
+
+    return 0;
+}
+
+/* Protobuf encoding of a decoded message, repeated fields unpacked */
+static int host_EncodeMessage(HOST_OSTREAM *pOs, const pb_field_t *pFields, const void *pMsg)
+{
+    pb_field_iter_t oIter;
+    const pb_field_t *pField;
+    const uint8_t *pElem;
+    uint32_t nCount, nIdx;
+
+    if(!pb_field_iter_begin(&oIter, pFields, (void *)pMsg))
+    {
+        return 0;
+    }
+
+    do
+    {
+        pField = oIter.pos;
+        if(PB_ATYPE(pField->type) != PB_ATYPE_STATIC)
+        {
+            return 1;
+        }
+
+        switch(PB_HTYPE(pField->type))
+        {
+            case PB_HTYPE_REQUIRED:
+                nCount = 1u;
+                break;
+            case PB_HTYPE_OPTIONAL:
+                nCount = *(const bool *)oIter.pSize ? 1u : 0u;
+                break;
+            case PB_HTYPE_REPEATED:
+                nCount = *(const pb_size_t *)oIter.pSize;
+                break;
+            default:
+                return 1;
+        }
+
+        pElem = (const uint8_t *)oIter.pData;
+        for(nIdx = 0u; nIdx < nCount; nIdx++)
+        {
+            if(host_EncodeValue(pOs, pField, pElem) != 0)
+            {
+                return 1;
+            }
+            pElem += pField->data_size;
+        }
+    } while(pb_field_iter_next(&oIter));
+
+    return pOs->bOverflow;
+}
+
+/* a2b_BddReadFunc over the fake EEPROM */
+static a2b_HResult A2B_CALL host_EepromRead(void *pCtx, a2b_UInt32 nOffset, a2b_UInt32 nLen, a2b_Byte *pBuf)
+{
+    (void)pCtx;
+
+    if((nOffset + nLen) > sizeof(aEeprom))
+    {
+        return 1u;
+    }
+    memcpy(pBuf, &aEeprom[nOffset], nLen);
+    nTxns++;
+    nTxnBytes += nLen;
+
+    return 0u;
+}
+
+/* The buffered path: one read of the whole BDD, then a2b_bddDecode() */
+static int host_DecodeBuffered(uint32_t nLen, bdd_Network *pOut)
+{
+    a2b_Byte *pBuf = malloc(nLen);
+    int nRet = 1;
+
+    if(pBuf != NULL)
+    {
+        if((host_EepromRead(NULL, HOST_EEPROM_BDD, nLen, pBuf) == 0u) &&
+           a2b_bddDecode(pBuf, nLen, pOut))
+        {
+            nRet = 0;
+        }
+        free(pBuf);
+    }
+    return nRet;
+}
+
+static int host_DecodeStreamed(uint32_t nLen, bdd_Network *pOut)
+{
+    return a2b_bddDecodeStream(&host_EepromRead, NULL, HOST_EEPROM_BDD, nLen, pOut) ? 0 : 1;
+}
+
+static double host_Time(int (*pfDecode)(uint32_t, bdd_Network *), uint32_t nLen, bdd_Network *pOut)
+{
+    uint32_t nRepeat, nLoop;
+    double dT0, dUs, dBest = 0.0;
+
+    for(nRepeat = 0u; nRepeat < HOST_REPEAT; nRepeat++)
+    {
+        dT0 = host_Seconds();
+        for(nLoop = 0u; nLoop < HOST_DECODE_LOOPS; nLoop++)
+        {
+            (void)pfDecode(nLen, pOut);
+        }
+        dUs = ((host_Seconds() - dT0) * 1e6) / (double)HOST_DECODE_LOOPS;
+        dBest = ((nRepeat == 0u) || (dUs < dBest)) ? dUs : dBest;
+    }
+    return dBest;
+}
+
+/* Modelled I2C time of nTxn random reads returning nBytes in total */
+static double host_I2cUs(uint32_t nTxn, uint32_t nBytes)
+{
+    double dBits = (double)nTxn * ((HOST_I2C_TXN_BYTES * 9.0) + 2.0) + ((double)nBytes * 9.0);
+    return (dBits * 1e6) / HOST_I2C_HZ;
+}
+
+int main(void)
+{
+    HOST_OSTREAM oOs = { aEncoded, 0u, HOST_MAX_ENCODED, 0 };
+    HOST_OSTREAM oRe = { aReencoded, 0u, HOST_MAX_ENCODED, 0 };
+    uint8_t aUnknown[HOST_UNKNOWN_LEN];
+    uint32_t nLen, nBufTxns, nStrTxns;
+    double dBufUs, dStrUs;
+
+    a2b_bcfParse_bdd(&sBusDescription, &oRef, 0u);
+
+    /* Unknown field first, then the BDD */
+    memset(aUnknown, 0xA5, sizeof(aUnknown));
+    host_PutTag(&oOs, HOST_UNKNOWN_TAG, PB_WT_STRING);
+    host_PutVarint(&oOs, sizeof(aUnknown));
+    host_Put(&oOs, aUnknown, sizeof(aUnknown));
+    if(host_EncodeMessage(&oOs, bdd_Network_fields, &oRef) != 0)
+    {
+        fprintf(stderr, "cannot encode the BDD\n");
+        return 1;
+    }
+    nLen = (uint32_t)oOs.nLen;
+    memcpy(&aEeprom[HOST_EEPROM_BDD], aEncoded, nLen);
+
+    memset(&oBuffered, 0, sizeof(oBuffered));
+    memset(&oStreamed, 0, sizeof(oStreamed));
+    nTxns = 0u; nTxnBytes = 0u;
+    if(host_DecodeBuffered(nLen, &oBuffered) != 0)
+    {
+        fprintf(stderr, "buffered decode failed\n");
+        return 1;
+    }
+    nBufTxns = nTxns;
+    nTxns = 0u; nTxnBytes = 0u;
+    if(host_DecodeStreamed(nLen, &oStreamed) != 0)
+    {
+        fprintf(stderr, "streamed decode failed\n");
+        return 1;
+    }
+    nStrTxns = nTxns;
+
+    if(memcmp(&oBuffered, &oStreamed, sizeof(bdd_Network)) != 0)
+    {
+        fprintf(stderr, "streamed and buffered decodes differ\n");
+        return 1;
+    }
+    if((host_EncodeMessage(&oRe, bdd_Network_fields, &oStreamed) != 0) ||
+       (oRe.nLen != (nLen - HOST_UNKNOWN_LEN - 3u)) ||
+       (memcmp(aReencoded, &aEncoded[HOST_UNKNOWN_LEN + 3u], oRe.nLen) != 0))
+    {
+        fprintf(stderr, "decoded BDD does not re-encode to the original\n");
+        return 1;
+    }
+
+    dBufUs = host_Time(&host_DecodeBuffered, nLen, &oBuffered);
+    dStrUs = host_Time(&host_DecodeStreamed, nLen, &oStreamed);
+
+    printf("BDD decode, chain 0 of adi_a2b_busconfig.c, %u nodes, %lu encoded bytes\n",
+           (unsigned)oStreamed.nodes_count, (unsigned long)nLen);
+    printf("  streamed and buffered decodes identical, re-encode matches\n");
+    printf("decode, host timings, best of %u x %u\n", HOST_REPEAT, HOST_DECODE_LOOPS);
+    printf("  buffered  a2b_bddDecode                       %8.2f us\n", dBufUs);
+    printf("  streamed  a2b_bddDecodeStream, %3u byte chunk  %8.2f us\n",
+           (unsigned)A2B_BDD_STREAM_CHUNK_SIZE, dStrUs);
+    printf("buffers in bytes\n");
+    printf("  buffered  heap, a2b_get_bddFromEEPROM scratch  %8u\n", (unsigned)HOST_EEPROM_SCRATCH);
+    printf("            heap, a2b_loadBdd file copy          %8lu\n", (unsigned long)nLen);
+    printf("  streamed  heap, a2b_get_bddFromEEPROM scratch  %8u\n", (unsigned)HOST_STREAM_SCRATCH);
+    printf("            heap, a2b_loadBdd                    %8u\n", 0u);
+    printf("            stack, chunk buffer                  %8u\n", (unsigned)A2B_BDD_STREAM_CHUNK_SIZE);
+    printf("  decoded bdd_Network (fixed arrays, both paths) %8lu\n", (unsigned long)sizeof(bdd_Network));
+    printf("BDD read from EEPROM, modelled at 400 kHz I2C (not measured)\n");
+    printf("  buffered  %4u transaction(s)                  %8.0f us\n", (unsigned)nBufTxns, host_I2cUs(nBufTxns, nLen));
+    printf("  streamed  %4u transaction(s)                  %8.0f us\n", (unsigned)nStrTxns, host_I2cUs(nStrTxns, nLen));
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : blocksize_host.c
+
+   Description: Host measurement of the per-block overhead of the audio chain
+                (deinterleave, FxLMS, interleave) for the block sizes that
+                adi_a2b_AudioSetBlockSize() accepts.
+
+                For each block size the chain processes the same amount of
+                audio. The table lists the cost per block and per frame, the
+                per-block overhead relative to the largest block, and the
+                input to output latency of the DMA ring.
+
+                blocksize_host [-s seconds] [-all]
+
+                -all measures every size from 1 to ADI_A2B_AUDIO_MAX_FRAMES,
+                otherwise a representative subset is measured.
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    blocksize_host.c
+                    ../RNC_21569/a2b_stack/a2bstack-pal/adi_a2b_audiostage.c
+                    ../RNC_21569/a2b_stack/a2bstack-pal/adi_a2b_fxlms.c
+                    -o blocksize_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "adi_a2b_audioconfig.h"
+#include "adi_a2b_audiostage.h"
+#include "adi_a2b_fxlms.h"
+
+/*============= D E F I N E S =============*/
+
+#define MAX_FRAMES      ADI_A2B_AUDIO_MAX_FRAMES
+
+/*============= D A T A =============*/
+
+static ADI_A2B_FXLMS oFxlms;
+
+static int32_t aRxFrame[MAX_FRAMES * RxNUM_CHANNELS];
+static int32_t aTxFrame[MAX_FRAMES * TxNUM_CHANNELS];
+static float aRxChannel[RxNUM_CHANNELS][MAX_FRAMES];
+static float aTxChannel[TxNUM_CHANNELS][MAX_FRAMES];
+
+static const unsigned aSubset[] = { 1u, 2u, 4u, 8u, 12u, 16u, 24u, 32u, 48u, 64u };
+
+/*============= C O D E =============*/
+
+static double host_Seconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (double)oTs.tv_sec + ((double)oTs.tv_nsec * 1e-9);
+}
+
+static void host_Setup(unsigned nFrames)
+{
+    ADI_A2B_FXLMS_CONFIG oConfig;
+    float aPath[ADI_A2B_FXLMS_SEC_LEN];
+    unsigned nSpk, nErr, nTap;
+
+    oConfig.fStepSize       = 0.5f;
+    oConfig.fLeakage        = 0.99999f;
+    oConfig.fRegularization = 1.0e-6f;
+    oConfig.fPowerSmoothing = 0.9f;
+    oConfig.nSecDelay       = DMA_NUM_DESC * nFrames;
+    oConfig.bAdapt          = A2B_TRUE;
+    adi_a2b_FxlmsInit(&oFxlms, &oConfig);
+
+    /* Full secondary path matrix: worst case cost */
+    for(nSpk = 0u; nSpk < ADI_A2B_FXLMS_NUM_SPK; nSpk++)
+    {
+        for(nErr = 0u; nErr < ADI_A2B_FXLMS_NUM_ERR; nErr++)
+        {
+            for(nTap = 0u; nTap < ADI_A2B_FXLMS_SEC_LEN; nTap++)
+            {
+                aPath[nTap] = 0.1f / (float)(1u + nTap + nSpk + nErr);
+            }
+            (void)adi_a2b_FxlmsSetSecondaryPath(&oFxlms, nSpk, nErr, aPath, ADI_A2B_FXLMS_SEC_LEN);
+        }
+    }
+}
+
+static double host_Measure(unsigned nFrames, unsigned nTotalFrames)
+{
+    float *apRx[RxNUM_CHANNELS];
+    const float *apTx[TxNUM_CHANNELS];
+    const float *apRef[ADI_A2B_FXLMS_NUM_REF], *apErr[ADI_A2B_FXLMS_NUM_ERR];
+    float *apOut[ADI_A2B_FXLMS_NUM_SPK];
+    unsigned nCh, nBlock, nBlocks = nTotalFrames / nFrames;
+    double dT0;
+
+    for(nCh = 0u; nCh < RxNUM_CHANNELS; nCh++)
+    {
+        apRx[nCh] = aRxChannel[nCh];
+    }
+    for(nCh = 0u; nCh < TxNUM_CHANNELS; nCh++)
+    {
+        apTx[nCh] = aTxChannel[nCh];
+    }
+    for(nCh = 0u; nCh < ADI_A2B_FXLMS_NUM_REF; nCh++)
+    {
+        apRef[nCh] = aRxChannel[nCh];
+    }
+    for(nCh = 0u; nCh < ADI_A2B_FXLMS_NUM_ERR; nCh++)
+    {
+        apErr[nCh] = aRxChannel[ADI_A2B_FXLMS_NUM_REF + nCh];
+    }
+    for(nCh = 0u; nCh < ADI_A2B_FXLMS_NUM_SPK; nCh++)
+    {
+        apOut[nCh] = aTxChannel[nCh];
+    }
+
+    host_Setup(nFrames);
+
+    dT0 = host_Seconds();
+    for(nBlock = 0u; nBlock < nBlocks; nBlock++)
+    {
+        adi_a2b_AudioDeinterleave(aRxFrame, RxNUM_CHANNELS, 0u, RxNUM_CHANNELS, apRx, nFrames);
+        adi_a2b_FxlmsProcess(&oFxlms, apRef, apErr, apOut, nFrames);
+        adi_a2b_AudioInterleave(apTx, TxNUM_CHANNELS, aTxFrame, TxNUM_CHANNELS, 0u, nFrames);
+    }
+
+    return ((host_Seconds() - dT0) * 1e9) / (double)nBlocks;
+}
+
+int main(int argc, char *argv[])
+{
+    static double aNsPerBlock[MAX_FRAMES + 1u];
+    unsigned aSizes[MAX_FRAMES];
+    unsigned nSizes = 0u, nIndex, nFrames, nTotalFrames;
+    float fSeconds = 2.0f;
+    double dNsPerFrameMax;
+    int nArg, bAll = 0;
+
+    for(nArg = 1; nArg < argc; nArg++)
+    {
+        if((strcmp(argv[nArg], "-s") == 0) && ((nArg + 1) < argc)) { fSeconds = (float)atof(argv[++nArg]); }
+        else if(strcmp(argv[nArg], "-all") == 0)                 { bAll = 1; }
+    }
+
+    if(bAll != 0)
+    {
+        for(nFrames = ADI_A2B_AUDIO_MIN_FRAMES; nFrames <= MAX_FRAMES; nFrames++)
+        {
+            aSizes[nSizes++] = nFrames;
+        }
+    }
+    else
+    {
+        for(nIndex = 0u; nIndex < (sizeof(aSubset) / sizeof(aSubset[0])); nIndex++)
+        {
+            aSizes[nSizes++] = aSubset[nIndex];
+        }
+    }
+
+    /* Random 24-bit left-justified input */
+    for(nIndex = 0u; nIndex < (MAX_FRAMES * RxNUM_CHANNELS); nIndex++)
+    {
+        aRxFrame[nIndex] = (int32_t)((uint32_t)((rand() & 0xFFFF) - 0x8000) << 12u);
+    }
+
+    nTotalFrames = (unsigned)(fSeconds * (float)SAMPLE_RATE);
+    for(nIndex = 0u; nIndex < nSizes; nIndex++)
+    {
+        aNsPerBlock[aSizes[nIndex]] = host_Measure(aSizes[nIndex], nTotalFrames);
+    }
+    dNsPerFrameMax = aNsPerBlock[MAX_FRAMES] / (double)MAX_FRAMES;
+    if(aNsPerBlock[MAX_FRAMES] == 0.0)
+    {
+        dNsPerFrameMax = host_Measure(MAX_FRAMES, nTotalFrames) / (double)MAX_FRAMES;
+    }
+
+    printf("FxLMS %u ref, %u err, %u spk, %u ctrl taps, %u sec taps; %u DMA descriptors; host timings\n",
+           ADI_A2B_FXLMS_NUM_REF, ADI_A2B_FXLMS_NUM_ERR, ADI_A2B_FXLMS_NUM_SPK,
+           ADI_A2B_FXLMS_CTRL_LEN, ADI_A2B_FXLMS_SEC_LEN, DMA_NUM_DESC);
+    printf("frames  latency ms  period us   ns/block   ns/frame  overhead ns/block  load %%\n");
+    for(nIndex = 0u; nIndex < nSizes; nIndex++)
+    {
+        double dPeriodNs;
+
+        nFrames   = aSizes[nIndex];
+        dPeriodNs = ((double)nFrames * 1e9) / (double)SAMPLE_RATE;
+        printf("%6u  %10.3f  %9.1f  %9.0f  %9.1f  %17.0f  %6.1f\n",
+               nFrames,
+               ((double)(DMA_NUM_DESC * nFrames) * 1e3) / (double)SAMPLE_RATE,
+               dPeriodNs / 1e3,
+               aNsPerBlock[nFrames],
+               aNsPerBlock[nFrames] / (double)nFrames,
+               aNsPerBlock[nFrames] - (dNsPerFrameMax * (double)nFrames),
+               (aNsPerBlock[nFrames] * 100.0) / dPeriodNs);
+    }
+
+    return 0;
+}
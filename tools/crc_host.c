@@ -0,0 +1,221 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : crc_host.c
+
+   Description: Checks the table driven a2b_crc8()/a2b_crc8Cont() and
+                a2b_crc32()/a2b_crc32Cont() (a2bstack util.c) and measures
+                their throughput on the host.
+
+                The reference CRC-8 is the previous bit by bit a2b_doCrc8(),
+                kept here verbatim; the reference CRC-32 is the textbook
+                reflected shift/xor loop. Both table versions must match
+                them on the catalogue check string, on random buffers of
+                every length up to 300 bytes at random start offsets (the
+                slice loop and its tail), and when a buffer is split at a
+                random point and continued with the Cont variant.
+
+                The throughput report runs each routine over the same
+                random buffer and prints MB/s. These are host figures and
+                only the ratios carry over to the target.
+
+                crc_host [-n MiB] [-s seed]
+
+                Rebuild with -DA2B_CONF_CRC_SLICES=1u to measure the single
+                table variant.
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    crc_host.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/util.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/stringbuffer.c
+                    -o crc_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "a2bstack/inc/a2b/util.h"
+
+/*============= D E F I N E S =============*/
+
+#define CRC_HOST_MAX_LEN        (300u)
+#define CRC_HOST_TRIALS         (20000u)
+
+/*============= D A T A =============*/
+
+static volatile a2b_UInt32 gnSink;
+
+/*============= C O D E =============*/
+
+/* a2b_doCrc8() as it was in util.c */
+static a2b_UInt8 ref_doCrc8(a2b_UInt8 crc_in, a2b_UInt8 data)
+{
+    a2b_UInt8 crc_out;
+    a2b_UInt8 xor_mask;
+    a2b_UInt8 i, j;
+
+    crc_out = crc_in;
+    for ( i = 0u; i < 8u; i++ )
+    {
+        j = 7u - i;
+        xor_mask = (a2b_UInt8)((((a2b_UInt32)crc_out & 0x80u) >> (a2b_UInt32)7u) ^ (((a2b_UInt32)data >> (a2b_UInt32)j) & (a2b_UInt32)1u));
+        xor_mask = xor_mask | (a2b_UInt8)(((a2b_UInt32)xor_mask << (a2b_UInt32)1u) | ((a2b_UInt32)xor_mask << (a2b_UInt32)2u));
+        crc_out  = (a2b_UInt8)((((a2b_UInt32)crc_out << (a2b_UInt32)1u) & (a2b_UInt32)0xffu) ^ (a2b_UInt32)xor_mask);
+    }
+
+    return crc_out;
+}
+
+static a2b_UInt8 ref_crc8(const a2b_UInt8* p, a2b_UInt32 n)
+{
+    a2b_UInt8 crc = 0xFFu;
+    a2b_UInt32 i;
+
+    for (i = 0u; i < n; i++)
+    {
+        crc = ref_doCrc8(crc, p[i]);
+    }
+    return crc;
+}
+
+static a2b_UInt32 ref_crc32(const a2b_UInt8* p, a2b_UInt32 n)
+{
+    a2b_UInt32 crc = 0xFFFFFFFFu;
+    a2b_UInt32 i;
+    a2b_UInt32 b;
+
+    for (i = 0u; i < n; i++)
+    {
+        crc ^= p[i];
+        for (b = 0u; b < 8u; b++)
+        {
+            crc = (crc & 1u) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+        }
+    }
+    return ~crc;
+}
+
+static double now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static int verify(unsigned seed)
+{
+    static const a2b_UInt8 check[] = "123456789";
+    a2b_UInt8 buf[CRC_HOST_MAX_LEN + 8u];
+    a2b_UInt32 t, i, len, off, cut;
+    int nErr = 0;
+
+    /* Catalogue check values: CRC-32 0xCBF43926, CRC-8 as the bitwise code */
+    if ((a2b_crc32(check, 0u, 9u) != 0xCBF43926u) ||
+        (a2b_crc8(check, 0u, 9u) != ref_crc8(check, 9u)))
+    {
+        printf("check string: crc8 0x%02X (ref 0x%02X), crc32 0x%08X (ref 0xCBF43926)\n",
+               (unsigned)a2b_crc8(check, 0u, 9u), (unsigned)ref_crc8(check, 9u),
+               (unsigned)a2b_crc32(check, 0u, 9u));
+        nErr++;
+    }
+
+    srand(seed);
+    for (t = 0u; (t < CRC_HOST_TRIALS) && (nErr < 10); t++)
+    {
+        len = (a2b_UInt32)rand() % (CRC_HOST_MAX_LEN + 1u);
+        off = (a2b_UInt32)rand() % 8u;
+        for (i = 0u; i < sizeof(buf); i++)
+        {
+            buf[i] = (a2b_UInt8)rand();
+        }
+        cut = (len != 0u) ? ((a2b_UInt32)rand() % len) : 0u;
+
+        /* a2b_crc8Cont() returns early for startIdx > crcLen, so the
+         * CRC-8 runs move the pointer rather than startIdx */
+        if ((a2b_crc8(&buf[off], 0u, len) != ref_crc8(&buf[off], len)) ||
+            (a2b_crc8Cont(&buf[off + cut], a2b_crc8(&buf[off], 0u, cut), 0u, len - cut) != ref_crc8(&buf[off], len)) ||
+            (a2b_crc32(buf, off, len) != ref_crc32(&buf[off], len)) ||
+            (a2b_crc32Cont(buf, a2b_crc32(buf, off, cut), off + cut, len - cut) != ref_crc32(&buf[off], len)))
+        {
+            printf("mismatch: len %u offset %u split %u\n", (unsigned)len, (unsigned)off, (unsigned)cut);
+            nErr++;
+        }
+    }
+
+    printf("verify: %u random buffers, %s\n", (unsigned)t, (nErr == 0) ? "bit-exact" : "MISMATCH");
+    return nErr;
+}
+
+static void bench(a2b_UInt32 nMiB, unsigned seed)
+{
+    a2b_UInt32 nLen = nMiB * 1024u * 1024u;
+    a2b_UInt8* buf = (a2b_UInt8*)malloc(nLen);
+    double t0, tRef8, tTab8, tRef32, tTab32;
+    a2b_UInt32 i;
+
+    if (buf == NULL)
+    {
+        printf("out of memory\n");
+        return;
+    }
+    srand(seed);
+    for (i = 0u; i < nLen; i++)
+    {
+        buf[i] = (a2b_UInt8)rand();
+    }
+
+    t0 = now_sec(); gnSink = ref_crc8(buf, nLen);          tRef8 = now_sec() - t0;
+    t0 = now_sec(); gnSink = a2b_crc8(buf, 0u, nLen);      tTab8 = now_sec() - t0;
+    t0 = now_sec(); gnSink = ref_crc32(buf, nLen);         tRef32 = now_sec() - t0;
+    t0 = now_sec(); gnSink = a2b_crc32(buf, 0u, nLen);     tTab32 = now_sec() - t0;
+
+    printf("throughput over %u MiB, A2B_CONF_CRC_SLICES %u:\n", (unsigned)nMiB, (unsigned)A2B_CONF_CRC_SLICES);
+    printf("  crc8  bitwise %8.1f MB/s   table %8.1f MB/s   x%.1f\n",
+           nLen / tRef8 / 1e6, nLen / tTab8 / 1e6, tRef8 / tTab8);
+    printf("  crc32 bitwise %8.1f MB/s   table %8.1f MB/s   x%.1f\n",
+           nLen / tRef32 / 1e6, nLen / tTab32 / 1e6, tRef32 / tTab32);
+
+    free(buf);
+}
+
+int main(int argc, char* argv[])
+{
+    a2b_UInt32 nMiB = 16u;
+    unsigned seed = 1u;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            nMiB = (a2b_UInt32)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+        {
+            seed = (unsigned)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            printf("usage: crc_host [-n MiB] [-s seed]\n");
+            return 1;
+        }
+    }
+
+    if (verify(seed) != 0)
+    {
+        return 1;
+    }
+    bench(nMiB, seed);
+
+    return 0;
+}
@@ -0,0 +1,325 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : fxlms_host.c
+
+   Description: Host build of the FxLMS engine (adi_a2b_fxlms.c). Runs the
+                same kernel block by block against either a synthetic
+                acoustic plant or recorded sensor data and reports the
+                cost per block and the convergence of the error power.
+
+                Synthetic plant (default):
+                    fxlms_host [-s seconds] [-b frames] [-d delay] [-mu step]
+
+                Recorded data (speakers off captures, 48 kHz float32):
+                    fxlms_host -ref ref.f32 -dist dist.f32 -sec sec.f32 [-d delay]
+
+                    ref.f32   interleaved ADI_A2B_FXLMS_NUM_REF channels
+                    dist.f32  interleaved ADI_A2B_FXLMS_NUM_ERR channels
+                              (error microphones with speakers off)
+                    sec.f32   identified secondary paths after the bulk
+                              delay, NUM_SPK x NUM_ERR x SEC_LEN taps
+
+                The error microphones are simulated as e = d + S * y, with
+                the true secondary path equal to the loaded model. The
+                synthetic primary path lags the secondary path by PRILEAD
+                samples so that the plant is causally controllable.
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    fxlms_host.c ../RNC_21569/a2b_stack/a2bstack-pal/adi_a2b_fxlms.c
+                    -lm -o fxlms_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "adi_a2b_fxlms.h"
+
+/*============= D E F I N E S =============*/
+
+#define NREF        ADI_A2B_FXLMS_NUM_REF
+#define NERR        ADI_A2B_FXLMS_NUM_ERR
+#define NSPK        ADI_A2B_FXLMS_NUM_SPK
+#define SECLEN      ADI_A2B_FXLMS_SEC_LEN
+#define PRILEN      (24u)                               /* Synthetic primary path taps */
+#define PRILEAD     (8u)                                /* Primary path delay beyond the secondary path */
+#define XHIST       (ADI_A2B_FXLMS_MAX_SEC_DELAY + PRILEAD + PRILEN + ADI_A2B_FXLMS_MAX_FRAMES)
+#define YHIST       (ADI_A2B_FXLMS_MAX_SEC_DELAY + SECLEN + ADI_A2B_FXLMS_MAX_FRAMES)
+
+/*============= D A T A =============*/
+
+static ADI_A2B_FXLMS oFxlms;
+
+static float aSecTrue[NSPK][NERR][SECLEN];              /* Natural order */
+static float aPrimary[NERR][NREF][PRILEN];
+static float aYHist[NSPK][YHIST];                       /* Speaker output history, oldest first */
+static float aXHist[NREF][XHIST];                       /* Reference history, oldest first */
+
+static float aRef[NREF][ADI_A2B_FXLMS_MAX_FRAMES];
+static float aDist[NERR][ADI_A2B_FXLMS_MAX_FRAMES];
+static float aErr[NERR][ADI_A2B_FXLMS_MAX_FRAMES];
+static float aOut[NSPK][ADI_A2B_FXLMS_MAX_FRAMES];
+
+/*============= C O D E =============*/
+
+static unsigned long long host_Ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int nLo, nHi;
+    __asm__ __volatile__("rdtsc" : "=a"(nLo), "=d"(nHi));
+    return ((unsigned long long)nHi << 32) | nLo;
+#else
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return ((unsigned long long)oTs.tv_sec * 1000000000ull) + (unsigned long long)oTs.tv_nsec;
+#endif
+}
+
+static float host_Rand(void)
+{
+    return ((float)rand() / (float)RAND_MAX) * 2.0f - 1.0f;
+}
+
+static void host_RandomPath(float aCoef[], unsigned nLen, float fDecay)
+{
+    unsigned nTap;
+    float fEnv = 1.0f;
+
+    for(nTap = 0u; nTap < nLen; nTap++)
+    {
+        aCoef[nTap] = 0.5f * host_Rand() * fEnv;
+        fEnv *= fDecay;
+    }
+}
+
+static long host_ReadFile(const char *pName, float **ppData)
+{
+    FILE *pFile = fopen(pName, "rb");
+    long nBytes;
+
+    if(pFile == NULL)
+    {
+        return -1;
+    }
+    fseek(pFile, 0, SEEK_END);
+    nBytes = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+    *ppData = (float *)malloc((size_t)nBytes);
+    if((*ppData == NULL) || (fread(*ppData, 1, (size_t)nBytes, pFile) != (size_t)nBytes))
+    {
+        fclose(pFile);
+        return -1;
+    }
+    fclose(pFile);
+    return nBytes / (long)sizeof(float);
+}
+
+int main(int argc, char *argv[])
+{
+    ADI_A2B_FXLMS_CONFIG oConfig;
+    const float *apRef[NREF], *apErr[NERR];
+    float *apOut[NSPK];
+    float *pRefData = NULL, *pDistData = NULL, *pSecData = NULL;
+    float fSeconds = 10.0f, fRefState[NREF];
+    double dErrPow = 0.0, dDistPow = 0.0;
+    unsigned long long nT0, nTicks, nTicksMax = 0ull, nTicksSum = 0ull;
+    unsigned nFrames = SAMPLES_PER_PERIOD, nDelay = 2u * SAMPLES_PER_PERIOD;
+    unsigned nSpk, nErr, nRef, nTap, nFrame, nBlock, nBlocks, nBlocksPerSec;
+    long nRecFrames = 0;
+    int nArg;
+
+    memset(&oConfig, 0, sizeof(oConfig));
+    oConfig.fStepSize       = 0.5f;
+    oConfig.fLeakage        = 0.99999f;
+    oConfig.fRegularization = 1e-6f;
+    oConfig.fPowerSmoothing = 0.9f;
+    oConfig.bAdapt          = A2B_TRUE;
+
+    for(nArg = 1; nArg < argc - 1; nArg += 2)
+    {
+        if(strcmp(argv[nArg], "-s") == 0)         { fSeconds = (float)atof(argv[nArg + 1]); }
+        else if(strcmp(argv[nArg], "-b") == 0)    { nFrames = (unsigned)atoi(argv[nArg + 1]); }
+        else if(strcmp(argv[nArg], "-d") == 0)    { nDelay = (unsigned)atoi(argv[nArg + 1]); }
+        else if(strcmp(argv[nArg], "-mu") == 0)   { oConfig.fStepSize = (float)atof(argv[nArg + 1]); }
+        else if(strcmp(argv[nArg], "-ref") == 0)  { nRecFrames = host_ReadFile(argv[nArg + 1], &pRefData) / (long)NREF; }
+        else if(strcmp(argv[nArg], "-dist") == 0) { (void)host_ReadFile(argv[nArg + 1], &pDistData); }
+        else if(strcmp(argv[nArg], "-sec") == 0)  { (void)host_ReadFile(argv[nArg + 1], &pSecData); }
+        else { fprintf(stderr, "unknown option %s\n", argv[nArg]); return 1; }
+    }
+
+    if((nFrames == 0u) || (nFrames > ADI_A2B_FXLMS_MAX_FRAMES) || (nDelay < nFrames) ||
+       (nDelay > ADI_A2B_FXLMS_MAX_SEC_DELAY))
+    {
+        fprintf(stderr, "need 1 <= frames (%u) <= %u and frames <= delay (%u) <= %u\n",
+                nFrames, ADI_A2B_FXLMS_MAX_FRAMES, nDelay, ADI_A2B_FXLMS_MAX_SEC_DELAY);
+        return 1;
+    }
+    oConfig.nSecDelay = nDelay;
+    adi_a2b_FxlmsInit(&oFxlms, &oConfig);
+
+    srand(1u);
+    for(nSpk = 0u; nSpk < NSPK; nSpk++)
+    {
+        for(nErr = 0u; nErr < NERR; nErr++)
+        {
+            if(pSecData != NULL)
+            {
+                memcpy(aSecTrue[nSpk][nErr], &pSecData[((nSpk * NERR) + nErr) * SECLEN], sizeof(aSecTrue[0][0]));
+            }
+            else
+            {
+                host_RandomPath(aSecTrue[nSpk][nErr], SECLEN, 0.8f);
+            }
+            (void)adi_a2b_FxlmsSetSecondaryPath(&oFxlms, nSpk, nErr, aSecTrue[nSpk][nErr], SECLEN);
+        }
+    }
+    for(nErr = 0u; nErr < NERR; nErr++)
+    {
+        for(nRef = 0u; nRef < NREF; nRef++)
+        {
+            host_RandomPath(aPrimary[nErr][nRef], PRILEN, 0.85f);
+        }
+    }
+
+    if((pRefData != NULL) && (pDistData != NULL))
+    {
+        nBlocks = (unsigned)(nRecFrames / (long)nFrames);
+    }
+    else
+    {
+        nBlocks = (unsigned)((fSeconds * (float)SAMPLE_RATE) / (float)nFrames);
+    }
+    nBlocksPerSec = SAMPLE_RATE / nFrames;
+    memset(fRefState, 0, sizeof(fRefState));
+
+    for(nRef = 0u; nRef < NREF; nRef++)
+    {
+        apRef[nRef] = aRef[nRef];
+    }
+    for(nErr = 0u; nErr < NERR; nErr++)
+    {
+        apErr[nErr] = aErr[nErr];
+    }
+    for(nSpk = 0u; nSpk < NSPK; nSpk++)
+    {
+        apOut[nSpk] = aOut[nSpk];
+    }
+
+    printf("FxLMS: %u ref, %u err, %u spk, %u ctrl taps, %u sec taps, delay %u, block %u\n",
+           NREF, NERR, NSPK, ADI_A2B_FXLMS_CTRL_LEN, SECLEN, nDelay, nFrames);
+    printf("MACs per block: %u\n", ADI_A2B_FXLMS_MACS_PER_FRAME * nFrames);
+    printf("%8s %12s %12s %10s\n", "second", "dist dB", "err dB", "atten dB");
+
+    for(nBlock = 0u; nBlock < nBlocks; nBlock++)
+    {
+        /* Sensor signals for this block */
+        for(nFrame = 0u; nFrame < nFrames; nFrame++)
+        {
+            for(nRef = 0u; nRef < NREF; nRef++)
+            {
+                if(pRefData != NULL)
+                {
+                    aRef[nRef][nFrame] = pRefData[(((nBlock * nFrames) + nFrame) * NREF) + nRef];
+                }
+                else
+                {
+                    /* Low-pass road noise surrogate */
+                    fRefState[nRef] = (0.95f * fRefState[nRef]) + (0.1f * host_Rand());
+                    aRef[nRef][nFrame] = fRefState[nRef];
+                }
+            }
+        }
+
+        for(nRef = 0u; nRef < NREF; nRef++)
+        {
+            memmove(&aXHist[nRef][0], &aXHist[nRef][nFrames], (XHIST - nFrames) * sizeof(float));
+            memcpy(&aXHist[nRef][XHIST - nFrames], aRef[nRef], nFrames * sizeof(float));
+        }
+
+        for(nErr = 0u; nErr < NERR; nErr++)
+        {
+            for(nFrame = 0u; nFrame < nFrames; nFrame++)
+            {
+                float fD = 0.0f, fY = 0.0f;
+
+                if(pDistData != NULL)
+                {
+                    fD = pDistData[(((nBlock * nFrames) + nFrame) * NERR) + nErr];
+                }
+                else
+                {
+                    for(nRef = 0u; nRef < NREF; nRef++)
+                    {
+                        for(nTap = 0u; nTap < PRILEN; nTap++)
+                        {
+                            fD += aPrimary[nErr][nRef][nTap] *
+                                  aXHist[nRef][XHIST - nFrames + nFrame - nDelay - PRILEAD - nTap];
+                        }
+                    }
+                }
+
+                /* Anti-noise reaching the mic: y delayed by D then through S */
+                for(nSpk = 0u; nSpk < NSPK; nSpk++)
+                {
+                    for(nTap = 0u; nTap < SECLEN; nTap++)
+                    {
+                        fY += aSecTrue[nSpk][nErr][nTap] * aYHist[nSpk][YHIST + nFrame - nDelay - nTap];
+                    }
+                }
+
+                aDist[nErr][nFrame] = fD;
+                aErr[nErr][nFrame]  = fD + fY;
+                dDistPow += (double)fD * fD;
+                dErrPow  += (double)aErr[nErr][nFrame] * aErr[nErr][nFrame];
+            }
+        }
+
+        nT0 = host_Ticks();
+        adi_a2b_FxlmsProcess(&oFxlms, apRef, apErr, apOut, nFrames);
+        nTicks = host_Ticks() - nT0;
+        nTicksSum += nTicks;
+        if(nTicks > nTicksMax)
+        {
+            nTicksMax = nTicks;
+        }
+
+        for(nSpk = 0u; nSpk < NSPK; nSpk++)
+        {
+            memmove(&aYHist[nSpk][0], &aYHist[nSpk][nFrames], (YHIST - nFrames) * sizeof(float));
+            memcpy(&aYHist[nSpk][YHIST - nFrames], aOut[nSpk], nFrames * sizeof(float));
+        }
+
+        if(((nBlock + 1u) % nBlocksPerSec) == 0u)
+        {
+            printf("%8u %12.2f %12.2f %10.2f\n", (nBlock + 1u) / nBlocksPerSec,
+                   10.0 * log10(dDistPow + 1e-30), 10.0 * log10(dErrPow + 1e-30),
+                   10.0 * log10((dDistPow + 1e-30) / (dErrPow + 1e-30)));
+            dDistPow = 0.0;
+            dErrPow  = 0.0;
+        }
+    }
+
+    if(nBlocks != 0u)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        printf("host TSC ticks per block: mean %llu, max %llu\n", nTicksSum / nBlocks, nTicksMax);
+#else
+        printf("host ns per block: mean %llu, max %llu\n", nTicksSum / nBlocks, nTicksMax);
+#endif
+    }
+
+    free(pRefData);
+    free(pDistData);
+    free(pSecData);
+    return 0;
+}
@@ -0,0 +1,302 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : jobexec_host.c
+
+   Description: Host simulation of the stack job executor (a2bstack
+                jobexec.c) on a discovery shaped workload, comparing the
+                ready list scheduler with the previous one, which walked
+                every job queue once per A2B_CONF_SCHEDULER_TICK_MULTIPLE
+                ticks and ran a queue only when its priority mask matched
+                the rotating schedule mask (PRIO1 mailboxes every other
+                pass).
+
+                Model, one stack tick = 1 msec, per slave node:
+                  - the master mailbox (PRIO1) starts discovery of the node
+                    and suspends; the bus reports the node -d msec later
+                    (resumed from the tick like a timer callback would)
+                  - the master sends the node init message to the slave
+                    plugin mailbox (PRIO1) and suspends until it completes
+                  - the master queues the peripheral configuration of the
+                    node on its periph mailbox (PRIO0), three steps that
+                    ask to run again in between, and moves on
+                Setup is complete when the last job has completed. The
+                time spent on the bus and in the jobs is not modelled,
+                only the scheduling latency in ticks.
+
+                jobexec_host [-d msec]
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    -I../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src
+                    jobexec_host.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/jobexec.c
+                    -o jobexec_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stack_priv.h"
+#include "stackctx.h"
+#include "jobexec.h"
+#include "job.h"
+
+/*============= D E F I N E S =============*/
+
+#define HOST_MAX_NODES      (10u)
+#define HOST_PERIPH_STEPS   (3u)
+#define HOST_MAX_TICKS      (100000u)
+
+/*============= D A T A =============*/
+
+typedef struct
+{
+    a2b_Job     oJob;
+    a2b_UInt32  nNode;
+    a2b_UInt32  nStep;
+
+}HOST_JOB;
+
+static a2b_Stack oStk;
+static a2b_StackContext oCtx;
+static a2b_JobExecutor *pExec;
+static a2b_JobQueue *pMasterQ;
+static a2b_JobQueue *aSlaveQ[HOST_MAX_NODES];
+static a2b_JobQueue *aPeriphQ[HOST_MAX_NODES];
+
+static HOST_JOB oMaster;
+static HOST_JOB aSlave[HOST_MAX_NODES];
+static HOST_JOB aPeriph[HOST_MAX_NODES];
+
+static a2b_UInt32 nNodes;
+static a2b_UInt32 nDscDelay = 2u;
+static a2b_UInt32 nNow;
+static a2b_UInt32 nBusEvent;        /* Tick the discovery completes, 0 = none */
+static a2b_UInt32 nPending;         /* Jobs not yet completed */
+static a2b_UInt16 nSchedMask;       /* Previous scheduler */
+static a2b_UInt32 nJobsRun;
+
+/*============= C O D E =============*/
+
+static void* A2B_CALL host_Malloc(a2b_Handle hnd, a2b_UInt32 size)
+{
+    (void)hnd;
+    return malloc(size);
+}
+
+static void A2B_CALL host_Free(a2b_Handle hnd, void* p)
+{
+    (void)hnd;
+    free(p);
+}
+
+static void host_OnComplete(struct a2b_Job* job, a2b_Bool isCancelled)
+{
+    (void)job;
+    (void)isCancelled;
+    nPending--;
+}
+
+static void host_OnSlaveComplete(struct a2b_Job* job, a2b_Bool isCancelled)
+{
+    host_OnComplete(job, isCancelled);
+
+    /* Reply to the master, which resumes */
+    a2b_jobExecUpdate(pMasterQ, A2B_EXEC_SCHEDULE);
+}
+
+static a2b_Int32 host_SlaveExecute(struct a2b_Job* job)
+{
+    (void)job;
+    nJobsRun++;
+    return A2B_EXEC_COMPLETE;
+}
+
+static a2b_Int32 host_PeriphExecute(struct a2b_Job* job)
+{
+    HOST_JOB *pJob = (HOST_JOB *)job;
+
+    nJobsRun++;
+    pJob->nStep++;
+    return (pJob->nStep < HOST_PERIPH_STEPS) ? A2B_EXEC_SCHEDULE : A2B_EXEC_COMPLETE;
+}
+
+static void host_Submit(a2b_JobQueue *q, HOST_JOB *pJob, a2b_UInt32 nNode,
+                        a2b_Int32 (*pfExecute)(struct a2b_Job*),
+                        void (*pfComplete)(struct a2b_Job*, a2b_Bool))
+{
+    memset(pJob, 0, sizeof(*pJob));
+    pJob->nNode = nNode;
+    pJob->oJob.execute = pfExecute;
+    pJob->oJob.onComplete = pfComplete;
+    nPending++;
+    (void)a2b_jobExecSubmit(q, &pJob->oJob);
+}
+
+/* Master discovery job: step 2n starts node n, step 2n+1 has it found */
+static a2b_Int32 host_MasterExecute(struct a2b_Job* job)
+{
+    HOST_JOB *pJob = (HOST_JOB *)job;
+    a2b_UInt32 nNode = pJob->nStep / 2u;
+
+    nJobsRun++;
+    if(nNode == nNodes)
+    {
+        return A2B_EXEC_COMPLETE;
+    }
+
+    if((pJob->nStep & 1u) == 0u)
+    {
+        nBusEvent = nNow + nDscDelay;
+    }
+    else
+    {
+        host_Submit(aSlaveQ[nNode], &aSlave[nNode], nNode, &host_SlaveExecute,
+                    &host_OnSlaveComplete);
+        host_Submit(aPeriphQ[nNode], &aPeriph[nNode], nNode, &host_PeriphExecute,
+                    &host_OnComplete);
+    }
+    pJob->nStep++;
+
+    return A2B_EXEC_SUSPEND;
+}
+
+/* The previous a2b_jobExecSchedule() */
+static void host_LegacySchedule(struct a2b_JobExecutor* exec)
+{
+    static const a2b_UInt16 gsPriorityMasks[] = { 0x01FFu, 0x00AAu, 0x0049u, 0x0022u, 0x0010u };
+    a2b_JobQueue* q;
+    a2b_JobQueue* nextQ;
+    a2b_Job* job;
+    a2b_Int32 action;
+
+    q = SLIST_FIRST(&exec->listHead);
+    while ( q != SLIST_END(&exec->listHead) )
+    {
+        a2b_jobExecRefQueue(q);
+
+        if ( (nSchedMask & gsPriorityMasks[q->priority]) &&
+            ( A2B_EXEC_SCHEDULE == q->action) )
+        {
+            if ( !SIMPLEQ_EMPTY(&q->qHead) )
+            {
+                job = SIMPLEQ_FIRST(&q->qHead);
+                if ( A2B_NULL != job->execute )
+                {
+                    action = job->execute(job);
+                    a2b_jobExecUpdate(q, action);
+                }
+            }
+        }
+
+        nextQ = SLIST_NEXT(q, link);
+        (void)a2b_jobExecUnrefQueue(q);
+        q = nextQ;
+    }
+
+    nSchedMask = nSchedMask << 1;
+    if ( nSchedMask > 0x1FFu )
+    {
+        nSchedMask = 1u;
+    }
+}
+
+/* Returns the ticks until every job completed */
+static a2b_UInt32 host_Run(a2b_UInt32 bLegacy, a2b_UInt32 nNodeCount)
+{
+    a2b_UInt32 nIndex, nTick;
+
+    memset(&oStk, 0, sizeof(oStk));
+    oStk.pal.memMgrMalloc = &host_Malloc;
+    oStk.pal.memMgrFree = &host_Free;
+    oCtx.stk = &oStk;
+    oCtx.domain = A2B_DOMAIN_APP;
+
+    nNodes = nNodeCount;
+    nNow = 0u;
+    nBusEvent = 0u;
+    nPending = 0u;
+    nSchedMask = 1u;
+    nJobsRun = 0u;
+
+    /* Queues are linked at the head, allocate in reverse of plugin order */
+    pExec = a2b_jobExecAlloc(&oCtx);
+    for(nIndex = nNodes; nIndex > 0u; nIndex--)
+    {
+        aPeriphQ[nIndex - 1u] = a2b_jobExecAllocQueue(pExec, A2B_JOB_PRIO0);
+        aSlaveQ[nIndex - 1u] = a2b_jobExecAllocQueue(pExec, A2B_JOB_PRIO1);
+    }
+    pMasterQ = a2b_jobExecAllocQueue(pExec, A2B_JOB_PRIO1);
+
+    host_Submit(pMasterQ, &oMaster, 0u, &host_MasterExecute, &host_OnComplete);
+
+    for(nTick = 0u; (nPending != 0u) && (nTick < HOST_MAX_TICKS); nTick++)
+    {
+        nNow++;
+
+        /* Timer callbacks run before the scheduler */
+        if((nBusEvent != 0u) && (nNow >= nBusEvent))
+        {
+            nBusEvent = 0u;
+            a2b_jobExecUpdate(pMasterQ, A2B_EXEC_SCHEDULE);
+        }
+
+        if(bLegacy)
+        {
+            if(0u == (nTick % A2B_CONF_SCHEDULER_TICK_MULTIPLE))
+            {
+                host_LegacySchedule(pExec);
+            }
+        }
+        else
+        {
+            if(0u == (nTick % A2B_CONF_SCHEDULER_TICK_MULTIPLE))
+            {
+                a2b_jobExecRelease(pExec);
+            }
+            a2b_jobExecSchedule(pExec);
+        }
+    }
+
+    a2b_jobExecFree(pExec);
+
+    return nTick;
+}
+
+int main(int argc, char *argv[])
+{
+    a2b_UInt32 nNodeCount, nLegacy, nReady, nJobsLegacy;
+    int nArg, nFail = 0;
+
+    for(nArg = 1; nArg < argc; nArg++)
+    {
+        if((strcmp(argv[nArg], "-d") == 0) && ((nArg + 1) < argc)) { nDscDelay = (a2b_UInt32)atol(argv[++nArg]); }
+    }
+
+    printf("simulated setup time in 1 msec ticks, node found %u msec after start\n", nDscDelay);
+    printf("  nodes   previous   ready lists   job runs\n");
+    for(nNodeCount = 1u; nNodeCount <= HOST_MAX_NODES; nNodeCount++)
+    {
+        nLegacy = host_Run(1u, nNodeCount);
+        nJobsLegacy = nJobsRun;
+        nReady = host_Run(0u, nNodeCount);
+
+        printf("  %5u   %8u   %11u   %3u/%3u\n", nNodeCount, nLegacy, nReady,
+               nJobsRun, nJobsLegacy);
+        if((nLegacy >= HOST_MAX_TICKS) || (nReady >= HOST_MAX_TICKS) ||
+           (nJobsRun != nJobsLegacy))
+        {
+            nFail = 1;
+        }
+    }
+
+    return nFail;
+}
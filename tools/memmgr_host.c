@@ -0,0 +1,341 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : memmgr_host.c
+
+   Description: Host stress benchmark of the stack memory manager
+                (a2bstack memmgr.c) under alloc/free churn.
+
+                memmgr.c is included here so that the previous allocation
+                and free paths, a scan over the pools for the first block
+                size that fits and a scan calling a2b_poolContainsPtr() on
+                every pool, can run verbatim on the same heap.
+
+                The churn mixes the sizes of the objects allocated at run
+                time (messages, timers, job queues, notifiers) with, one in
+                four, arbitrary sizes up to the largest block, frees in random order and runs the pools
+                into exhaustion so the spill to larger pools is exercised.
+                Both paths run the same operation sequence from the same
+                heap state; every returned pointer must match. The pool
+                statistics (a2b_memMgrGetStats()) of the checked run are
+                printed along with the pool table entries they map to.
+
+                memmgr_host [-n ops] [-s seed] [-l live]
+
+                -l bounds the number of live allocations (default 40, the
+                pools hold 78 blocks in the default configuration).
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    -I../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src
+                    memmgr_host.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/pool.c
+                    -o memmgr_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "memmgr.c"
+
+/*============= D E F I N E S =============*/
+
+#define HOST_MAX_LIVE       (256u)
+#define HOST_REPEAT         (3u)
+
+/*============= D A T A =============*/
+
+/* Objects allocated and released while the stack runs */
+static const a2b_UInt32 aTypeSize[] =
+{
+    sizeof(a2b_Msg), sizeof(a2b_Msg), sizeof(a2b_Msg),
+    sizeof(a2b_Timer), sizeof(a2b_Timer),
+    sizeof(a2b_JobQueue), sizeof(a2b_MsgNotifier)
+};
+
+typedef struct
+{
+    a2b_UInt32  bAlloc;     /* 1 = alloc of nSize, 0 = free of live slot nSlot */
+    a2b_UInt32  nSize;
+    a2b_UInt32  nSlot;
+
+}HOST_OP;
+
+static a2b_UInt32 nMaxLive = 40u;
+static HOST_OP *pOps;
+static void **pResult;
+static void *aLive[HOST_MAX_LIVE];
+
+/*============= C O D E =============*/
+
+static double host_Seconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (double)oTs.tv_sec + ((double)oTs.tv_nsec * 1e-9);
+}
+
+/* The previous a2b_memMgrMalloc() */
+__attribute__((noinline))
+static void* host_LegacyMalloc(a2b_Handle hnd, a2b_UInt32 size)
+{
+    a2b_StackHeap* stackHeap = (a2b_StackHeap*)hnd;
+    void* mem = A2B_NULL;
+    a2b_Int32 idx;
+
+    if ( A2B_NULL != stackHeap )
+    {
+        for ( idx = 0; idx < stackHeap->numPools; ++idx )
+        {
+            if ( size <= stackHeap->pools[idx].blockSize )
+            {
+                mem = a2b_poolAlloc(&stackHeap->pools[idx].pool);
+                if ( A2B_NULL != mem )
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    return mem;
+}
+
+/* The previous a2b_memMgrFree() */
+__attribute__((noinline))
+static void host_LegacyFree(a2b_Handle hnd, void* p)
+{
+    a2b_StackHeap* stackHeap = (a2b_StackHeap*)hnd;
+    a2b_Int32 idx;
+
+    if ( A2B_NULL != stackHeap )
+    {
+        for ( idx = 0; idx < stackHeap->numPools; ++idx )
+        {
+            if ( a2b_poolContainsPtr(&stackHeap->pools[idx].pool, p) )
+            {
+                a2b_poolFree(&stackHeap->pools[idx].pool, p);
+                break;
+            }
+        }
+    }
+}
+
+/* Random operation sequence. Live slots are tracked while generating so
+ * that frees refer to allocations of the same sequence. */
+static void host_MakeOps(a2b_UInt32 nOps, a2b_UInt32 nMaxSize)
+{
+    a2b_UInt32 nIndex, nLive = 0u, nSlot;
+    a2b_UInt32 aSlotUsed[HOST_MAX_LIVE];
+
+    memset(aSlotUsed, 0, sizeof(aSlotUsed));
+    for(nIndex = 0u; nIndex < nOps; nIndex++)
+    {
+        a2b_UInt32 nRand = (a2b_UInt32)rand();
+        a2b_UInt32 bAlloc = (nLive == 0u) ||
+                            ((nLive < nMaxLive) && ((nRand % 100u) < 52u));
+
+        if(bAlloc)
+        {
+            for(nSlot = 0u; aSlotUsed[nSlot] != 0u; nSlot++) { }
+            aSlotUsed[nSlot] = 1u;
+            nLive++;
+            pOps[nIndex].bAlloc = 1u;
+            pOps[nIndex].nSlot = nSlot;
+            if(((nRand >> 8u) % 4u) != 0u)
+            {
+                pOps[nIndex].nSize = aTypeSize[(nRand >> 12u) % A2B_ARRAY_SIZE(aTypeSize)];
+            }
+            else
+            {
+                pOps[nIndex].nSize = (nRand >> 12u) % (nMaxSize + 1u);
+            }
+        }
+        else
+        {
+            nSlot = (nRand >> 8u) % nMaxLive;
+            while(aSlotUsed[nSlot] == 0u)
+            {
+                nSlot = (nSlot + 1u) % nMaxLive;
+            }
+            aSlotUsed[nSlot] = 0u;
+            nLive--;
+            pOps[nIndex].bAlloc = 0u;
+            pOps[nIndex].nSlot = nSlot;
+            pOps[nIndex].nSize = 0u;
+        }
+    }
+}
+
+static void host_PrintStats(a2b_Handle hnd)
+{
+    a2b_HeapPoolStats aStats[A2B_NUM_POOLS];
+    a2b_HeapPoolEntry aEntry[A2B_NUM_POOLS];
+    a2b_UInt32 nPools, nEntries, nPool, nIndex;
+
+    nPools = a2b_memMgrGetStats(hnd, aStats, A2B_NUM_POOLS);
+    nEntries = a2b_memMgrGetPoolTable(aEntry, A2B_NUM_POOLS);
+    printf("pool  block  blocks  in use  peak  missed  failed  entries\n");
+    for(nPool = 0u; nPool < nPools; nPool++)
+    {
+        printf("%4u  %5u  %6u  %6u  %4u  %6u  %6u ", nPool, aStats[nPool].blockSize,
+               aStats[nPool].numBlocks, aStats[nPool].numInUse, aStats[nPool].maxInUse,
+               aStats[nPool].numMissed, aStats[nPool].numFailed);
+        for(nIndex = 0u; nIndex < nEntries; nIndex++)
+        {
+            if(aEntry[nIndex].poolIdx == nPool)
+            {
+                printf(" %s(%s)", aEntry[nIndex].name, aEntry[nIndex].typeName);
+            }
+        }
+        printf("\n");
+    }
+}
+
+/* Runs the sequence on a freshly opened heap, returns the seconds spent
+ * and records every pointer */
+static double host_Run(a2b_Byte *pHeap, a2b_UInt32 nHeapSize, a2b_UInt32 bLegacy,
+                       a2b_UInt32 nOps, a2b_UInt32 *pNull, a2b_UInt32 bStats)
+{
+    a2b_UInt32 nIndex;
+    a2b_Handle hnd;
+    double dT0, dT;
+
+    hnd = a2b_memMgrOpen(pHeap, nHeapSize);
+    *pNull = 0u;
+    dT0 = host_Seconds();
+    for(nIndex = 0u; nIndex < nOps; nIndex++)
+    {
+        const HOST_OP *pOp = &pOps[nIndex];
+
+        if(pOp->bAlloc != 0u)
+        {
+            void *p = (bLegacy != 0u) ? host_LegacyMalloc(hnd, pOp->nSize)
+                                      : a2b_memMgrMalloc(hnd, pOp->nSize);
+            aLive[pOp->nSlot] = p;
+            pResult[nIndex] = p;
+            *pNull += (p == A2B_NULL) ? 1u : 0u;
+        }
+        else if(aLive[pOp->nSlot] != A2B_NULL)
+        {
+            if(bLegacy != 0u)
+            {
+                host_LegacyFree(hnd, aLive[pOp->nSlot]);
+            }
+            else
+            {
+                a2b_memMgrFree(hnd, aLive[pOp->nSlot]);
+            }
+            aLive[pOp->nSlot] = A2B_NULL;
+        }
+        else
+        {
+            /* Allocation had failed */
+        }
+    }
+    dT = host_Seconds() - dT0;
+
+    if(bStats != 0u)
+    {
+        host_PrintStats(hnd);
+    }
+
+    memset(aLive, 0, sizeof(aLive));
+    (void)a2b_memMgrClose(hnd);
+
+    return dT;
+}
+
+int main(int argc, char *argv[])
+{
+    a2b_UInt32 nOps = 2000000u, nSeed = 1u, nIndex, nMismatch = 0u;
+    a2b_UInt32 nNullLegacy, nNullNew, nRepeat, nBlocks = 0u;
+    a2b_UInt32 nHeapSize;
+    a2b_Byte *pHeap;
+    void **pRef;
+    a2b_Handle hnd;
+    a2b_Int32 nPools;
+    double dLegacy = 0.0, dNew = 0.0, dT;
+    int nArg;
+
+    for(nArg = 1; nArg < argc; nArg++)
+    {
+        if((strcmp(argv[nArg], "-n") == 0) && ((nArg + 1) < argc)) { nOps = (a2b_UInt32)atol(argv[++nArg]); }
+        if((strcmp(argv[nArg], "-s") == 0) && ((nArg + 1) < argc)) { nSeed = (a2b_UInt32)atol(argv[++nArg]); }
+        if((strcmp(argv[nArg], "-l") == 0) && ((nArg + 1) < argc)) { nMaxLive = (a2b_UInt32)atol(argv[++nArg]); }
+    }
+
+    nHeapSize = a2b_memMgrGetMinHeapSize(A2B_NULL);
+    pHeap = (a2b_Byte *)malloc(nHeapSize + A2B_CONF_MEMORY_ALIGNMENT);
+    pOps = (HOST_OP *)malloc(nOps * sizeof(HOST_OP));
+    pResult = (void **)malloc(nOps * sizeof(void *));
+    pRef = (void **)malloc(nOps * sizeof(void *));
+    nMaxLive = A2B_MAX(1u, A2B_MIN(nMaxLive, HOST_MAX_LIVE));
+    if((pHeap == NULL) || (pOps == NULL) || (pResult == NULL) || (pRef == NULL))
+    {
+        return 1;
+    }
+
+    nHeapSize += A2B_CONF_MEMORY_ALIGNMENT;
+    hnd = a2b_memMgrOpen(pHeap, nHeapSize);
+    if(hnd == A2B_NULL)
+    {
+        printf("a2b_memMgrOpen failed\n");
+        return 1;
+    }
+    nPools = ((a2b_StackHeap *)hnd)->numPools;
+    for(nIndex = 0u; nIndex < (a2b_UInt32)nPools; nIndex++)
+    {
+        nBlocks += ((a2b_StackHeap *)hnd)->pools[nIndex].pool.numBlocks;
+    }
+    (void)a2b_memMgrClose(hnd);
+
+    srand(nSeed);
+    host_MakeOps(nOps, (a2b_UInt32)sizeof(a2b_PoolBlock));
+
+    printf("heap %u bytes, %d pools, %u blocks, %u size classes, %u ops, <= %u live\n",
+           nHeapSize, nPools, nBlocks,
+           (a2b_UInt32)A2B_MEMMGR_NUM_SIZE_CLASSES, nOps, nMaxLive);
+
+    /* Same sequence from the same (fully free) heap state */
+    (void)host_Run(pHeap, nHeapSize, 1u, nOps, &nNullLegacy, 0u);
+    memcpy(pRef, pResult, nOps * sizeof(void *));
+    (void)host_Run(pHeap, nHeapSize, 0u, nOps, &nNullNew, 1u);
+    for(nIndex = 0u; nIndex < nOps; nIndex++)
+    {
+        if((pOps[nIndex].bAlloc != 0u) && (pRef[nIndex] != pResult[nIndex]))
+        {
+            if(nMismatch++ < 5u)
+            {
+                printf("  op %u size %u: %p, previously %p\n", nIndex, pOps[nIndex].nSize,
+                       pResult[nIndex], pRef[nIndex]);
+            }
+        }
+    }
+    printf("check: %s (%u failed allocations, previously %u)\n",
+           ((nMismatch == 0u) && (nNullNew == nNullLegacy)) ? "pointers identical" : "MISMATCH",
+           nNullNew, nNullLegacy);
+
+    for(nRepeat = 0u; nRepeat < HOST_REPEAT; nRepeat++)
+    {
+        dT = host_Run(pHeap, nHeapSize, 1u, nOps, &nNullLegacy, 0u);
+        dLegacy = ((nRepeat == 0u) || (dT < dLegacy)) ? dT : dLegacy;
+        dT = host_Run(pHeap, nHeapSize, 0u, nOps, &nNullNew, 0u);
+        dNew = ((nRepeat == 0u) || (dT < dNew)) ? dT : dNew;
+    }
+
+    printf("\nhost timings, best of %u\n", HOST_REPEAT);
+    printf("  pool scans          %6.1f ns/op\n", (dLegacy * 1e9) / (double)nOps);
+    printf("  size class / range  %6.1f ns/op\n", (dNew * 1e9) / (double)nOps);
+    printf("  speedup             %6.2fx\n", dLegacy / dNew);
+
+    return ((nMismatch == 0u) && (nNullNew == nNullLegacy)) ? 0 : 1;
+}
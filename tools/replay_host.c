@@ -0,0 +1,465 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : replay_host.c
+
+   Description: Offline replay of an upstream SPORT capture through the audio
+                chain (adi_a2b_AudioChainProcess(), the code run by
+                process_audioBlocks() on the target).
+
+                The capture is cut into blocks laid out like int_SP0ABuffer
+                (RxNUM_CHANNELS 32-bit slots per frame, 24-bit samples left
+                justified); each block is processed into a block laid out
+                like int_SP4ABuffer (TxNUM_CHANNELS slots). A short last
+                block is padded with silence.
+
+                Reports blocks per second, the real-time factor and the
+                per-block processing time percentiles, optionally writes the
+                DAC stream and compares it bit for bit with a golden file.
+
+                replay_host -i capture [-c slots] [-o dac] [-g golden]
+                            [-b frames] [-n passes]
+
+                -i  Capture: a PCM WAV file (16, 24 or 32 bit; channel n goes
+                    to upstream slot n) or raw little endian 32-bit frames.
+                -c  Slots per frame of a raw capture (default RxNUM_CHANNELS)
+                -o  DAC output: 32-bit PCM WAV if the name ends in .wav,
+                    raw 32-bit frames otherwise
+                -g  Golden DAC output to compare with (same formats as -o)
+                -b  Frames per block (default ADI_A2B_AUDIO_DEFAULT_FRAMES)
+                -n  Replay passes for timing (default 1). The chain is
+                    re-initialised before each pass; output and comparison
+                    use the first pass.
+
+                Build with -DA2B_LOOP_BACKTEST to replay the loop-back copy
+                instead of the RNC chain.
+
+                Exit status is 0 if the output matches the golden file (or
+                none was given), 1 on mismatch, 2 on usage or file errors.
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    replay_host.c
+                    ../RNC_21569/a2b_stack/a2bstack-pal/adi_a2b_audiochain.c
+                    ../RNC_21569/a2b_stack/a2bstack-pal/adi_a2b_audiostage.c
+                    ../RNC_21569/a2b_stack/a2bstack-pal/adi_a2b_fxlms.c
+                    -lm -o replay_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "adi_a2b_audioconfig.h"
+#include "adi_a2b_audiochain.h"
+
+/*============= D E F I N E S =============*/
+
+#define REPLAY_WAV_PCM          (1u)
+#define REPLAY_WAV_EXTENSIBLE   (0xFFFEu)
+
+/*============= D A T A =============*/
+
+/* A stream of frames with a fixed number of 32-bit slots */
+typedef struct
+{
+    int32_t     *pData;
+    uint32_t    nSlots;
+    uint32_t    nFrames;
+} REPLAY_STREAM;
+
+static int32_t aRxBlock[A2B_BUFFER_SIZE];
+static int32_t aTxBlock[DAC_BUFFER_SIZE];
+
+/*============= C O D E =============*/
+
+static uint64_t replay_Nanoseconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return ((uint64_t)oTs.tv_sec * 1000000000u) + (uint64_t)oTs.tv_nsec;
+}
+
+static uint32_t replay_Le16(const uint8_t *p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8u); }
+static uint32_t replay_Le32(const uint8_t *p) { return replay_Le16(p) | (replay_Le16(&p[2]) << 16u); }
+
+static int replay_HasSuffix(const char *pName, const char *pSuffix)
+{
+    size_t nName = strlen(pName), nSuffix = strlen(pSuffix);
+    return (nName >= nSuffix) && (strcmp(&pName[nName - nSuffix], pSuffix) == 0);
+}
+
+static uint8_t *replay_ReadFile(const char *pName, size_t *pSize)
+{
+    FILE *pFile = fopen(pName, "rb");
+    uint8_t *pData;
+    long nSize;
+
+    if(pFile == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", pName);
+        return NULL;
+    }
+    fseek(pFile, 0, SEEK_END);
+    nSize = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+    pData = (uint8_t *)malloc((size_t)nSize + 1u);
+    if((pData == NULL) || (fread(pData, 1u, (size_t)nSize, pFile) != (size_t)nSize))
+    {
+        fprintf(stderr, "cannot read %s\n", pName);
+        free(pData);
+        fclose(pFile);
+        return NULL;
+    }
+    fclose(pFile);
+    *pSize = (size_t)nSize;
+    return pData;
+}
+
+/* PCM WAV to left justified 32-bit slots */
+static int replay_ParseWav(const uint8_t *pFile, size_t nSize, REPLAY_STREAM *pStream)
+{
+    const uint8_t *pFmt = NULL, *pPcm = NULL;
+    size_t nPos = 12u, nPcmSize = 0u;
+    uint32_t nFormat, nBytes, nFrame, nSlot;
+
+    while((nPos + 8u) <= nSize)
+    {
+        uint32_t nChunk = replay_Le32(&pFile[nPos + 4u]);
+
+        if(memcmp(&pFile[nPos], "fmt ", 4u) == 0)
+        {
+            pFmt = &pFile[nPos + 8u];
+        }
+        else if(memcmp(&pFile[nPos], "data", 4u) == 0)
+        {
+            pPcm     = &pFile[nPos + 8u];
+            nPcmSize = A2B_MIN((size_t)nChunk, nSize - nPos - 8u);
+        }
+        nPos += 8u + nChunk + (nChunk & 1u);
+    }
+
+    if((pFmt == NULL) || (pPcm == NULL))
+    {
+        fprintf(stderr, "WAV file without fmt or data chunk\n");
+        return 1;
+    }
+
+    nFormat          = replay_Le16(&pFmt[0]);
+    pStream->nSlots  = replay_Le16(&pFmt[2]);
+    nBytes           = replay_Le16(&pFmt[14]) / 8u;
+    if(((nFormat != REPLAY_WAV_PCM) && (nFormat != REPLAY_WAV_EXTENSIBLE)) ||
+       (nBytes < 2u) || (nBytes > 4u) || (pStream->nSlots == 0u))
+    {
+        fprintf(stderr, "only 16, 24 and 32-bit PCM WAV files are supported\n");
+        return 1;
+    }
+    if(replay_Le32(&pFmt[4]) != SAMPLE_RATE)
+    {
+        fprintf(stderr, "warning: WAV rate %u Hz, chain runs at %u Hz\n",
+                (unsigned)replay_Le32(&pFmt[4]), (unsigned)SAMPLE_RATE);
+    }
+
+    pStream->nFrames = (uint32_t)(nPcmSize / (nBytes * pStream->nSlots));
+    pStream->pData   = (int32_t *)malloc(((size_t)pStream->nFrames * pStream->nSlots * sizeof(int32_t)) + 1u);
+    if(pStream->pData == NULL)
+    {
+        return 1;
+    }
+
+    for(nFrame = 0u; nFrame < pStream->nFrames; nFrame++)
+    {
+        for(nSlot = 0u; nSlot < pStream->nSlots; nSlot++)
+        {
+            const uint8_t *p = &pPcm[((nFrame * pStream->nSlots) + nSlot) * nBytes];
+            uint32_t nWord = 0u, nByte;
+
+            for(nByte = 0u; nByte < nBytes; nByte++)
+            {
+                nWord |= (uint32_t)p[nByte] << (8u * (nByte + 4u - nBytes));
+            }
+            pStream->pData[(nFrame * pStream->nSlots) + nSlot] = (int32_t)nWord;
+        }
+    }
+
+    return 0;
+}
+
+static int replay_Load(const char *pName, uint32_t nRawSlots, REPLAY_STREAM *pStream)
+{
+    size_t nSize, nIndex;
+    uint8_t *pFile = replay_ReadFile(pName, &nSize);
+    int nResult = 0;
+
+    if(pFile == NULL)
+    {
+        return 1;
+    }
+
+    if((nSize >= 12u) && (memcmp(pFile, "RIFF", 4u) == 0) && (memcmp(&pFile[8], "WAVE", 4u) == 0))
+    {
+        nResult = replay_ParseWav(pFile, nSize, pStream);
+    }
+    else
+    {
+        pStream->nSlots  = nRawSlots;
+        pStream->nFrames = (uint32_t)(nSize / (4u * nRawSlots));
+        pStream->pData   = (int32_t *)malloc(((size_t)pStream->nFrames * nRawSlots * sizeof(int32_t)) + 1u);
+        if(pStream->pData == NULL)
+        {
+            nResult = 1;
+        }
+        else
+        {
+            for(nIndex = 0u; nIndex < ((size_t)pStream->nFrames * nRawSlots); nIndex++)
+            {
+                pStream->pData[nIndex] = (int32_t)replay_Le32(&pFile[4u * nIndex]);
+            }
+        }
+    }
+
+    free(pFile);
+    return nResult;
+}
+
+static void replay_Put32(FILE *pFile, uint32_t nWord)
+{
+    uint8_t a[4];
+
+    a[0] = (uint8_t)nWord;
+    a[1] = (uint8_t)(nWord >> 8u);
+    a[2] = (uint8_t)(nWord >> 16u);
+    a[3] = (uint8_t)(nWord >> 24u);
+    fwrite(a, 1u, 4u, pFile);
+}
+
+static int replay_Save(const char *pName, const REPLAY_STREAM *pStream)
+{
+    FILE *pFile = fopen(pName, "wb");
+    uint32_t nBytes = pStream->nFrames * pStream->nSlots * 4u;
+    uint32_t nIndex;
+
+    if(pFile == NULL)
+    {
+        fprintf(stderr, "cannot create %s\n", pName);
+        return 1;
+    }
+
+    if(replay_HasSuffix(pName, ".wav") != 0)
+    {
+        fwrite("RIFF", 1u, 4u, pFile);
+        replay_Put32(pFile, 36u + nBytes);
+        fwrite("WAVEfmt ", 1u, 8u, pFile);
+        replay_Put32(pFile, 16u);
+        replay_Put32(pFile, REPLAY_WAV_PCM | (pStream->nSlots << 16u));
+        replay_Put32(pFile, SAMPLE_RATE);
+        replay_Put32(pFile, SAMPLE_RATE * pStream->nSlots * 4u);
+        replay_Put32(pFile, (pStream->nSlots * 4u) | (32u << 16u));
+        fwrite("data", 1u, 4u, pFile);
+        replay_Put32(pFile, nBytes);
+    }
+
+    for(nIndex = 0u; nIndex < (pStream->nFrames * pStream->nSlots); nIndex++)
+    {
+        replay_Put32(pFile, (uint32_t)pStream->pData[nIndex]);
+    }
+
+    fclose(pFile);
+    return 0;
+}
+
+static int replay_CompareU64(const void *pA, const void *pB)
+{
+    uint64_t nA = *(const uint64_t *)pA, nB = *(const uint64_t *)pB;
+    return (nA > nB) - (nA < nB);
+}
+
+/* Runs the whole capture once; returns the chain time in ns */
+static uint64_t replay_Pass(const REPLAY_STREAM *pIn, REPLAY_STREAM *pOut, uint32_t nFrames,
+                            uint64_t aBlockNs[], uint32_t nBlocks)
+{
+    uint32_t nBlock, nFrame, nFirst, nCount, nSlots;
+    uint64_t nT0, nTotal = 0u;
+
+    adi_a2b_AudioChainInit(nFrames);
+    nSlots = A2B_MIN(pIn->nSlots, RxNUM_CHANNELS);
+
+    for(nBlock = 0u; nBlock < nBlocks; nBlock++)
+    {
+        nFirst = nBlock * nFrames;
+        nCount = A2B_MIN(nFrames, pIn->nFrames - nFirst);
+
+        memset(aRxBlock, 0, sizeof(aRxBlock));
+        for(nFrame = 0u; nFrame < nCount; nFrame++)
+        {
+            memcpy(&aRxBlock[nFrame * RxNUM_CHANNELS],
+                   &pIn->pData[(nFirst + nFrame) * pIn->nSlots],
+                   nSlots * sizeof(int32_t));
+        }
+
+        nT0 = replay_Nanoseconds();
+        adi_a2b_AudioChainProcess(aRxBlock, aTxBlock);
+        aBlockNs[nBlock] = replay_Nanoseconds() - nT0;
+        nTotal += aBlockNs[nBlock];
+
+        if(pOut != NULL)
+        {
+            memcpy(&pOut->pData[nFirst * TxNUM_CHANNELS], aTxBlock,
+                   (size_t)nFrames * TxNUM_CHANNELS * sizeof(int32_t));
+        }
+    }
+
+    return nTotal;
+}
+
+static int replay_Golden(const char *pName, const REPLAY_STREAM *pOut, uint32_t nFrames)
+{
+    REPLAY_STREAM oGolden;
+    uint32_t nIndex, nMismatch = 0u, nFirst = 0u;
+    uint32_t nCommon;
+
+    if(replay_Load(pName, TxNUM_CHANNELS, &oGolden) != 0)
+    {
+        return 2;
+    }
+    if(oGolden.nSlots != pOut->nSlots)
+    {
+        printf("golden: %u slots per frame, output has %u: MISMATCH\n",
+               (unsigned)oGolden.nSlots, (unsigned)pOut->nSlots);
+        free(oGolden.pData);
+        return 1;
+    }
+
+    nCommon = A2B_MIN(oGolden.nFrames, pOut->nFrames) * pOut->nSlots;
+    for(nIndex = 0u; nIndex < nCommon; nIndex++)
+    {
+        if(oGolden.pData[nIndex] != pOut->pData[nIndex])
+        {
+            if(nMismatch == 0u)
+            {
+                nFirst = nIndex;
+            }
+            nMismatch++;
+        }
+    }
+
+    if(oGolden.nFrames != pOut->nFrames)
+    {
+        printf("golden: %u frames, output %u frames: MISMATCH\n",
+               (unsigned)oGolden.nFrames, (unsigned)pOut->nFrames);
+        nMismatch++;
+    }
+    else if(nMismatch == 0u)
+    {
+        printf("golden: %u frames bit exact\n", (unsigned)pOut->nFrames);
+    }
+
+    if((nMismatch != 0u) && (nCommon != 0u) && (oGolden.pData[nFirst] != pOut->pData[nFirst]))
+    {
+        uint32_t nFrame = nFirst / pOut->nSlots;
+        printf("golden: %u samples differ, first at block %u frame %u slot %u (0x%08x, expected 0x%08x)\n",
+               (unsigned)nMismatch, (unsigned)(nFrame / nFrames), (unsigned)(nFrame % nFrames),
+               (unsigned)(nFirst % pOut->nSlots), (unsigned)pOut->pData[nFirst],
+               (unsigned)oGolden.pData[nFirst]);
+    }
+
+    free(oGolden.pData);
+    return (nMismatch == 0u) ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *pInName = NULL, *pOutName = NULL, *pGoldenName = NULL;
+    uint32_t nRawSlots = RxNUM_CHANNELS, nFrames = ADI_A2B_AUDIO_DEFAULT_FRAMES, nPasses = 1u;
+    uint32_t nBlocks, nPass;
+    REPLAY_STREAM oIn, oOut;
+    uint64_t *aBlockNs, *aSorted, nChainNs = 0u;
+    double dAudioSec, dChainSec;
+    int nArg, nResult = 0;
+
+    for(nArg = 1; nArg < argc; nArg++)
+    {
+        if((nArg + 1) >= argc)                  { break; }
+        else if(strcmp(argv[nArg], "-i") == 0)  { pInName = argv[++nArg]; }
+        else if(strcmp(argv[nArg], "-o") == 0)  { pOutName = argv[++nArg]; }
+        else if(strcmp(argv[nArg], "-g") == 0)  { pGoldenName = argv[++nArg]; }
+        else if(strcmp(argv[nArg], "-c") == 0)  { nRawSlots = (uint32_t)atoi(argv[++nArg]); }
+        else if(strcmp(argv[nArg], "-b") == 0)  { nFrames = (uint32_t)atoi(argv[++nArg]); }
+        else if(strcmp(argv[nArg], "-n") == 0)  { nPasses = (uint32_t)atoi(argv[++nArg]); }
+        else                                    { break; }
+    }
+    if((nArg < argc) || (pInName == NULL) || (nRawSlots == 0u) || (nPasses == 0u) ||
+       (nFrames < ADI_A2B_AUDIO_MIN_FRAMES) || (nFrames > ADI_A2B_AUDIO_MAX_FRAMES))
+    {
+        fprintf(stderr, "usage: replay_host -i capture [-c slots] [-o dac] [-g golden] [-b frames] [-n passes]\n");
+        return 2;
+    }
+
+    if(replay_Load(pInName, nRawSlots, &oIn) != 0)
+    {
+        return 2;
+    }
+    if(oIn.nSlots > RxNUM_CHANNELS)
+    {
+        fprintf(stderr, "warning: capture has %u slots, only the first %u are replayed\n",
+                (unsigned)oIn.nSlots, (unsigned)RxNUM_CHANNELS);
+    }
+
+    /* Output is trimmed to the capture length; the buffer holds the padding */
+    nBlocks       = (oIn.nFrames + nFrames - 1u) / nFrames;
+    oOut.nSlots   = TxNUM_CHANNELS;
+    oOut.nFrames  = oIn.nFrames;
+    oOut.pData    = (int32_t *)calloc(((size_t)nBlocks * nFrames * TxNUM_CHANNELS) + 1u, sizeof(int32_t));
+    aBlockNs      = (uint64_t *)calloc((size_t)nBlocks + 1u, sizeof(uint64_t));
+    aSorted       = (uint64_t *)calloc(((size_t)nBlocks * nPasses) + 1u, sizeof(uint64_t));
+    if((oOut.pData == NULL) || (aBlockNs == NULL) || (aSorted == NULL) || (nBlocks == 0u))
+    {
+        fprintf(stderr, "empty capture or out of memory\n");
+        return 2;
+    }
+
+    for(nPass = 0u; nPass < nPasses; nPass++)
+    {
+        nChainNs += replay_Pass(&oIn, (nPass == 0u) ? &oOut : NULL, nFrames, aBlockNs, nBlocks);
+        memcpy(&aSorted[nPass * nBlocks], aBlockNs, (size_t)nBlocks * sizeof(uint64_t));
+    }
+    qsort(aSorted, (size_t)nBlocks * nPasses, sizeof(uint64_t), replay_CompareU64);
+
+    dAudioSec = ((double)oIn.nFrames * nPasses) / (double)SAMPLE_RATE;
+    dChainSec = (double)nChainNs * 1e-9;
+
+    printf("capture: %u frames, %u slots, %.3f s; %u blocks of %u frames, %u pass(es); host timings\n",
+           (unsigned)oIn.nFrames, (unsigned)oIn.nSlots, dAudioSec / nPasses,
+           (unsigned)nBlocks, (unsigned)nFrames, (unsigned)nPasses);
+    printf("throughput: %.0f blocks/s, %.1fx real time (block period %.1f us)\n",
+           ((double)nBlocks * nPasses) / dChainSec, dAudioSec / dChainSec,
+           ((double)nFrames * 1e6) / (double)SAMPLE_RATE);
+    printf("block time us: p50 %.2f  p90 %.2f  p99 %.2f  p99.9 %.2f  max %.2f\n",
+           (double)aSorted[((size_t)nBlocks * nPasses * 50u) / 100u] * 1e-3,
+           (double)aSorted[((size_t)nBlocks * nPasses * 90u) / 100u] * 1e-3,
+           (double)aSorted[((size_t)nBlocks * nPasses * 99u) / 100u] * 1e-3,
+           (double)aSorted[((size_t)nBlocks * nPasses * 999u) / 1000u] * 1e-3,
+           (double)aSorted[((size_t)nBlocks * nPasses) - 1u] * 1e-3);
+
+    if((pOutName != NULL) && (replay_Save(pOutName, &oOut) != 0))
+    {
+        nResult = 2;
+    }
+    if((nResult == 0) && (pGoldenName != NULL))
+    {
+        nResult = replay_Golden(pGoldenName, &oOut, nFrames);
+    }
+
+    free(oIn.pData);
+    free(oOut.pData);
+    free(aBlockNs);
+    free(aSorted);
+    return nResult;
+}
@@ -0,0 +1,904 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : seqchart_host.c
+
+   Description: Renders a binary sequence chart dump
+                (A2B_FEATURE_SEQ_CHART_BINARY, a2b_seqChartBinDump()) into
+                the PlantUML text the stack writes to the sequence chart log
+                channel without the binary option. Messages are formatted
+                with the stack's own a2b_vsnprintfStringBuffer() and I2C
+                transfers as i2c.c formats them, so the text is the same as
+                the one formatted on target. The dump must come from a target
+                of the same byte order as the host.
+
+                seqchart_host dump.bin      render a dump to stdout
+                seqchart_host -w [-n n]     chart a discovery like workload
+                                            to stdout
+                seqchart_host -b            host timing of an I2C transfer
+
+                The workload links seqchart.c and i2c.c and drives I2C
+                transfers of every kind (master, slave, broadcast, peripheral
+                from the application and from plugins, failing ones) together
+                with A2B_SEQ_CHARTn messages, notes and groups. Built with
+                the binary option it dumps the capture and renders it, built
+                without it the log channel writes the lines as they come.
+                Both builds must print the same chart:
+
+                  ./seqchart_text -w > text.puml
+                  ./seqchart_bin  -w > bin.puml
+                  cmp text.puml bin.puml
+
+                -b times a chart of I2C transfers against the same transfers
+                with the chart stopped, in either build (the text build
+                formats every line but does not write it anywhere).
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -DA2B_FEATURE_SEQ_CHART [-DA2B_FEATURE_SEQ_CHART_BINARY]
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    -I../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src
+                    seqchart_host.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/seqchart.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/i2c.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/util.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/stringbuffer.c
+                    -o seqchart_bin (or seqchart_text)
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "a2bstack/inc/a2b/seqchartctl.h"
+#include "a2bstack/inc/a2b/seqchart.h"
+#include "a2bstack/inc/a2b/trace.h"
+#include "a2bstack/inc/a2b/util.h"
+#include "a2bstack/inc/a2b/stringbuffer.h"
+#include "a2bstack/inc/a2b/i2c.h"
+#include "a2bstack/inc/a2b/error.h"
+#include "stack_priv.h"
+#include "stackctx.h"
+
+/*============= D E F I N E S =============*/
+
+#define HOST_MAX_STRINGS    (4096u)
+#define HOST_LINE_SIZE      (A2B_CONF_TRACE_BUF_SIZE)
+#define HOST_I2C_BUF_SIZE   (64u)     /* A2B_I2C_TEMP_BUF_SIZE of i2c.c */
+#define HOST_I2C_DATA_ARGS  (8u)      /* A2B_I2C_DATA_ARGS of i2c.c */
+#define HOST_MAX_DUMP       (1024u * 1024u)
+#define HOST_REPEAT         (5u)
+#define HOST_MASTER_I2C     (0x68u)
+
+/*============= D A T A =============*/
+
+typedef struct
+{
+    a2b_UIntPtr     nAddr;
+    const char*     pStr;
+
+}HOST_STRING;
+
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+static HOST_STRING aStrings[HOST_MAX_STRINGS];
+static uint32_t nStrings;
+#endif
+
+/* Workload */
+static a2b_Stack oStk;
+static A2B_ECB oEcb;
+static a2b_StackContext oCtx;
+static uint32_t nSysTime;
+static uint32_t nTransfers;
+static int bLogQuiet;
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+static uint8_t *pDump;
+static size_t nDumpSize;
+#endif
+
+/*============= C O D E =============*/
+
+static double host_Seconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (double)oTs.tv_sec + ((double)oTs.tv_nsec * 1e-9);
+}
+
+/*------------------------------- renderer -------------------------------*/
+
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+
+static const char* host_String(a2b_UIntPtr nAddr)
+{
+    uint32_t nIndex;
+
+    for(nIndex = 0u; nIndex < nStrings; nIndex++)
+    {
+        if(aStrings[nIndex].nAddr == nAddr)
+        {
+            return aStrings[nIndex].pStr;
+        }
+    }
+
+    return "?";
+}
+
+static a2b_UIntPtr host_Ptr(const uint32_t *pWords, uint32_t nPtrWords)
+{
+    a2b_UIntPtr nValue = 0u;
+    uint32_t nIndex;
+
+    for(nIndex = nPtrWords; nIndex > 0u; nIndex--)
+    {
+        nValue = ((nValue << 16u) << 16u) | (a2b_UIntPtr)pWords[nIndex - 1u];
+    }
+
+    return nValue;
+}
+
+/* Writes a line through the stack's formatter, as a2b_seqChartLog0/1() do */
+static void host_Line(const char *pFmt, void **aArgs, uint32_t nArgs)
+{
+    a2b_Char aBuf[HOST_LINE_SIZE];
+
+    (void)a2b_vsnprintf(aBuf, A2B_ARRAY_SIZE(aBuf), pFmt, aArgs, (a2b_UInt16)nArgs);
+    printf("%s\n", aBuf);
+}
+
+static void host_TimeNote(const uint32_t *pRec)
+{
+    void *aArgs[1];
+    uint32_t nTime = pRec[A2B_SEQBIN_REC_TIME];
+
+    if((A2B_SEQBIN_REC_FLAGS(pRec[A2B_SEQBIN_REC_HDR]) & A2B_SEQBIN_FLAG_TIMESTAMP) != 0u)
+    {
+        aArgs[0] = &nTime;
+        host_Line("note left: TS=%010u", aArgs, 1u);
+    }
+}
+
+/* a2b_seqChartHeader() */
+static void host_Header(uint32_t nOptions, const char *pTitle)
+{
+    static const char *aHeader[] = {
+        "@startuml",
+        "skinparam backgroundColor #EEEBDC",
+        "skinparam sequence {",
+            "ArrowColor DeepSkyBlue",
+            "ActorBorderColor DeepSkyBlue",
+            "LifeLineBorderColor blue",
+            "LifeLineBackgroundColor #A9DCDF",
+            "ParticipantBorderColor DeepSkyBlue",
+            "ParticipantBackgroundColor DodgerBlue",
+            "ParticipantFontName Impact",
+            "ParticipantFontSize 17",
+            "ParticipantFontColor #black",
+            "ActorBackgroundColor aqua",
+            "ActorFontColor DeepSkyBlue",
+            "ActorFontSize 17",
+            "ActorFontName Aapex",
+            "TitleFontSize 24",
+        "}",
+        "participant Application #90EE90",
+        "participant Stack #ADD8E6",
+        "participant Platform #gray",
+        "participant PluginM #FFDB00"
+    };
+    void *aArgs[1];
+    uint32_t nIndex;
+
+    for(nIndex = 0u; nIndex < A2B_ARRAY_SIZE(aHeader); nIndex++)
+    {
+        host_Line(aHeader[nIndex], NULL, 0u);
+    }
+    if((nOptions & A2B_SEQ_CHART_OPT_AUTONUMBER) != 0u)
+    {
+        host_Line("autonumber \"<b>[000]\"", NULL, 0u);
+    }
+    if(pTitle != NULL)
+    {
+        aArgs[0] = (void *)pTitle;
+        host_Line("title %s\n", aArgs, 1u);
+    }
+}
+
+/* a2b_seqChartPrefix() */
+static void host_Prefix(a2b_StringBuffer *pBuf, uint32_t nEntities)
+{
+    const char *pArrow;
+    char aNames[2][sizeof("PluginXX")];
+    const char *pNames[2];
+    uint32_t aEnt[2];
+    void *aArgs[3];
+    a2b_Int16 nNode;
+    uint32_t nIndex;
+
+    switch(A2B_SEQBIN_COMM(nEntities))
+    {
+        case A2B_SEQ_CHART_COMM_REQUEST: pArrow = "-[#blue]>>"; break;
+        case A2B_SEQ_CHART_COMM_REPLY:   pArrow = "-[#blue]->>"; break;
+        case A2B_SEQ_CHART_COMM_NOTIFY:  pArrow = "o[#green]->>"; break;
+        default:                         pArrow = "-[#orange]>"; break;
+    }
+
+    aEnt[0] = A2B_SEQBIN_SRC(nEntities);
+    aEnt[1] = A2B_SEQBIN_DEST(nEntities);
+    for(nIndex = 0u; nIndex < 2u; nIndex++)
+    {
+        switch(aEnt[nIndex])
+        {
+            case A2B_SEQ_CHART_ENTITY_APP:           pNames[nIndex] = "Application"; break;
+            case A2B_SEQ_CHART_ENTITY_STACK:         pNames[nIndex] = "Stack"; break;
+            case A2B_SEQ_CHART_ENTITY_PLATFORM:      pNames[nIndex] = "Platform"; break;
+            case A2B_SEQ_CHART_ENTITY_PLUGIN_MASTER: pNames[nIndex] = "PluginM"; break;
+            default:
+                if((aEnt[nIndex] >= A2B_SEQ_CHART_ENTITY_PLUGIN_SLAVE_START) &&
+                   (aEnt[nIndex] < A2B_SEQ_CHART_ENTITY_PLUGIN_SLAVE_END))
+                {
+                    nNode = (a2b_Int16)(aEnt[nIndex] - A2B_SEQ_CHART_ENTITY_PLUGIN_SLAVE_START);
+                    aArgs[0] = &nNode;
+                    (void)a2b_vsnprintf(aNames[nIndex], sizeof(aNames[0]), "Plugin%hd", aArgs, 1);
+                    pNames[nIndex] = aNames[nIndex];
+                }
+                else
+                {
+                    pNames[nIndex] = "Unknown";
+                }
+                break;
+        }
+    }
+
+    aArgs[0] = (void *)pNames[0];
+    aArgs[1] = (void *)pArrow;
+    aArgs[2] = (void *)pNames[1];
+    (void)a2b_vsnprintfStringBuffer(pBuf, "%s %s %s : ", aArgs, 3);
+}
+
+/* a2b_seqChartN() */
+static void host_Message(uint32_t nEntities, const char *pFmt, void **aArgs, uint32_t nArgs)
+{
+    a2b_Char aBuf[HOST_LINE_SIZE];
+    a2b_StringBuffer oBuf;
+
+    a2b_stringBufferInit(&oBuf, aBuf, A2B_ARRAY_SIZE(aBuf));
+    host_Prefix(&oBuf, nEntities);
+    (void)a2b_vsnprintfStringBuffer(&oBuf, pFmt, aArgs, (a2b_UInt16)nArgs);
+    printf("%s\n", aBuf);
+}
+
+/* a2b_i2cFormatString() */
+static void host_I2cText(char *pBuf, const char *pFmt, void **aArgs, uint32_t nArgs,
+                         const uint8_t *pData, uint32_t nBytes)
+{
+    a2b_StringBuffer oBuf;
+    uint32_t nIndex, nShown = A2B_MIN(nBytes, HOST_I2C_DATA_ARGS);
+    void *aByte[1];
+
+    a2b_stringBufferInit(&oBuf, pBuf, HOST_I2C_BUF_SIZE);
+    (void)a2b_vsnprintfStringBuffer(&oBuf, pFmt, aArgs, (a2b_UInt16)nArgs);
+    for(nIndex = 0u; nIndex < nShown; nIndex++)
+    {
+        aByte[0] = (void *)&pData[nIndex];
+        (void)a2b_vsnprintfStringBuffer(&oBuf, "%02bX", aByte, 1);
+        if((nIndex + 1u) < nShown)
+        {
+            (void)a2b_vsnprintfStringBuffer(&oBuf, " ", NULL, 0);
+        }
+    }
+    if(nBytes > nShown)
+    {
+        (void)a2b_vsnprintfStringBuffer(&oBuf, " ...", NULL, 0);
+    }
+}
+
+/* The request and reply lines a2b_i2cRead/Write/WriteRead() chart */
+static int host_I2c(const uint32_t *pRec)
+{
+    const uint32_t *pData = &pRec[A2B_SEQBIN_REC_DATA];
+    const uint8_t *pWrite = (const uint8_t *)&pData[3];
+    const uint8_t *pRead = pWrite + A2B_SEQBIN_I2C_DATA_BYTES;
+    uint32_t nOrigin = A2B_SEQBIN_SRC(pRec[A2B_SEQBIN_REC_ENTITIES]);
+    a2b_UInt16 nAddr = (a2b_UInt16)(pData[0] & 0xFFFFu);
+    a2b_UInt16 nWrite = (a2b_UInt16)(pData[1] & 0xFFFFu);
+    a2b_UInt16 nRead = (a2b_UInt16)(pData[1] >> 16u);
+    a2b_HResult nResult = pData[2];
+    int bOk = A2B_SUCCEEDED(nResult);
+    char aText[HOST_I2C_BUF_SIZE];
+    void *aArgs[4];
+    void *aLine[1];
+
+    aLine[0] = aText;
+    aArgs[0] = &nAddr;
+    switch(pData[0] >> 16u)
+    {
+        case A2B_SEQBIN_I2C_READ:
+            aArgs[1] = &nRead;
+            aArgs[2] = &nResult;
+            host_I2cText(aText, "a2b_i2cRead(0x%02hX, %hu)", aArgs, 2u, NULL, 0u);
+            host_Message(A2B_SEQBIN_ENTITIES(nOrigin, A2B_SEQ_CHART_ENTITY_PLATFORM,
+                         A2B_SEQ_CHART_COMM_REQUEST), "%s", aLine, 1u);
+            host_TimeNote(pRec);
+            if(bOk)
+            {
+                host_I2cText(aText, "a2b_i2cRead(0x%02hX, %hu) <- ", aArgs, 2u, pRead, nRead);
+            }
+            else
+            {
+                host_I2cText(aText, "a2b_i2cRead(0x%02hX, %hu) <- Error 0x%lX", aArgs, 3u, NULL, 0u);
+            }
+            break;
+
+        case A2B_SEQBIN_I2C_WRITE:
+            aArgs[1] = &nWrite;
+            aArgs[2] = &nResult;
+            host_I2cText(aText, "a2b_i2cWrite(0x%02hX, %hu) -> ", aArgs, 2u, pWrite, nWrite);
+            host_Message(A2B_SEQBIN_ENTITIES(nOrigin, A2B_SEQ_CHART_ENTITY_PLATFORM,
+                         A2B_SEQ_CHART_COMM_REQUEST), "%s", aLine, 1u);
+            host_TimeNote(pRec);
+            if(bOk)
+            {
+                host_I2cText(aText, "a2b_i2cWrite(0x%02hX, %hu) <- Success", aArgs, 2u, NULL, 0u);
+            }
+            else
+            {
+                host_I2cText(aText, "a2b_i2cWrite(0x%02hX, %hu) <- Error: 0x%lX", aArgs, 3u, NULL, 0u);
+            }
+            break;
+
+        case A2B_SEQBIN_I2C_WRITE_READ:
+            aArgs[1] = &nWrite;
+            aArgs[2] = &nRead;
+            aArgs[3] = &nResult;
+            host_I2cText(aText, "a2b_i2cWriteRead(0x%02hX, %hu, %hu) -> ", aArgs, 3u, pWrite, nWrite);
+            host_Message(A2B_SEQBIN_ENTITIES(nOrigin, A2B_SEQ_CHART_ENTITY_PLATFORM,
+                         A2B_SEQ_CHART_COMM_REQUEST), "%s", aLine, 1u);
+            host_TimeNote(pRec);
+            if(bOk)
+            {
+                host_I2cText(aText, "a2b_i2cWriteRead(0x%02hX, %hu, %hu) <- ", aArgs, 3u, pRead, nRead);
+            }
+            else
+            {
+                host_I2cText(aText, "a2b_i2cWriteRead(0x%02hX, %hu, %hu) <- Error: 0x%lX",
+                             aArgs, 4u, NULL, 0u);
+            }
+            break;
+
+        default:
+            return 1;
+    }
+
+    host_Message(A2B_SEQBIN_ENTITIES(A2B_SEQ_CHART_ENTITY_PLATFORM, nOrigin,
+                 A2B_SEQ_CHART_COMM_REPLY), "%s", aLine, 1u);
+    host_TimeNote(pRec);
+
+    return 0;
+}
+
+/* Renders one record; returns 0 on success */
+static int host_RenderRecord(const uint32_t *pRec, uint32_t nPtrWords)
+{
+    union
+    {
+        a2b_UInt8   b;
+        a2b_UInt16  h;
+        a2b_UInt32  l;
+        uint64_t    L;
+    } aValue[A2B_TRCBIN_MAX_ARGS];
+    void *aArgs[A2B_TRCBIN_MAX_ARGS];
+    a2b_Char aText[A2B_CONF_TRACE_BUF_SIZE];
+    uint32_t nWords = A2B_SEQBIN_REC_WORDS(pRec[A2B_SEQBIN_REC_HDR]);
+    uint32_t nPos = A2B_SEQBIN_REC_DATA;
+    uint32_t nDesc, nKind, nArgs = 0u, nText;
+    a2b_UIntPtr nTitle;
+    const char *pFmt;
+
+    switch(A2B_SEQBIN_REC_TYPE(pRec[A2B_SEQBIN_REC_HDR]))
+    {
+        case A2B_SEQBIN_TYPE_START:
+            nTitle = host_Ptr(&pRec[nPos + 1u], nPtrWords);
+            host_Header(pRec[nPos], (nTitle != 0u) ? host_String(nTitle) : NULL);
+            break;
+
+        case A2B_SEQBIN_TYPE_STOP:
+            host_Line("@enduml", NULL, 0u);
+            break;
+
+        case A2B_SEQBIN_TYPE_TEXT:
+            /* a2b_seqChartInject() passes the text as a format */
+            nText = pRec[nPos];
+            if((nText >= sizeof(aText)) || ((nPos + 1u + ((nText + 3u) / 4u)) > nWords))
+            {
+                return 1;
+            }
+            memcpy(aText, &pRec[nPos + 1u], nText);
+            aText[nText] = '\0';
+            host_Line(aText, NULL, 0u);
+            host_TimeNote(pRec);
+            break;
+
+        case A2B_SEQBIN_TYPE_I2C:
+            if(nWords != A2B_SEQBIN_I2C_WORDS)
+            {
+                return 1;
+            }
+            return host_I2c(pRec);
+
+        case A2B_SEQBIN_TYPE_MSG:
+            pFmt = host_String(host_Ptr(&pRec[nPos], nPtrWords));
+            nPos += nPtrWords;
+            nDesc = a2b_vsnprintfArgKinds(pFmt);
+
+            while((nPos < nWords) && (nArgs < A2B_TRCBIN_DESC_COUNT(nDesc)))
+            {
+                nKind = A2B_TRCBIN_DESC_KIND(nDesc, nArgs);
+                aArgs[nArgs] = &aValue[nArgs];
+                switch(nKind)
+                {
+                    case A2B_TRCBIN_ARG_8:
+                        aValue[nArgs].b = (a2b_UInt8)pRec[nPos];
+                        nPos++;
+                        break;
+                    case A2B_TRCBIN_ARG_16:
+                        aValue[nArgs].h = (a2b_UInt16)pRec[nPos];
+                        nPos++;
+                        break;
+                    case A2B_TRCBIN_ARG_64:
+                        aValue[nArgs].L = (uint64_t)pRec[nPos] | ((uint64_t)pRec[nPos + 1u] << 32u);
+                        nPos += 2u;
+                        break;
+                    case A2B_TRCBIN_ARG_PTR:
+                        aArgs[nArgs] = (void *)(uintptr_t)host_Ptr(&pRec[nPos], nPtrWords);
+                        nPos += nPtrWords;
+                        break;
+                    case A2B_TRCBIN_ARG_STR:
+                        aArgs[nArgs] = (void *)host_String(host_Ptr(&pRec[nPos], nPtrWords));
+                        nPos += nPtrWords;
+                        break;
+                    default:
+                        aValue[nArgs].l = pRec[nPos];
+                        nPos++;
+                        break;
+                }
+                nArgs++;
+            }
+            if(nPos != nWords)
+            {
+                return 1;
+            }
+            host_Message(pRec[A2B_SEQBIN_REC_ENTITIES], pFmt, aArgs, nArgs);
+            host_TimeNote(pRec);
+            break;
+
+        default:
+            return 1;
+    }
+
+    return 0;
+}
+
+/* Renders a dump to stdout; returns 0 on success */
+static int host_Render(const uint8_t *pData, size_t nSize)
+{
+    const uint32_t *pWords = (const uint32_t *)pData;
+    size_t nCount = nSize / 4u;
+    uint32_t nPtrWords, nRecWords, nPos, nLen;
+    a2b_UIntPtr nAddr;
+
+    if((nCount < A2B_SEQBIN_HDR_WORDS) || (pWords[0] != A2B_SEQBIN_MAGIC) ||
+       (pWords[1] != A2B_SEQBIN_VERSION))
+    {
+        fprintf(stderr, "not a binary sequence chart dump\n");
+        return 1;
+    }
+    nPtrWords = pWords[2];
+    nRecWords = pWords[3];
+    if(((nPtrWords * 4u) > sizeof(a2b_UIntPtr)) || ((A2B_SEQBIN_HDR_WORDS + nRecWords) > nCount))
+    {
+        fprintf(stderr, "unsupported or truncated dump\n");
+        return 1;
+    }
+
+    /* Strings follow the records */
+    nStrings = 0u;
+    nPos = A2B_SEQBIN_HDR_WORDS + nRecWords;
+    while((nPos < nCount) && (pWords[nPos] == A2B_SEQBIN_STR_MAGIC))
+    {
+        nAddr = host_Ptr(&pWords[nPos + 1u], nPtrWords);
+        nLen = pWords[nPos + 1u + nPtrWords];
+        nPos += 2u + nPtrWords;
+        if((nPos + ((nLen + 3u) / 4u)) > nCount)
+        {
+            fprintf(stderr, "truncated string table\n");
+            return 1;
+        }
+        if(nStrings < HOST_MAX_STRINGS)
+        {
+            char *pStr = malloc(nLen + 1u);
+            memcpy(pStr, &pWords[nPos], nLen);
+            pStr[nLen] = '\0';
+            aStrings[nStrings].nAddr = nAddr;
+            aStrings[nStrings].pStr = pStr;
+            nStrings++;
+        }
+        nPos += (nLen + 3u) / 4u;
+    }
+
+    nPos = A2B_SEQBIN_HDR_WORDS;
+    while(nPos < (A2B_SEQBIN_HDR_WORDS + nRecWords))
+    {
+        uint32_t nHdr = pWords[nPos];
+
+        if(!A2B_SEQBIN_REC_IS_VALID(nHdr) || (A2B_SEQBIN_REC_WORDS(nHdr) == 0u) ||
+           (host_RenderRecord(&pWords[nPos], nPtrWords) != 0))
+        {
+            fprintf(stderr, "bad record at word %u\n", nPos);
+            return 1;
+        }
+        nPos += A2B_SEQBIN_REC_WORDS(nHdr);
+    }
+
+    if(pWords[4] != 0u)
+    {
+        fprintf(stderr, "%u later events did not fit the capture\n", pWords[4]);
+    }
+
+    return 0;
+}
+#endif
+
+/*------------------------------- workload -------------------------------*/
+
+/* i2c.c resets the cached access mode on failures */
+void a2b_stackResetI2cLastMode(a2b_I2cLastMode* mode)
+{
+    mode->access = A2B_I2C_ACCESS_UNKNOWN;
+    mode->nodeAddr = A2B_NODEADDR_NOTUSED;
+    mode->chipAddr = A2B_INVALID_7BIT_I2C_ADDRESS;
+    mode->broadcast = A2B_FALSE;
+}
+
+static a2b_UInt32 A2B_CALL host_GetSysTime(void)
+{
+    return nSysTime;
+}
+
+static a2b_HResult host_I2cResult(a2b_UInt16 addr)
+{
+    nTransfers++;
+    if((nTransfers % 17u) == 0u)
+    {
+        return A2B_MAKE_HRESULT(A2B_SEV_FAILURE, A2B_FAC_PLATFORM, A2B_EC_IO);
+    }
+    (void)addr;
+    return A2B_RESULT_SUCCESS;
+}
+
+static a2b_HResult A2B_CALL host_I2cRead(a2b_Handle hnd, a2b_UInt16 addr, a2b_UInt16 nRead,
+                                         a2b_Byte* rBuf)
+{
+    a2b_UInt16 nIndex;
+
+    (void)hnd;
+    for(nIndex = 0u; nIndex < nRead; nIndex++)
+    {
+        rBuf[nIndex] = (a2b_Byte)(nTransfers + (nIndex * 3u));
+    }
+    return host_I2cResult(addr);
+}
+
+static a2b_HResult A2B_CALL host_I2cWrite(a2b_Handle hnd, a2b_UInt16 addr, a2b_UInt16 nWrite,
+                                          const a2b_Byte* wBuf)
+{
+    (void)hnd;
+    (void)nWrite;
+    (void)wBuf;
+    return host_I2cResult(addr);
+}
+
+static a2b_HResult A2B_CALL host_I2cWriteRead(a2b_Handle hnd, a2b_UInt16 addr, a2b_UInt16 nWrite,
+                                              const a2b_Byte* wBuf, a2b_UInt16 nRead, a2b_Byte* rBuf)
+{
+    (void)nWrite;
+    (void)wBuf;
+    return host_I2cRead(hnd, addr, nRead, rBuf);
+}
+
+#ifndef A2B_FEATURE_SEQ_CHART_BINARY
+static a2b_Handle A2B_CALL host_LogOpen(const a2b_Char* url)
+{
+    (void)url;
+    return (a2b_Handle)stdout;
+}
+
+static a2b_HResult A2B_CALL host_LogClose(a2b_Handle hnd)
+{
+    (void)hnd;
+    return A2B_RESULT_SUCCESS;
+}
+
+static a2b_HResult A2B_CALL host_LogWrite(a2b_Handle hnd, const a2b_Char* msg)
+{
+    if(!bLogQuiet)
+    {
+        fprintf((FILE *)hnd, "%s\n", msg);
+    }
+    return A2B_RESULT_SUCCESS;
+}
+#else
+static void A2B_CALL host_DumpWrite(a2b_Handle hnd, const a2b_Byte* data, a2b_UInt32 nBytes)
+{
+    (void)hnd;
+    if((nDumpSize + nBytes) <= HOST_MAX_DUMP)
+    {
+        memcpy(&pDump[nDumpSize], data, nBytes);
+    }
+    nDumpSize += nBytes;
+}
+#endif
+
+static void host_Init(void)
+{
+    memset(&oStk, 0, sizeof(oStk));
+    memset(&oEcb, 0, sizeof(oEcb));
+    oEcb.baseEcb.i2cMasterAddr = HOST_MASTER_I2C;
+    oStk.ecb = &oEcb;
+    oStk.pal.timerGetSysTime = &host_GetSysTime;
+    oStk.pal.i2cRead = &host_I2cRead;
+    oStk.pal.i2cWrite = &host_I2cWrite;
+    oStk.pal.i2cWriteRead = &host_I2cWriteRead;
+#ifndef A2B_FEATURE_SEQ_CHART_BINARY
+    oStk.pal.logOpen = &host_LogOpen;
+    oStk.pal.logClose = &host_LogClose;
+    oStk.pal.logWrite = &host_LogWrite;
+#endif
+    a2b_stackResetI2cLastMode(&oStk.i2cMode);
+    oCtx.stk = &oStk;
+}
+
+/* Runs as the application or as the plugin of a node */
+static void host_Domain(a2b_Int16 nNode, int bApp)
+{
+    oCtx.domain = bApp ? A2B_DOMAIN_APP : A2B_DOMAIN_PLUGIN;
+    oCtx.ccb.plugin.nodeSig.nodeAddr = nNode;
+}
+
+/* One discovery like step: returns the number of I2C transfers issued */
+static void host_Step(uint32_t nStep)
+{
+    static const char *aNames[] = { "AD2428", "AD2425", "AD2426", "AD2420" };
+    a2b_Byte aWrite[12];
+    a2b_Byte aRead[12];
+    a2b_Int16 nNode = (a2b_Int16)(nStep % 4u);
+    a2b_UInt16 nChip = (a2b_UInt16)(0x50u + (nStep % 3u));
+    a2b_UInt8 nReg = (a2b_UInt8)(nStep * 5u);
+    a2b_UInt32 nValue = nStep * 2654435761u;
+    a2b_UInt32 nMsgId = nStep % 7u;
+    const char *pName = aNames[nStep % 4u];
+    uint32_t nIndex;
+
+    for(nIndex = 0u; nIndex < sizeof(aWrite); nIndex++)
+    {
+        aWrite[nIndex] = (a2b_Byte)(nReg + nIndex);
+    }
+
+    nSysTime += 1u + (nStep % 3u);
+    switch(nStep % 6u)
+    {
+        case 0u:
+            host_Domain(A2B_NODEADDR_MASTER, 1);
+            A2B_SEQ_CHART2((&oCtx, A2B_SEQ_CHART_ENTITY_APP, A2B_SEQ_CHART_ENTITY_STACK,
+                            A2B_SEQ_CHART_COMM_REQUEST, A2B_SEQ_CHART_LEVEL_MSGS,
+                            "a2b_msgRtrSendRequest(msgId=%lu, node=%hd)", &nMsgId, &nNode));
+            host_Domain(A2B_NODEADDR_MASTER, 0);
+            (void)a2b_i2cMasterWrite(&oCtx, 2u, aWrite);
+            (void)a2b_i2cMasterWriteRead(&oCtx, 1u, aWrite, 4u, aRead);
+            (void)a2b_i2cMasterRead(&oCtx, 1u, aRead);
+            break;
+
+        case 1u:
+            host_Domain(A2B_NODEADDR_MASTER, 0);
+            A2B_SEQ_GROUP1(&oCtx, A2B_SEQ_CHART_LEVEL_DISCOVERY, "Discover node %hd", &nNode);
+            (void)a2b_i2cSlaveWrite(&oCtx, nNode, 12u, aWrite);
+            (void)a2b_i2cSlaveWriteRead(&oCtx, nNode, 1u, aWrite, 9u, aRead);
+            A2B_SEQ_END(&oCtx, A2B_SEQ_CHART_LEVEL_DISCOVERY);
+            break;
+
+        case 2u:
+            host_Domain(A2B_NODEADDR_MASTER, 0);
+            (void)a2b_i2cSlaveBroadcastWrite(&oCtx, 2u, aWrite);
+            (void)a2b_i2cSlaveRead(&oCtx, nNode, 2u, aRead);
+            A2B_SEQ_GENNOTE2(&oCtx, A2B_SEQ_CHART_LEVEL_DISCOVERY, "node %hd is an %s",
+                             &nNode, pName);
+            break;
+
+        case 3u:
+            /* The application reaches a peripheral */
+            host_Domain(A2B_NODEADDR_MASTER, 1);
+            (void)a2b_i2cPeriphWrite(&oCtx, nNode, nChip, 3u, aWrite);
+            (void)a2b_i2cPeriphWriteRead(&oCtx, nNode, nChip, 1u, aWrite, 2u, aRead);
+            A2B_SEQ_CHART3((&oCtx, A2B_SEQ_CHART_ENTITY_STACK, A2B_SEQ_CHART_ENTITY_APP,
+                            A2B_SEQ_CHART_COMM_NOTIFY, A2B_SEQ_CHART_LEVEL_MSGS,
+                            "notify %s reg 0x%02bX = 0x%08lX", (void *)pName, &nReg, &nValue));
+            break;
+
+        case 4u:
+            /* A slave plugin reaches its own peripheral */
+            host_Domain(nNode, 0);
+            (void)a2b_i2cPeriphRead(&oCtx, nNode, nChip, 5u, aRead);
+            (void)a2b_i2cPeriphWrite(&oCtx, nNode, nChip, 9u, aWrite);
+            A2B_SEQ_CHART1((&oCtx, A2B_NODE_ADDR_TO_CHART_PLUGIN_ENTITY(nNode),
+                            A2B_SEQ_CHART_ENTITY_STACK, A2B_SEQ_CHART_COMM_REPLY,
+                            A2B_SEQ_CHART_LEVEL_MSGS, "peripheral done, 100%% ok (%lu)", &nValue));
+            break;
+
+        default:
+            host_Domain(A2B_NODEADDR_MASTER, 0);
+            A2B_SEQ_RAW1(&oCtx, A2B_SEQ_CHART_LEVEL_MSGS, "== step %lu ==", &nStep);
+            /* Not charted: level not enabled */
+            A2B_SEQ_CHART0((&oCtx, A2B_SEQ_CHART_ENTITY_APP, A2B_SEQ_CHART_ENTITY_STACK,
+                            A2B_SEQ_CHART_COMM_REQUEST, A2B_SEQ_CHART_LEVEL_7, "hidden"));
+            A2B_SEQ_CHART0((&oCtx, A2B_SEQ_CHART_ENTITY_PLUGIN_MASTER, A2B_SEQ_CHART_ENTITY_PLATFORM,
+                            (a2b_SeqChartCommType)7, A2B_SEQ_CHART_LEVEL_MSGS, "odd arrow"));
+            break;
+    }
+}
+
+static void host_Chart(uint32_t nSteps)
+{
+    uint32_t nStep;
+
+    host_Domain(A2B_NODEADDR_MASTER, 1);
+    (void)a2b_seqChartStart(&oCtx, "chart", A2B_SEQ_CHART_LEVEL_I2C | A2B_SEQ_CHART_LEVEL_MSGS |
+                            A2B_SEQ_CHART_LEVEL_DISCOVERY, A2B_SEQ_CHART_OPT_ALL, "Sequence Chart");
+    for(nStep = 0u; nStep < nSteps; nStep++)
+    {
+        host_Step(nStep);
+    }
+    host_Domain(A2B_NODEADDR_MASTER, 1);
+    (void)a2b_seqChartStop(&oCtx);
+}
+
+static int host_Workload(uint32_t nSteps)
+{
+    host_Init();
+    nSysTime = 0xFFFFFFF0u;
+    host_Chart(nSteps);
+
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+    {
+        int nRet;
+
+        pDump = malloc(HOST_MAX_DUMP);
+        nDumpSize = 0u;
+        a2b_seqChartBinDump(&host_DumpWrite, NULL);
+        if(nDumpSize > HOST_MAX_DUMP)
+        {
+            fprintf(stderr, "dump of %zu bytes too large\n", nDumpSize);
+            return 1;
+        }
+        fprintf(stderr, "%zu byte dump of a %u word capture\n", nDumpSize,
+                (unsigned)A2B_CONF_SEQ_CHART_BIN_SIZE);
+        nRet = host_Render(pDump, nDumpSize);
+        free(pDump);
+        return nRet;
+    }
+#else
+    return 0;
+#endif
+}
+
+/* Master writes with the chart running against the chart stopped */
+static int host_Bench(void)
+{
+    a2b_Byte aWrite[4] = { 0x12u, 0x34u, 0x56u, 0x78u };
+    uint32_t nRepeat, nCall, nCalls = 200000u;
+    double dT0, dNs, dOn = 0.0, dOff = 0.0;
+
+    host_Init();
+    host_Domain(A2B_NODEADDR_MASTER, 0);
+    bLogQuiet = 1;
+    for(nRepeat = 0u; nRepeat < HOST_REPEAT; nRepeat++)
+    {
+        dT0 = host_Seconds();
+        for(nCall = 0u; nCall < nCalls; nCall++)
+        {
+            /* Restart well before a binary capture fills up */
+            if((nCall % 256u) == 0u)
+            {
+                (void)a2b_seqChartStart(&oCtx, "chart", A2B_SEQ_CHART_LEVEL_I2C,
+                                        A2B_SEQ_CHART_OPT_ALL, NULL);
+            }
+            (void)a2b_i2cMasterWrite(&oCtx, 4u, aWrite);
+        }
+        (void)a2b_seqChartStop(&oCtx);
+        dNs = ((host_Seconds() - dT0) * 1e9) / (double)nCalls;
+        dOn = ((nRepeat == 0u) || (dNs < dOn)) ? dNs : dOn;
+
+        dT0 = host_Seconds();
+        for(nCall = 0u; nCall < nCalls; nCall++)
+        {
+            (void)a2b_i2cMasterWrite(&oCtx, 4u, aWrite);
+        }
+        dNs = ((host_Seconds() - dT0) * 1e9) / (double)nCalls;
+        dOff = ((nRepeat == 0u) || (dNs < dOff)) ? dNs : dOff;
+    }
+
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+    printf("binary chart, host timings, best of %u x %u master writes (4 bytes)\n", HOST_REPEAT, nCalls);
+#else
+    printf("text chart, host timings, best of %u x %u master writes (4 bytes, lines not written)\n",
+           HOST_REPEAT, nCalls);
+#endif
+    printf("  chart stopped   %6.1f ns/transfer\n", dOff);
+    printf("  chart running   %6.1f ns/transfer\n", dOn);
+    printf("  chart cost      %6.1f ns/transfer\n", dOn - dOff);
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t nSteps = 120u;
+    int nArg, bWork = 0, bBench = 0;
+    const char *pPath = NULL;
+    FILE *pFile;
+    uint8_t *pData;
+    size_t nSize;
+    int nRet;
+
+    for(nArg = 1; nArg < argc; nArg++)
+    {
+        if(strcmp(argv[nArg], "-w") == 0) { bWork = 1; }
+        else if(strcmp(argv[nArg], "-b") == 0) { bBench = 1; }
+        else if((strcmp(argv[nArg], "-n") == 0) && ((nArg + 1) < argc)) { nSteps = (uint32_t)atol(argv[++nArg]); }
+        else { pPath = argv[nArg]; }
+    }
+
+    if(bWork)
+    {
+        return host_Workload(nSteps);
+    }
+    if(bBench)
+    {
+        return host_Bench();
+    }
+
+#ifdef A2B_FEATURE_SEQ_CHART_BINARY
+    if(pPath == NULL)
+    {
+        fprintf(stderr, "usage: seqchart_host dump.bin | -w [-n steps] | -b\n");
+        return 2;
+    }
+
+    pFile = fopen(pPath, "rb");
+    if(pFile == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", pPath);
+        return 2;
+    }
+    pData = malloc(HOST_MAX_DUMP);
+    nSize = fread(pData, 1u, HOST_MAX_DUMP, pFile);
+    fclose(pFile);
+
+    nRet = host_Render(pData, nSize);
+    free(pData);
+
+    return nRet;
+#else
+    (void)pPath;
+    (void)pFile;
+    (void)pData;
+    (void)nSize;
+    (void)nRet;
+    fprintf(stderr, "usage: seqchart_host -w [-n steps] | -b (dumps need the binary build)\n");
+    return 2;
+#endif
+}
@@ -0,0 +1,351 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : timer_host.c
+
+   Description: Host benchmark of the stack timer service (a2bstack timer.c)
+                against the previous tick, which walked every allocated
+                timer of the stack once per millisecond.
+
+                The load is one 1 msec repeating timer (interrupt poll) and
+                the rest mostly idle: half repeating with periods of 50 msec
+                to ~1 s, half single shot and re-armed from their callback
+                (discovery, peripheral and BECOVF style timers).
+
+                The previous tick loop is kept here verbatim and runs on the
+                same timer objects. Both run the same schedule; the expiry
+                count of every timer is compared, and a2b_timerNextDeadline() is
+                checked against a scan of all timers on every tick, also
+                with the tick arriving late (several msec per call).
+
+                timer_host [-t msec]
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    -I../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src
+                    timer_host.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/timer.c
+                    -o timer_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "a2bstack/inc/a2b/timer.h"
+#include "stack_priv.h"
+#include "stackctx.h"
+#include "timer_priv.h"
+
+/*============= D E F I N E S =============*/
+
+#define HOST_MAX_TIMERS     (1000u)
+#define HOST_REPEAT         (3u)
+
+/*============= D A T A =============*/
+
+static uint32_t nSysTime;
+
+static a2b_Stack oStk;
+static a2b_StackContext oCtx;
+static struct a2b_Timer *aTimer[HOST_MAX_TIMERS];
+
+static uint32_t aFiresWheel[HOST_MAX_TIMERS];
+static uint32_t aFiresLegacy[HOST_MAX_TIMERS];
+static uint32_t *pFires = aFiresWheel;
+
+/*============= C O D E =============*/
+
+static double host_Seconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (double)oTs.tv_sec + ((double)oTs.tv_nsec * 1e-9);
+}
+
+static a2b_UInt32 A2B_CALL host_GetSysTime(void)
+{
+    return nSysTime;
+}
+
+static void* A2B_CALL host_Malloc(a2b_Handle hnd, a2b_UInt32 size)
+{
+    (void)hnd;
+    return malloc(size);
+}
+
+static void A2B_CALL host_Free(a2b_Handle hnd, void* p)
+{
+    (void)hnd;
+    free(p);
+}
+
+/* Schedule shared by both services */
+static uint32_t host_Period(uint32_t nIndex)
+{
+    return (nIndex == 0u) ? 1u : (50u + ((nIndex * 37u) % 1000u));
+}
+
+static uint32_t host_IsSingleShot(uint32_t nIndex)
+{
+    return (nIndex != 0u) && ((nIndex & 1u) != 0u);
+}
+
+static uint32_t host_Rearm(uint32_t nIndex, uint32_t nFires)
+{
+    return 20u + (((nIndex * 13u) + (nFires * 7u)) % 500u);
+}
+
+/*------------------------- stack timer service -------------------------*/
+
+static void A2B_CALL host_OnTimeout(struct a2b_Timer* timer, a2b_Handle userData)
+{
+    uint32_t nIndex = (uint32_t)(uintptr_t)userData;
+
+    pFires[nIndex]++;
+    if(host_IsSingleShot(nIndex))
+    {
+        a2b_timerSet(timer, host_Rearm(nIndex, pFires[nIndex]), 0u);
+        a2b_timerStart(timer);
+    }
+}
+
+static void host_Setup(uint32_t nTimers, uint32_t *pCount)
+{
+    uint32_t nIndex;
+
+    pFires = pCount;
+    memset(&oStk, 0, sizeof(oStk));
+    oStk.pal.memMgrMalloc = &host_Malloc;
+    oStk.pal.memMgrFree = &host_Free;
+    oStk.pal.timerGetSysTime = &host_GetSysTime;
+    SLIST_INIT(&oStk.timerList);
+    oCtx.stk = &oStk;
+    oCtx.domain = A2B_DOMAIN_APP;
+
+    for(nIndex = 0u; nIndex < nTimers; nIndex++)
+    {
+        uint32_t nPeriod = host_Period(nIndex);
+
+        pFires[nIndex] = 0u;
+        aTimer[nIndex] = a2b_timerAlloc(&oCtx, &host_OnTimeout, (a2b_Handle)(uintptr_t)nIndex);
+        a2b_timerSet(aTimer[nIndex], nPeriod, host_IsSingleShot(nIndex) ? 0u : nPeriod);
+        a2b_timerStart(aTimer[nIndex]);
+    }
+}
+
+static void host_Teardown(uint32_t nTimers)
+{
+    uint32_t nIndex;
+
+    for(nIndex = 0u; nIndex < nTimers; nIndex++)
+    {
+        (void)a2b_timerUnref(aTimer[nIndex]);
+    }
+}
+
+/*------------------------- previous timer service -------------------------*/
+
+/* The previous a2b_timerTick(): every allocated timer is visited */
+__attribute__((noinline))
+static void host_LegacyTick(struct a2b_StackContext* ctx)
+{
+    a2b_Timer* timer;
+    a2b_Timer* next;
+    a2b_UInt32 nTimerRemaining = 0u;
+    a2b_Bool bTimterActive = A2B_FALSE;
+
+    next = SLIST_FIRST(&ctx->stk->timerList);
+    while ( next != SLIST_END(&ctx->stk->timerList) )
+    {
+        timer = next;
+        a2b_timerRef(timer);
+
+        bTimterActive = a2b_timerIsActive(timer);
+        if ( bTimterActive )
+        {
+            nTimerRemaining = a2b_timerRemaining(timer);
+        }
+
+        if ( (bTimterActive) && (nTimerRemaining == 0u) )
+        {
+            if ( A2B_NULL != timer->expireFunc )
+            {
+                timer->expireFunc(timer, timer->userData);
+            }
+
+            bTimterActive = a2b_timerIsActive(timer);
+            if ( bTimterActive )
+            {
+                nTimerRemaining = a2b_timerRemaining(timer);
+            }
+            if ( (bTimterActive) && (nTimerRemaining == 0u) )
+            {
+                if ( timer->repeat == (a2b_UInt32)0 )
+                {
+                    a2b_timerStop(timer);
+                }
+                else
+                {
+                    a2b_timerSet(timer, timer->repeat, timer->repeat);
+                    a2b_timerStart(timer);
+                }
+            }
+        }
+
+        next = SLIST_NEXT(timer, link);
+        (void)a2b_timerUnref(timer);
+    }
+}
+
+/*------------------------------- checks -------------------------------*/
+
+static uint32_t host_ScanDeadline(uint32_t nTimers)
+{
+    uint32_t nIndex, nMin = A2B_TIMER_NO_DEADLINE;
+
+    for(nIndex = 0u; nIndex < nTimers; nIndex++)
+    {
+        if(a2b_timerIsActive(aTimer[nIndex]))
+        {
+            uint32_t nRemaining = a2b_timerRemaining(aTimer[nIndex]);
+            nMin = (nRemaining < nMin) ? nRemaining : nMin;
+        }
+    }
+
+    return nMin;
+}
+
+static int host_Check(uint32_t nTimers, uint32_t nStart, uint32_t nMsec, uint32_t nStep)
+{
+    uint32_t nIndex, nNext, nScan, nErrors = 0u;
+
+    /* Previous tick */
+    nSysTime = nStart;
+    host_Setup(nTimers, aFiresLegacy);
+    while((nSysTime - nStart) < nMsec)
+    {
+        nSysTime += nStep;
+        host_LegacyTick(&oCtx);
+    }
+    host_Teardown(nTimers);
+
+    /* Timer wheel */
+    nSysTime = nStart;
+    host_Setup(nTimers, aFiresWheel);
+    while((nSysTime - nStart) < nMsec)
+    {
+        nSysTime += nStep;
+        a2b_timerTick(&oCtx);
+
+        nNext = a2b_timerNextDeadline(&oCtx);
+        nScan = host_ScanDeadline(nTimers);
+        if(nNext != nScan)
+        {
+            if(nErrors++ < 5u)
+            {
+                printf("  t=%u next deadline %u, scan %u\n", nSysTime, nNext, nScan);
+            }
+        }
+    }
+    host_Teardown(nTimers);
+
+    for(nIndex = 0u; nIndex < nTimers; nIndex++)
+    {
+        if(aFiresWheel[nIndex] != aFiresLegacy[nIndex])
+        {
+            if(nErrors++ < 10u)
+            {
+                printf("  timer %u fired %u times, previously %u\n", nIndex,
+                       aFiresWheel[nIndex], aFiresLegacy[nIndex]);
+            }
+        }
+    }
+
+    return (nErrors == 0u) ? 0 : 1;
+}
+
+/*------------------------------- timing -------------------------------*/
+
+static double host_Time(uint32_t bLegacy, uint32_t nTimers, uint32_t nMsec)
+{
+    uint32_t nRepeat, nTick;
+    double dT0, dNs, dBest = 0.0;
+
+    for(nRepeat = 0u; nRepeat < HOST_REPEAT; nRepeat++)
+    {
+        nSysTime = 0u;
+        host_Setup(nTimers, bLegacy ? aFiresLegacy : aFiresWheel);
+        dT0 = host_Seconds();
+        for(nTick = 0u; nTick < nMsec; nTick++)
+        {
+            nSysTime++;
+            if(bLegacy)
+            {
+                host_LegacyTick(&oCtx);
+            }
+            else
+            {
+                a2b_timerTick(&oCtx);
+            }
+        }
+        dNs = ((host_Seconds() - dT0) * 1e9) / (double)nMsec;
+        host_Teardown(nTimers);
+        if((nRepeat == 0u) || (dNs < dBest))
+        {
+            dBest = dNs;
+        }
+    }
+
+    return dBest;
+}
+
+int main(int argc, char *argv[])
+{
+    static const uint32_t aCount[] = { 10u, 100u, 1000u };
+    uint32_t nIndex, nMsec = 600000u;
+    int nArg, nRet, nFail = 0;
+
+    for(nArg = 1; nArg < argc; nArg++)
+    {
+        if((strcmp(argv[nArg], "-t") == 0) && ((nArg + 1) < argc)) { nMsec = (uint32_t)atol(argv[++nArg]); }
+    }
+
+    printf("checks (expiry counts vs. previous tick, next deadline vs. scan)\n");
+    for(nIndex = 0u; nIndex < (sizeof(aCount) / sizeof(aCount[0])); nIndex++)
+    {
+        uint32_t nStep;
+
+        for(nStep = 1u; nStep <= 7u; nStep += 3u)
+        {
+            nRet = host_Check(aCount[nIndex], 0x10000u, 20000u, nStep);
+
+            printf("  %4u timers, %u msec per tick: %s\n", aCount[nIndex], nStep,
+                   (nRet == 0) ? "ok" : "MISMATCH");
+            nFail |= nRet;
+        }
+    }
+    nRet = host_Check(1000u, 0xFFFFC000u, 40000u, 1u);
+    printf("  1000 timers, system time wrapping: %s\n", (nRet == 0) ? "ok" : "MISMATCH");
+    nFail |= nRet;
+
+    printf("\nhost timings, best of %u x %u ticks of 1 msec\n", HOST_REPEAT, nMsec);
+    printf("  timers   list walk ns/tick   wheel ns/tick   speedup\n");
+    for(nIndex = 0u; nIndex < (sizeof(aCount) / sizeof(aCount[0])); nIndex++)
+    {
+        double dLegacy = host_Time(1u, aCount[nIndex], nMsec);
+        double dWheel = host_Time(0u, aCount[nIndex], nMsec);
+
+        printf("  %6u   %17.1f   %13.1f   %6.1fx\n", aCount[nIndex], dLegacy, dWheel,
+               dLegacy / dWheel);
+    }
+
+    return nFail;
+}
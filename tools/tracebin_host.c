@@ -0,0 +1,830 @@
+/*******************************************************************************
+Copyright (c) 2015 - Analog Devices Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc.
+and its licensors.
+*******************************************************************************
+
+   Name       : tracebin_host.c
+
+   Description: Renders a binary trace dump (A2B_FEATURE_TRACE_BINARY,
+                a2b_traceBinDump()) into the text the stack writes to the
+                trace log channel without the binary option:
+
+                  <time> <file>:<function>(<line>) [<LEVEL>] <message>
+
+                Messages are formatted with the stack's own
+                a2b_vsnprintfStringBuffer(), so the text is the same as the
+                one formatted on target. The dump must come from a target of
+                the same byte order as the host.
+
+                tracebin_host dump.bin      render a dump to stdout
+                tracebin_host -t [-n msgs]  self test and host timing
+
+                I2C transfers (A2B_TRACE_I2C) are stored by value and are
+                formatted here as i2c.c formats them for the text trace; a
+                successful write/read renders as its two lines.
+
+                The self test links trace.c with the binary option, traces
+                a discovery like mix of messages (all argument sizes,
+                strings, pointers, injected text, I2C transfers from a
+                reused buffer) through the A2B_TRACEn macros until the ring
+                has wrapped many times, dumps it and compares every
+                rendered line with the text formatted at the time of the
+                call. It then times a message recorded into the
+                ring against formatting the same message as the text trace
+                does (without the file write).
+
+   Build      : gcc -O2 -DA2B_CONF_POINTER_SIZE=64
+                    -DA2B_FEATURE_TRACE -DA2B_FEATURE_TRACE_BINARY
+                    -I../RNC_21569/a2b_stack/a2bstack-pal
+                    -I../RNC_21569/a2b_stack/a2bstack-gen
+                    -I../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src
+                    tracebin_host.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/trace.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/util.c
+                    ../RNC_21569/a2b_stack/a2bstack-gen/a2bstack/src/stringbuffer.c
+                    -o tracebin_host
+
+******************************************************************************/
+
+/*============= I N C L U D E S =============*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "a2bstack/inc/a2b/trace.h"
+#include "a2bstack/inc/a2b/util.h"
+#include "a2bstack/inc/a2b/stringbuffer.h"
+#include "stack_priv.h"
+#include "stackctx.h"
+#include "trace_priv.h"
+
+/*============= D E F I N E S =============*/
+
+#define HOST_MAX_STRINGS    (4096u)
+#define HOST_MAX_LINES      (A2B_CONF_TRACE_BIN_SIZE)
+#define HOST_LINE_SIZE      (A2B_CONF_TRACE_BUF_SIZE + 1u)
+#define HOST_MAX_DUMP       (1024u * 1024u)
+#define HOST_REPEAT         (5u)
+#define HOST_I2C_BUF_SIZE   (64u)   /* A2B_I2C_TEMP_BUF_SIZE in i2c.c */
+
+/*============= D A T A =============*/
+
+typedef struct
+{
+    a2b_UIntPtr     nAddr;
+    const char*     pStr;
+
+}HOST_STRING;
+
+typedef void (*HOST_LINE_FUNC)(const char *pLine);
+
+static HOST_STRING aStrings[HOST_MAX_STRINGS];
+static uint32_t nStrings;
+static uint32_t nRecords;
+
+/* Self test */
+static a2b_Stack oStk;
+static a2b_StackContext oCtx;
+static uint32_t nSysTime;
+static char aExpect[HOST_MAX_LINES][HOST_LINE_SIZE];
+static uint32_t nExpectHead;
+static uint32_t nExpectCount;
+static uint32_t nExpectTotal;
+static uint32_t nExpectExtra;   /* Lines beyond one per record */
+static uint8_t *pDump;
+static size_t nDumpSize;
+static char (*pDumpLines)[HOST_LINE_SIZE];
+static uint32_t nDumpLines;
+
+/*============= C O D E =============*/
+
+static double host_Seconds(void)
+{
+    struct timespec oTs;
+    clock_gettime(CLOCK_MONOTONIC, &oTs);
+    return (double)oTs.tv_sec + ((double)oTs.tv_nsec * 1e-9);
+}
+
+/*------------------------------- renderer -------------------------------*/
+
+static const char* host_String(a2b_UIntPtr nAddr)
+{
+    uint32_t nIndex;
+
+    for(nIndex = 0u; nIndex < nStrings; nIndex++)
+    {
+        if(aStrings[nIndex].nAddr == nAddr)
+        {
+            return aStrings[nIndex].pStr;
+        }
+    }
+
+    return "?";
+}
+
+static a2b_UIntPtr host_Ptr(const uint32_t *pWords, uint32_t nPtrWords)
+{
+    a2b_UIntPtr nValue = 0u;
+    uint32_t nIndex;
+
+    for(nIndex = nPtrWords; nIndex > 0u; nIndex--)
+    {
+        nValue = ((nValue << 16u) << 16u) | (a2b_UIntPtr)pWords[nIndex - 1u];
+    }
+
+    return nValue;
+}
+
+/* The level tag of a2b_traceLevelString() */
+static const char* host_LevelString(uint32_t nLevel)
+{
+    switch(nLevel & A2B_TRC_LVL_MASK)
+    {
+        case A2B_TRC_LVL_FATAL:  return "FATAL";
+        case A2B_TRC_LVL_ERROR:  return "ERROR";
+        case A2B_TRC_LVL_WARN:   return "WARN";
+        case A2B_TRC_LVL_INFO:   return "INFO";
+        case A2B_TRC_LVL_DEBUG:  return "DEBUG";
+        case A2B_TRC_LVL_TRACE1: return "TRACE1";
+        case A2B_TRC_LVL_TRACE2: return "TRACE2";
+        case A2B_TRC_LVL_TRACE3: return "TRACE3";
+        default:                 return NULL;
+    }
+}
+
+/* Formats the prefix and level as a2b_tracePrintPrefix() and a2b_traceN() do */
+static void host_FormatHead(a2b_StringBuffer *pBuf, uint32_t nTime, const char *pFile,
+                            const char *pFunc, uint32_t nLine, uint32_t nLevel)
+{
+    void *aArgs[4];
+    const char *pLevel = host_LevelString(nLevel);
+
+    aArgs[0] = &nTime;
+    aArgs[1] = (void *)pFile;
+    if(pFunc != NULL)
+    {
+        aArgs[2] = (void *)pFunc;
+        aArgs[3] = &nLine;
+        (void)a2b_vsnprintfStringBuffer(pBuf, "%lu %s:%s(%lu) ", aArgs, 4);
+    }
+    else
+    {
+        aArgs[2] = &nLine;
+        (void)a2b_vsnprintfStringBuffer(pBuf, "%010lu %s(%lu) ", aArgs, 3);
+    }
+
+    if(pLevel != NULL)
+    {
+        aArgs[0] = (void *)pLevel;
+        (void)a2b_vsnprintfStringBuffer(pBuf, "[%s] ", aArgs, 1);
+    }
+}
+
+/* The data bytes as a2b_i2cFormatString() appends them */
+static void host_FormatI2cData(a2b_StringBuffer *pBuf, const a2b_Byte *pData, uint32_t nBytes)
+{
+    void *aArgs[1];
+    uint32_t nShown = (nBytes < A2B_TRCBIN_I2C_DATA_BYTES) ? nBytes : A2B_TRCBIN_I2C_DATA_BYTES;
+    uint32_t nIndex;
+
+    for(nIndex = 0u; nIndex < nShown; nIndex++)
+    {
+        aArgs[0] = (void *)&pData[nIndex];
+        (void)a2b_vsnprintfStringBuffer(pBuf, "%02bX", aArgs, 1);
+        if((nIndex + 1u) < nShown)
+        {
+            (void)a2b_vsnprintfStringBuffer(pBuf, " ", NULL, 0);
+        }
+    }
+    if(nBytes > nShown)
+    {
+        (void)a2b_vsnprintfStringBuffer(pBuf, " ...", NULL, 0);
+    }
+}
+
+/* Formats line nLine of an I2C transfer into pText as the text trace of
+   a2b_i2cRead(), a2b_i2cWrite() and a2b_i2cWriteRead() does; returns the
+   number of lines of the transfer */
+static uint32_t host_FormatI2c(char *pText, uint32_t nLine, uint32_t nOp, a2b_UInt16 nAddr,
+                               uint32_t nWrite, const a2b_Byte *pWrite, uint32_t nRead,
+                               const a2b_Byte *pRead, a2b_UInt32 nResult)
+{
+    static const char *aName[] = { "a2b_i2cRead", "a2b_i2cWrite", "a2b_i2cWriteRead" };
+    a2b_StringBuffer oBuf;
+    void *aArgs[2];
+    uint32_t nLines = 1u;
+
+    a2b_stringBufferInit(&oBuf, pText, HOST_I2C_BUF_SIZE);
+    aArgs[0] = (void *)aName[(nOp <= A2B_TRCBIN_I2C_WRITE_READ) ? nOp : 0u];
+    aArgs[1] = &nAddr;
+    (void)a2b_vsnprintfStringBuffer(&oBuf, "%s[0x%02hX]", aArgs, 2);
+
+    if(nResult != 0u)
+    {
+        aArgs[0] = &nResult;
+        (void)a2b_vsnprintfStringBuffer(&oBuf, " Error: 0x%lX", aArgs, 1);
+        if(nOp == A2B_TRCBIN_I2C_WRITE)
+        {
+            host_FormatI2cData(&oBuf, pWrite, nWrite);
+        }
+    }
+    else if((nOp == A2B_TRCBIN_I2C_READ) || (nLine == 1u))
+    {
+        (void)a2b_vsnprintfStringBuffer(&oBuf, " <- ", NULL, 0);
+        host_FormatI2cData(&oBuf, pRead, nRead);
+        nLines = (nOp == A2B_TRCBIN_I2C_WRITE_READ) ? 2u : 1u;
+    }
+    else
+    {
+        (void)a2b_vsnprintfStringBuffer(&oBuf, " -> ", NULL, 0);
+        host_FormatI2cData(&oBuf, pWrite, nWrite);
+        nLines = (nOp == A2B_TRCBIN_I2C_WRITE_READ) ? 2u : 1u;
+    }
+
+    return nLines;
+}
+
+/* Renders one record, calling pfLine per line; returns 0 on success */
+static int host_RenderRecord(const uint32_t *pRec, uint32_t nPtrWords, HOST_LINE_FUNC pfLine)
+{
+    a2b_Char aBuf[A2B_CONF_TRACE_BUF_SIZE];
+    a2b_StringBuffer oBuf;
+    a2b_Char aText[A2B_CONF_TRACE_BUF_SIZE];
+    union
+    {
+        a2b_UInt8   b;
+        a2b_UInt16  h;
+        a2b_UInt32  l;
+        uint64_t    L;
+    } aValue[A2B_TRCBIN_MAX_ARGS];
+    void *aArgs[A2B_TRCBIN_MAX_ARGS];
+    uint32_t nWords = A2B_TRCBIN_REC_WORDS(pRec[A2B_TRCBIN_REC_HDR]);
+    uint32_t nFlags = A2B_TRCBIN_REC_FLAGS(pRec[A2B_TRCBIN_REC_HDR]);
+    uint32_t nPos = A2B_TRCBIN_REC_FILE;
+    uint32_t nDesc, nKind, nArgs = 0u;
+    a2b_UIntPtr nFile, nFunc;
+    const char *pFmt;
+    char aLine[HOST_LINE_SIZE];
+    char aI2c[HOST_I2C_BUF_SIZE];
+    uint32_t nLine, nLines;
+
+    nFile = host_Ptr(&pRec[nPos], nPtrWords);
+    nPos += nPtrWords;
+    nFunc = host_Ptr(&pRec[nPos], nPtrWords);
+    nPos += nPtrWords;
+
+    a2b_stringBufferInit(&oBuf, aBuf, A2B_ARRAY_SIZE(aBuf));
+    host_FormatHead(&oBuf, pRec[A2B_TRCBIN_REC_TIME], host_String(nFile),
+                    (nFunc != 0u) ? host_String(nFunc) : NULL,
+                    pRec[A2B_TRCBIN_REC_LINE], pRec[A2B_TRCBIN_REC_LEVEL]);
+
+    if((nFlags & A2B_TRCBIN_FLAG_I2C) != 0u)
+    {
+        const a2b_Byte *pData = (const a2b_Byte *)&pRec[nPos + 3u];
+
+        if((nPos + 3u + ((2u * A2B_TRCBIN_I2C_DATA_BYTES) / 4u)) != nWords)
+        {
+            return 1;
+        }
+        nLines = 1u;
+        for(nLine = 0u; nLine < nLines; nLine++)
+        {
+            nLines = host_FormatI2c(aI2c, nLine, pRec[nPos] >> 16u, (a2b_UInt16)pRec[nPos],
+                                    pRec[nPos + 1u] & 0xFFFFu, pData,
+                                    pRec[nPos + 1u] >> 16u, &pData[A2B_TRCBIN_I2C_DATA_BYTES],
+                                    pRec[nPos + 2u]);
+            /* The transfer is traced as "%s" */
+            a2b_stringBufferInit(&oBuf, aLine, A2B_CONF_TRACE_BUF_SIZE);
+            host_FormatHead(&oBuf, pRec[A2B_TRCBIN_REC_TIME], host_String(nFile),
+                            (nFunc != 0u) ? host_String(nFunc) : NULL,
+                            pRec[A2B_TRCBIN_REC_LINE], pRec[A2B_TRCBIN_REC_LEVEL]);
+            aArgs[0] = aI2c;
+            (void)a2b_vsnprintfStringBuffer(&oBuf, "%s", aArgs, 1);
+            pfLine(aLine);
+        }
+        return 0;
+    }
+    else if((nFlags & A2B_TRCBIN_FLAG_TEXT) != 0u)
+    {
+        uint32_t nText = pRec[nPos];
+
+        if((nText >= sizeof(aText)) || ((nPos + 1u + ((nText + 3u) / 4u)) > nWords))
+        {
+            return 1;
+        }
+        memcpy(aText, &pRec[nPos + 1u], nText);
+        aText[nText] = '\0';
+        (void)a2b_vsnprintfStringBuffer(&oBuf, aText, NULL, 0);
+    }
+    else
+    {
+        pFmt = host_String(host_Ptr(&pRec[nPos], nPtrWords));
+        nPos += nPtrWords;
+        nDesc = a2b_vsnprintfArgKinds(pFmt);
+
+        while((nPos < nWords) && (nArgs < A2B_TRCBIN_DESC_COUNT(nDesc)))
+        {
+            nKind = A2B_TRCBIN_DESC_KIND(nDesc, nArgs);
+            aArgs[nArgs] = &aValue[nArgs];
+            switch(nKind)
+            {
+                case A2B_TRCBIN_ARG_8:
+                    aValue[nArgs].b = (a2b_UInt8)pRec[nPos];
+                    nPos++;
+                    break;
+                case A2B_TRCBIN_ARG_16:
+                    aValue[nArgs].h = (a2b_UInt16)pRec[nPos];
+                    nPos++;
+                    break;
+                case A2B_TRCBIN_ARG_64:
+                    aValue[nArgs].L = (uint64_t)pRec[nPos] | ((uint64_t)pRec[nPos + 1u] << 32u);
+                    nPos += 2u;
+                    break;
+                case A2B_TRCBIN_ARG_PTR:
+                    aArgs[nArgs] = (void *)(uintptr_t)host_Ptr(&pRec[nPos], nPtrWords);
+                    nPos += nPtrWords;
+                    break;
+                case A2B_TRCBIN_ARG_STR:
+                    aArgs[nArgs] = (void *)host_String(host_Ptr(&pRec[nPos], nPtrWords));
+                    nPos += nPtrWords;
+                    break;
+                default:
+                    aValue[nArgs].l = pRec[nPos];
+                    nPos++;
+                    break;
+            }
+            nArgs++;
+        }
+        if(nPos != nWords)
+        {
+            return 1;
+        }
+        (void)a2b_vsnprintfStringBuffer(&oBuf, pFmt, aArgs, (a2b_UInt16)nArgs);
+    }
+
+    pfLine(aBuf);
+    return 0;
+}
+
+/* Renders a dump, calling pfLine per message; returns 0 on success */
+static int host_Render(const uint8_t *pData, size_t nSize, HOST_LINE_FUNC pfLine)
+{
+    const uint32_t *pWords = (const uint32_t *)pData;
+    size_t nCount = nSize / 4u;
+    uint32_t nPtrWords, nRecWords, nPos, nLen;
+    a2b_UIntPtr nAddr;
+
+    if((nCount < A2B_TRCBIN_HDR_WORDS) || (pWords[0] != A2B_TRCBIN_MAGIC) ||
+       (pWords[1] != A2B_TRCBIN_VERSION))
+    {
+        fprintf(stderr, "not a binary trace dump\n");
+        return 1;
+    }
+    nPtrWords = pWords[2];
+    nRecWords = pWords[3];
+    if((nPtrWords * 4u) > sizeof(a2b_UIntPtr) || (A2B_TRCBIN_HDR_WORDS + nRecWords) > nCount)
+    {
+        fprintf(stderr, "unsupported or truncated dump\n");
+        return 1;
+    }
+
+    /* Strings follow the records */
+    nStrings = 0u;
+    nRecords = 0u;
+    nPos = A2B_TRCBIN_HDR_WORDS + nRecWords;
+    while((nPos < nCount) && (pWords[nPos] == A2B_TRCBIN_STR_MAGIC))
+    {
+        nAddr = host_Ptr(&pWords[nPos + 1u], nPtrWords);
+        nLen = pWords[nPos + 1u + nPtrWords];
+        nPos += 2u + nPtrWords;
+        if((nPos + ((nLen + 3u) / 4u)) > nCount)
+        {
+            fprintf(stderr, "truncated string table\n");
+            return 1;
+        }
+        if(nStrings < HOST_MAX_STRINGS)
+        {
+            char *pStr = malloc(nLen + 1u);
+            memcpy(pStr, &pWords[nPos], nLen);
+            pStr[nLen] = '\0';
+            aStrings[nStrings].nAddr = nAddr;
+            aStrings[nStrings].pStr = pStr;
+            nStrings++;
+        }
+        nPos += (nLen + 3u) / 4u;
+    }
+
+    nPos = A2B_TRCBIN_HDR_WORDS;
+    while(nPos < (A2B_TRCBIN_HDR_WORDS + nRecWords))
+    {
+        uint32_t nHdr = pWords[nPos];
+
+        if(!A2B_TRCBIN_REC_IS_VALID(nHdr) || (A2B_TRCBIN_REC_WORDS(nHdr) == 0u) ||
+           (host_RenderRecord(&pWords[nPos], nPtrWords, pfLine) != 0))
+        {
+            fprintf(stderr, "bad record at word %u\n", nPos);
+            return 1;
+        }
+        nRecords++;
+        nPos += A2B_TRCBIN_REC_WORDS(nHdr);
+    }
+
+    return 0;
+}
+
+static void host_PrintLine(const char *pLine)
+{
+    printf("%s\n", pLine);
+}
+
+/*------------------------------- self test -------------------------------*/
+
+static a2b_UInt32 A2B_CALL host_GetSysTime(void)
+{
+    return nSysTime;
+}
+
+static void* A2B_CALL host_Malloc(a2b_Handle hnd, a2b_UInt32 size)
+{
+    (void)hnd;
+    return malloc(size);
+}
+
+static void A2B_CALL host_Free(a2b_Handle hnd, void* p)
+{
+    (void)hnd;
+    free(p);
+}
+
+static void A2B_CALL host_DumpWrite(a2b_Handle hnd, const a2b_Byte* data, a2b_UInt32 nBytes)
+{
+    (void)hnd;
+    if((nDumpSize + nBytes) <= HOST_MAX_DUMP)
+    {
+        memcpy(&pDump[nDumpSize], data, nBytes);
+    }
+    nDumpSize += nBytes;
+}
+
+/* The text the trace writes without the binary option */
+static void host_Expect(const char *pFile, const char *pFunc, uint32_t nLine, uint32_t nLevel,
+                        const char *pFmt, void **aArgs, uint32_t nArgs)
+{
+    a2b_StringBuffer oBuf;
+    char *pLine = aExpect[(nExpectHead + nExpectCount) % HOST_MAX_LINES];
+    const char *pName = strrchr(pFile, A2B_CONF_PATH_SEPARATOR);
+
+    a2b_stringBufferInit(&oBuf, pLine, A2B_CONF_TRACE_BUF_SIZE);
+    host_FormatHead(&oBuf, nSysTime, (pName != NULL) ? (pName + 1) : pFile, pFunc, nLine, nLevel);
+    (void)a2b_vsnprintfStringBuffer(&oBuf, pFmt, aArgs, (a2b_UInt16)nArgs);
+
+    nExpectTotal++;
+    if(nExpectCount < HOST_MAX_LINES)
+    {
+        nExpectCount++;
+    }
+    else
+    {
+        nExpectHead = (nExpectHead + 1u) % HOST_MAX_LINES;
+    }
+}
+
+/* The lines the I2C layer traces for a transfer without the binary option */
+static void host_ExpectI2c(const char *pFunc, uint32_t nLine, uint32_t nLevel, uint32_t nOp,
+                           a2b_UInt16 nAddr, uint32_t nWrite, const a2b_Byte *pWrite,
+                           uint32_t nRead, const a2b_Byte *pRead, a2b_UInt32 nResult)
+{
+    char aI2c[HOST_I2C_BUF_SIZE];
+    void *aArgs[1];
+    uint32_t nIndex, nLines = 1u;
+
+    for(nIndex = 0u; nIndex < nLines; nIndex++)
+    {
+        nLines = host_FormatI2c(aI2c, nIndex, nOp, nAddr, nWrite, pWrite, nRead, pRead, nResult);
+        aArgs[0] = aI2c;
+        host_Expect(__FILE__, pFunc, nLine, nLevel, "%s", aArgs, 1u);
+    }
+    nExpectExtra += nLines - 1u;
+}
+
+static void host_CollectLine(const char *pLine)
+{
+    if(nDumpLines < HOST_MAX_LINES)
+    {
+        strcpy(pDumpLines[nDumpLines], pLine);
+    }
+    nDumpLines++;
+}
+
+#define HOST_TRACE(N, LVL, FMT, ...) \
+    do { \
+        void *aArgs[] = { NULL, __VA_ARGS__ }; \
+        A2B_TRACE##N((&oCtx, (LVL), FMT, __VA_ARGS__)); \
+        host_Expect(__FILE__, __FUNCTION__, __LINE__, (LVL), FMT, &aArgs[1], N); \
+    } while(0)
+
+static void host_Workload(uint32_t nMsgs)
+{
+    static const char *aNames[] = { "master", "slave0", "slave1", "slave2" };
+    char aInject[64];
+    a2b_Byte aWrite[12];
+    a2b_Byte aRead[12];
+    uint32_t nMsg, nLine, nIndex;
+
+    for(nMsg = 0u; nMsg < nMsgs; nMsg++)
+    {
+        a2b_UInt8 nNode = (a2b_UInt8)(nMsg % 11u);
+        a2b_Int8 nSigned8 = (a2b_Int8)(-(int)(nMsg % 100u));
+        a2b_UInt16 nReg = (a2b_UInt16)(nMsg * 7u);
+        a2b_UInt32 nValue = nMsg * 2654435761u;
+        a2b_Int32 nSigned = -(a2b_Int32)nMsg;
+        a2b_UInt64 nBig = ((a2b_UInt64)nMsg << 33u) | 5u;
+        a2b_Char cChar = (a2b_Char)('A' + (nMsg % 26u));
+        const char *pName = aNames[nMsg % 4u];
+
+        nSysTime += (nMsg % 3u);
+        switch(nMsg % 9u)
+        {
+            case 0u:
+                A2B_TRACE0((&oCtx, (A2B_TRC_DOM_STACK | A2B_TRC_LVL_INFO), "Discovery started"));
+                host_Expect(__FILE__, __FUNCTION__, __LINE__ - 1u, (A2B_TRC_DOM_STACK | A2B_TRC_LVL_INFO),
+                            "Discovery started", NULL, 0u);
+                break;
+            case 1u:
+                HOST_TRACE(2, (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_DEBUG),
+                           "%s: node %bu found", (void *)pName, &nNode);
+                break;
+            case 2u:
+                HOST_TRACE(3, (A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE1),
+                           "I2C write reg 0x%02hX = 0x%08lX (%d)", &nReg, &nValue, &nSigned);
+                break;
+            case 3u:
+                HOST_TRACE(4, (A2B_TRC_DOM_MSGRTR | A2B_TRC_LVL_WARN),
+                           "msg %Lu ptr %p chr %c s8 %bd", &nBig, (void *)&oCtx, &cChar, &nSigned8);
+                break;
+            case 4u:
+                /* Several level bits: no level tag */
+                HOST_TRACE(1, (A2B_TRC_DOM_TIMERS | A2B_TRC_LVL_ERROR | A2B_TRC_LVL_WARN),
+                           "timer %lu expired, 100%% late", &nValue);
+                break;
+            case 5u:
+                /* More arguments than conversions and the other way round */
+                HOST_TRACE(2, (A2B_TRC_DOM_STACK | A2B_TRC_LVL_FATAL), "%s only", (void *)pName, &nValue);
+                HOST_TRACE(1, (A2B_TRC_DOM_STACK | A2B_TRC_LVL_ERROR), "%lu and %lu", &nValue);
+                break;
+            case 6u:
+                HOST_TRACE(8, (A2B_TRC_DOM_PLUGIN | A2B_TRC_LVL_TRACE2),
+                           "%bu %hu %lu %s %bu %hu %lu %s", &nNode, &nReg, &nValue, (void *)pName,
+                           &nNode, &nReg, &nValue, (void *)aNames[0]);
+                break;
+            case 7u:
+                {
+                    /* The transfer is copied, the buffers are reused right away */
+                    uint32_t nOp = (nMsg / 9u) % 3u;
+                    a2b_UInt16 nAddr = (a2b_UInt16)(0x68u + (nMsg % 4u));
+                    a2b_UInt16 nWrite = (nOp == A2B_TRCBIN_I2C_READ) ? 0u : (a2b_UInt16)(nMsg % 13u);
+                    a2b_UInt16 nRead = (nOp == A2B_TRCBIN_I2C_WRITE) ? 0u : (a2b_UInt16)(1u + (nMsg % 11u));
+                    a2b_HResult nResult = ((nMsg % 5u) == 0u) ? (a2b_HResult)(0x80010000u | nMsg) : 0u;
+                    a2b_UInt32 nLevel = A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE2 |
+                                        ((nResult != 0u) ? A2B_TRC_LVL_ERROR : 0u);
+
+                    for(nIndex = 0u; nIndex < sizeof(aWrite); nIndex++)
+                    {
+                        aWrite[nIndex] = (a2b_Byte)(nMsg + nIndex);
+                        aRead[nIndex] = (a2b_Byte)(nValue >> (nIndex % 4u));
+                    }
+                    A2B_TRACE_I2C((&oCtx, nLevel, nOp, nAddr, nWrite, aWrite, nRead, aRead, nResult)); nLine = __LINE__;
+                    host_ExpectI2c(__FUNCTION__, nLine, nLevel, nOp, nAddr, nWrite, aWrite, nRead, aRead, nResult);
+                    memset(aWrite, 0xEE, sizeof(aWrite));
+                    memset(aRead, 0xEE, sizeof(aRead));
+                }
+                break;
+            default:
+                /* Injected text is copied, the buffer is reused right away */
+                sprintf(aInject, "user note %u, 50%% done", nMsg);
+                a2b_traceInject(&oCtx, (A2B_TRC_DOM_STACK | A2B_TRC_LVL_INFO), aInject);
+                {
+                    a2b_StringBuffer oBuf;
+                    char *pLine = aExpect[(nExpectHead + nExpectCount) % HOST_MAX_LINES];
+
+                    a2b_stringBufferInit(&oBuf, pLine, A2B_CONF_TRACE_BUF_SIZE);
+                    host_FormatHead(&oBuf, nSysTime, "user", NULL, 0u, (A2B_TRC_DOM_STACK | A2B_TRC_LVL_INFO));
+                    (void)a2b_vsnprintfStringBuffer(&oBuf, aInject, NULL, 0);
+                    nExpectTotal++;
+                    if(nExpectCount < HOST_MAX_LINES) { nExpectCount++; }
+                    else { nExpectHead = (nExpectHead + 1u) % HOST_MAX_LINES; }
+                }
+                memset(aInject, 'x', sizeof(aInject) - 1u);
+                break;
+        }
+    }
+}
+
+static int host_SelfTest(uint32_t nMsgs)
+{
+    uint32_t nIndex, nCompare, nErrors = 0u, nTotal;
+    double dT0, dBin, dText;
+
+    memset(&oStk, 0, sizeof(oStk));
+    oStk.pal.memMgrMalloc = &host_Malloc;
+    oStk.pal.memMgrFree = &host_Free;
+    oStk.pal.timerGetSysTime = &host_GetSysTime;
+    oCtx.stk = &oStk;
+    oCtx.domain = A2B_DOMAIN_APP;
+    oStk.traceChan = a2b_traceAlloc(&oCtx, "ring");
+    a2b_traceSetMask(&oCtx, A2B_TRC_ALL);
+
+    pDump = malloc(HOST_MAX_DUMP);
+    pDumpLines = malloc(sizeof(*pDumpLines) * HOST_MAX_LINES);
+
+    for(nTotal = 0u; nTotal < 3u; nTotal++)
+    {
+        uint32_t nCount = (nTotal == 0u) ? 5u : ((nTotal == 1u) ? 200u : nMsgs);
+
+        a2b_traceBinClear();
+        nExpectHead = 0u;
+        nExpectCount = 0u;
+        nExpectTotal = 0u;
+        nExpectExtra = 0u;
+        nSysTime = 0xFFFFFF00u;
+        host_Workload(nCount);
+
+        nDumpSize = 0u;
+        a2b_traceBinDump(&host_DumpWrite, NULL);
+        if(nDumpSize > HOST_MAX_DUMP)
+        {
+            printf("  dump of %zu bytes too large\n", nDumpSize);
+            return 1;
+        }
+
+        nDumpLines = 0u;
+        if(host_Render(pDump, nDumpSize, &host_CollectLine) != 0)
+        {
+            return 1;
+        }
+
+        /* The dump must end with the newest expected lines */
+        nCompare = (nDumpLines < nExpectCount) ? nDumpLines : nExpectCount;
+        /* Every message is either in the dump or counted as dropped */
+        if((nDumpLines > HOST_MAX_LINES) || (nDumpLines == 0u) ||
+           ((nRecords + ((const uint32_t *)pDump)[4]) != (nExpectTotal - nExpectExtra)))
+        {
+            printf("  %u messages, %u in the dump, %u dropped\n", nExpectTotal - nExpectExtra, nRecords,
+                   ((const uint32_t *)pDump)[4]);
+            nErrors++;
+        }
+        for(nIndex = 0u; nIndex < nCompare; nIndex++)
+        {
+            const char *pExp = aExpect[(nExpectHead + nExpectCount - nCompare + nIndex) % HOST_MAX_LINES];
+            const char *pGot = pDumpLines[nDumpLines - nCompare + nIndex];
+
+            if(strcmp(pExp, pGot) != 0)
+            {
+                if(nErrors++ < 5u)
+                {
+                    printf("  expected: %s\n  rendered: %s\n", pExp, pGot);
+                }
+            }
+        }
+        printf("  %6u messages: %5u kept, %6u dropped, %u word ring (%zu byte dump), %s\n",
+               nExpectTotal - nExpectExtra, nRecords, ((const uint32_t *)pDump)[4], (unsigned)A2B_CONF_TRACE_BIN_SIZE, nDumpSize,
+               (nErrors == 0u) ? "text identical" : "MISMATCH");
+    }
+
+    /* Timing: one three argument message */
+    {
+        a2b_UInt16 nReg = 0x12u;
+        a2b_UInt32 nValue = 0xDEADBEEFu;
+        a2b_Int32 nSigned = -5;
+        a2b_Char aBuf[A2B_CONF_TRACE_BUF_SIZE];
+        a2b_Char aI2c[HOST_I2C_BUF_SIZE];
+        a2b_StringBuffer oBuf;
+        void *aArgs[3];
+        a2b_Byte aData[8] = { 0x11u, 0x22u, 0x33u, 0x44u, 0x55u, 0x66u, 0x77u, 0x88u };
+        double dBinI2c = 0.0, dTextI2c = 0.0;
+        uint32_t nRepeat, nCall, nCalls = 1000000u;
+        volatile uint32_t nSink = 0u;
+
+        aArgs[0] = &nReg;
+        aArgs[1] = &nValue;
+        aArgs[2] = &nSigned;
+        dBin = 0.0;
+        dText = 0.0;
+        for(nRepeat = 0u; nRepeat < HOST_REPEAT; nRepeat++)
+        {
+            double dNs;
+
+            dT0 = host_Seconds();
+            for(nCall = 0u; nCall < nCalls; nCall++)
+            {
+                A2B_TRACE3((&oCtx, (A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE1),
+                            "I2C write reg 0x%02hX = 0x%08lX (%d)", &nReg, &nValue, &nSigned));
+            }
+            dNs = ((host_Seconds() - dT0) * 1e9) / (double)nCalls;
+            dBin = ((nRepeat == 0u) || (dNs < dBin)) ? dNs : dBin;
+
+            /* What the text trace does per message, without the file write */
+            a2b_stringBufferInit(&oBuf, aBuf, A2B_ARRAY_SIZE(aBuf));
+            dT0 = host_Seconds();
+            for(nCall = 0u; nCall < nCalls; nCall++)
+            {
+                host_FormatHead(&oBuf, nSysTime, "trace.c", "host_SelfTest", 42u,
+                                (A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE1));
+                (void)a2b_vsnprintfStringBuffer(&oBuf, "I2C write reg 0x%02hX = 0x%08lX (%d)", aArgs, 3);
+                nSink += (uint32_t)aBuf[5];
+                a2b_stringBufferClear(&oBuf);
+            }
+            dNs = ((host_Seconds() - dT0) * 1e9) / (double)nCalls;
+            dText = ((nRepeat == 0u) || (dNs < dText)) ? dNs : dText;
+
+            /* An 8 byte I2C write: recorded, or formatted by i2c.c and traced as "%s" */
+            dT0 = host_Seconds();
+            for(nCall = 0u; nCall < nCalls; nCall++)
+            {
+                A2B_TRACE_I2C((&oCtx, (A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE2), A2B_TRCBIN_I2C_WRITE,
+                               0x68u, 8u, aData, 0u, NULL, 0u));
+            }
+            dNs = ((host_Seconds() - dT0) * 1e9) / (double)nCalls;
+            dBinI2c = ((nRepeat == 0u) || (dNs < dBinI2c)) ? dNs : dBinI2c;
+
+            dT0 = host_Seconds();
+            for(nCall = 0u; nCall < nCalls; nCall++)
+            {
+                (void)host_FormatI2c(aI2c, 0u, A2B_TRCBIN_I2C_WRITE, 0x68u, 8u, aData, 0u, NULL, 0u);
+                host_FormatHead(&oBuf, nSysTime, "i2c.c", "a2b_i2cWrite", 42u,
+                                (A2B_TRC_DOM_I2C | A2B_TRC_LVL_TRACE2));
+                aArgs[0] = aI2c;
+                (void)a2b_vsnprintfStringBuffer(&oBuf, "%s", aArgs, 1);
+                nSink += (uint32_t)aBuf[5];
+                a2b_stringBufferClear(&oBuf);
+            }
+            dNs = ((host_Seconds() - dT0) * 1e9) / (double)nCalls;
+            dTextI2c = ((nRepeat == 0u) || (dNs < dTextI2c)) ? dNs : dTextI2c;
+        }
+        (void)nSink;
+
+        printf("\nhost timings, best of %u x %u messages (3 arguments)\n", HOST_REPEAT, nCalls);
+        printf("  binary record   %6.1f ns/message\n", dBin);
+        printf("  text format     %6.1f ns/message (formatting only, no file write)\n", dText);
+        printf("host timings, best of %u x %u I2C writes (8 bytes)\n", HOST_REPEAT, nCalls);
+        printf("  binary record   %6.1f ns/transfer\n", dBinI2c);
+        printf("  text format     %6.1f ns/transfer (formatting only, no file write)\n", dTextI2c);
+    }
+
+    a2b_traceFree(oStk.traceChan);
+    free(pDump);
+    free(pDumpLines);
+
+    return (nErrors == 0u) ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t nMsgs = 100000u;
+    int nArg, bTest = 0;
+    const char *pPath = NULL;
+    FILE *pFile;
+    uint8_t *pData;
+    size_t nSize;
+    int nRet;
+
+    for(nArg = 1; nArg < argc; nArg++)
+    {
+        if(strcmp(argv[nArg], "-t") == 0) { bTest = 1; }
+        else if((strcmp(argv[nArg], "-n") == 0) && ((nArg + 1) < argc)) { nMsgs = (uint32_t)atol(argv[++nArg]); }
+        else { pPath = argv[nArg]; }
+    }
+
+    if(bTest)
+    {
+        printf("self test (rendered dump vs. text trace formatting)\n");
+        return host_SelfTest(nMsgs);
+    }
+
+    if(pPath == NULL)
+    {
+        fprintf(stderr, "usage: tracebin_host dump.bin | -t [-n msgs]\n");
+        return 2;
+    }
+
+    pFile = fopen(pPath, "rb");
+    if(pFile == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", pPath);
+        return 2;
+    }
+    pData = malloc(HOST_MAX_DUMP * 16u);
+    nSize = fread(pData, 1u, HOST_MAX_DUMP * 16u, pFile);
+    fclose(pFile);
+
+    nRet = host_Render(pData, nSize, &host_PrintLine);
+    if((nRet == 0) && (((const uint32_t *)pData)[4] != 0u))
+    {
+        fprintf(stderr, "%u older messages were overwritten\n", ((const uint32_t *)pData)[4]);
+    }
+    free(pData);
+
+    return nRet;
+}